@@ -40,6 +40,77 @@
 #define DEFAULT_AUTOEXPECT true
 #endif
 
+// DEFAULT_INDEXARGUMENTS sets the initial value of indexArguments on each MockRepository. With it,
+// the OnCall registrations of each mocked function whose With() arguments are all integers, enums,
+// pointers or std::strings are kept in a hash index, so that a call looks its arguments up instead
+// of comparing them against every registration in turn. Registrations with DontCare, ByRef, Out,
+// In or a Match() functor are still scanned, and the last matching registration still wins. This
+// only pays off for mocks with many such registrations, so it is off by default. Parameters with a
+// specialized comparer<T> are never indexed.
+#ifndef DEFAULT_INDEXARGUMENTS
+#define DEFAULT_INDEXARGUMENTS false
+#endif
+
+// DEFAULT_NEARESTCANDIDATES sets the initial value of nearestCandidates on each MockRepository: the
+// number of registrations an ExpectationException lists, nearest first, rather than every one of
+// them. Registrations on the same function come first, those with the most arguments equal to the
+// call's at the top, then the others on the same mock, then the rest. Set it to 0 to list all.
+#ifndef DEFAULT_NEARESTCANDIDATES
+#define DEFAULT_NEARESTCANDIDATES 10
+#endif
+
+// DEFAULT_POOLMOCKS sets the initial value of poolMocks on each MockRepository. With it, the
+// repository hands the mocks it created back to a pool for their type when it is destroyed, and
+// takes them from there again for the next Mock<T>() or Stub<T>(), so that a test suite that mocks
+// the same interface many times does not build a new mock and function table for each test. A
+// pooled mock keeps its address from one repository to the next, and the idle ones are only freed
+// at exit, so it is off by default. HM_MOCK_POOL_SIZE is the number of idle mocks kept per type.
+// The pools are per thread with C++11, and shared by the whole process before that.
+#ifndef DEFAULT_POOLMOCKS
+#define DEFAULT_POOLMOCKS false
+#endif
+#ifndef HM_MOCK_POOL_SIZE
+#define HM_MOCK_POOL_SIZE 16
+#endif
+
+// MockRepository::memoryUsage() tells how much memory a repository holds for its mocks and
+// registrations. Set the environment variable named by HM_MEMORY_REPORT_ENV to have each
+// MockRepository print that to stderr, per mock type, when it is destroyed. The variable is read
+// once, when the first repository is destroyed.
+#ifndef HM_MEMORY_REPORT_ENV
+#define HM_MEMORY_REPORT_ENV "HIPPOMOCKS_MEMORY_REPORT"
+#endif
+
+// By default HippoMocks is header-only, and all of its non-template code (the dispatch helpers,
+// VerifyAll, reset, the exception types and the diagnostic dumps) is emitted inline in every
+// translation unit that includes it. Define HM_COMPILED in all of your translation units to get
+// declarations only, and compile that code once by defining HM_IMPLEMENTATION as well in exactly
+// one of them (hippomocks.cpp does this; the HippoMocks::compiled CMake target sets it all up).
+// All other configuration defines must then be the same for the library and its users.
+#ifdef HM_COMPILED
+#define HM_INLINE
+#else
+#define HM_INLINE inline
+#endif
+
+// Define HM_DISPATCH_STATS to have the MockRepository count what it does for each mocked call:
+// how many calls it dispatched, how many registrations it inspected to find them, how often it
+// compared arguments or ran Match() functors, how many exceptions it raised and how much time it
+// spent. Counters are kept per Call, per mock and for the whole repository; see Statistics() and
+// DumpStatistics(). Without the define none of this is compiled in. It changes the layout of Call
+// and MockRepository, so define it for every translation unit or for none.
+//
+// Define HM_CALL_TRACE to be able to record every mocked call to a binary trace file with
+// StartTrace() and StopTrace(), for offline analysis of long-running tests. The same caveat applies.
+//
+// Define HM_MOCK_ALLOCATOR to be able to give a MockRepository a MockAllocator, or with C++17 a
+// std::pmr::memory_resource, to take its memory from instead of the heap; see MockBuffer. Every
+// block HippoMocks allocates then carries a header saying where it came from, so this is not
+// compiled in by default. The same caveat applies.
+#if defined(HM_DISPATCH_STATS) || defined(HM_CALL_TRACE)
+#define HM_DISPATCH_HOOKS
+#endif
+
 #ifdef NO_HIPPOMOCKS_NAMESPACE
 #define HM_NS
 #else
@@ -97,6 +168,16 @@ extern "C" __declspec(dllimport) void WINCALL DebugBreak();
 #define CMOCK_FUNC_PLATFORMIS64BIT
 #endif
 
+// Stub<T>() answers every function it has no registration for with one shared thunk, which ignores
+// its arguments. That only works where the caller cleans up the stack, so not on 32-bit Windows
+// where member functions are thiscall. The thunk does not know what the function returns, so it
+// zeroes the registers results come back in: integers and pointers everywhere, and float and double
+// on x86-64 System V. Functions returning a class by value, or floating point elsewhere, must be
+// given a StubCall() or another registration before they are called.
+#if !defined(_WIN32) || defined(_WIN64)
+#define _HIPPOMOCKS__ENABLE_STUB_SUPPORT
+#endif
+
 #ifdef SOME_X86
 #if defined(_MSC_VER) && (defined(_WIN32) || defined(_WIN64))
 #define _HIPPOMOCKS__ENABLE_CFUNC_MOCKING_SUPPORT
@@ -124,12 +205,16 @@ class X{};
 #endif
 
 #include <cstdio>
-#include <list>
+#include <cstddef>
+#include <cstdlib>
 #include <map>
+#include <vector>
 #include <memory>
+#include <new>
 #include <iostream>
 #include <sstream>
 #include <cstring>
+#include <string>
 #include <algorithm>
 #include <limits>
 
@@ -138,6 +223,33 @@ class X{};
 #include <codecvt>
 #endif
 
+#if defined(HM_MOCK_ALLOCATOR) && __cplusplus >= 201703L && defined(__has_include)
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#define HM_MEMORY_RESOURCE
+#endif
+#endif
+
+#ifdef HM_DISPATCH_HOOKS
+#if __cplusplus > 199711L
+#include <chrono>
+#else
+#include <ctime>
+#endif
+#endif
+#if __cplusplus > 199711L
+#include <type_traits>
+#include <utility>
+#include <functional>
+#include <unordered_map>
+#if defined(HM_REPLAY_MMAP) && !defined(_WIN32)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+#endif
+
 #ifdef _MSC_VER
 // these warnings are pointless and huge, and will confuse new users.
 #pragma warning(push)
@@ -154,12 +266,196 @@ namespace HippoMocks
 {
 #endif
 
+#ifdef HM_MOCK_ALLOCATOR
+// Where a MockRepository takes the memory for its mocks, registrations and bookkeeping from. Pass
+// one to the MockRepository constructor to keep a test off the heap; see MockBuffer. With C++17 a
+// std::pmr::memory_resource can be passed instead. Exception messages always use the heap, as they
+// outlive the repository.
+class MockAllocator
+{
+public:
+	virtual ~MockAllocator() {}
+	virtual void *allocate(size_t size) = 0;
+	virtual void deallocate(void *p, size_t size) = 0;
+};
+
+// The allocator of the MockRepository that registered, created a mock or dispatched a call last on
+// this thread, or null for the heap. Shared by the whole process before C++11.
+template <int X>
+struct MockAllocatorHolder {
+#if __cplusplus > 199711L
+	static thread_local MockAllocator *current;
+#else
+	static MockAllocator *current;
+#endif
+};
+
+template <int X>
+#if __cplusplus > 199711L
+thread_local
+#endif
+MockAllocator *MockAllocatorHolder<X>::current = 0;
+#endif
+
+// Base of everything a MockRepository allocates. With HM_MOCK_ALLOCATOR each block remembers the
+// allocator it came from, so that it goes back there even if it is freed while another repository's
+// allocator is in use; otherwise the blocks come straight from the heap.
+class MockAllocated
+{
+public:
+	static void *allocate(size_t size)
+	{
+#ifdef HM_MOCK_ALLOCATOR
+		MockAllocator *allocator = MockAllocatorHolder<0>::current;
+		Header *header = static_cast<Header *>(allocator ? allocator->allocate(sizeof(Header) + size)
+		                                                 : ::operator new(sizeof(Header) + size));
+		header->info.allocator = allocator;
+		header->info.size = size;
+		return header + 1;
+#else
+		return ::operator new(size);
+#endif
+	}
+	static void deallocate(void *p)
+	{
+#ifdef HM_MOCK_ALLOCATOR
+		if (!p)
+			return;
+		Header *header = static_cast<Header *>(p) - 1;
+		if (header->info.allocator)
+			header->info.allocator->deallocate(header, sizeof(Header) + header->info.size);
+		else
+			::operator delete(header);
+#else
+		::operator delete(p);
+#endif
+	}
+	static void *operator new(size_t size) { return allocate(size); }
+	static void *operator new(size_t, void *where) { return where; }
+	static void operator delete(void *p) { deallocate(p); }
+	static void operator delete(void *, void *) {}
+#ifdef HM_MOCK_ALLOCATOR
+	// The allocator the block at p, which allocate() returned, came from, or null for the heap.
+	static MockAllocator *allocatorOf(const void *p)
+	{
+		return (static_cast<const Header *>(p) - 1)->info.allocator;
+	}
+private:
+	union Header {
+		struct {
+			MockAllocator *allocator;
+			size_t size;
+		} info;
+		long double alignment;
+	};
+#endif
+};
+
+// A standard allocator over MockAllocated, for the containers of a MockRepository and its mocks.
+template <typename T>
+class MockStlAllocator
+{
+public:
+	typedef T value_type;
+	typedef T *pointer;
+	typedef const T *const_pointer;
+	typedef T &reference;
+	typedef const T &const_reference;
+	typedef size_t size_type;
+	typedef std::ptrdiff_t difference_type;
+	template <typename U>
+	struct rebind { typedef MockStlAllocator<U> other; };
+	MockStlAllocator() {}
+	template <typename U>
+	MockStlAllocator(const MockStlAllocator<U> &) {}
+	pointer address(reference x) const { return &x; }
+	const_pointer address(const_reference x) const { return &x; }
+	pointer allocate(size_type n, const void * = 0) { return static_cast<pointer>(MockAllocated::allocate(n * sizeof(T))); }
+	void deallocate(pointer p, size_type) { MockAllocated::deallocate(p); }
+	size_type max_size() const { return (size_type)-1 / sizeof(T); }
+	void construct(pointer p, const T &value) { new ((void *)p) T(value); }
+	void destroy(pointer p) { p->~T(); }
+};
+
+template <typename T, typename U>
+bool operator==(const MockStlAllocator<T> &, const MockStlAllocator<U> &) { return true; }
+template <typename T, typename U>
+bool operator!=(const MockStlAllocator<T> &, const MockStlAllocator<U> &) { return false; }
+
+typedef std::basic_string<char, std::char_traits<char>, MockStlAllocator<char> > MockString;
+typedef std::basic_stringstream<char, std::char_traits<char>, MockStlAllocator<char> > MockStringStream;
+
+#ifdef HM_MOCK_ALLOCATOR
+// A MockAllocator that hands out a caller-provided buffer front to back and never reuses any of
+// it, so that a test can run without touching the heap:
+//
+//   static char storage[65536];
+//   MockBuffer buffer(storage, sizeof(storage));
+//   MockRepository mocks(&buffer);
+//
+// It must outlive the MockRepository. Running out of it throws std::bad_alloc, or aborts without
+// exception support.
+class MockBuffer : public MockAllocator
+{
+public:
+	MockBuffer(void *storage, size_t size)
+		: begin(static_cast<unsigned char *>(storage))
+		, end(begin + size)
+		, next(begin)
+	{
+	}
+	void *allocate(size_t size)
+	{
+		size_t padding = (alignment - (size_t)next % alignment) % alignment;
+		if (padding > (size_t)(end - next) || size > (size_t)(end - next) - padding)
+		{
+#ifdef HM_NO_EXCEPTIONS
+			printf("MockBuffer exhausted after %u bytes\n", (unsigned)used());
+			abort();
+#else
+			throw std::bad_alloc();
+#endif
+		}
+		void *p = next + padding;
+		next += padding + size;
+		return p;
+	}
+	void deallocate(void *, size_t) {}
+	// The number of bytes handed out so far, including padding.
+	size_t used() const { return (size_t)(next - begin); }
+private:
+	static const size_t alignment = 16;
+	unsigned char *begin;
+	unsigned char *end;
+	unsigned char *next;
+};
+
+#ifdef HM_MEMORY_RESOURCE
+// A MockAllocator over a std::pmr::memory_resource, such as a monotonic_buffer_resource, or one
+// that counts what a test allocates.
+class MemoryResourceAllocator : public MockAllocator
+{
+public:
+	explicit MemoryResourceAllocator(std::pmr::memory_resource *resource = 0)
+		: resource(resource)
+	{
+	}
+	void *allocate(size_t size) { return resource->allocate(size, alignof(std::max_align_t)); }
+	void deallocate(void *p, size_t size) { resource->deallocate(p, size, alignof(std::max_align_t)); }
+private:
+	std::pmr::memory_resource *resource;
+};
+#endif
+#endif
+
 //Type-safe exception wrapping
-class ExceptionHolder
+class ExceptionHolder : public MockAllocated
 {
 public:
 	virtual ~ExceptionHolder() {}
 	virtual void rethrow() = 0;
+	// The bytes of the object, for MockRepository::memoryUsage().
+	virtual size_t objectSize() const = 0;
 	template <typename T>
 	static ExceptionHolder *Create(T ex);
 };
@@ -170,6 +466,7 @@ class ExceptionWrapper : public ExceptionHolder {
 public:
 	ExceptionWrapper(T ex) : exception(ex) {}
 	void rethrow() { throw exception; }
+	size_t objectSize() const { return sizeof(*this); }
 };
 
 template <typename T>
@@ -272,7 +569,7 @@ T horrible_cast(U u)
 	return un.t;
 }
 
-class Replace
+class Replace : public MockAllocated
 {
 private:
   void *origFunc;
@@ -343,6 +640,9 @@ public:
 #endif
 
 class MockRepository;
+#if __cplusplus > 199711L
+class CallReplay;
+#endif
 
 struct
 RegistrationType
@@ -366,11 +666,86 @@ const RegistrationType Once = RegistrationType( 1, 1 );
 
 
 
+class Call;
+typedef std::vector<Call *, MockStlAllocator<Call *> > CallList;
+
+// The Calls registered on one mock, in the order they were registered. They are linked through
+// the Calls themselves, so that the mock's destructor and VerifyPartial only look at its own Calls.
+struct MockCalls
+{
+	MockCalls() : first(0), last(0) {}
+	Call *first;
+	Call *last;
+};
+
+// The bytes a MockRepository holds, by what it holds them for; see MockRepository::memoryUsage().
+struct MemoryUsage {
+	size_t functionTables;       // function tables of the mocks, and the arrays of their Fake()s
+	size_t notImplementedTables; // the notimplementedfuncs array in each mock
+	size_t calls;                // registered Calls
+	size_t tuples;               // With() arguments kept by the Calls
+	size_t functors;             // Fake()s, and Do(), Match() and Capture() functors too large for their Call
+	size_t returnValues;         // Return(), ReturnSequence() and Throw() holders
+	MemoryUsage()
+		: functionTables(0), notImplementedTables(0), calls(0), tuples(0), functors(0), returnValues(0)
+	{
+	}
+	size_t total() const
+	{
+		return functionTables + notImplementedTables + calls + tuples + functors + returnValues;
+	}
+	MemoryUsage &operator+=(const MemoryUsage &other)
+	{
+		functionTables += other.functionTables;
+		notImplementedTables += other.notImplementedTables;
+		calls += other.calls;
+		tuples += other.tuples;
+		functors += other.functors;
+		returnValues += other.returnValues;
+		return *this;
+	}
+};
+
+HM_INLINE std::ostream &operator<<(std::ostream &os, const MemoryUsage &usage);
+
+// The name of T as the compiler spells it in a function signature, for reports.
+template <typename T>
+struct TypeName
+{
+	static std::string get()
+	{
+#if defined(__GNUC__)
+		// "... TypeName<T>::get() [with T = IFoo; ...]", or "[T = IFoo]" with clang.
+		std::string signature = __PRETTY_FUNCTION__;
+		std::string::size_type begin = signature.find("T = ");
+		if (begin != std::string::npos)
+		{
+			begin += 4;
+			return signature.substr(begin, signature.find_first_of(";]", begin) - begin);
+		}
+#elif defined(_MSC_VER)
+		// "... TypeName<class IFoo>::get(void)"
+		std::string signature = __FUNCSIG__;
+		std::string::size_type begin = signature.find("TypeName<");
+		std::string::size_type end = signature.rfind(">::get");
+		if (begin != std::string::npos && end != std::string::npos)
+			return signature.substr(begin + 9, end - begin - 9);
+#endif
+		return "mock";
+	}
+};
+
 // base type
-class base_mock {
+class base_mock : public MockAllocated {
 public:
-	void destroy() { unwriteVft(); delete this; }
+	void destroy() { unwriteVft(); mock_release(); }
 	virtual ~base_mock() {}
+	// base_mock cannot hold data without shifting the layout of the mocked class, so a mock keeps
+	// its MockCalls in the slot after its function table.
+	MockCalls *registeredCalls()
+	{
+		return (*(MockCalls ***)this)[VIRT_FUNC_LIMIT+3];
+	}
 	void *rewriteVft(void *newVf)
 	{
 		void *oldVf = *(void **)this;
@@ -383,6 +758,25 @@ public:
 		mock_reset();
 	}
 	virtual void mock_reset() = 0;
+	virtual void mock_release() = 0;
+	virtual void mock_memoryUsage(MemoryUsage &usage) = 0;
+	virtual std::string mock_typeName() = 0;
+	// The virtual functions above are only reachable through the original function table.
+	void memoryUsage(MemoryUsage &usage)
+	{
+		void *table = *(void **)this;
+		unwriteVft();
+		mock_memoryUsage(usage);
+		*(void **)this = table;
+	}
+	std::string typeName()
+	{
+		void *table = *(void **)this;
+		unwriteVft();
+		std::string name = mock_typeName();
+		*(void **)this = table;
+		return name;
+	}
 	void unwriteVft()
 	{
 		*(void **)this = (*(void ***)this)[VIRT_FUNC_LIMIT+1];
@@ -459,6 +853,115 @@ InParam<T, false> In(T& t) { return InParam<T, false>(t); }
 template <typename T>
 InParam<T, true> In(T*& t) { return InParam<T, true>(t); }
 
+// The hash of the argument a Fingerprint last hashed, so that the other Fingerprints tried against
+// the same call reuse it rather than hash the payload again. Each MockRepository has one, and only
+// a repository with Calls that hold a Fingerprint starts a new generation for every call it
+// dispatches, as the same buffer may hold other bytes by the next call. It also makes its cache
+// the current one, the one Fingerprints use. That is per thread with C++11, so that repositories
+// on different threads do not share it, and shared by the whole process before that.
+struct FingerprintCache
+{
+	FingerprintCache() : generation(0), hashedIn(~0ULL), data(0), size(0), hash(0) {}
+	void begin()
+	{
+		++generation;
+		Current<0>::cache = this;
+	}
+	template <int X>
+	struct Current
+	{
+#if __cplusplus > 199711L
+		static thread_local FingerprintCache *cache;
+#else
+		static FingerprintCache *cache;
+#endif
+	};
+	unsigned long long generation;
+	unsigned long long hashedIn;
+	const unsigned char *data;
+	size_t size;
+	unsigned long long hash;
+};
+
+template <int X>
+#if __cplusplus > 199711L
+thread_local
+#endif
+FingerprintCache *FingerprintCache::Current<X>::cache = 0;
+
+// Fingerprint(payload) matches an argument by the length and a 64-bit hash of its bytes, so that
+// With() neither keeps a copy of a large std::string or std::vector nor compares all of it for
+// every call. Verified() also compares the bytes when the hash matches, to rule out collisions; it
+// reads them from the payload, which must then stay alive and unchanged.
+class Fingerprint
+{
+public:
+	template <typename T>
+	explicit Fingerprint(const T &payload) { init(bytes(payload)); }
+	explicit Fingerprint(const char *payload) { init(bytes(payload)); }
+	Fingerprint &Verified() { verify = true; return *this; }
+	template <typename T>
+	bool matches(const T &argument) const
+	{
+		Bytes value = bytes(argument);
+		return value.second == size &&
+			hashArgument(value) == hash &&
+			(!verify || !size || memcmp(value.first, data, size) == 0);
+	}
+	size_t length() const { return size; }
+	unsigned long long value() const { return hash; }
+	// 64-bit FNV-1a, but over eight bytes at a time where it can.
+	static unsigned long long hashBytes(const unsigned char *data, size_t size)
+	{
+		unsigned long long hash = 14695981039346656037ULL;
+		for (; size >= sizeof(hash); size -= sizeof(hash), data += sizeof(hash))
+		{
+			unsigned long long word;
+			memcpy(&word, data, sizeof(word));
+			hash = (hash ^ word) * 1099511628211ULL;
+		}
+		for (; size; --size)
+			hash = (hash ^ *data++) * 1099511628211ULL;
+		return hash;
+	}
+private:
+	typedef std::pair<const unsigned char *, size_t> Bytes;
+	template <typename T>
+	static Bytes bytes(const T &container)
+	{
+		if (container.empty())
+			return Bytes(0, 0);
+		return Bytes(reinterpret_cast<const unsigned char *>(&container[0]), container.size() * sizeof(container[0]));
+	}
+	static Bytes bytes(const char *text) { return Bytes(reinterpret_cast<const unsigned char *>(text), text ? strlen(text) : 0); }
+	static Bytes bytes(char *text) { return bytes((const char *)text); }
+	static unsigned long long hashArgument(Bytes value)
+	{
+		FingerprintCache *cache = FingerprintCache::Current<0>::cache;
+		if (!cache)
+			return hashBytes(value.first, value.second);
+		if (cache->hashedIn != cache->generation || cache->data != value.first || cache->size != value.second)
+		{
+			cache->hashedIn = cache->generation;
+			cache->data = value.first;
+			cache->size = value.second;
+			cache->hash = hashBytes(value.first, value.second);
+		}
+		return cache->hash;
+	}
+	void init(Bytes payload)
+	{
+		data = payload.first;
+		size = payload.second;
+		hash = hashBytes(data, size);
+		verify = false;
+	}
+	const unsigned char *data;
+	size_t size;
+	unsigned long long hash;
+	bool verify;
+};
+
 struct NotPrintable { template <typename T> NotPrintable(T const&) {} };
 
 inline std::ostream &operator<<(std::ostream &os, NotPrintable const&)
@@ -473,6 +976,14 @@ inline std::ostream &operator<<(std::ostream &os, DontCare const&)
 	return os;
 }
 
+inline std::ostream &operator<<(std::ostream &os, Fingerprint const &fingerprint)
+{
+	std::ios::fmtflags flags = os.flags();
+	os << "fingerprint(" << fingerprint.length() << " bytes, " << std::hex << fingerprint.value() << ")";
+	os.flags(flags);
+	return os;
+}
+
 template <typename T>
 inline std::ostream &operator<<(std::ostream &os, ByRef<T> &ref) {
   os << "byRef(" << (T)ref << ")";
@@ -513,17 +1024,45 @@ struct printArg<NullType>
 	}
 };
 
-class base_tuple
+#ifdef HM_DISPATCH_HOOKS
+inline unsigned long long MonotonicNanoseconds()
+{
+#if __cplusplus > 199711L
+	return (unsigned long long)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#else
+	return (unsigned long long)((double)clock() * (1000000000.0 / CLOCKS_PER_SEC));
+#endif
+}
+#endif
+
+#ifdef HM_CALL_TRACE
+class CallTraceWriter;
+#endif
+
+class base_tuple : public MockAllocated
 {
 protected:
 	base_tuple()
+		: packed(0)
 	{
 	}
 public:
 	virtual ~base_tuple()
 	{
 	}
+	// The arguments of a call packed for comparing them with memcmp, or null until a Call with packed
+	// With() values compares them. See ArgumentKeys.
+	mutable const unsigned char *packed;
 	virtual void printTo(std::ostream &os) const = 0;
+	// The number of arguments of tuple, a call to the same function, that are equal to these With()
+	// arguments. Only used to rank registrations when a call matches none of them.
+	virtual unsigned matchingArgs(const base_tuple &) { return 0; }
+	// The bytes of the tuple, for MockRepository::memoryUsage(). Only the copy_tuple that keeps the
+	// With() values of a Call counts.
+	virtual size_t objectSize() const { return 0; }
+#ifdef HM_CALL_TRACE
+	virtual void traceTo(CallTraceWriter &) const {}
+#endif
 };
 
 template <typename X>
@@ -545,6 +1084,8 @@ template <typename T> struct base_type<const T&> { typedef T type; };
 template <typename T>
 struct comparer
 {
+	// Marks this as the default comparison, which only compares with ==; see indexes_arg.
+	typedef void plain_equality;
 	static inline bool compare(typename with_const<T>::type a, typename with_const<T>::type b)
 	{
 		return a == b;
@@ -553,6 +1094,10 @@ struct comparer
 	{
 		return true;
 	}
+	static inline bool compare(const Fingerprint &a, typename with_const<T>::type b)
+	{
+		return a.matches(b);
+	}
   template <typename U>
   static inline bool compare(const ByRef<U> &a, typename with_const<T>::type b)
   {
@@ -560,71 +1105,422 @@ struct comparer
   }
 };
 
-template <typename T>
-struct IsOutParamType { enum { value = false }; };
-template <typename T>
-struct IsOutParamType<OutParam<T> > { enum { value = true }; };
+// arg_hasher<T> hashes the arguments that indexArguments can look up: integers, enums, pointers and
+// std::strings, all of which comparer<T> compares with ==. Any other type is not hashable, and
+// With() values of such a type are scanned as before. All but std::string are also bitwise, so
+// that == compares their bytes and they can be compared with memcmp instead.
+#if __cplusplus > 199711L
+template <typename T, bool = std::is_enum<T>::value>
+#else
+template <typename T, bool = false>
+#endif
+struct arg_hasher
+{
+	enum { hashable = false, bitwise = false };
+	static size_t hash(const T &) { return 0; }
+};
 
 template <typename T>
-struct IsInParamType { enum { value = false }; };
+struct arg_hasher<T, true>
+{
+	enum { hashable = true, bitwise = true };
+	static size_t hash(T value) { return (size_t)value; }
+};
+
 template <typename T>
-struct IsInParamType<InParam<T, true> > { enum { value = true }; };
+struct arg_hasher<T *>
+{
+	enum { hashable = true, bitwise = true };
+	static size_t hash(T *value) { return (size_t)value; }
+};
+
+template <> struct arg_hasher<bool> : arg_hasher<bool, true> {};
+template <> struct arg_hasher<char> : arg_hasher<char, true> {};
+template <> struct arg_hasher<signed char> : arg_hasher<signed char, true> {};
+template <> struct arg_hasher<unsigned char> : arg_hasher<unsigned char, true> {};
+template <> struct arg_hasher<wchar_t> : arg_hasher<wchar_t, true> {};
+template <> struct arg_hasher<short> : arg_hasher<short, true> {};
+template <> struct arg_hasher<unsigned short> : arg_hasher<unsigned short, true> {};
+template <> struct arg_hasher<int> : arg_hasher<int, true> {};
+template <> struct arg_hasher<unsigned int> : arg_hasher<unsigned int, true> {};
+template <> struct arg_hasher<long> : arg_hasher<long, true> {};
+template <> struct arg_hasher<unsigned long> : arg_hasher<unsigned long, true> {};
+template <> struct arg_hasher<long long> : arg_hasher<long long, true> {};
+template <> struct arg_hasher<unsigned long long> : arg_hasher<unsigned long long, true> {};
+
+template <>
+struct arg_hasher<std::string>
+{
+	enum { hashable = true, bitwise = false };
+	static size_t hash(const std::string &value)
+	{
+		// FNV-1a
+		size_t hash = 2166136261u;
+		for (size_t i = 0; i < value.size(); ++i)
+			hash = (hash ^ (unsigned char)value[i]) * 16777619u;
+		return hash;
+	}
+};
+
+// Whether comparer<T> is the default one rather than a specialization that compares differently.
 template <typename T>
-struct IsInParamType<InParam<T, false> > { enum { value = true }; };
+struct plain_comparer
+{
+	template <typename U>
+	static char test(typename U::plain_equality *);
+	template <typename U>
+	static long test(...);
+	enum { value = sizeof(test<comparer<T> >(0)) == 1 };
+};
 
-template <typename T1, typename T2, bool Assign>
-struct do_assign;
+// Whether a With() value stored as S for a parameter of type A can be indexed. Neither may be
+// DontCare, ByRef, Out or In, which are not hashable, and the parameter must be compared by the
+// default comparer<A>.
+template <typename A, typename S>
+struct indexes_arg
+{
+	enum { value = arg_hasher<typename base_type<A>::type>::hashable && arg_hasher<typename base_type<S>::type>::hashable && plain_comparer<A>::value };
+};
 
-template <typename T1, typename T2>
-struct do_assign<T1, T2*, true>
+// Hashes a With() value as the parameter type it is compared as, so that it gets the same hash as
+// the arguments it compares equal to.
+template <typename A, typename S, bool = indexes_arg<A, S>::value>
+struct arg_key
 {
-  static void assign_to(T1 outparam, T2 *refparam)
-  {
-	*refparam = outparam.value;
-  }
-  static void assign_from(T1 inparam, T2 *refparam)
-  {
-	inparam.value = refparam;
-  }
+	static size_t hash(const S &) { return 0; }
 };
 
-template <typename T1, typename T2>
-struct do_assign<T1, T2&, true>
+template <typename A, typename S>
+struct arg_key<A, S, true>
 {
-  static void assign_to(T1 outparam, T2 &refparam)
-  {
-	refparam = outparam.value;
-  }
-  static void assign_from(T1 inparam, T2 &refparam)
-  {
-	inparam.value = refparam;
-  }
+	static size_t hash(typename with_const<A>::type value) { return arg_hasher<typename base_type<A>::type>::hash(value); }
 };
 
-template <typename T1, typename T2>
-struct do_assign<T1, T2, false>
+// Whether a With() value stored as S for a parameter of type A can be packed: converted to the
+// parameter type and copied as bytes, so that it compares with memcmp against a call's arguments.
+template <typename A, typename S>
+struct packs_arg
 {
-	static void assign_to(T1, T2) {}
-	static void assign_from(T1, T2) {}
+	enum { value = indexes_arg<A, S>::value && arg_hasher<typename base_type<A>::type>::bitwise };
 };
 
-template <typename T1, typename T2>
-void out_assign(T1 a, T2 b)
+template <typename A, bool = arg_hasher<typename base_type<A>::type>::bitwise>
+struct packed_size
 {
-	do_assign<T1, T2, IsOutParamType<typename base_type<T1>::type>::value >::assign_to(a, b);
+	enum { value = 0 };
+};
+
+template <typename A>
+struct packed_size<A, true>
+{
+	enum { value = sizeof(typename base_type<A>::type) };
+};
+
+template <typename A, typename S, bool = packs_arg<A, S>::value>
+struct arg_packer
+{
+	static void pack(unsigned char *&, const S &) {}
+};
+
+template <typename A, typename S>
+struct arg_packer<A, S, true>
+{
+	static void pack(unsigned char *&out, typename with_const<A>::type value)
+	{
+		typename base_type<A>::type converted = value;
+		memcpy(out, &converted, sizeof(converted));
+		out += sizeof(converted);
+	}
+};
+
+// memcmp for packed arguments, which are short enough that comparing them a word at a time inline
+// beats calling memcmp.
+inline bool packed_equal(const unsigned char *a, const unsigned char *b, size_t size)
+{
+	for (; size >= sizeof(size_t); size -= sizeof(size_t), a += sizeof(size_t), b += sizeof(size_t))
+	{
+		size_t wordA, wordB;
+		memcpy(&wordA, a, sizeof(wordA));
+		memcpy(&wordB, b, sizeof(wordB));
+		if (wordA != wordB)
+			return false;
+	}
+	for (; size; --size)
+		if (*a++ != *b++)
+			return false;
+	return true;
 }
 
-template <typename T1, typename T2>
-void in_assign(T1 a, T2 b)
+inline size_t hash_combine(size_t seed, size_t value)
 {
-	do_assign<T1, T2, IsInParamType<typename base_type<T1>::type>::value >::assign_from(a, b);
+	return seed ^ (value + 0x9e3779b9u + (seed << 6) + (seed >> 2));
 }
 
-template <typename A = NullType, typename B = NullType, typename C = NullType, typename D = NullType,
-		  typename E = NullType, typename F = NullType, typename G = NullType, typename H = NullType,
-		  typename I = NullType, typename J = NullType, typename K = NullType, typename L = NullType,
-		  typename M = NullType, typename N = NullType, typename O = NullType, typename P = NullType>
-class ref_tuple : public base_tuple
+template <typename A>
+struct packs_bitwise
+{
+	enum { value = arg_hasher<typename base_type<A>::type>::bitwise };
+};
+
+template <>
+struct packs_bitwise<NullType>
+{
+	enum { value = true };
+};
+
+// How the arguments of a call to a function taking A..P pack: whether all of them can, and the room
+// that takes. The padding NullTypes take none.
+template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H,
+		  typename I, typename J, typename K, typename L, typename M, typename N, typename O, typename P>
+struct packed_args
+{
+	enum { packable = packs_bitwise<A>::value && packs_bitwise<B>::value && packs_bitwise<C>::value && packs_bitwise<D>::value &&
+					  packs_bitwise<E>::value && packs_bitwise<F>::value && packs_bitwise<G>::value && packs_bitwise<H>::value &&
+					  packs_bitwise<I>::value && packs_bitwise<J>::value && packs_bitwise<K>::value && packs_bitwise<L>::value &&
+					  packs_bitwise<M>::value && packs_bitwise<N>::value && packs_bitwise<O>::value && packs_bitwise<P>::value,
+		   size = packed_size<A>::value + packed_size<B>::value + packed_size<C>::value + packed_size<D>::value +
+				  packed_size<E>::value + packed_size<F>::value + packed_size<G>::value + packed_size<H>::value +
+				  packed_size<I>::value + packed_size<J>::value + packed_size<K>::value + packed_size<L>::value +
+				  packed_size<M>::value + packed_size<N>::value + packed_size<O>::value + packed_size<P>::value,
+		   bufferSize = packable && size ? size : 1 };
+};
+
+// The argument visitors below do for every arity what hashing and packing need per argument. The
+// visit() of a ref_tuple or copy_tuple hands each of its values to arg<A, S>(value), with A the
+// parameter type and S the type the value is held as.
+
+template <typename T> struct is_fingerprint { enum { value = false }; };
+template <> struct is_fingerprint<Fingerprint> { enum { value = true }; };
+
+// Whether all With() values can be looked up in the argument index, whether all can be packed, and
+// whether any is a Fingerprint.
+struct arg_kinds_visitor
+{
+	arg_kinds_visitor() : indexes(true), packs(true), fingerprints(false) {}
+	bool indexes;
+	bool packs;
+	bool fingerprints;
+	template <typename A, typename S>
+	void arg(const S &)
+	{
+		indexes = indexes && indexes_arg<A, S>::value;
+		packs = packs && packs_arg<A, S>::value;
+		fingerprints = fingerprints || is_fingerprint<typename base_type<S>::type>::value;
+	}
+};
+
+// Hashes With() values as the parameter types they are compared as.
+struct arg_key_visitor
+{
+	arg_key_visitor() : key(0) {}
+	size_t key;
+	template <typename A, typename S>
+	void arg(const S &value) { key = hash_combine(key, arg_key<A, S>::hash(value)); }
+};
+
+// Hashes the arguments of a call the same way.
+struct arg_hash_visitor
+{
+	arg_hash_visitor() : key(0) {}
+	size_t key;
+	template <typename A, typename S>
+	void arg(const S &value) { key = hash_combine(key, arg_hasher<typename base_type<A>::type>::hash(value)); }
+};
+
+struct arg_pack_visitor
+{
+	arg_pack_visitor(unsigned char *out) : out(out) {}
+	unsigned char *out;
+	template <typename A, typename S>
+	void arg(const S &value) { arg_packer<A, S>::pack(out, value); }
+};
+
+template <typename T>
+struct IsOutParamType { enum { value = false }; };
+template <typename T>
+struct IsOutParamType<OutParam<T> > { enum { value = true }; };
+
+template <typename T>
+struct IsInParamType { enum { value = false }; };
+template <typename T>
+struct IsInParamType<InParam<T, true> > { enum { value = true }; };
+template <typename T>
+struct IsInParamType<InParam<T, false> > { enum { value = true }; };
+
+template <typename T1, typename T2, bool Assign>
+struct do_assign;
+
+template <typename T1, typename T2>
+struct do_assign<T1, T2*, true>
+{
+  static void assign_to(T1 outparam, T2 *refparam)
+  {
+	*refparam = outparam.value;
+  }
+  static void assign_from(T1 inparam, T2 *refparam)
+  {
+	inparam.value = refparam;
+  }
+};
+
+template <typename T1, typename T2>
+struct do_assign<T1, T2&, true>
+{
+  static void assign_to(T1 outparam, T2 &refparam)
+  {
+	refparam = outparam.value;
+  }
+  static void assign_from(T1 inparam, T2 &refparam)
+  {
+	inparam.value = refparam;
+  }
+};
+
+template <typename T1, typename T2>
+struct do_assign<T1, T2, false>
+{
+	static void assign_to(T1, T2) {}
+	static void assign_from(T1, T2) {}
+};
+
+template <typename T>
+struct assigns_arg
+{
+	enum { value = IsOutParamType<typename base_type<T>::type>::value || IsInParamType<typename base_type<T>::type>::value };
+};
+
+template <typename T1, typename T2>
+void out_assign(T1 a, T2 b)
+{
+	do_assign<T1, T2, IsOutParamType<typename base_type<T1>::type>::value >::assign_to(a, b);
+}
+
+template <typename T1, typename T2>
+void in_assign(T1 a, T2 b)
+{
+	do_assign<T1, T2, IsInParamType<typename base_type<T1>::type>::value >::assign_from(a, b);
+}
+
+#ifdef HM_CALL_TRACE
+// Buffered binary writer for call traces. The file starts with the 8 bytes "HMTRACE1" followed by
+// records in native byte order, each made of:
+//   uint64 sequence number      uint64 nanoseconds since StartTrace()
+//   uint32 mock id              int32 baseOffset            int32 funcIndex
+//   uint32 id of the matched Call, 0 if none matched
+//   uint8 argument count, and per argument: uint8 kind, uint32 length, length bytes
+// Mocks are numbered from 1 in order of creation, with 0 for C functions, and Calls from 1 in order
+// of registration. Argument kind 0 is the raw object representation of a trivially copyable
+// argument, kind 1 is the argument as HippoMocks prints it in its messages.
+class CallTraceWriter : public MockAllocated
+{
+public:
+	enum { RawArg = 0, TextArg = 1 };
+	CallTraceWriter(FILE *file)
+		: file(file)
+		, used(0)
+	{
+		write("HMTRACE1", 8);
+	}
+	~CallTraceWriter()
+	{
+		flush();
+		fclose(file);
+	}
+	void write(const void *data, size_t size)
+	{
+		if (used + size > sizeof(buffer))
+		{
+			flush();
+			if (size > sizeof(buffer))
+			{
+				fwrite(data, 1, size, file);
+				return;
+			}
+		}
+		memcpy(buffer + used, data, size);
+		used += size;
+	}
+	template <typename T>
+	void put(T value)
+	{
+		write(&value, sizeof(value));
+	}
+	void putArg(unsigned char kind, const void *data, size_t size)
+	{
+		put(kind);
+		put((unsigned int)size);
+		write(data, size);
+	}
+	void flush()
+	{
+		fwrite(buffer, 1, used, file);
+		used = 0;
+		fflush(file);
+	}
+private:
+	CallTraceWriter(const CallTraceWriter &);
+	CallTraceWriter &operator=(const CallTraceWriter &);
+	FILE *file;
+	size_t used;
+	char buffer[65536];
+};
+
+template <typename T> struct as_ref { typedef const T &type; };
+template <typename T> struct as_ref<T &> { typedef T &type; };
+
+template <typename T, bool raw>
+struct traceArgAs
+{
+	static void write(CallTraceWriter &out, typename as_ref<T>::type arg)
+	{
+		MockStringStream text;
+		printArg<T>::print(text, arg, false);
+		MockString str = text.str();
+		out.putArg(CallTraceWriter::TextArg, str.data(), str.size());
+	}
+};
+
+template <typename T>
+struct traceArgAs<T, true>
+{
+	static void write(CallTraceWriter &out, typename as_ref<T>::type arg)
+	{
+		out.putArg(CallTraceWriter::RawArg, &arg, sizeof(arg));
+	}
+};
+
+template <typename T>
+struct traceArg : traceArgAs<T,
+#if __cplusplus > 199711L
+	std::is_trivially_copyable<typename base_type<T>::type>::value
+#else
+	false
+#endif
+	>
+{
+	enum { count = 1 };
+};
+
+// Strings are more useful as text than as pointer values.
+template <> struct traceArg<const char *> : traceArgAs<const char *, false> { enum { count = 1 }; };
+template <> struct traceArg<char *> : traceArgAs<char *, false> { enum { count = 1 }; };
+
+template <>
+struct traceArg<NullType>
+{
+	enum { count = 0 };
+	static void write(CallTraceWriter &, NullType) {}
+};
+#endif
+
+// The arguments of one call, as the thunk received them. ref_tuple is specialized for each arity,
+// so a call only constructs, prints and traces the arguments it has; the NullType parameters only
+// pad the type to the 16 that TCall and the tuples it compares against are written for.
+template <typename A = NullType, typename B = NullType, typename C = NullType, typename D = NullType,
+		  typename E = NullType, typename F = NullType, typename G = NullType, typename H = NullType,
+		  typename I = NullType, typename J = NullType, typename K = NullType, typename L = NullType,
+		  typename M = NullType, typename N = NullType, typename O = NullType, typename P = NullType>
+class ref_tuple : public base_tuple
 {
 public:
 	A a;
@@ -646,6 +1542,28 @@ public:
 	ref_tuple(A valueA = A(), B valueB = B(), C valueC = C(), D valueD = D(), E valueE = E(), F valueF = F(), G valueG = G(), H valueH = H(), I valueI = I(), J valueJ = J(), K valueK = K(), L valueL = L(), M valueM = M(), N valueN = N(), O valueO = O(), P valueP = P())
 		  : a(valueA), b(valueB), c(valueC), d(valueD), e(valueE), f(valueF), g(valueG), h(valueH), i(valueI), j(valueJ), k(valueK), l(valueL), m(valueM), n(valueN), o(valueO), p(valueP)
 	{}
+	// Room for the arguments packed like the With() values of a copy_tuple, see packed_args.
+	mutable unsigned char bytes[packed_args<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P>::bufferSize];
+	template <typename V>
+	void visit(V &v) const
+	{
+		v.template arg<A, typename base_type<A>::type>(a);
+		v.template arg<B, typename base_type<B>::type>(b);
+		v.template arg<C, typename base_type<C>::type>(c);
+		v.template arg<D, typename base_type<D>::type>(d);
+		v.template arg<E, typename base_type<E>::type>(e);
+		v.template arg<F, typename base_type<F>::type>(f);
+		v.template arg<G, typename base_type<G>::type>(g);
+		v.template arg<H, typename base_type<H>::type>(h);
+		v.template arg<I, typename base_type<I>::type>(i);
+		v.template arg<J, typename base_type<J>::type>(j);
+		v.template arg<K, typename base_type<K>::type>(k);
+		v.template arg<L, typename base_type<L>::type>(l);
+		v.template arg<M, typename base_type<M>::type>(m);
+		v.template arg<N, typename base_type<N>::type>(n);
+		v.template arg<O, typename base_type<O>::type>(o);
+		v.template arg<P, typename base_type<P>::type>(p);
+	}
 	virtual void printTo(std::ostream &os) const
 	{
 	  os << "(";
@@ -667,2496 +1585,6088 @@ public:
 	  printArg<P>::print(os, p, true);
 	  os << ")";
 	}
+#ifdef HM_CALL_TRACE
+	virtual void traceTo(CallTraceWriter &out) const
+	{
+	  out.put((unsigned char)16);
+	  traceArg<A>::write(out, a);
+	  traceArg<B>::write(out, b);
+	  traceArg<C>::write(out, c);
+	  traceArg<D>::write(out, d);
+	  traceArg<E>::write(out, e);
+	  traceArg<F>::write(out, f);
+	  traceArg<G>::write(out, g);
+	  traceArg<H>::write(out, h);
+	  traceArg<I>::write(out, i);
+	  traceArg<J>::write(out, j);
+	  traceArg<K>::write(out, k);
+	  traceArg<L>::write(out, l);
+	  traceArg<M>::write(out, m);
+	  traceArg<N>::write(out, n);
+	  traceArg<O>::write(out, o);
+	  traceArg<P>::write(out, p);
+	}
+#endif
 };
 
-template <typename A = NullType, typename B = NullType, typename C = NullType, typename D = NullType,
-		  typename E = NullType, typename F = NullType, typename G = NullType, typename H = NullType,
-		  typename I = NullType, typename J = NullType, typename K = NullType, typename L = NullType,
-		  typename M = NullType, typename N = NullType, typename O = NullType, typename P = NullType>
-class ref_comparable_assignable_tuple : public base_tuple
+template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename M, typename N, typename O>
+class ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> : public base_tuple
 {
 public:
-	virtual bool operator==(const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &bo) = 0;
-	virtual void assign_from(ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &from) = 0;
-  virtual void assign_to(ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &to) = 0;
-};
-
-template <typename T> struct no_array { typedef T type; };
-template <typename T, int N> struct no_array<T[N]> { typedef T* type; };
-
-template <typename B>
-struct store_as
-{
-	typedef typename no_array<B>::type type;
+	A a;
+	B b;
+	C c;
+	D d;
+	E e;
+	F f;
+	G g;
+	H h;
+	I i;
+	J j;
+	K k;
+	L l;
+	M m;
+	N n;
+	O o;
+	ref_tuple(A valueA = A(), B valueB = B(), C valueC = C(), D valueD = D(), E valueE = E(), F valueF = F(), G valueG = G(), H valueH = H(), I valueI = I(), J valueJ = J(), K valueK = K(), L valueL = L(), M valueM = M(), N valueN = N(), O valueO = O())
+		  : a(valueA), b(valueB), c(valueC), d(valueD), e(valueE), f(valueF), g(valueG), h(valueH), i(valueI), j(valueJ), k(valueK), l(valueL), m(valueM), n(valueN), o(valueO)
+	{}
+	// Room for the arguments packed like the With() values of a copy_tuple, see packed_args.
+	mutable unsigned char bytes[packed_args<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType>::bufferSize];
+	template <typename V>
+	void visit(V &v) const
+	{
+		v.template arg<A, typename base_type<A>::type>(a);
+		v.template arg<B, typename base_type<B>::type>(b);
+		v.template arg<C, typename base_type<C>::type>(c);
+		v.template arg<D, typename base_type<D>::type>(d);
+		v.template arg<E, typename base_type<E>::type>(e);
+		v.template arg<F, typename base_type<F>::type>(f);
+		v.template arg<G, typename base_type<G>::type>(g);
+		v.template arg<H, typename base_type<H>::type>(h);
+		v.template arg<I, typename base_type<I>::type>(i);
+		v.template arg<J, typename base_type<J>::type>(j);
+		v.template arg<K, typename base_type<K>::type>(k);
+		v.template arg<L, typename base_type<L>::type>(l);
+		v.template arg<M, typename base_type<M>::type>(m);
+		v.template arg<N, typename base_type<N>::type>(n);
+		v.template arg<O, typename base_type<O>::type>(o);
+	}
+	virtual void printTo(std::ostream &os) const
+	{
+	  os << "(";
+	  printArg<A>::print(os, a, false);
+	  printArg<B>::print(os, b, true);
+	  printArg<C>::print(os, c, true);
+	  printArg<D>::print(os, d, true);
+	  printArg<E>::print(os, e, true);
+	  printArg<F>::print(os, f, true);
+	  printArg<G>::print(os, g, true);
+	  printArg<H>::print(os, h, true);
+	  printArg<I>::print(os, i, true);
+	  printArg<J>::print(os, j, true);
+	  printArg<K>::print(os, k, true);
+	  printArg<L>::print(os, l, true);
+	  printArg<M>::print(os, m, true);
+	  printArg<N>::print(os, n, true);
+	  printArg<O>::print(os, o, true);
+	  os << ")";
+	}
+#ifdef HM_CALL_TRACE
+	virtual void traceTo(CallTraceWriter &out) const
+	{
+	  out.put((unsigned char)15);
+	  traceArg<A>::write(out, a);
+	  traceArg<B>::write(out, b);
+	  traceArg<C>::write(out, c);
+	  traceArg<D>::write(out, d);
+	  traceArg<E>::write(out, e);
+	  traceArg<F>::write(out, f);
+	  traceArg<G>::write(out, g);
+	  traceArg<H>::write(out, h);
+	  traceArg<I>::write(out, i);
+	  traceArg<J>::write(out, j);
+	  traceArg<K>::write(out, k);
+	  traceArg<L>::write(out, l);
+	  traceArg<M>::write(out, m);
+	  traceArg<N>::write(out, n);
+	  traceArg<O>::write(out, o);
+	}
+#endif
 };
 
-template <typename B>
-struct store_as<B&>
+template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename M, typename N>
+class ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> : public base_tuple
 {
-  typedef typename no_array<B>::type type;
+public:
+	A a;
+	B b;
+	C c;
+	D d;
+	E e;
+	F f;
+	G g;
+	H h;
+	I i;
+	J j;
+	K k;
+	L l;
+	M m;
+	N n;
+	ref_tuple(A valueA = A(), B valueB = B(), C valueC = C(), D valueD = D(), E valueE = E(), F valueF = F(), G valueG = G(), H valueH = H(), I valueI = I(), J valueJ = J(), K valueK = K(), L valueL = L(), M valueM = M(), N valueN = N())
+		  : a(valueA), b(valueB), c(valueC), d(valueD), e(valueE), f(valueF), g(valueG), h(valueH), i(valueI), j(valueJ), k(valueK), l(valueL), m(valueM), n(valueN)
+	{}
+	// Room for the arguments packed like the With() values of a copy_tuple, see packed_args.
+	mutable unsigned char bytes[packed_args<A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType>::bufferSize];
+	template <typename V>
+	void visit(V &v) const
+	{
+		v.template arg<A, typename base_type<A>::type>(a);
+		v.template arg<B, typename base_type<B>::type>(b);
+		v.template arg<C, typename base_type<C>::type>(c);
+		v.template arg<D, typename base_type<D>::type>(d);
+		v.template arg<E, typename base_type<E>::type>(e);
+		v.template arg<F, typename base_type<F>::type>(f);
+		v.template arg<G, typename base_type<G>::type>(g);
+		v.template arg<H, typename base_type<H>::type>(h);
+		v.template arg<I, typename base_type<I>::type>(i);
+		v.template arg<J, typename base_type<J>::type>(j);
+		v.template arg<K, typename base_type<K>::type>(k);
+		v.template arg<L, typename base_type<L>::type>(l);
+		v.template arg<M, typename base_type<M>::type>(m);
+		v.template arg<N, typename base_type<N>::type>(n);
+	}
+	virtual void printTo(std::ostream &os) const
+	{
+	  os << "(";
+	  printArg<A>::print(os, a, false);
+	  printArg<B>::print(os, b, true);
+	  printArg<C>::print(os, c, true);
+	  printArg<D>::print(os, d, true);
+	  printArg<E>::print(os, e, true);
+	  printArg<F>::print(os, f, true);
+	  printArg<G>::print(os, g, true);
+	  printArg<H>::print(os, h, true);
+	  printArg<I>::print(os, i, true);
+	  printArg<J>::print(os, j, true);
+	  printArg<K>::print(os, k, true);
+	  printArg<L>::print(os, l, true);
+	  printArg<M>::print(os, m, true);
+	  printArg<N>::print(os, n, true);
+	  os << ")";
+	}
+#ifdef HM_CALL_TRACE
+	virtual void traceTo(CallTraceWriter &out) const
+	{
+	  out.put((unsigned char)14);
+	  traceArg<A>::write(out, a);
+	  traceArg<B>::write(out, b);
+	  traceArg<C>::write(out, c);
+	  traceArg<D>::write(out, d);
+	  traceArg<E>::write(out, e);
+	  traceArg<F>::write(out, f);
+	  traceArg<G>::write(out, g);
+	  traceArg<H>::write(out, h);
+	  traceArg<I>::write(out, i);
+	  traceArg<J>::write(out, j);
+	  traceArg<K>::write(out, k);
+	  traceArg<L>::write(out, l);
+	  traceArg<M>::write(out, m);
+	  traceArg<N>::write(out, n);
+	}
+#endif
 };
 
-template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H,
-		  typename I, typename J, typename K, typename L, typename M, typename N, typename O, typename P,
-		  typename CA, typename CB, typename CC, typename CD, typename CE, typename CF, typename CG, typename CH,
-		  typename CI, typename CJ, typename CK, typename CL, typename CM, typename CN, typename CO, typename CP>
-class copy_tuple : public ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P>
+template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename M>
+class ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> : public base_tuple
 {
 public:
-	typename store_as<CA>::type a;
-	typename store_as<CB>::type b;
-	typename store_as<CC>::type c;
-	typename store_as<CD>::type d;
-	typename store_as<CE>::type e;
-	typename store_as<CF>::type f;
-	typename store_as<CG>::type g;
-	typename store_as<CH>::type h;
-	typename store_as<CI>::type i;
-	typename store_as<CJ>::type j;
-	typename store_as<CK>::type k;
-	typename store_as<CL>::type l;
-	typename store_as<CM>::type m;
-	typename store_as<CN>::type n;
-	typename store_as<CO>::type o;
-	typename store_as<CP>::type p;
-	copy_tuple(typename store_as<CA>::type valueA, typename store_as<CB>::type valueB,
-		typename store_as<CC>::type valueC, typename store_as<CD>::type valueD,
-		typename store_as<CE>::type valueE, typename store_as<CF>::type valueF,
-		typename store_as<CG>::type valueG, typename store_as<CH>::type valueH,
-		typename store_as<CI>::type valueI, typename store_as<CJ>::type valueJ,
-		typename store_as<CK>::type valueK, typename store_as<CL>::type valueL,
-		typename store_as<CM>::type valueM, typename store_as<CN>::type valueN,
-		typename store_as<CO>::type valueO, typename store_as<CP>::type valueP)
-		  : a(valueA), b(valueB), c(valueC), d(valueD), e(valueE), f(valueF), g(valueG), h(valueH), i(valueI), j(valueJ), k(valueK), l(valueL), m(valueM), n(valueN), o(valueO), p(valueP)
+	A a;
+	B b;
+	C c;
+	D d;
+	E e;
+	F f;
+	G g;
+	H h;
+	I i;
+	J j;
+	K k;
+	L l;
+	M m;
+	ref_tuple(A valueA = A(), B valueB = B(), C valueC = C(), D valueD = D(), E valueE = E(), F valueF = F(), G valueG = G(), H valueH = H(), I valueI = I(), J valueJ = J(), K valueK = K(), L valueL = L(), M valueM = M())
+		  : a(valueA), b(valueB), c(valueC), d(valueD), e(valueE), f(valueF), g(valueG), h(valueH), i(valueI), j(valueJ), k(valueK), l(valueL), m(valueM)
 	{}
-	bool operator==(const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &to)
-	{
-		return (comparer<A>::compare(a, to.a) &&
-				comparer<B>::compare(b, to.b) &&
-				comparer<C>::compare(c, to.c) &&
-				comparer<D>::compare(d, to.d) &&
-				comparer<E>::compare(e, to.e) &&
-				comparer<F>::compare(f, to.f) &&
-				comparer<G>::compare(g, to.g) &&
-				comparer<H>::compare(h, to.h) &&
-				comparer<I>::compare(i, to.i) &&
-				comparer<J>::compare(j, to.j) &&
-				comparer<K>::compare(k, to.k) &&
-				comparer<L>::compare(l, to.l) &&
-				comparer<M>::compare(m, to.m) &&
-				comparer<N>::compare(n, to.n) &&
-				comparer<O>::compare(o, to.o) &&
-				comparer<P>::compare(p, to.p));
-	}
-	void assign_from(ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &from)
-	{
-		in_assign< typename store_as<CA>::type, A>(a, from.a);
-		in_assign< typename store_as<CB>::type, B>(b, from.b);
-		in_assign< typename store_as<CC>::type, C>(c, from.c);
-		in_assign< typename store_as<CD>::type, D>(d, from.d);
-		in_assign< typename store_as<CE>::type, E>(e, from.e);
-		in_assign< typename store_as<CF>::type, F>(f, from.f);
-		in_assign< typename store_as<CG>::type, G>(g, from.g);
-		in_assign< typename store_as<CH>::type, H>(h, from.h);
-		in_assign< typename store_as<CI>::type, I>(i, from.i);
-		in_assign< typename store_as<CJ>::type, J>(j, from.j);
-		in_assign< typename store_as<CK>::type, K>(k, from.k);
-		in_assign< typename store_as<CL>::type, L>(l, from.l);
-		in_assign< typename store_as<CM>::type, M>(m, from.m);
-		in_assign< typename store_as<CN>::type, N>(n, from.n);
-		in_assign< typename store_as<CO>::type, O>(o, from.o);
-		in_assign< typename store_as<CP>::type, P>(p, from.p);
-	}
-	void assign_to(ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &to)
-	{
-		out_assign< typename store_as<CA>::type, A>(a, to.a);
-		out_assign< typename store_as<CB>::type, B>(b, to.b);
-		out_assign< typename store_as<CC>::type, C>(c, to.c);
-		out_assign< typename store_as<CD>::type, D>(d, to.d);
-		out_assign< typename store_as<CE>::type, E>(e, to.e);
-		out_assign< typename store_as<CF>::type, F>(f, to.f);
-		out_assign< typename store_as<CG>::type, G>(g, to.g);
-		out_assign< typename store_as<CH>::type, H>(h, to.h);
-		out_assign< typename store_as<CI>::type, I>(i, to.i);
-		out_assign< typename store_as<CJ>::type, J>(j, to.j);
-		out_assign< typename store_as<CK>::type, K>(k, to.k);
-		out_assign< typename store_as<CL>::type, L>(l, to.l);
-		out_assign< typename store_as<CM>::type, M>(m, to.m);
-		out_assign< typename store_as<CN>::type, N>(n, to.n);
-		out_assign< typename store_as<CO>::type, O>(o, to.o);
-		out_assign< typename store_as<CP>::type, P>(p, to.p);
+	// Room for the arguments packed like the With() values of a copy_tuple, see packed_args.
+	mutable unsigned char bytes[packed_args<A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType>::bufferSize];
+	template <typename V>
+	void visit(V &v) const
+	{
+		v.template arg<A, typename base_type<A>::type>(a);
+		v.template arg<B, typename base_type<B>::type>(b);
+		v.template arg<C, typename base_type<C>::type>(c);
+		v.template arg<D, typename base_type<D>::type>(d);
+		v.template arg<E, typename base_type<E>::type>(e);
+		v.template arg<F, typename base_type<F>::type>(f);
+		v.template arg<G, typename base_type<G>::type>(g);
+		v.template arg<H, typename base_type<H>::type>(h);
+		v.template arg<I, typename base_type<I>::type>(i);
+		v.template arg<J, typename base_type<J>::type>(j);
+		v.template arg<K, typename base_type<K>::type>(k);
+		v.template arg<L, typename base_type<L>::type>(l);
+		v.template arg<M, typename base_type<M>::type>(m);
 	}
 	virtual void printTo(std::ostream &os) const
 	{
-		os << "(";
-		printArg<typename store_as<CA>::type>::print(os, a, false);
-		printArg<typename store_as<CB>::type>::print(os, b, true);
-		printArg<typename store_as<CC>::type>::print(os, c, true);
-		printArg<typename store_as<CD>::type>::print(os, d, true);
-		printArg<typename store_as<CE>::type>::print(os, e, true);
-		printArg<typename store_as<CF>::type>::print(os, f, true);
-		printArg<typename store_as<CG>::type>::print(os, g, true);
-		printArg<typename store_as<CH>::type>::print(os, h, true);
-		printArg<typename store_as<CI>::type>::print(os, i, true);
-		printArg<typename store_as<CJ>::type>::print(os, j, true);
-		printArg<typename store_as<CK>::type>::print(os, k, true);
-		printArg<typename store_as<CL>::type>::print(os, l, true);
-		printArg<typename store_as<CM>::type>::print(os, m, true);
-		printArg<typename store_as<CN>::type>::print(os, n, true);
-		printArg<typename store_as<CO>::type>::print(os, o, true);
-		printArg<typename store_as<CP>::type>::print(os, p, true);
-		os << ")";
+	  os << "(";
+	  printArg<A>::print(os, a, false);
+	  printArg<B>::print(os, b, true);
+	  printArg<C>::print(os, c, true);
+	  printArg<D>::print(os, d, true);
+	  printArg<E>::print(os, e, true);
+	  printArg<F>::print(os, f, true);
+	  printArg<G>::print(os, g, true);
+	  printArg<H>::print(os, h, true);
+	  printArg<I>::print(os, i, true);
+	  printArg<J>::print(os, j, true);
+	  printArg<K>::print(os, k, true);
+	  printArg<L>::print(os, l, true);
+	  printArg<M>::print(os, m, true);
+	  os << ")";
+	}
+#ifdef HM_CALL_TRACE
+	virtual void traceTo(CallTraceWriter &out) const
+	{
+	  out.put((unsigned char)13);
+	  traceArg<A>::write(out, a);
+	  traceArg<B>::write(out, b);
+	  traceArg<C>::write(out, c);
+	  traceArg<D>::write(out, d);
+	  traceArg<E>::write(out, e);
+	  traceArg<F>::write(out, f);
+	  traceArg<G>::write(out, g);
+	  traceArg<H>::write(out, h);
+	  traceArg<I>::write(out, i);
+	  traceArg<J>::write(out, j);
+	  traceArg<K>::write(out, k);
+	  traceArg<L>::write(out, l);
+	  traceArg<M>::write(out, m);
 	}
-};
-
-inline std::ostream &operator<<(std::ostream &os, const MockRepository &repo);
-
-template <int X>
-class MockRepoInstanceHolder {
-public:
-	static MockRepository *instance;
-};
-
-template <int X>
-MockRepository *MockRepoInstanceHolder<X>::instance;
-
-class BaseException
-#ifndef HM_NO_EXCEPTIONS
-	: public BASE_EXCEPTION
 #endif
-{
-public:
-	~BaseException() throw() {}
-	const char *what() const throw() { return txt.c_str(); }
-protected:
-	std::string txt;
 };
 
-// exception types
-class ExpectationException : public BaseException {
+template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L>
+class ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> : public base_tuple
+{
 public:
-	ExpectationException(MockRepository *repo, const base_tuple *tuple, const char *funcName)
-	{
-		std::stringstream text;
-		text << "Function ";
-		text << funcName;
-		if (tuple)
-			tuple->printTo(text);
-		else
-			text << "(...)";
-		text << " called with mismatching expectation!" << std::endl;
-		text << *repo;
-		txt = text.str();
+	A a;
+	B b;
+	C c;
+	D d;
+	E e;
+	F f;
+	G g;
+	H h;
+	I i;
+	J j;
+	K k;
+	L l;
+	ref_tuple(A valueA = A(), B valueB = B(), C valueC = C(), D valueD = D(), E valueE = E(), F valueF = F(), G valueG = G(), H valueH = H(), I valueI = I(), J valueJ = J(), K valueK = K(), L valueL = L())
+		  : a(valueA), b(valueB), c(valueC), d(valueD), e(valueE), f(valueF), g(valueG), h(valueH), i(valueI), j(valueJ), k(valueK), l(valueL)
+	{}
+	// Room for the arguments packed like the With() values of a copy_tuple, see packed_args.
+	mutable unsigned char bytes[packed_args<A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType>::bufferSize];
+	template <typename V>
+	void visit(V &v) const
+	{
+		v.template arg<A, typename base_type<A>::type>(a);
+		v.template arg<B, typename base_type<B>::type>(b);
+		v.template arg<C, typename base_type<C>::type>(c);
+		v.template arg<D, typename base_type<D>::type>(d);
+		v.template arg<E, typename base_type<E>::type>(e);
+		v.template arg<F, typename base_type<F>::type>(f);
+		v.template arg<G, typename base_type<G>::type>(g);
+		v.template arg<H, typename base_type<H>::type>(h);
+		v.template arg<I, typename base_type<I>::type>(i);
+		v.template arg<J, typename base_type<J>::type>(j);
+		v.template arg<K, typename base_type<K>::type>(k);
+		v.template arg<L, typename base_type<L>::type>(l);
 	}
-};
-
-#ifdef LINUX_TARGET
-#include <execinfo.h>
-#endif
-
-class NotImplementedException : public BaseException {
-public:
-	NotImplementedException(MockRepository *repo)
+	virtual void printTo(std::ostream &os) const
 	{
-		std::stringstream text;
-		text << "Function called without expectation!" << std::endl;
-		text << *repo;
-
-#ifdef LINUX_TARGET
-		void* stacktrace[256];
-		size_t size = backtrace( stacktrace, sizeof(stacktrace) );
-		if( size > 0 )
-		{
-			text << "Stackdump:" << std::endl;
-			char **symbols = backtrace_symbols( stacktrace, size );
-			for( size_t i = 0; i < size; i = i + 1 )
-			{
-				text << symbols[i] << std::endl;
-			}
-			free( symbols );
-		}
-#endif
-
-		txt = text.str();
+	  os << "(";
+	  printArg<A>::print(os, a, false);
+	  printArg<B>::print(os, b, true);
+	  printArg<C>::print(os, c, true);
+	  printArg<D>::print(os, d, true);
+	  printArg<E>::print(os, e, true);
+	  printArg<F>::print(os, f, true);
+	  printArg<G>::print(os, g, true);
+	  printArg<H>::print(os, h, true);
+	  printArg<I>::print(os, i, true);
+	  printArg<J>::print(os, j, true);
+	  printArg<K>::print(os, k, true);
+	  printArg<L>::print(os, l, true);
+	  os << ")";
 	}
+#ifdef HM_CALL_TRACE
+	virtual void traceTo(CallTraceWriter &out) const
+	{
+	  out.put((unsigned char)12);
+	  traceArg<A>::write(out, a);
+	  traceArg<B>::write(out, b);
+	  traceArg<C>::write(out, c);
+	  traceArg<D>::write(out, d);
+	  traceArg<E>::write(out, e);
+	  traceArg<F>::write(out, f);
+	  traceArg<G>::write(out, g);
+	  traceArg<H>::write(out, h);
+	  traceArg<I>::write(out, i);
+	  traceArg<J>::write(out, j);
+	  traceArg<K>::write(out, k);
+	  traceArg<L>::write(out, l);
+	}
+#endif
 };
 
-class CallMissingException : public BaseException {
+template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K>
+class ref_tuple<A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> : public base_tuple
+{
 public:
-	CallMissingException(MockRepository *repo)
+	A a;
+	B b;
+	C c;
+	D d;
+	E e;
+	F f;
+	G g;
+	H h;
+	I i;
+	J j;
+	K k;
+	ref_tuple(A valueA = A(), B valueB = B(), C valueC = C(), D valueD = D(), E valueE = E(), F valueF = F(), G valueG = G(), H valueH = H(), I valueI = I(), J valueJ = J(), K valueK = K())
+		  : a(valueA), b(valueB), c(valueC), d(valueD), e(valueE), f(valueF), g(valueG), h(valueH), i(valueI), j(valueJ), k(valueK)
+	{}
+	// Room for the arguments packed like the With() values of a copy_tuple, see packed_args.
+	mutable unsigned char bytes[packed_args<A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType>::bufferSize];
+	template <typename V>
+	void visit(V &v) const
+	{
+		v.template arg<A, typename base_type<A>::type>(a);
+		v.template arg<B, typename base_type<B>::type>(b);
+		v.template arg<C, typename base_type<C>::type>(c);
+		v.template arg<D, typename base_type<D>::type>(d);
+		v.template arg<E, typename base_type<E>::type>(e);
+		v.template arg<F, typename base_type<F>::type>(f);
+		v.template arg<G, typename base_type<G>::type>(g);
+		v.template arg<H, typename base_type<H>::type>(h);
+		v.template arg<I, typename base_type<I>::type>(i);
+		v.template arg<J, typename base_type<J>::type>(j);
+		v.template arg<K, typename base_type<K>::type>(k);
+	}
+	virtual void printTo(std::ostream &os) const
 	{
-		std::stringstream text;
-		text << "Function with expectation not called!" << std::endl;
-		text << *repo;
-		txt = text.str();
+	  os << "(";
+	  printArg<A>::print(os, a, false);
+	  printArg<B>::print(os, b, true);
+	  printArg<C>::print(os, c, true);
+	  printArg<D>::print(os, d, true);
+	  printArg<E>::print(os, e, true);
+	  printArg<F>::print(os, f, true);
+	  printArg<G>::print(os, g, true);
+	  printArg<H>::print(os, h, true);
+	  printArg<I>::print(os, i, true);
+	  printArg<J>::print(os, j, true);
+	  printArg<K>::print(os, k, true);
+	  os << ")";
 	}
+#ifdef HM_CALL_TRACE
+	virtual void traceTo(CallTraceWriter &out) const
+	{
+	  out.put((unsigned char)11);
+	  traceArg<A>::write(out, a);
+	  traceArg<B>::write(out, b);
+	  traceArg<C>::write(out, c);
+	  traceArg<D>::write(out, d);
+	  traceArg<E>::write(out, e);
+	  traceArg<F>::write(out, f);
+	  traceArg<G>::write(out, g);
+	  traceArg<H>::write(out, h);
+	  traceArg<I>::write(out, i);
+	  traceArg<J>::write(out, j);
+	  traceArg<K>::write(out, k);
+	}
+#endif
 };
 
-class ZombieMockException : public BaseException {
+template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J>
+class ref_tuple<A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> : public base_tuple
+{
 public:
-	ZombieMockException(MockRepository *repo)
-	{
-		std::stringstream text;
-		text << "Function called on mock that has already been destroyed!" << std::endl;
-		text << *repo;
-
-#ifdef LINUX_TARGET
-	void* stacktrace[256];
-	size_t size = backtrace( stacktrace, sizeof(stacktrace) );
-	if( size > 0 )
+	A a;
+	B b;
+	C c;
+	D d;
+	E e;
+	F f;
+	G g;
+	H h;
+	I i;
+	J j;
+	ref_tuple(A valueA = A(), B valueB = B(), C valueC = C(), D valueD = D(), E valueE = E(), F valueF = F(), G valueG = G(), H valueH = H(), I valueI = I(), J valueJ = J())
+		  : a(valueA), b(valueB), c(valueC), d(valueD), e(valueE), f(valueF), g(valueG), h(valueH), i(valueI), j(valueJ)
+	{}
+	// Room for the arguments packed like the With() values of a copy_tuple, see packed_args.
+	mutable unsigned char bytes[packed_args<A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType>::bufferSize];
+	template <typename V>
+	void visit(V &v) const
+	{
+		v.template arg<A, typename base_type<A>::type>(a);
+		v.template arg<B, typename base_type<B>::type>(b);
+		v.template arg<C, typename base_type<C>::type>(c);
+		v.template arg<D, typename base_type<D>::type>(d);
+		v.template arg<E, typename base_type<E>::type>(e);
+		v.template arg<F, typename base_type<F>::type>(f);
+		v.template arg<G, typename base_type<G>::type>(g);
+		v.template arg<H, typename base_type<H>::type>(h);
+		v.template arg<I, typename base_type<I>::type>(i);
+		v.template arg<J, typename base_type<J>::type>(j);
+	}
+	virtual void printTo(std::ostream &os) const
 	{
-	  text << "Stackdump:" << std::endl;
-	  char **symbols = backtrace_symbols( stacktrace, size );
-	  for( size_t i = 0; i < size; i = i + 1 )
-	  {
-		text << symbols[i] << std::endl;
-	  }
-	  free( symbols );
+	  os << "(";
+	  printArg<A>::print(os, a, false);
+	  printArg<B>::print(os, b, true);
+	  printArg<C>::print(os, c, true);
+	  printArg<D>::print(os, d, true);
+	  printArg<E>::print(os, e, true);
+	  printArg<F>::print(os, f, true);
+	  printArg<G>::print(os, g, true);
+	  printArg<H>::print(os, h, true);
+	  printArg<I>::print(os, i, true);
+	  printArg<J>::print(os, j, true);
+	  os << ")";
+	}
+#ifdef HM_CALL_TRACE
+	virtual void traceTo(CallTraceWriter &out) const
+	{
+	  out.put((unsigned char)10);
+	  traceArg<A>::write(out, a);
+	  traceArg<B>::write(out, b);
+	  traceArg<C>::write(out, c);
+	  traceArg<D>::write(out, d);
+	  traceArg<E>::write(out, e);
+	  traceArg<F>::write(out, f);
+	  traceArg<G>::write(out, g);
+	  traceArg<H>::write(out, h);
+	  traceArg<I>::write(out, i);
+	  traceArg<J>::write(out, j);
 	}
 #endif
+};
 
-		txt = text.str();
+template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I>
+class ref_tuple<A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public base_tuple
+{
+public:
+	A a;
+	B b;
+	C c;
+	D d;
+	E e;
+	F f;
+	G g;
+	H h;
+	I i;
+	ref_tuple(A valueA = A(), B valueB = B(), C valueC = C(), D valueD = D(), E valueE = E(), F valueF = F(), G valueG = G(), H valueH = H(), I valueI = I())
+		  : a(valueA), b(valueB), c(valueC), d(valueD), e(valueE), f(valueF), g(valueG), h(valueH), i(valueI)
+	{}
+	// Room for the arguments packed like the With() values of a copy_tuple, see packed_args.
+	mutable unsigned char bytes[packed_args<A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType>::bufferSize];
+	template <typename V>
+	void visit(V &v) const
+	{
+		v.template arg<A, typename base_type<A>::type>(a);
+		v.template arg<B, typename base_type<B>::type>(b);
+		v.template arg<C, typename base_type<C>::type>(c);
+		v.template arg<D, typename base_type<D>::type>(d);
+		v.template arg<E, typename base_type<E>::type>(e);
+		v.template arg<F, typename base_type<F>::type>(f);
+		v.template arg<G, typename base_type<G>::type>(g);
+		v.template arg<H, typename base_type<H>::type>(h);
+		v.template arg<I, typename base_type<I>::type>(i);
+	}
+	virtual void printTo(std::ostream &os) const
+	{
+	  os << "(";
+	  printArg<A>::print(os, a, false);
+	  printArg<B>::print(os, b, true);
+	  printArg<C>::print(os, c, true);
+	  printArg<D>::print(os, d, true);
+	  printArg<E>::print(os, e, true);
+	  printArg<F>::print(os, f, true);
+	  printArg<G>::print(os, g, true);
+	  printArg<H>::print(os, h, true);
+	  printArg<I>::print(os, i, true);
+	  os << ")";
+	}
+#ifdef HM_CALL_TRACE
+	virtual void traceTo(CallTraceWriter &out) const
+	{
+	  out.put((unsigned char)9);
+	  traceArg<A>::write(out, a);
+	  traceArg<B>::write(out, b);
+	  traceArg<C>::write(out, c);
+	  traceArg<D>::write(out, d);
+	  traceArg<E>::write(out, e);
+	  traceArg<F>::write(out, f);
+	  traceArg<G>::write(out, g);
+	  traceArg<H>::write(out, h);
+	  traceArg<I>::write(out, i);
 	}
+#endif
 };
 
-class NoResultSetUpException : public BaseException {
+template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H>
+class ref_tuple<A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public base_tuple
+{
 public:
-	NoResultSetUpException(MockRepository *repo, const base_tuple *tuple, const char *funcName)
+	A a;
+	B b;
+	C c;
+	D d;
+	E e;
+	F f;
+	G g;
+	H h;
+	ref_tuple(A valueA = A(), B valueB = B(), C valueC = C(), D valueD = D(), E valueE = E(), F valueF = F(), G valueG = G(), H valueH = H())
+		  : a(valueA), b(valueB), c(valueC), d(valueD), e(valueE), f(valueF), g(valueG), h(valueH)
+	{}
+	// Room for the arguments packed like the With() values of a copy_tuple, see packed_args.
+	mutable unsigned char bytes[packed_args<A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>::bufferSize];
+	template <typename V>
+	void visit(V &v) const
+	{
+		v.template arg<A, typename base_type<A>::type>(a);
+		v.template arg<B, typename base_type<B>::type>(b);
+		v.template arg<C, typename base_type<C>::type>(c);
+		v.template arg<D, typename base_type<D>::type>(d);
+		v.template arg<E, typename base_type<E>::type>(e);
+		v.template arg<F, typename base_type<F>::type>(f);
+		v.template arg<G, typename base_type<G>::type>(g);
+		v.template arg<H, typename base_type<H>::type>(h);
+	}
+	virtual void printTo(std::ostream &os) const
 	{
-		std::stringstream text;
-		text << "No result set up on call to ";
-		text << funcName;
-		if (tuple)
-			tuple->printTo(text);
-		else
-			text << "(...)";
-		text << std::endl;
-		text << *repo;
+	  os << "(";
+	  printArg<A>::print(os, a, false);
+	  printArg<B>::print(os, b, true);
+	  printArg<C>::print(os, c, true);
+	  printArg<D>::print(os, d, true);
+	  printArg<E>::print(os, e, true);
+	  printArg<F>::print(os, f, true);
+	  printArg<G>::print(os, g, true);
+	  printArg<H>::print(os, h, true);
+	  os << ")";
+	}
+#ifdef HM_CALL_TRACE
+	virtual void traceTo(CallTraceWriter &out) const
+	{
+	  out.put((unsigned char)8);
+	  traceArg<A>::write(out, a);
+	  traceArg<B>::write(out, b);
+	  traceArg<C>::write(out, c);
+	  traceArg<D>::write(out, d);
+	  traceArg<E>::write(out, e);
+	  traceArg<F>::write(out, f);
+	  traceArg<G>::write(out, g);
+	  traceArg<H>::write(out, h);
+	}
+#endif
+};
 
-#ifdef LINUX_TARGET
-	void* stacktrace[256];
-	size_t size = backtrace( stacktrace, sizeof(stacktrace) );
-	if( size > 0 )
+template <typename A, typename B, typename C, typename D, typename E, typename F, typename G>
+class ref_tuple<A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public base_tuple
+{
+public:
+	A a;
+	B b;
+	C c;
+	D d;
+	E e;
+	F f;
+	G g;
+	ref_tuple(A valueA = A(), B valueB = B(), C valueC = C(), D valueD = D(), E valueE = E(), F valueF = F(), G valueG = G())
+		  : a(valueA), b(valueB), c(valueC), d(valueD), e(valueE), f(valueF), g(valueG)
+	{}
+	// Room for the arguments packed like the With() values of a copy_tuple, see packed_args.
+	mutable unsigned char bytes[packed_args<A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>::bufferSize];
+	template <typename V>
+	void visit(V &v) const
+	{
+		v.template arg<A, typename base_type<A>::type>(a);
+		v.template arg<B, typename base_type<B>::type>(b);
+		v.template arg<C, typename base_type<C>::type>(c);
+		v.template arg<D, typename base_type<D>::type>(d);
+		v.template arg<E, typename base_type<E>::type>(e);
+		v.template arg<F, typename base_type<F>::type>(f);
+		v.template arg<G, typename base_type<G>::type>(g);
+	}
+	virtual void printTo(std::ostream &os) const
 	{
-	  text << "Stackdump:" << std::endl;
-	  char **symbols = backtrace_symbols( stacktrace, size );
-	  for( size_t i = 0; i < size; i = i + 1 )
-	  {
-		text << symbols[i] << std::endl;
-	  }
-	  free( symbols );
+	  os << "(";
+	  printArg<A>::print(os, a, false);
+	  printArg<B>::print(os, b, true);
+	  printArg<C>::print(os, c, true);
+	  printArg<D>::print(os, d, true);
+	  printArg<E>::print(os, e, true);
+	  printArg<F>::print(os, f, true);
+	  printArg<G>::print(os, g, true);
+	  os << ")";
+	}
+#ifdef HM_CALL_TRACE
+	virtual void traceTo(CallTraceWriter &out) const
+	{
+	  out.put((unsigned char)7);
+	  traceArg<A>::write(out, a);
+	  traceArg<B>::write(out, b);
+	  traceArg<C>::write(out, c);
+	  traceArg<D>::write(out, d);
+	  traceArg<E>::write(out, e);
+	  traceArg<F>::write(out, f);
+	  traceArg<G>::write(out, g);
 	}
 #endif
+};
 
-		txt = text.str();
+template <typename A, typename B, typename C, typename D, typename E, typename F>
+class ref_tuple<A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public base_tuple
+{
+public:
+	A a;
+	B b;
+	C c;
+	D d;
+	E e;
+	F f;
+	ref_tuple(A valueA = A(), B valueB = B(), C valueC = C(), D valueD = D(), E valueE = E(), F valueF = F())
+		  : a(valueA), b(valueB), c(valueC), d(valueD), e(valueE), f(valueF)
+	{}
+	// Room for the arguments packed like the With() values of a copy_tuple, see packed_args.
+	mutable unsigned char bytes[packed_args<A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>::bufferSize];
+	template <typename V>
+	void visit(V &v) const
+	{
+		v.template arg<A, typename base_type<A>::type>(a);
+		v.template arg<B, typename base_type<B>::type>(b);
+		v.template arg<C, typename base_type<C>::type>(c);
+		v.template arg<D, typename base_type<D>::type>(d);
+		v.template arg<E, typename base_type<E>::type>(e);
+		v.template arg<F, typename base_type<F>::type>(f);
+	}
+	virtual void printTo(std::ostream &os) const
+	{
+	  os << "(";
+	  printArg<A>::print(os, a, false);
+	  printArg<B>::print(os, b, true);
+	  printArg<C>::print(os, c, true);
+	  printArg<D>::print(os, d, true);
+	  printArg<E>::print(os, e, true);
+	  printArg<F>::print(os, f, true);
+	  os << ")";
+	}
+#ifdef HM_CALL_TRACE
+	virtual void traceTo(CallTraceWriter &out) const
+	{
+	  out.put((unsigned char)6);
+	  traceArg<A>::write(out, a);
+	  traceArg<B>::write(out, b);
+	  traceArg<C>::write(out, c);
+	  traceArg<D>::write(out, d);
+	  traceArg<E>::write(out, e);
+	  traceArg<F>::write(out, f);
 	}
+#endif
 };
 
-// function-index-of-type
-class func_index {
+template <typename A, typename B, typename C, typename D, typename E>
+class ref_tuple<A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public base_tuple
+{
 public:
-	int lci;
-	virtual int f0(int) { return lci=0; }			virtual int f1(int) { return lci=1; }			virtual int f2(int) { return lci=2; }			virtual int f3(int) { return lci=3; }
-	virtual int f4(int) { return lci=4; }			virtual int f5(int) { return lci=5; }			virtual int f6(int) { return lci=6; }			virtual int f7(int) { return lci=7; }
-	virtual int f8(int) { return lci=8; }			virtual int f9(int) { return lci=9; }			virtual int f10(int) { return lci=10; }		virtual int f11(int) { return lci=11; }
-	virtual int f12(int) { return lci=12; }		virtual int f13(int) { return lci=13; }		virtual int f14(int) { return lci=14; }		virtual int f15(int) { return lci=15; }
-	virtual int f16(int) { return lci=16; }		virtual int f17(int) { return lci=17; }		virtual int f18(int) { return lci=18; }		virtual int f19(int) { return lci=19; }
-	virtual int f20(int) { return lci=20; }		virtual int f21(int) { return lci=21; }		virtual int f22(int) { return lci=22; }		virtual int f23(int) { return lci=23; }
-	virtual int f24(int) { return lci=24; }		virtual int f25(int) { return lci=25; }		virtual int f26(int) { return lci=26; }		virtual int f27(int) { return lci=27; }
-	virtual int f28(int) { return lci=28; }		virtual int f29(int) { return lci=29; }		virtual int f30(int) { return lci=30; }		virtual int f31(int) { return lci=31; }
-	virtual int f32(int) { return lci=32; }		virtual int f33(int) { return lci=33; }		virtual int f34(int) { return lci=34; }		virtual int f35(int) { return lci=35; }
-	virtual int f36(int) { return lci=36; }		virtual int f37(int) { return lci=37; }		virtual int f38(int) { return lci=38; }		virtual int f39(int) { return lci=39; }
-	virtual int f40(int) { return lci=40; }		virtual int f41(int) { return lci=41; }		virtual int f42(int) { return lci=42; }		virtual int f43(int) { return lci=43; }
-	virtual int f44(int) { return lci=44; }		virtual int f45(int) { return lci=45; }		virtual int f46(int) { return lci=46; }		virtual int f47(int) { return lci=47; }
-	virtual int f48(int) { return lci=48; }		virtual int f49(int) { return lci=49; }		virtual int f50(int) { return lci=50; }		virtual int f51(int) { return lci=51; }
-	virtual int f52(int) { return lci=52; }		virtual int f53(int) { return lci=53; }		virtual int f54(int) { return lci=54; }		virtual int f55(int) { return lci=55; }
-	virtual int f56(int) { return lci=56; }		virtual int f57(int) { return lci=57; }		virtual int f58(int) { return lci=58; }		virtual int f59(int) { return lci=59; }
-	virtual int f60(int) { return lci=60; }		virtual int f61(int) { return lci=61; }		virtual int f62(int) { return lci=62; }		virtual int f63(int) { return lci=63; }
-	virtual int f64(int) { return lci=64; }		virtual int f65(int) { return lci=65; }		virtual int f66(int) { return lci=66; }		virtual int f67(int) { return lci=67; }
-	virtual int f68(int) { return lci=68; }		virtual int f69(int) { return lci=69; }		virtual int f70(int) { return lci=70; }		virtual int f71(int) { return lci=71; }
-	virtual int f72(int) { return lci=72; }		virtual int f73(int) { return lci=73; }		virtual int f74(int) { return lci=74; }		virtual int f75(int) { return lci=75; }
-	virtual int f76(int) { return lci=76; }		virtual int f77(int) { return lci=77; }		virtual int f78(int) { return lci=78; }		virtual int f79(int) { return lci=79; }
-	virtual int f80(int) { return lci=80; }		virtual int f81(int) { return lci=81; }		virtual int f82(int) { return lci=82; }		virtual int f83(int) { return lci=83; }
-	virtual int f84(int) { return lci=84; }		virtual int f85(int) { return lci=85; }		virtual int f86(int) { return lci=86; }		virtual int f87(int) { return lci=87; }
-	virtual int f88(int) { return lci=88; }		virtual int f89(int) { return lci=89; }		virtual int f90(int) { return lci=90; }		virtual int f91(int) { return lci=91; }
-	virtual int f92(int) { return lci=92; }		virtual int f93(int) { return lci=93; }		virtual int f94(int) { return lci=94; }		virtual int f95(int) { return lci=95; }
-	virtual int f96(int) { return lci=96; }		virtual int f97(int) { return lci=97; }		virtual int f98(int) { return lci=98; }		virtual int f99(int) { return lci=99; }
-	virtual int f100(int) { return lci=100; }		virtual int f101(int) { return lci=101; }		virtual int f102(int) { return lci=102; }		virtual int f103(int) { return lci=103; }
-	virtual int f104(int) { return lci=104; }		virtual int f105(int) { return lci=105; }		virtual int f106(int) { return lci=106; }		virtual int f107(int) { return lci=107; }
-	virtual int f108(int) { return lci=108; }		virtual int f109(int) { return lci=109; }		virtual int f110(int) { return lci=110; }		virtual int f111(int) { return lci=111; }
-	virtual int f112(int) { return lci=112; }		virtual int f113(int) { return lci=113; }		virtual int f114(int) { return lci=114; }		virtual int f115(int) { return lci=115; }
-	virtual int f116(int) { return lci=116; }		virtual int f117(int) { return lci=117; }		virtual int f118(int) { return lci=118; }		virtual int f119(int) { return lci=119; }
-	virtual int f120(int) { return lci=120; }		virtual int f121(int) { return lci=121; }		virtual int f122(int) { return lci=122; }		virtual int f123(int) { return lci=123; }
-	virtual int f124(int) { return lci=124; }		virtual int f125(int) { return lci=125; }		virtual int f126(int) { return lci=126; }		virtual int f127(int) { return lci=127; }
-	virtual int f128(int) { return lci=128; }		virtual int f129(int) { return lci=129; }		virtual int f130(int) { return lci=130; }		virtual int f131(int) { return lci=131; }
-	virtual int f132(int) { return lci=132; }		virtual int f133(int) { return lci=133; }		virtual int f134(int) { return lci=134; }		virtual int f135(int) { return lci=135; }
-	virtual int f136(int) { return lci=136; }		virtual int f137(int) { return lci=137; }		virtual int f138(int) { return lci=138; }		virtual int f139(int) { return lci=139; }
-	virtual int f140(int) { return lci=140; }		virtual int f141(int) { return lci=141; }		virtual int f142(int) { return lci=142; }		virtual int f143(int) { return lci=143; }
-	virtual int f144(int) { return lci=144; }		virtual int f145(int) { return lci=145; }		virtual int f146(int) { return lci=146; }		virtual int f147(int) { return lci=147; }
-	virtual int f148(int) { return lci=148; }		virtual int f149(int) { return lci=149; }		virtual int f150(int) { return lci=150; }		virtual int f151(int) { return lci=151; }
-	virtual int f152(int) { return lci=152; }		virtual int f153(int) { return lci=153; }		virtual int f154(int) { return lci=154; }		virtual int f155(int) { return lci=155; }
-	virtual int f156(int) { return lci=156; }		virtual int f157(int) { return lci=157; }		virtual int f158(int) { return lci=158; }		virtual int f159(int) { return lci=159; }
-	virtual int f160(int) { return lci=160; }		virtual int f161(int) { return lci=161; }		virtual int f162(int) { return lci=162; }		virtual int f163(int) { return lci=163; }
-	virtual int f164(int) { return lci=164; }		virtual int f165(int) { return lci=165; }		virtual int f166(int) { return lci=166; }		virtual int f167(int) { return lci=167; }
-	virtual int f168(int) { return lci=168; }		virtual int f169(int) { return lci=169; }		virtual int f170(int) { return lci=170; }		virtual int f171(int) { return lci=171; }
-	virtual int f172(int) { return lci=172; }		virtual int f173(int) { return lci=173; }		virtual int f174(int) { return lci=174; }		virtual int f175(int) { return lci=175; }
-	virtual int f176(int) { return lci=176; }		virtual int f177(int) { return lci=177; }		virtual int f178(int) { return lci=178; }		virtual int f179(int) { return lci=179; }
-	virtual int f180(int) { return lci=180; }		virtual int f181(int) { return lci=181; }		virtual int f182(int) { return lci=182; }		virtual int f183(int) { return lci=183; }
-	virtual int f184(int) { return lci=184; }		virtual int f185(int) { return lci=185; }		virtual int f186(int) { return lci=186; }		virtual int f187(int) { return lci=187; }
-	virtual int f188(int) { return lci=188; }		virtual int f189(int) { return lci=189; }		virtual int f190(int) { return lci=190; }		virtual int f191(int) { return lci=191; }
-	virtual int f192(int) { return lci=192; }		virtual int f193(int) { return lci=193; }		virtual int f194(int) { return lci=194; }		virtual int f195(int) { return lci=195; }
-	virtual int f196(int) { return lci=196; }		virtual int f197(int) { return lci=197; }		virtual int f198(int) { return lci=198; }		virtual int f199(int) { return lci=199; }
-	virtual int f200(int) { return lci=200; }		virtual int f201(int) { return lci=201; }		virtual int f202(int) { return lci=202; }		virtual int f203(int) { return lci=203; }
-	virtual int f204(int) { return lci=204; }		virtual int f205(int) { return lci=205; }		virtual int f206(int) { return lci=206; }		virtual int f207(int) { return lci=207; }
-	virtual int f208(int) { return lci=208; }		virtual int f209(int) { return lci=209; }		virtual int f210(int) { return lci=210; }		virtual int f211(int) { return lci=211; }
-	virtual int f212(int) { return lci=212; }		virtual int f213(int) { return lci=213; }		virtual int f214(int) { return lci=214; }		virtual int f215(int) { return lci=215; }
-	virtual int f216(int) { return lci=216; }		virtual int f217(int) { return lci=217; }		virtual int f218(int) { return lci=218; }		virtual int f219(int) { return lci=219; }
-	virtual int f220(int) { return lci=220; }		virtual int f221(int) { return lci=221; }		virtual int f222(int) { return lci=222; }		virtual int f223(int) { return lci=223; }
-	virtual int f224(int) { return lci=224; }		virtual int f225(int) { return lci=225; }		virtual int f226(int) { return lci=226; }		virtual int f227(int) { return lci=227; }
-	virtual int f228(int) { return lci=228; }		virtual int f229(int) { return lci=229; }		virtual int f230(int) { return lci=230; }		virtual int f231(int) { return lci=231; }
-	virtual int f232(int) { return lci=232; }		virtual int f233(int) { return lci=233; }		virtual int f234(int) { return lci=234; }		virtual int f235(int) { return lci=235; }
-	virtual int f236(int) { return lci=236; }		virtual int f237(int) { return lci=237; }		virtual int f238(int) { return lci=238; }		virtual int f239(int) { return lci=239; }
-	virtual int f240(int) { return lci=240; }		virtual int f241(int) { return lci=241; }		virtual int f242(int) { return lci=242; }		virtual int f243(int) { return lci=243; }
-	virtual int f244(int) { return lci=244; }		virtual int f245(int) { return lci=245; }		virtual int f246(int) { return lci=246; }		virtual int f247(int) { return lci=247; }
-	virtual int f248(int) { return lci=248; }		virtual int f249(int) { return lci=249; }		virtual int f250(int) { return lci=250; }		virtual int f251(int) { return lci=251; }
-	virtual int f252(int) { return lci=252; }		virtual int f253(int) { return lci=253; }		virtual int f254(int) { return lci=254; }		virtual int f255(int) { return lci=255; }
-	virtual int f256(int) { return lci=256; }		virtual int f257(int) { return lci=257; }		virtual int f258(int) { return lci=258; }		virtual int f259(int) { return lci=259; }
-	virtual int f260(int) { return lci=260; }		virtual int f261(int) { return lci=261; }		virtual int f262(int) { return lci=262; }		virtual int f263(int) { return lci=263; }
-	virtual int f264(int) { return lci=264; }		virtual int f265(int) { return lci=265; }		virtual int f266(int) { return lci=266; }		virtual int f267(int) { return lci=267; }
-	virtual int f268(int) { return lci=268; }		virtual int f269(int) { return lci=269; }		virtual int f270(int) { return lci=270; }		virtual int f271(int) { return lci=271; }
-	virtual int f272(int) { return lci=272; }		virtual int f273(int) { return lci=273; }		virtual int f274(int) { return lci=274; }		virtual int f275(int) { return lci=275; }
-	virtual int f276(int) { return lci=276; }		virtual int f277(int) { return lci=277; }		virtual int f278(int) { return lci=278; }		virtual int f279(int) { return lci=279; }
-	virtual int f280(int) { return lci=280; }		virtual int f281(int) { return lci=281; }		virtual int f282(int) { return lci=282; }		virtual int f283(int) { return lci=283; }
-	virtual int f284(int) { return lci=284; }		virtual int f285(int) { return lci=285; }		virtual int f286(int) { return lci=286; }		virtual int f287(int) { return lci=287; }
-	virtual int f288(int) { return lci=288; }		virtual int f289(int) { return lci=289; }		virtual int f290(int) { return lci=290; }		virtual int f291(int) { return lci=291; }
-	virtual int f292(int) { return lci=292; }		virtual int f293(int) { return lci=293; }		virtual int f294(int) { return lci=294; }		virtual int f295(int) { return lci=295; }
-	virtual int f296(int) { return lci=296; }		virtual int f297(int) { return lci=297; }		virtual int f298(int) { return lci=298; }		virtual int f299(int) { return lci=299; }
-	virtual int f300(int) { return lci=300; }		virtual int f301(int) { return lci=301; }		virtual int f302(int) { return lci=302; }		virtual int f303(int) { return lci=303; }
-	virtual int f304(int) { return lci=304; }		virtual int f305(int) { return lci=305; }		virtual int f306(int) { return lci=306; }		virtual int f307(int) { return lci=307; }
-	virtual int f308(int) { return lci=308; }		virtual int f309(int) { return lci=309; }		virtual int f310(int) { return lci=310; }		virtual int f311(int) { return lci=311; }
-	virtual int f312(int) { return lci=312; }		virtual int f313(int) { return lci=313; }		virtual int f314(int) { return lci=314; }		virtual int f315(int) { return lci=315; }
-	virtual int f316(int) { return lci=316; }		virtual int f317(int) { return lci=317; }		virtual int f318(int) { return lci=318; }		virtual int f319(int) { return lci=319; }
-	virtual int f320(int) { return lci=320; }		virtual int f321(int) { return lci=321; }		virtual int f322(int) { return lci=322; }		virtual int f323(int) { return lci=323; }
-	virtual int f324(int) { return lci=324; }		virtual int f325(int) { return lci=325; }		virtual int f326(int) { return lci=326; }		virtual int f327(int) { return lci=327; }
-	virtual int f328(int) { return lci=328; }		virtual int f329(int) { return lci=329; }		virtual int f330(int) { return lci=330; }		virtual int f331(int) { return lci=331; }
-	virtual int f332(int) { return lci=332; }		virtual int f333(int) { return lci=333; }		virtual int f334(int) { return lci=334; }		virtual int f335(int) { return lci=335; }
-	virtual int f336(int) { return lci=336; }		virtual int f337(int) { return lci=337; }		virtual int f338(int) { return lci=338; }		virtual int f339(int) { return lci=339; }
-	virtual int f340(int) { return lci=340; }		virtual int f341(int) { return lci=341; }		virtual int f342(int) { return lci=342; }		virtual int f343(int) { return lci=343; }
-	virtual int f344(int) { return lci=344; }		virtual int f345(int) { return lci=345; }		virtual int f346(int) { return lci=346; }		virtual int f347(int) { return lci=347; }
-	virtual int f348(int) { return lci=348; }		virtual int f349(int) { return lci=349; }		virtual int f350(int) { return lci=350; }		virtual int f351(int) { return lci=351; }
-	virtual int f352(int) { return lci=352; }		virtual int f353(int) { return lci=353; }		virtual int f354(int) { return lci=354; }		virtual int f355(int) { return lci=355; }
-	virtual int f356(int) { return lci=356; }		virtual int f357(int) { return lci=357; }		virtual int f358(int) { return lci=358; }		virtual int f359(int) { return lci=359; }
-	virtual int f360(int) { return lci=360; }		virtual int f361(int) { return lci=361; }		virtual int f362(int) { return lci=362; }		virtual int f363(int) { return lci=363; }
-	virtual int f364(int) { return lci=364; }		virtual int f365(int) { return lci=365; }		virtual int f366(int) { return lci=366; }		virtual int f367(int) { return lci=367; }
-	virtual int f368(int) { return lci=368; }		virtual int f369(int) { return lci=369; }		virtual int f370(int) { return lci=370; }		virtual int f371(int) { return lci=371; }
-	virtual int f372(int) { return lci=372; }		virtual int f373(int) { return lci=373; }		virtual int f374(int) { return lci=374; }		virtual int f375(int) { return lci=375; }
-	virtual int f376(int) { return lci=376; }		virtual int f377(int) { return lci=377; }		virtual int f378(int) { return lci=378; }		virtual int f379(int) { return lci=379; }
-	virtual int f380(int) { return lci=380; }		virtual int f381(int) { return lci=381; }		virtual int f382(int) { return lci=382; }		virtual int f383(int) { return lci=383; }
-	virtual int f384(int) { return lci=384; }		virtual int f385(int) { return lci=385; }		virtual int f386(int) { return lci=386; }		virtual int f387(int) { return lci=387; }
-	virtual int f388(int) { return lci=388; }		virtual int f389(int) { return lci=389; }		virtual int f390(int) { return lci=390; }		virtual int f391(int) { return lci=391; }
-	virtual int f392(int) { return lci=392; }		virtual int f393(int) { return lci=393; }		virtual int f394(int) { return lci=394; }		virtual int f395(int) { return lci=395; }
-	virtual int f396(int) { return lci=396; }		virtual int f397(int) { return lci=397; }		virtual int f398(int) { return lci=398; }		virtual int f399(int) { return lci=399; }
-	virtual int f400(int) { return lci=400; }		virtual int f401(int) { return lci=401; }		virtual int f402(int) { return lci=402; }		virtual int f403(int) { return lci=403; }
-	virtual int f404(int) { return lci=404; }		virtual int f405(int) { return lci=405; }		virtual int f406(int) { return lci=406; }		virtual int f407(int) { return lci=407; }
-	virtual int f408(int) { return lci=408; }		virtual int f409(int) { return lci=409; }		virtual int f410(int) { return lci=410; }		virtual int f411(int) { return lci=411; }
-	virtual int f412(int) { return lci=412; }		virtual int f413(int) { return lci=413; }		virtual int f414(int) { return lci=414; }		virtual int f415(int) { return lci=415; }
-	virtual int f416(int) { return lci=416; }		virtual int f417(int) { return lci=417; }		virtual int f418(int) { return lci=418; }		virtual int f419(int) { return lci=419; }
-	virtual int f420(int) { return lci=420; }		virtual int f421(int) { return lci=421; }		virtual int f422(int) { return lci=422; }		virtual int f423(int) { return lci=423; }
-	virtual int f424(int) { return lci=424; }		virtual int f425(int) { return lci=425; }		virtual int f426(int) { return lci=426; }		virtual int f427(int) { return lci=427; }
-	virtual int f428(int) { return lci=428; }		virtual int f429(int) { return lci=429; }		virtual int f430(int) { return lci=430; }		virtual int f431(int) { return lci=431; }
-	virtual int f432(int) { return lci=432; }		virtual int f433(int) { return lci=433; }		virtual int f434(int) { return lci=434; }		virtual int f435(int) { return lci=435; }
-	virtual int f436(int) { return lci=436; }		virtual int f437(int) { return lci=437; }		virtual int f438(int) { return lci=438; }		virtual int f439(int) { return lci=439; }
-	virtual int f440(int) { return lci=440; }		virtual int f441(int) { return lci=441; }		virtual int f442(int) { return lci=442; }		virtual int f443(int) { return lci=443; }
-	virtual int f444(int) { return lci=444; }		virtual int f445(int) { return lci=445; }		virtual int f446(int) { return lci=446; }		virtual int f447(int) { return lci=447; }
-	virtual int f448(int) { return lci=448; }		virtual int f449(int) { return lci=449; }		virtual int f450(int) { return lci=450; }		virtual int f451(int) { return lci=451; }
-	virtual int f452(int) { return lci=452; }		virtual int f453(int) { return lci=453; }		virtual int f454(int) { return lci=454; }		virtual int f455(int) { return lci=455; }
-	virtual int f456(int) { return lci=456; }		virtual int f457(int) { return lci=457; }		virtual int f458(int) { return lci=458; }		virtual int f459(int) { return lci=459; }
-	virtual int f460(int) { return lci=460; }		virtual int f461(int) { return lci=461; }		virtual int f462(int) { return lci=462; }		virtual int f463(int) { return lci=463; }
-	virtual int f464(int) { return lci=464; }		virtual int f465(int) { return lci=465; }		virtual int f466(int) { return lci=466; }		virtual int f467(int) { return lci=467; }
-	virtual int f468(int) { return lci=468; }		virtual int f469(int) { return lci=469; }		virtual int f470(int) { return lci=470; }		virtual int f471(int) { return lci=471; }
-	virtual int f472(int) { return lci=472; }		virtual int f473(int) { return lci=473; }		virtual int f474(int) { return lci=474; }		virtual int f475(int) { return lci=475; }
-	virtual int f476(int) { return lci=476; }		virtual int f477(int) { return lci=477; }		virtual int f478(int) { return lci=478; }		virtual int f479(int) { return lci=479; }
-	virtual int f480(int) { return lci=480; }		virtual int f481(int) { return lci=481; }		virtual int f482(int) { return lci=482; }		virtual int f483(int) { return lci=483; }
-	virtual int f484(int) { return lci=484; }		virtual int f485(int) { return lci=485; }		virtual int f486(int) { return lci=486; }		virtual int f487(int) { return lci=487; }
-	virtual int f488(int) { return lci=488; }		virtual int f489(int) { return lci=489; }		virtual int f490(int) { return lci=490; }		virtual int f491(int) { return lci=491; }
-	virtual int f492(int) { return lci=492; }		virtual int f493(int) { return lci=493; }		virtual int f494(int) { return lci=494; }		virtual int f495(int) { return lci=495; }
-	virtual int f496(int) { return lci=496; }		virtual int f497(int) { return lci=497; }		virtual int f498(int) { return lci=498; }		virtual int f499(int) { return lci=499; }
-	virtual int f500(int) { return lci=500; }		virtual int f501(int) { return lci=501; }		virtual int f502(int) { return lci=502; }		virtual int f503(int) { return lci=503; }
-	virtual int f504(int) { return lci=504; }		virtual int f505(int) { return lci=505; }		virtual int f506(int) { return lci=506; }		virtual int f507(int) { return lci=507; }
-	virtual int f508(int) { return lci=508; }		virtual int f509(int) { return lci=509; }		virtual int f510(int) { return lci=510; }		virtual int f511(int) { return lci=511; }
-	virtual int f512(int) { return lci=512; }		virtual int f513(int) { return lci=513; }		virtual int f514(int) { return lci=514; }		virtual int f515(int) { return lci=515; }
-	virtual int f516(int) { return lci=516; }		virtual int f517(int) { return lci=517; }		virtual int f518(int) { return lci=518; }		virtual int f519(int) { return lci=519; }
-	virtual int f520(int) { return lci=520; }		virtual int f521(int) { return lci=521; }		virtual int f522(int) { return lci=522; }		virtual int f523(int) { return lci=523; }
-	virtual int f524(int) { return lci=524; }		virtual int f525(int) { return lci=525; }		virtual int f526(int) { return lci=526; }		virtual int f527(int) { return lci=527; }
-	virtual int f528(int) { return lci=528; }		virtual int f529(int) { return lci=529; }		virtual int f530(int) { return lci=530; }		virtual int f531(int) { return lci=531; }
-	virtual int f532(int) { return lci=532; }		virtual int f533(int) { return lci=533; }		virtual int f534(int) { return lci=534; }		virtual int f535(int) { return lci=535; }
-	virtual int f536(int) { return lci=536; }		virtual int f537(int) { return lci=537; }		virtual int f538(int) { return lci=538; }		virtual int f539(int) { return lci=539; }
-	virtual int f540(int) { return lci=540; }		virtual int f541(int) { return lci=541; }		virtual int f542(int) { return lci=542; }		virtual int f543(int) { return lci=543; }
-	virtual int f544(int) { return lci=544; }		virtual int f545(int) { return lci=545; }		virtual int f546(int) { return lci=546; }		virtual int f547(int) { return lci=547; }
-	virtual int f548(int) { return lci=548; }		virtual int f549(int) { return lci=549; }		virtual int f550(int) { return lci=550; }		virtual int f551(int) { return lci=551; }
-	virtual int f552(int) { return lci=552; }		virtual int f553(int) { return lci=553; }		virtual int f554(int) { return lci=554; }		virtual int f555(int) { return lci=555; }
-	virtual int f556(int) { return lci=556; }		virtual int f557(int) { return lci=557; }		virtual int f558(int) { return lci=558; }		virtual int f559(int) { return lci=559; }
-	virtual int f560(int) { return lci=560; }		virtual int f561(int) { return lci=561; }		virtual int f562(int) { return lci=562; }		virtual int f563(int) { return lci=563; }
-	virtual int f564(int) { return lci=564; }		virtual int f565(int) { return lci=565; }		virtual int f566(int) { return lci=566; }		virtual int f567(int) { return lci=567; }
-	virtual int f568(int) { return lci=568; }		virtual int f569(int) { return lci=569; }		virtual int f570(int) { return lci=570; }		virtual int f571(int) { return lci=571; }
-	virtual int f572(int) { return lci=572; }		virtual int f573(int) { return lci=573; }		virtual int f574(int) { return lci=574; }		virtual int f575(int) { return lci=575; }
-	virtual int f576(int) { return lci=576; }		virtual int f577(int) { return lci=577; }		virtual int f578(int) { return lci=578; }		virtual int f579(int) { return lci=579; }
-	virtual int f580(int) { return lci=580; }		virtual int f581(int) { return lci=581; }		virtual int f582(int) { return lci=582; }		virtual int f583(int) { return lci=583; }
-	virtual int f584(int) { return lci=584; }		virtual int f585(int) { return lci=585; }		virtual int f586(int) { return lci=586; }		virtual int f587(int) { return lci=587; }
-	virtual int f588(int) { return lci=588; }		virtual int f589(int) { return lci=589; }		virtual int f590(int) { return lci=590; }		virtual int f591(int) { return lci=591; }
-	virtual int f592(int) { return lci=592; }		virtual int f593(int) { return lci=593; }		virtual int f594(int) { return lci=594; }		virtual int f595(int) { return lci=595; }
-	virtual int f596(int) { return lci=596; }		virtual int f597(int) { return lci=597; }		virtual int f598(int) { return lci=598; }		virtual int f599(int) { return lci=599; }
-	virtual int f600(int) { return lci=600; }		virtual int f601(int) { return lci=601; }		virtual int f602(int) { return lci=602; }		virtual int f603(int) { return lci=603; }
-	virtual int f604(int) { return lci=604; }		virtual int f605(int) { return lci=605; }		virtual int f606(int) { return lci=606; }		virtual int f607(int) { return lci=607; }
-	virtual int f608(int) { return lci=608; }		virtual int f609(int) { return lci=609; }		virtual int f610(int) { return lci=610; }		virtual int f611(int) { return lci=611; }
-	virtual int f612(int) { return lci=612; }		virtual int f613(int) { return lci=613; }		virtual int f614(int) { return lci=614; }		virtual int f615(int) { return lci=615; }
-	virtual int f616(int) { return lci=616; }		virtual int f617(int) { return lci=617; }		virtual int f618(int) { return lci=618; }		virtual int f619(int) { return lci=619; }
-	virtual int f620(int) { return lci=620; }		virtual int f621(int) { return lci=621; }		virtual int f622(int) { return lci=622; }		virtual int f623(int) { return lci=623; }
-	virtual int f624(int) { return lci=624; }		virtual int f625(int) { return lci=625; }		virtual int f626(int) { return lci=626; }		virtual int f627(int) { return lci=627; }
-	virtual int f628(int) { return lci=628; }		virtual int f629(int) { return lci=629; }		virtual int f630(int) { return lci=630; }		virtual int f631(int) { return lci=631; }
-	virtual int f632(int) { return lci=632; }		virtual int f633(int) { return lci=633; }		virtual int f634(int) { return lci=634; }		virtual int f635(int) { return lci=635; }
-	virtual int f636(int) { return lci=636; }		virtual int f637(int) { return lci=637; }		virtual int f638(int) { return lci=638; }		virtual int f639(int) { return lci=639; }
-	virtual int f640(int) { return lci=640; }		virtual int f641(int) { return lci=641; }		virtual int f642(int) { return lci=642; }		virtual int f643(int) { return lci=643; }
-	virtual int f644(int) { return lci=644; }		virtual int f645(int) { return lci=645; }		virtual int f646(int) { return lci=646; }		virtual int f647(int) { return lci=647; }
-	virtual int f648(int) { return lci=648; }		virtual int f649(int) { return lci=649; }		virtual int f650(int) { return lci=650; }		virtual int f651(int) { return lci=651; }
-	virtual int f652(int) { return lci=652; }		virtual int f653(int) { return lci=653; }		virtual int f654(int) { return lci=654; }		virtual int f655(int) { return lci=655; }
-	virtual int f656(int) { return lci=656; }		virtual int f657(int) { return lci=657; }		virtual int f658(int) { return lci=658; }		virtual int f659(int) { return lci=659; }
-	virtual int f660(int) { return lci=660; }		virtual int f661(int) { return lci=661; }		virtual int f662(int) { return lci=662; }		virtual int f663(int) { return lci=663; }
-	virtual int f664(int) { return lci=664; }		virtual int f665(int) { return lci=665; }		virtual int f666(int) { return lci=666; }		virtual int f667(int) { return lci=667; }
-	virtual int f668(int) { return lci=668; }		virtual int f669(int) { return lci=669; }		virtual int f670(int) { return lci=670; }		virtual int f671(int) { return lci=671; }
-	virtual int f672(int) { return lci=672; }		virtual int f673(int) { return lci=673; }		virtual int f674(int) { return lci=674; }		virtual int f675(int) { return lci=675; }
-	virtual int f676(int) { return lci=676; }		virtual int f677(int) { return lci=677; }		virtual int f678(int) { return lci=678; }		virtual int f679(int) { return lci=679; }
-	virtual int f680(int) { return lci=680; }		virtual int f681(int) { return lci=681; }		virtual int f682(int) { return lci=682; }		virtual int f683(int) { return lci=683; }
-	virtual int f684(int) { return lci=684; }		virtual int f685(int) { return lci=685; }		virtual int f686(int) { return lci=686; }		virtual int f687(int) { return lci=687; }
-	virtual int f688(int) { return lci=688; }		virtual int f689(int) { return lci=689; }		virtual int f690(int) { return lci=690; }		virtual int f691(int) { return lci=691; }
-	virtual int f692(int) { return lci=692; }		virtual int f693(int) { return lci=693; }		virtual int f694(int) { return lci=694; }		virtual int f695(int) { return lci=695; }
-	virtual int f696(int) { return lci=696; }		virtual int f697(int) { return lci=697; }		virtual int f698(int) { return lci=698; }		virtual int f699(int) { return lci=699; }
-	virtual int f700(int) { return lci=700; }		virtual int f701(int) { return lci=701; }		virtual int f702(int) { return lci=702; }		virtual int f703(int) { return lci=703; }
-	virtual int f704(int) { return lci=704; }		virtual int f705(int) { return lci=705; }		virtual int f706(int) { return lci=706; }		virtual int f707(int) { return lci=707; }
-	virtual int f708(int) { return lci=708; }		virtual int f709(int) { return lci=709; }		virtual int f710(int) { return lci=710; }		virtual int f711(int) { return lci=711; }
-	virtual int f712(int) { return lci=712; }		virtual int f713(int) { return lci=713; }		virtual int f714(int) { return lci=714; }		virtual int f715(int) { return lci=715; }
-	virtual int f716(int) { return lci=716; }		virtual int f717(int) { return lci=717; }		virtual int f718(int) { return lci=718; }		virtual int f719(int) { return lci=719; }
-	virtual int f720(int) { return lci=720; }		virtual int f721(int) { return lci=721; }		virtual int f722(int) { return lci=722; }		virtual int f723(int) { return lci=723; }
-	virtual int f724(int) { return lci=724; }		virtual int f725(int) { return lci=725; }		virtual int f726(int) { return lci=726; }		virtual int f727(int) { return lci=727; }
-	virtual int f728(int) { return lci=728; }		virtual int f729(int) { return lci=729; }		virtual int f730(int) { return lci=730; }		virtual int f731(int) { return lci=731; }
-	virtual int f732(int) { return lci=732; }		virtual int f733(int) { return lci=733; }		virtual int f734(int) { return lci=734; }		virtual int f735(int) { return lci=735; }
-	virtual int f736(int) { return lci=736; }		virtual int f737(int) { return lci=737; }		virtual int f738(int) { return lci=738; }		virtual int f739(int) { return lci=739; }
-	virtual int f740(int) { return lci=740; }		virtual int f741(int) { return lci=741; }		virtual int f742(int) { return lci=742; }		virtual int f743(int) { return lci=743; }
-	virtual int f744(int) { return lci=744; }		virtual int f745(int) { return lci=745; }		virtual int f746(int) { return lci=746; }		virtual int f747(int) { return lci=747; }
-	virtual int f748(int) { return lci=748; }		virtual int f749(int) { return lci=749; }		virtual int f750(int) { return lci=750; }		virtual int f751(int) { return lci=751; }
-	virtual int f752(int) { return lci=752; }		virtual int f753(int) { return lci=753; }		virtual int f754(int) { return lci=754; }		virtual int f755(int) { return lci=755; }
-	virtual int f756(int) { return lci=756; }		virtual int f757(int) { return lci=757; }		virtual int f758(int) { return lci=758; }		virtual int f759(int) { return lci=759; }
-	virtual int f760(int) { return lci=760; }		virtual int f761(int) { return lci=761; }		virtual int f762(int) { return lci=762; }		virtual int f763(int) { return lci=763; }
-	virtual int f764(int) { return lci=764; }		virtual int f765(int) { return lci=765; }		virtual int f766(int) { return lci=766; }		virtual int f767(int) { return lci=767; }
-	virtual int f768(int) { return lci=768; }		virtual int f769(int) { return lci=769; }		virtual int f770(int) { return lci=770; }		virtual int f771(int) { return lci=771; }
-	virtual int f772(int) { return lci=772; }		virtual int f773(int) { return lci=773; }		virtual int f774(int) { return lci=774; }		virtual int f775(int) { return lci=775; }
-	virtual int f776(int) { return lci=776; }		virtual int f777(int) { return lci=777; }		virtual int f778(int) { return lci=778; }		virtual int f779(int) { return lci=779; }
-	virtual int f780(int) { return lci=780; }		virtual int f781(int) { return lci=781; }		virtual int f782(int) { return lci=782; }		virtual int f783(int) { return lci=783; }
-	virtual int f784(int) { return lci=784; }		virtual int f785(int) { return lci=785; }		virtual int f786(int) { return lci=786; }		virtual int f787(int) { return lci=787; }
-	virtual int f788(int) { return lci=788; }		virtual int f789(int) { return lci=789; }		virtual int f790(int) { return lci=790; }		virtual int f791(int) { return lci=791; }
-	virtual int f792(int) { return lci=792; }		virtual int f793(int) { return lci=793; }		virtual int f794(int) { return lci=794; }		virtual int f795(int) { return lci=795; }
-	virtual int f796(int) { return lci=796; }		virtual int f797(int) { return lci=797; }		virtual int f798(int) { return lci=798; }		virtual int f799(int) { return lci=799; }
-	virtual int f800(int) { return lci=800; }		virtual int f801(int) { return lci=801; }		virtual int f802(int) { return lci=802; }		virtual int f803(int) { return lci=803; }
-	virtual int f804(int) { return lci=804; }		virtual int f805(int) { return lci=805; }		virtual int f806(int) { return lci=806; }		virtual int f807(int) { return lci=807; }
-	virtual int f808(int) { return lci=808; }		virtual int f809(int) { return lci=809; }		virtual int f810(int) { return lci=810; }		virtual int f811(int) { return lci=811; }
-	virtual int f812(int) { return lci=812; }		virtual int f813(int) { return lci=813; }		virtual int f814(int) { return lci=814; }		virtual int f815(int) { return lci=815; }
-	virtual int f816(int) { return lci=816; }		virtual int f817(int) { return lci=817; }		virtual int f818(int) { return lci=818; }		virtual int f819(int) { return lci=819; }
-	virtual int f820(int) { return lci=820; }		virtual int f821(int) { return lci=821; }		virtual int f822(int) { return lci=822; }		virtual int f823(int) { return lci=823; }
-	virtual int f824(int) { return lci=824; }		virtual int f825(int) { return lci=825; }		virtual int f826(int) { return lci=826; }		virtual int f827(int) { return lci=827; }
-	virtual int f828(int) { return lci=828; }		virtual int f829(int) { return lci=829; }		virtual int f830(int) { return lci=830; }		virtual int f831(int) { return lci=831; }
-	virtual int f832(int) { return lci=832; }		virtual int f833(int) { return lci=833; }		virtual int f834(int) { return lci=834; }		virtual int f835(int) { return lci=835; }
-	virtual int f836(int) { return lci=836; }		virtual int f837(int) { return lci=837; }		virtual int f838(int) { return lci=838; }		virtual int f839(int) { return lci=839; }
-	virtual int f840(int) { return lci=840; }		virtual int f841(int) { return lci=841; }		virtual int f842(int) { return lci=842; }		virtual int f843(int) { return lci=843; }
-	virtual int f844(int) { return lci=844; }		virtual int f845(int) { return lci=845; }		virtual int f846(int) { return lci=846; }		virtual int f847(int) { return lci=847; }
-	virtual int f848(int) { return lci=848; }		virtual int f849(int) { return lci=849; }		virtual int f850(int) { return lci=850; }		virtual int f851(int) { return lci=851; }
-	virtual int f852(int) { return lci=852; }		virtual int f853(int) { return lci=853; }		virtual int f854(int) { return lci=854; }		virtual int f855(int) { return lci=855; }
-	virtual int f856(int) { return lci=856; }		virtual int f857(int) { return lci=857; }		virtual int f858(int) { return lci=858; }		virtual int f859(int) { return lci=859; }
-	virtual int f860(int) { return lci=860; }		virtual int f861(int) { return lci=861; }		virtual int f862(int) { return lci=862; }		virtual int f863(int) { return lci=863; }
-	virtual int f864(int) { return lci=864; }		virtual int f865(int) { return lci=865; }		virtual int f866(int) { return lci=866; }		virtual int f867(int) { return lci=867; }
-	virtual int f868(int) { return lci=868; }		virtual int f869(int) { return lci=869; }		virtual int f870(int) { return lci=870; }		virtual int f871(int) { return lci=871; }
-	virtual int f872(int) { return lci=872; }		virtual int f873(int) { return lci=873; }		virtual int f874(int) { return lci=874; }		virtual int f875(int) { return lci=875; }
-	virtual int f876(int) { return lci=876; }		virtual int f877(int) { return lci=877; }		virtual int f878(int) { return lci=878; }		virtual int f879(int) { return lci=879; }
-	virtual int f880(int) { return lci=880; }		virtual int f881(int) { return lci=881; }		virtual int f882(int) { return lci=882; }		virtual int f883(int) { return lci=883; }
-	virtual int f884(int) { return lci=884; }		virtual int f885(int) { return lci=885; }		virtual int f886(int) { return lci=886; }		virtual int f887(int) { return lci=887; }
-	virtual int f888(int) { return lci=888; }		virtual int f889(int) { return lci=889; }		virtual int f890(int) { return lci=890; }		virtual int f891(int) { return lci=891; }
-	virtual int f892(int) { return lci=892; }		virtual int f893(int) { return lci=893; }		virtual int f894(int) { return lci=894; }		virtual int f895(int) { return lci=895; }
-	virtual int f896(int) { return lci=896; }		virtual int f897(int) { return lci=897; }		virtual int f898(int) { return lci=898; }		virtual int f899(int) { return lci=899; }
-	virtual int f900(int) { return lci=900; }		virtual int f901(int) { return lci=901; }		virtual int f902(int) { return lci=902; }		virtual int f903(int) { return lci=903; }
-	virtual int f904(int) { return lci=904; }		virtual int f905(int) { return lci=905; }		virtual int f906(int) { return lci=906; }		virtual int f907(int) { return lci=907; }
-	virtual int f908(int) { return lci=908; }		virtual int f909(int) { return lci=909; }		virtual int f910(int) { return lci=910; }		virtual int f911(int) { return lci=911; }
-	virtual int f912(int) { return lci=912; }		virtual int f913(int) { return lci=913; }		virtual int f914(int) { return lci=914; }		virtual int f915(int) { return lci=915; }
-	virtual int f916(int) { return lci=916; }		virtual int f917(int) { return lci=917; }		virtual int f918(int) { return lci=918; }		virtual int f919(int) { return lci=919; }
-	virtual int f920(int) { return lci=920; }		virtual int f921(int) { return lci=921; }		virtual int f922(int) { return lci=922; }		virtual int f923(int) { return lci=923; }
-	virtual int f924(int) { return lci=924; }		virtual int f925(int) { return lci=925; }		virtual int f926(int) { return lci=926; }		virtual int f927(int) { return lci=927; }
-	virtual int f928(int) { return lci=928; }		virtual int f929(int) { return lci=929; }		virtual int f930(int) { return lci=930; }		virtual int f931(int) { return lci=931; }
-	virtual int f932(int) { return lci=932; }		virtual int f933(int) { return lci=933; }		virtual int f934(int) { return lci=934; }		virtual int f935(int) { return lci=935; }
-	virtual int f936(int) { return lci=936; }		virtual int f937(int) { return lci=937; }		virtual int f938(int) { return lci=938; }		virtual int f939(int) { return lci=939; }
-	virtual int f940(int) { return lci=940; }		virtual int f941(int) { return lci=941; }		virtual int f942(int) { return lci=942; }		virtual int f943(int) { return lci=943; }
-	virtual int f944(int) { return lci=944; }		virtual int f945(int) { return lci=945; }		virtual int f946(int) { return lci=946; }		virtual int f947(int) { return lci=947; }
-	virtual int f948(int) { return lci=948; }		virtual int f949(int) { return lci=949; }		virtual int f950(int) { return lci=950; }		virtual int f951(int) { return lci=951; }
-	virtual int f952(int) { return lci=952; }		virtual int f953(int) { return lci=953; }		virtual int f954(int) { return lci=954; }		virtual int f955(int) { return lci=955; }
-	virtual int f956(int) { return lci=956; }		virtual int f957(int) { return lci=957; }		virtual int f958(int) { return lci=958; }		virtual int f959(int) { return lci=959; }
-	virtual int f960(int) { return lci=960; }		virtual int f961(int) { return lci=961; }		virtual int f962(int) { return lci=962; }		virtual int f963(int) { return lci=963; }
-	virtual int f964(int) { return lci=964; }		virtual int f965(int) { return lci=965; }		virtual int f966(int) { return lci=966; }		virtual int f967(int) { return lci=967; }
-	virtual int f968(int) { return lci=968; }		virtual int f969(int) { return lci=969; }		virtual int f970(int) { return lci=970; }		virtual int f971(int) { return lci=971; }
-	virtual int f972(int) { return lci=972; }		virtual int f973(int) { return lci=973; }		virtual int f974(int) { return lci=974; }		virtual int f975(int) { return lci=975; }
-	virtual int f976(int) { return lci=976; }		virtual int f977(int) { return lci=977; }		virtual int f978(int) { return lci=978; }		virtual int f979(int) { return lci=979; }
-	virtual int f980(int) { return lci=980; }		virtual int f981(int) { return lci=981; }		virtual int f982(int) { return lci=982; }		virtual int f983(int) { return lci=983; }
-	virtual int f984(int) { return lci=984; }		virtual int f985(int) { return lci=985; }		virtual int f986(int) { return lci=986; }		virtual int f987(int) { return lci=987; }
-	virtual int f988(int) { return lci=988; }		virtual int f989(int) { return lci=989; }		virtual int f990(int) { return lci=990; }		virtual int f991(int) { return lci=991; }
-	virtual int f992(int) { return lci=992; }		virtual int f993(int) { return lci=993; }		virtual int f994(int) { return lci=994; }		virtual int f995(int) { return lci=995; }
-	virtual int f996(int) { return lci=996; }		virtual int f997(int) { return lci=997; }		virtual int f998(int) { return lci=998; }		virtual int f999(int) { return lci=999; }
-	virtual int f1000(int) { return lci=1000; }	virtual int f1001(int) { return lci=1001; }	virtual int f1002(int) { return lci=1002; }	virtual int f1003(int) { return lci=1003; }
-	virtual int f1004(int) { return lci=1004; }	virtual int f1005(int) { return lci=1005; }	virtual int f1006(int) { return lci=1006; }	virtual int f1007(int) { return lci=1007; }
-	virtual int f1008(int) { return lci=1008; }	virtual int f1009(int) { return lci=1009; }	virtual int f1010(int) { return lci=1010; }	virtual int f1011(int) { return lci=1011; }
-	virtual int f1012(int) { return lci=1012; }	virtual int f1013(int) { return lci=1013; }	virtual int f1014(int) { return lci=1014; }	virtual int f1015(int) { return lci=1015; }
-	virtual int f1016(int) { return lci=1016; }	virtual int f1017(int) { return lci=1017; }	virtual int f1018(int) { return lci=1018; }	virtual int f1019(int) { return lci=1019; }
-	virtual int f1020(int) { return lci=1020; }	virtual int f1021(int) { return lci=1021; }	virtual int f1022(int) { return lci=1022; }	virtual int f1023(int) { return lci=1023; }
-	virtual ~func_index() {}
+	A a;
+	B b;
+	C c;
+	D d;
+	E e;
+	ref_tuple(A valueA = A(), B valueB = B(), C valueC = C(), D valueD = D(), E valueE = E())
+		  : a(valueA), b(valueB), c(valueC), d(valueD), e(valueE)
+	{}
+	// Room for the arguments packed like the With() values of a copy_tuple, see packed_args.
+	mutable unsigned char bytes[packed_args<A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>::bufferSize];
+	template <typename V>
+	void visit(V &v) const
+	{
+		v.template arg<A, typename base_type<A>::type>(a);
+		v.template arg<B, typename base_type<B>::type>(b);
+		v.template arg<C, typename base_type<C>::type>(c);
+		v.template arg<D, typename base_type<D>::type>(d);
+		v.template arg<E, typename base_type<E>::type>(e);
+	}
+	virtual void printTo(std::ostream &os) const
+	{
+	  os << "(";
+	  printArg<A>::print(os, a, false);
+	  printArg<B>::print(os, b, true);
+	  printArg<C>::print(os, c, true);
+	  printArg<D>::print(os, d, true);
+	  printArg<E>::print(os, e, true);
+	  os << ")";
+	}
+#ifdef HM_CALL_TRACE
+	virtual void traceTo(CallTraceWriter &out) const
+	{
+	  out.put((unsigned char)5);
+	  traceArg<A>::write(out, a);
+	  traceArg<B>::write(out, b);
+	  traceArg<C>::write(out, c);
+	  traceArg<D>::write(out, d);
+	  traceArg<E>::write(out, e);
+	}
+#endif
 };
 
-#ifdef _MSC_VER
-template <int s>
-int virtual_function_index(unsigned char *func)
+template <typename A, typename B, typename C, typename D>
+class ref_tuple<A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public base_tuple
 {
-	if (*func == 0xE9)
+public:
+	A a;
+	B b;
+	C c;
+	D d;
+	ref_tuple(A valueA = A(), B valueB = B(), C valueC = C(), D valueD = D())
+		  : a(valueA), b(valueB), c(valueC), d(valueD)
+	{}
+	// Room for the arguments packed like the With() values of a copy_tuple, see packed_args.
+	mutable unsigned char bytes[packed_args<A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>::bufferSize];
+	template <typename V>
+	void visit(V &v) const
 	{
-		return virtual_function_index<0>(func + 5 + *(unsigned int *)(func + 1));
+		v.template arg<A, typename base_type<A>::type>(a);
+		v.template arg<B, typename base_type<B>::type>(b);
+		v.template arg<C, typename base_type<C>::type>(c);
+		v.template arg<D, typename base_type<D>::type>(d);
 	}
-	else
+	virtual void printTo(std::ostream &os) const
 	{
-#ifdef _WIN64
-		func++; // Add one to the pointer to skip the REX prefix used to access 64-bit registers.
-#endif
-		switch (*(unsigned int *)func)
-		{ // mov ecx, this; jump [eax + v/Ib/Iw]
-		case 0x20ff018b: return 0;
-#ifdef _WIN32
-		case 0x0424448b:
-			if (func[7] == 0x20)
-				return 0;
-			return *(unsigned char *)(func + 8) / sizeof(void*);
+	  os << "(";
+	  printArg<A>::print(os, a, false);
+	  printArg<B>::print(os, b, true);
+	  printArg<C>::print(os, c, true);
+	  printArg<D>::print(os, d, true);
+	  os << ")";
+	}
+#ifdef HM_CALL_TRACE
+	virtual void traceTo(CallTraceWriter &out) const
+	{
+	  out.put((unsigned char)4);
+	  traceArg<A>::write(out, a);
+	  traceArg<B>::write(out, b);
+	  traceArg<C>::write(out, c);
+	  traceArg<D>::write(out, d);
+	}
 #endif
-		case 0x60ff018b: return *(unsigned char *)(func + sizeof(int)) / sizeof(void*);
-		case 0xA0ff018b: return *(unsigned long *)(func + sizeof(int)) / sizeof(void*);
-		default: return -1;
-		}
+};
+
+template <typename A, typename B, typename C>
+class ref_tuple<A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public base_tuple
+{
+public:
+	A a;
+	B b;
+	C c;
+	ref_tuple(A valueA = A(), B valueB = B(), C valueC = C())
+		  : a(valueA), b(valueB), c(valueC)
+	{}
+	// Room for the arguments packed like the With() values of a copy_tuple, see packed_args.
+	mutable unsigned char bytes[packed_args<A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>::bufferSize];
+	template <typename V>
+	void visit(V &v) const
+	{
+		v.template arg<A, typename base_type<A>::type>(a);
+		v.template arg<B, typename base_type<B>::type>(b);
+		v.template arg<C, typename base_type<C>::type>(c);
 	}
-}
+	virtual void printTo(std::ostream &os) const
+	{
+	  os << "(";
+	  printArg<A>::print(os, a, false);
+	  printArg<B>::print(os, b, true);
+	  printArg<C>::print(os, c, true);
+	  os << ")";
+	}
+#ifdef HM_CALL_TRACE
+	virtual void traceTo(CallTraceWriter &out) const
+	{
+	  out.put((unsigned char)3);
+	  traceArg<A>::write(out, a);
+	  traceArg<B>::write(out, b);
+	  traceArg<C>::write(out, c);
+	}
+#endif
+};
 
+template <typename A, typename B>
+class ref_tuple<A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public base_tuple
+{
+public:
+	A a;
+	B b;
+	ref_tuple(A valueA = A(), B valueB = B())
+		  : a(valueA), b(valueB)
+	{}
+	// Room for the arguments packed like the With() values of a copy_tuple, see packed_args.
+	mutable unsigned char bytes[packed_args<A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>::bufferSize];
+	template <typename V>
+	void visit(V &v) const
+	{
+		v.template arg<A, typename base_type<A>::type>(a);
+		v.template arg<B, typename base_type<B>::type>(b);
+	}
+	virtual void printTo(std::ostream &os) const
+	{
+	  os << "(";
+	  printArg<A>::print(os, a, false);
+	  printArg<B>::print(os, b, true);
+	  os << ")";
+	}
+#ifdef HM_CALL_TRACE
+	virtual void traceTo(CallTraceWriter &out) const
+	{
+	  out.put((unsigned char)2);
+	  traceArg<A>::write(out, a);
+	  traceArg<B>::write(out, b);
+	}
 #endif
+};
 
-template <typename T>
-std::pair<int, int> virtual_index(T t)
+template <typename A>
+class ref_tuple<A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public base_tuple
 {
-#if defined(__GNUG__)
-	union {
-		T t;
-		struct
-		{
-			unsigned long value;
-			unsigned long baseoffs;
-		} u;
-	} conv = {};
-	conv.t = t;
-#if defined(SOME_ARM)
-	// ARM ABI says the bit is in bsaeoffs instead, and that the value is shiffted left 1.
-	// This because valid ARM pointers may have the LSB set, so the "is virtual" bit had to be moved.
-	if (conv.u.baseoffs & 1)
-		return std::pair<int, int>(conv.u.baseoffs / (sizeof(void*) * 2), conv.u.value / sizeof(void *));
-#else
-	// simple Itanium ABI implementation, used by everything but Microsoft and embedded EDG-based compilers
-	if (conv.u.value & 1)
-		return std::pair<int, int>(conv.u.baseoffs / sizeof(void*), conv.u.value / sizeof(void *));
+public:
+	A a;
+	ref_tuple(A valueA = A())
+		  : a(valueA)
+	{}
+	// Room for the arguments packed like the With() values of a copy_tuple, see packed_args.
+	mutable unsigned char bytes[packed_args<A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>::bufferSize];
+	template <typename V>
+	void visit(V &v) const
+	{
+		v.template arg<A, typename base_type<A>::type>(a);
+	}
+	virtual void printTo(std::ostream &os) const
+	{
+	  os << "(";
+	  printArg<A>::print(os, a, false);
+	  os << ")";
+	}
+#ifdef HM_CALL_TRACE
+	virtual void traceTo(CallTraceWriter &out) const
+	{
+	  out.put((unsigned char)1);
+	  traceArg<A>::write(out, a);
+	}
 #endif
+};
 
-#elif defined(_MSC_VER)
-	union {
-		T t;
-		struct
-		{
-			unsigned char *value;
-			unsigned long baseoffs;
-		} u;
-	} conv = {};
-	conv.t = t;
-
-	int value = virtual_function_index<0>((unsigned char *)conv.u.value);
-	if (value != -1)
-		return std::pair<int, int>((int)(conv.u.baseoffs/sizeof(void*)), value);
-#elif defined(__EDG__)
-	union {
-		T t;
-		struct {
-			short delta;
-			short vindex;
-			long vtordisp;
-		} u;
-	} conv;
-	conv.t = t;
-
-	if (conv.u.vindex != 0)
-		return std::pair<int, int>((conv.u.delta + conv.u.vtordisp)/sizeof(void*), conv.u.vindex * 2 + 1);
-
-#elif defined (__SUNPRO_CC)
-    union {
-        T t;
-        struct
-        {
-            unsigned char *value;
-            unsigned long baseoffs;
-        } u;
-    } conv;
-    conv.t = t;
-   //is virtual call
-    unsigned char prolog[]= {0x55, 0x8b, 0xec, 0x83, 0xec,
-            0x04, 0x89, 0x5d, 0xfc,
-            0x8b, 0x45};//, 0x08, 0x8b, 0x40, 0x00,
-            //0x8b, 0x40}; //movl <index>
-	unsigned char* opcodes = conv.u.value;
-    if (0 == memcmp(opcodes, prolog, sizeof(prolog)))
-    {
-        if (opcodes[11] == 0x08 || opcodes[11] == 0x0c)
-        {
-            unsigned char epilogue[] = { 0x8b, 0x5d, 0xfc, 0xc9, 0xff, 0xe0 };
-
-            int i;
-            for (i = 0; i < 4; i++)
-            {
-                if (0 == memcmp(&opcodes[18 + i], epilogue, sizeof(epilogue)))
-                {
-                    break;
-                }
-            }
-            //is virtual call prologue
-            int index = 0;// = opcodes[17] / 4; //offset of function index
-
-            switch (i)
-            {
-                case 3:
-                    index += static_cast<unsigned int>(opcodes[17 + 3]) << (8 * 3);
-                case 2:
-                    index += static_cast<unsigned int>(opcodes[17 + 2]) << (8 * 2);
-                case 1:
-                    index += static_cast<unsigned int>(opcodes[17 + 1]) << (8 * 1);
-                case 0:
-                default:
-                    index += static_cast<unsigned int>(opcodes[17]);
-            }
-            index = index / 4;
-
-            return std::pair<int, int>(conv.u.baseoffs / 4, index);
-        }
-    }
-#else
-#error No virtual indexing found for this compiler! Please contact the maintainers of HippoMocks
-#endif
-
-	return std::pair<int, int>(-1, 0);
-}
-
-template <typename T, typename U>
-T getNonvirtualMemberFunctionAddress(U u)
+template <>
+class ref_tuple<NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public base_tuple
 {
-#ifdef __EDG__
-	// Edison Design Group C++ frontend (Comeau, Portland Group, Greenhills, etc)
-	union {
-	  struct {
-			short delta;
-			short vindex;
-			T t;
-	  } mfp_structure;
-	  U u;
-	} conv;
-#else
-	// Visual Studio, GCC, others
-	union {
-	  struct {
-			T t;
-		} mfp_structure;
-		U u;
-	} conv;
-#endif
-	conv.u = u;
-	return conv.mfp_structure.t;
-}
-
-class TypeDestructable {
-public:
-	virtual ~TypeDestructable() {}
-};
-
-template <typename A>
-class MemberWrap : public TypeDestructable {
-private:
-	A *member;
 public:
-	MemberWrap(A *mem)
-		: member(mem)
+	ref_tuple() {}
+	virtual void printTo(std::ostream &os) const
 	{
-		new (member) A();
+	  os << "(";
+	  os << ")";
 	}
-	~MemberWrap()
+#ifdef HM_CALL_TRACE
+	virtual void traceTo(CallTraceWriter &out) const
 	{
-		member->~A();
+	  out.put((unsigned char)0);
 	}
+#endif
 };
 
-// mock types
-template <class T>
-class mock : public base_mock
+// What the MockRepository can use of the With() values of a Call without knowing their types: their
+// hash for indexArguments, with hasher to hash the arguments of a call the same way, and their
+// bytes, which compare with one memcmp against the arguments of a call once packer has packed
+// those. Each is null unless all arguments allow it. fingerprints tells whether any is a
+// Fingerprint.
+struct ArgumentKeys
+{
+	ArgumentKeys() : hash(0), hasher(0), packed(0), packedSize(0), packer(0), fingerprints(false) {}
+	size_t hash;
+	size_t (*hasher)(const base_tuple &);
+	const unsigned char *packed;
+	size_t packedSize;
+	void (*packer)(const base_tuple &);
+	bool fingerprints;
+};
+
+template <typename A = NullType, typename B = NullType, typename C = NullType, typename D = NullType,
+		  typename E = NullType, typename F = NullType, typename G = NullType, typename H = NullType,
+		  typename I = NullType, typename J = NullType, typename K = NullType, typename L = NullType,
+		  typename M = NullType, typename N = NullType, typename O = NullType, typename P = NullType>
+class ref_comparable_assignable_tuple : public base_tuple
 {
-	typedef void (*funcptr)();
-	friend class MockRepository;
-	unsigned char remaining[sizeof(T)];
-	void NotImplemented() {
-		RAISEEXCEPTION(:: HM_NS NotImplementedException(MockRepoInstanceHolder<0>::instance));
-	}
-protected:
-	std::map<int, void (**)()> funcTables;
-	void (*notimplementedfuncs[VIRT_FUNC_LIMIT])();
 public:
-	bool isZombie;
-	std::list<TypeDestructable *> members;
-	MockRepository *repo;
-	std::map<std::pair<int, int>, int> funcMap;
-	mock(MockRepository *repository)
-		: isZombie(false)
-		, repo(repository)
-	{
-		for (int i = 0; i < VIRT_FUNC_LIMIT; i++)
-		{
-			notimplementedfuncs[i] = getNonvirtualMemberFunctionAddress<void (*)()>(&mock<T>::NotImplemented);
-		}
-		funcptr *funcTable = new funcptr[VIRT_FUNC_LIMIT+2];
-		memcpy(funcTable, notimplementedfuncs, sizeof(funcptr) * VIRT_FUNC_LIMIT);
-		((void **)funcTable)[VIRT_FUNC_LIMIT] = this;
-		((void **)funcTable)[VIRT_FUNC_LIMIT+1] = *(void **)this;
-		funcTables[0] = funcTable;
-		*(void **)this = funcTable;
-		for (unsigned int i = 1; i < sizeof(remaining) / sizeof(funcptr); i++)
-		{
-			((void **)this)[i] = (void *)notimplementedfuncs;
-		}
-	}
-	~mock()
+	ref_comparable_assignable_tuple() : assigning(false) {}
+	// Whether any argument is an Out() or In() parameter, so that assign_to and assign_from do something.
+	bool assigning;
+	ArgumentKeys keys;
+	unsigned char bytes[packed_args<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P>::bufferSize];
+	// Hashes and packs the With() values of tuple, the copy_tuple this is, as far as they allow.
+	template <typename T>
+	void setKeys(const T &tuple)
 	{
-		for (std::list<TypeDestructable *>::iterator i = members.begin(); i != members.end(); ++i)
+		arg_kinds_visitor kinds;
+		tuple.visit(kinds);
+		keys.fingerprints = kinds.fingerprints;
+		if (kinds.indexes)
 		{
-			delete *i;
+			arg_key_visitor hasher;
+			tuple.visit(hasher);
+			keys.hash = hasher.key;
+			keys.hasher = &hashArgs;
 		}
-		for (std::map<int, void (**)()>::iterator i = funcTables.begin(); i != funcTables.end(); ++i)
+		if (kinds.packs)
 		{
-			delete [] i->second;
+			arg_pack_visitor packer(bytes);
+			tuple.visit(packer);
+			keys.packed = bytes;
+			keys.packedSize = sizeof(bytes);
+			keys.packer = &packArgs;
 		}
 	}
-	void mock_reset()
-	{
-		MockRepository *repository = this->repo;
-		// ugly but simple
-		this->~mock<T>();
-		new (this) mock<T>(repository);
-	}
-	mock<T> *getRealThis()
+	static size_t hashArgs(const base_tuple &tuple)
 	{
-		void ***base = (void ***)this;
-		return (mock<T> *)((*base)[VIRT_FUNC_LIMIT]);
+		arg_hash_visitor hasher;
+		static_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &>(tuple).visit(hasher);
+		return hasher.key;
 	}
-	std::pair<int, int> translateX(int x)
+	// Packs the arguments of a call, the first time a Call with packed With() values compares them.
+	static void packArgs(const base_tuple &tuple)
 	{
-		for (std::map<std::pair<int, int>, int>::iterator i = funcMap.begin(); i != funcMap.end(); ++i)
-		{
-			if (i->second == x+1) return i->first;
-		}
-		return std::pair<int, int>(-1, 0);
+		const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &args = static_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &>(tuple);
+		arg_pack_visitor packer(args.bytes);
+		args.visit(packer);
+		tuple.packed = args.bytes;
 	}
-	template <int X>
-	void mockedDestructor(int);
+	virtual bool operator==(const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &bo) = 0;
+	virtual void assign_from(ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &from) = 0;
+  virtual void assign_to(ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &to) = 0;
 };
 
-// Do() function wrapping
-class VirtualDestructable { public: virtual ~VirtualDestructable() {} };
+template <typename T> struct no_array { typedef T type; };
+template <typename T, int N> struct no_array<T[N]> { typedef T* type; };
 
-template <typename Y>
-class TupleInvocable : public VirtualDestructable
+template <typename B>
+struct store_as
 {
-public:
-	virtual Y operator()(const base_tuple &tupl) = 0;
+	typedef typename no_array<B>::type type;
 };
 
-template <typename Y,
-		  typename A = NullType, typename B = NullType, typename C = NullType, typename D = NullType,
-		  typename E = NullType, typename F = NullType, typename G = NullType, typename H = NullType,
-		  typename I = NullType, typename J = NullType, typename K = NullType, typename L = NullType,
-		  typename M = NullType, typename N = NullType, typename O = NullType, typename P = NullType>
-class Invocable : public TupleInvocable<Y>
+template <typename B>
+struct store_as<B&>
 {
-public:
-	virtual Y operator()(A a = A(), B b = B(), C c = C(), D d = D(), E e = E(), F f = F(), G g = G(), H h = H(), I i = I(), J j = J(), K k = K(), L l = L(), M m = M(), N n = N(), O o = O(), P p = P()) = 0;
-	virtual Y operator()(const base_tuple &tupl) {
-		const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &rTupl = reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &>(tupl);
-		return (*this)(rTupl.a, rTupl.b, rTupl.c, rTupl.d, rTupl.e, rTupl.f, rTupl.g, rTupl.h,
-			rTupl.i, rTupl.j, rTupl.k, rTupl.l, rTupl.m, rTupl.n, rTupl.o, rTupl.p);
-	}
+  typedef typename no_array<B>::type type;
 };
-template <typename T, typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J, typename K, typename L,
-		  typename M, typename N, typename O, typename P>
-class DoWrapper : public Invocable<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> {
-	T t;
+
+// The arguments given to With(). Like ref_tuple it is specialized for each arity, so comparing
+// and assigning only visit the real arguments.
+template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H,
+		  typename I, typename J, typename K, typename L, typename M, typename N, typename O, typename P,
+		  typename CA, typename CB, typename CC, typename CD, typename CE, typename CF, typename CG, typename CH,
+		  typename CI, typename CJ, typename CK, typename CL, typename CM, typename CN, typename CO, typename CP>
+class copy_tuple : public ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P>
+{
 public:
-	DoWrapper(T templ) : t(templ) {}
-	virtual Y operator()(A a, B b, C c, D d, E e, F f, G g, H h, I i, J j, K k, L l, M m, N n, O o, P p)
+	size_t objectSize() const { return sizeof(*this); }
+	typename store_as<CA>::type a;
+	typename store_as<CB>::type b;
+	typename store_as<CC>::type c;
+	typename store_as<CD>::type d;
+	typename store_as<CE>::type e;
+	typename store_as<CF>::type f;
+	typename store_as<CG>::type g;
+	typename store_as<CH>::type h;
+	typename store_as<CI>::type i;
+	typename store_as<CJ>::type j;
+	typename store_as<CK>::type k;
+	typename store_as<CL>::type l;
+	typename store_as<CM>::type m;
+	typename store_as<CN>::type n;
+	typename store_as<CO>::type o;
+	typename store_as<CP>::type p;
+	copy_tuple(typename store_as<CA>::type valueA, typename store_as<CB>::type valueB, typename store_as<CC>::type valueC, typename store_as<CD>::type valueD, typename store_as<CE>::type valueE, typename store_as<CF>::type valueF, typename store_as<CG>::type valueG, typename store_as<CH>::type valueH, typename store_as<CI>::type valueI, typename store_as<CJ>::type valueJ, typename store_as<CK>::type valueK, typename store_as<CL>::type valueL, typename store_as<CM>::type valueM, typename store_as<CN>::type valueN, typename store_as<CO>::type valueO, typename store_as<CP>::type valueP)
+		  : a(valueA), b(valueB), c(valueC), d(valueD), e(valueE), f(valueF), g(valueG), h(valueH), i(valueI), j(valueJ), k(valueK), l(valueL), m(valueM), n(valueN), o(valueO), p(valueP)
 	{
-		return t(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p);
+		this->assigning = assigns_arg<typename store_as<CA>::type>::value ||
+			assigns_arg<typename store_as<CB>::type>::value ||
+			assigns_arg<typename store_as<CC>::type>::value ||
+			assigns_arg<typename store_as<CD>::type>::value ||
+			assigns_arg<typename store_as<CE>::type>::value ||
+			assigns_arg<typename store_as<CF>::type>::value ||
+			assigns_arg<typename store_as<CG>::type>::value ||
+			assigns_arg<typename store_as<CH>::type>::value ||
+			assigns_arg<typename store_as<CI>::type>::value ||
+			assigns_arg<typename store_as<CJ>::type>::value ||
+			assigns_arg<typename store_as<CK>::type>::value ||
+			assigns_arg<typename store_as<CL>::type>::value ||
+			assigns_arg<typename store_as<CM>::type>::value ||
+			assigns_arg<typename store_as<CN>::type>::value ||
+			assigns_arg<typename store_as<CO>::type>::value ||
+			assigns_arg<typename store_as<CP>::type>::value;
+		this->setKeys(*this);
+	}
+	template <typename V>
+	void visit(V &v) const
+	{
+		v.template arg<A, typename store_as<CA>::type>(a);
+		v.template arg<B, typename store_as<CB>::type>(b);
+		v.template arg<C, typename store_as<CC>::type>(c);
+		v.template arg<D, typename store_as<CD>::type>(d);
+		v.template arg<E, typename store_as<CE>::type>(e);
+		v.template arg<F, typename store_as<CF>::type>(f);
+		v.template arg<G, typename store_as<CG>::type>(g);
+		v.template arg<H, typename store_as<CH>::type>(h);
+		v.template arg<I, typename store_as<CI>::type>(i);
+		v.template arg<J, typename store_as<CJ>::type>(j);
+		v.template arg<K, typename store_as<CK>::type>(k);
+		v.template arg<L, typename store_as<CL>::type>(l);
+		v.template arg<M, typename store_as<CM>::type>(m);
+		v.template arg<N, typename store_as<CN>::type>(n);
+		v.template arg<O, typename store_as<CO>::type>(o);
+		v.template arg<P, typename store_as<CP>::type>(p);
 	}
-	using Invocable<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P>::operator();
-};
-template <typename T, typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J, typename K, typename L,
-		  typename M, typename N, typename O>
-class DoWrapper<T,Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> : public Invocable<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O> {
-	T t;
-public:
-	DoWrapper(T templ) : t(templ) {}
-	virtual Y operator()(A a, B b, C c, D d, E e, F f, G g, H h, I i, J j, K k, L l, M m, N n, O o, NullType)
+	bool operator==(const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &to)
 	{
-		return t(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o);
+		return (comparer<A>::compare(a, to.a) &&
+				comparer<B>::compare(b, to.b) &&
+				comparer<C>::compare(c, to.c) &&
+				comparer<D>::compare(d, to.d) &&
+				comparer<E>::compare(e, to.e) &&
+				comparer<F>::compare(f, to.f) &&
+				comparer<G>::compare(g, to.g) &&
+				comparer<H>::compare(h, to.h) &&
+				comparer<I>::compare(i, to.i) &&
+				comparer<J>::compare(j, to.j) &&
+				comparer<K>::compare(k, to.k) &&
+				comparer<L>::compare(l, to.l) &&
+				comparer<M>::compare(m, to.m) &&
+				comparer<N>::compare(n, to.n) &&
+				comparer<O>::compare(o, to.o) &&
+				comparer<P>::compare(p, to.p));
 	}
-	using Invocable<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O>::operator();
-};
-template <typename T, typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J, typename K, typename L,
-		  typename M, typename N>
-class DoWrapper<T,Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> : public Invocable<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N> {
-	T t;
-public:
-	DoWrapper(T templ) : t(templ) {}
-	virtual Y operator()(A a, B b, C c, D d, E e, F f, G g, H h, I i, J j, K k, L l, M m, N n, NullType, NullType)
-	{
-		return t(a,b,c,d,e,f,g,h,i,j,k,l,m,n);
-	}
-	using Invocable<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N>::operator();
-};
-template <typename T, typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J, typename K, typename L,
-		  typename M>
-class DoWrapper<T,Y,A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> : public Invocable<Y,A,B,C,D,E,F,G,H,I,J,K,L,M> {
-	T t;
-public:
-	DoWrapper(T templ) : t(templ) {}
-	virtual Y operator()(A a, B b, C c, D d, E e, F f, G g, H h, I i, J j, K k, L l, M m, NullType, NullType, NullType)
-	{
-		return t(a,b,c,d,e,f,g,h,i,j,k,l,m);
+	unsigned matchingArgs(const base_tuple &tuple)
+	{
+		const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &to = static_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &>(tuple);
+		return (comparer<A>::compare(a, to.a) ? 1 : 0) +
+				(comparer<B>::compare(b, to.b) ? 1 : 0) +
+				(comparer<C>::compare(c, to.c) ? 1 : 0) +
+				(comparer<D>::compare(d, to.d) ? 1 : 0) +
+				(comparer<E>::compare(e, to.e) ? 1 : 0) +
+				(comparer<F>::compare(f, to.f) ? 1 : 0) +
+				(comparer<G>::compare(g, to.g) ? 1 : 0) +
+				(comparer<H>::compare(h, to.h) ? 1 : 0) +
+				(comparer<I>::compare(i, to.i) ? 1 : 0) +
+				(comparer<J>::compare(j, to.j) ? 1 : 0) +
+				(comparer<K>::compare(k, to.k) ? 1 : 0) +
+				(comparer<L>::compare(l, to.l) ? 1 : 0) +
+				(comparer<M>::compare(m, to.m) ? 1 : 0) +
+				(comparer<N>::compare(n, to.n) ? 1 : 0) +
+				(comparer<O>::compare(o, to.o) ? 1 : 0) +
+				(comparer<P>::compare(p, to.p) ? 1 : 0);
 	}
-	using Invocable<Y,A,B,C,D,E,F,G,H,I,J,K,L,M>::operator();
-};
-template <typename T, typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J, typename K, typename L>
-class DoWrapper<T,Y,A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> : public Invocable<Y,A,B,C,D,E,F,G,H,I,J,K,L> {
-	T t;
-public:
-	DoWrapper(T templ) : t(templ) {}
-	virtual Y operator()(A a, B b, C c, D d, E e, F f, G g, H h, I i, J j, K k, L l, NullType, NullType, NullType, NullType)
+	void assign_from(ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &from)
 	{
-		return t(a,b,c,d,e,f,g,h,i,j,k,l);
+		in_assign< typename store_as<CA>::type, A>(a, from.a);
+		in_assign< typename store_as<CB>::type, B>(b, from.b);
+		in_assign< typename store_as<CC>::type, C>(c, from.c);
+		in_assign< typename store_as<CD>::type, D>(d, from.d);
+		in_assign< typename store_as<CE>::type, E>(e, from.e);
+		in_assign< typename store_as<CF>::type, F>(f, from.f);
+		in_assign< typename store_as<CG>::type, G>(g, from.g);
+		in_assign< typename store_as<CH>::type, H>(h, from.h);
+		in_assign< typename store_as<CI>::type, I>(i, from.i);
+		in_assign< typename store_as<CJ>::type, J>(j, from.j);
+		in_assign< typename store_as<CK>::type, K>(k, from.k);
+		in_assign< typename store_as<CL>::type, L>(l, from.l);
+		in_assign< typename store_as<CM>::type, M>(m, from.m);
+		in_assign< typename store_as<CN>::type, N>(n, from.n);
+		in_assign< typename store_as<CO>::type, O>(o, from.o);
+		in_assign< typename store_as<CP>::type, P>(p, from.p);
 	}
-	using Invocable<Y,A,B,C,D,E,F,G,H,I,J,K,L>::operator();
-};
-template <typename T, typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J, typename K>
-class DoWrapper<T,Y,A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> : public Invocable<Y,A,B,C,D,E,F,G,H,I,J,K> {
-	T t;
-public:
-	DoWrapper(T templ) : t(templ) {}
-	virtual Y operator()(A a, B b, C c, D d, E e, F f, G g, H h, I i, J j, K k, NullType, NullType, NullType, NullType, NullType)
+	void assign_to(ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &to)
 	{
-		return t(a,b,c,d,e,f,g,h,i,j,k);
+		out_assign< typename store_as<CA>::type, A>(a, to.a);
+		out_assign< typename store_as<CB>::type, B>(b, to.b);
+		out_assign< typename store_as<CC>::type, C>(c, to.c);
+		out_assign< typename store_as<CD>::type, D>(d, to.d);
+		out_assign< typename store_as<CE>::type, E>(e, to.e);
+		out_assign< typename store_as<CF>::type, F>(f, to.f);
+		out_assign< typename store_as<CG>::type, G>(g, to.g);
+		out_assign< typename store_as<CH>::type, H>(h, to.h);
+		out_assign< typename store_as<CI>::type, I>(i, to.i);
+		out_assign< typename store_as<CJ>::type, J>(j, to.j);
+		out_assign< typename store_as<CK>::type, K>(k, to.k);
+		out_assign< typename store_as<CL>::type, L>(l, to.l);
+		out_assign< typename store_as<CM>::type, M>(m, to.m);
+		out_assign< typename store_as<CN>::type, N>(n, to.n);
+		out_assign< typename store_as<CO>::type, O>(o, to.o);
+		out_assign< typename store_as<CP>::type, P>(p, to.p);
 	}
-	using Invocable<Y,A,B,C,D,E,F,G,H,I,J,K>::operator();
-};
-template <typename T, typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J>
-class DoWrapper<T,Y,A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> : public Invocable<Y,A,B,C,D,E,F,G,H,I,J> {
-	T t;
-public:
-	DoWrapper(T templ) : t(templ) {}
-	virtual Y operator()(A a, B b, C c, D d, E e, F f, G g, H h, I i, J j, NullType, NullType, NullType, NullType, NullType, NullType)
+	virtual void printTo(std::ostream &os) const
 	{
-		return t(a,b,c,d,e,f,g,h,i,j);
+		os << "(";
+		printArg<typename store_as<CA>::type>::print(os, a, false);
+		printArg<typename store_as<CB>::type>::print(os, b, true);
+		printArg<typename store_as<CC>::type>::print(os, c, true);
+		printArg<typename store_as<CD>::type>::print(os, d, true);
+		printArg<typename store_as<CE>::type>::print(os, e, true);
+		printArg<typename store_as<CF>::type>::print(os, f, true);
+		printArg<typename store_as<CG>::type>::print(os, g, true);
+		printArg<typename store_as<CH>::type>::print(os, h, true);
+		printArg<typename store_as<CI>::type>::print(os, i, true);
+		printArg<typename store_as<CJ>::type>::print(os, j, true);
+		printArg<typename store_as<CK>::type>::print(os, k, true);
+		printArg<typename store_as<CL>::type>::print(os, l, true);
+		printArg<typename store_as<CM>::type>::print(os, m, true);
+		printArg<typename store_as<CN>::type>::print(os, n, true);
+		printArg<typename store_as<CO>::type>::print(os, o, true);
+		printArg<typename store_as<CP>::type>::print(os, p, true);
+		os << ")";
 	}
-	using Invocable<Y,A,B,C,D,E,F,G,H,I,J>::operator();
 };
-template <typename T, typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I>
-class DoWrapper<T,Y,A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType>  : public Invocable<Y,A,B,C,D,E,F,G,H,I>{
-	T t;
+
+template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename M, typename N, typename O, typename CA, typename CB, typename CC, typename CD, typename CE, typename CF, typename CG, typename CH, typename CI, typename CJ, typename CK, typename CL, typename CM, typename CN, typename CO>
+class copy_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType,
+				 CA,CB,CC,CD,CE,CF,CG,CH,CI,CJ,CK,CL,CM,CN,CO,NullType>
+	: public ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType>
+{
 public:
-	DoWrapper(T templ) : t(templ) {}
-	virtual Y operator()(A a, B b, C c, D d, E e, F f, G g, H h, I i, NullType, NullType, NullType, NullType, NullType, NullType, NullType)
+	size_t objectSize() const { return sizeof(*this); }
+	typename store_as<CA>::type a;
+	typename store_as<CB>::type b;
+	typename store_as<CC>::type c;
+	typename store_as<CD>::type d;
+	typename store_as<CE>::type e;
+	typename store_as<CF>::type f;
+	typename store_as<CG>::type g;
+	typename store_as<CH>::type h;
+	typename store_as<CI>::type i;
+	typename store_as<CJ>::type j;
+	typename store_as<CK>::type k;
+	typename store_as<CL>::type l;
+	typename store_as<CM>::type m;
+	typename store_as<CN>::type n;
+	typename store_as<CO>::type o;
+	copy_tuple(typename store_as<CA>::type valueA, typename store_as<CB>::type valueB, typename store_as<CC>::type valueC, typename store_as<CD>::type valueD, typename store_as<CE>::type valueE, typename store_as<CF>::type valueF, typename store_as<CG>::type valueG, typename store_as<CH>::type valueH, typename store_as<CI>::type valueI, typename store_as<CJ>::type valueJ, typename store_as<CK>::type valueK, typename store_as<CL>::type valueL, typename store_as<CM>::type valueM, typename store_as<CN>::type valueN, typename store_as<CO>::type valueO)
+		  : a(valueA), b(valueB), c(valueC), d(valueD), e(valueE), f(valueF), g(valueG), h(valueH), i(valueI), j(valueJ), k(valueK), l(valueL), m(valueM), n(valueN), o(valueO)
+	{
+		this->assigning = assigns_arg<typename store_as<CA>::type>::value ||
+			assigns_arg<typename store_as<CB>::type>::value ||
+			assigns_arg<typename store_as<CC>::type>::value ||
+			assigns_arg<typename store_as<CD>::type>::value ||
+			assigns_arg<typename store_as<CE>::type>::value ||
+			assigns_arg<typename store_as<CF>::type>::value ||
+			assigns_arg<typename store_as<CG>::type>::value ||
+			assigns_arg<typename store_as<CH>::type>::value ||
+			assigns_arg<typename store_as<CI>::type>::value ||
+			assigns_arg<typename store_as<CJ>::type>::value ||
+			assigns_arg<typename store_as<CK>::type>::value ||
+			assigns_arg<typename store_as<CL>::type>::value ||
+			assigns_arg<typename store_as<CM>::type>::value ||
+			assigns_arg<typename store_as<CN>::type>::value ||
+			assigns_arg<typename store_as<CO>::type>::value;
+		this->setKeys(*this);
+	}
+	template <typename V>
+	void visit(V &v) const
+	{
+		v.template arg<A, typename store_as<CA>::type>(a);
+		v.template arg<B, typename store_as<CB>::type>(b);
+		v.template arg<C, typename store_as<CC>::type>(c);
+		v.template arg<D, typename store_as<CD>::type>(d);
+		v.template arg<E, typename store_as<CE>::type>(e);
+		v.template arg<F, typename store_as<CF>::type>(f);
+		v.template arg<G, typename store_as<CG>::type>(g);
+		v.template arg<H, typename store_as<CH>::type>(h);
+		v.template arg<I, typename store_as<CI>::type>(i);
+		v.template arg<J, typename store_as<CJ>::type>(j);
+		v.template arg<K, typename store_as<CK>::type>(k);
+		v.template arg<L, typename store_as<CL>::type>(l);
+		v.template arg<M, typename store_as<CM>::type>(m);
+		v.template arg<N, typename store_as<CN>::type>(n);
+		v.template arg<O, typename store_as<CO>::type>(o);
+	}
+	bool operator==(const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &to)
 	{
-		return t(a,b,c,d,e,f,g,h,i);
-	}
-	using Invocable<Y,A,B,C,D,E,F,G,H,I>::operator();
-};
-template <typename T, typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H>
-class DoWrapper<T,Y,A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Invocable<Y,A,B,C,D,E,F,G,H> {
-	T t;
-public:
-	DoWrapper(T templ) : t(templ) {}
-	virtual Y operator()(A a, B b, C c, D d, E e, F f, G g, H h, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType)
+		return (comparer<A>::compare(a, to.a) &&
+				comparer<B>::compare(b, to.b) &&
+				comparer<C>::compare(c, to.c) &&
+				comparer<D>::compare(d, to.d) &&
+				comparer<E>::compare(e, to.e) &&
+				comparer<F>::compare(f, to.f) &&
+				comparer<G>::compare(g, to.g) &&
+				comparer<H>::compare(h, to.h) &&
+				comparer<I>::compare(i, to.i) &&
+				comparer<J>::compare(j, to.j) &&
+				comparer<K>::compare(k, to.k) &&
+				comparer<L>::compare(l, to.l) &&
+				comparer<M>::compare(m, to.m) &&
+				comparer<N>::compare(n, to.n) &&
+				comparer<O>::compare(o, to.o));
+	}
+	unsigned matchingArgs(const base_tuple &tuple)
+	{
+		const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &to = static_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &>(tuple);
+		return (comparer<A>::compare(a, to.a) ? 1 : 0) +
+				(comparer<B>::compare(b, to.b) ? 1 : 0) +
+				(comparer<C>::compare(c, to.c) ? 1 : 0) +
+				(comparer<D>::compare(d, to.d) ? 1 : 0) +
+				(comparer<E>::compare(e, to.e) ? 1 : 0) +
+				(comparer<F>::compare(f, to.f) ? 1 : 0) +
+				(comparer<G>::compare(g, to.g) ? 1 : 0) +
+				(comparer<H>::compare(h, to.h) ? 1 : 0) +
+				(comparer<I>::compare(i, to.i) ? 1 : 0) +
+				(comparer<J>::compare(j, to.j) ? 1 : 0) +
+				(comparer<K>::compare(k, to.k) ? 1 : 0) +
+				(comparer<L>::compare(l, to.l) ? 1 : 0) +
+				(comparer<M>::compare(m, to.m) ? 1 : 0) +
+				(comparer<N>::compare(n, to.n) ? 1 : 0) +
+				(comparer<O>::compare(o, to.o) ? 1 : 0);
+	}
+	void assign_from(ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &from)
 	{
-		return t(a,b,c,d,e,f,g,h);
+		in_assign< typename store_as<CA>::type, A>(a, from.a);
+		in_assign< typename store_as<CB>::type, B>(b, from.b);
+		in_assign< typename store_as<CC>::type, C>(c, from.c);
+		in_assign< typename store_as<CD>::type, D>(d, from.d);
+		in_assign< typename store_as<CE>::type, E>(e, from.e);
+		in_assign< typename store_as<CF>::type, F>(f, from.f);
+		in_assign< typename store_as<CG>::type, G>(g, from.g);
+		in_assign< typename store_as<CH>::type, H>(h, from.h);
+		in_assign< typename store_as<CI>::type, I>(i, from.i);
+		in_assign< typename store_as<CJ>::type, J>(j, from.j);
+		in_assign< typename store_as<CK>::type, K>(k, from.k);
+		in_assign< typename store_as<CL>::type, L>(l, from.l);
+		in_assign< typename store_as<CM>::type, M>(m, from.m);
+		in_assign< typename store_as<CN>::type, N>(n, from.n);
+		in_assign< typename store_as<CO>::type, O>(o, from.o);
 	}
-	using Invocable<Y,A,B,C,D,E,F,G,H>::operator();
-};
-template <typename T, typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G>
-class DoWrapper<T,Y,A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Invocable<Y,A,B,C,D,E,F,G> {
-	T t;
-public:
-	DoWrapper(T templ) : t(templ) {}
-	virtual Y operator()(A a, B b, C c, D d, E e, F f, G g, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType)
+	void assign_to(ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &to)
 	{
-		return t(a,b,c,d,e,f,g);
+		out_assign< typename store_as<CA>::type, A>(a, to.a);
+		out_assign< typename store_as<CB>::type, B>(b, to.b);
+		out_assign< typename store_as<CC>::type, C>(c, to.c);
+		out_assign< typename store_as<CD>::type, D>(d, to.d);
+		out_assign< typename store_as<CE>::type, E>(e, to.e);
+		out_assign< typename store_as<CF>::type, F>(f, to.f);
+		out_assign< typename store_as<CG>::type, G>(g, to.g);
+		out_assign< typename store_as<CH>::type, H>(h, to.h);
+		out_assign< typename store_as<CI>::type, I>(i, to.i);
+		out_assign< typename store_as<CJ>::type, J>(j, to.j);
+		out_assign< typename store_as<CK>::type, K>(k, to.k);
+		out_assign< typename store_as<CL>::type, L>(l, to.l);
+		out_assign< typename store_as<CM>::type, M>(m, to.m);
+		out_assign< typename store_as<CN>::type, N>(n, to.n);
+		out_assign< typename store_as<CO>::type, O>(o, to.o);
 	}
-	using Invocable<Y,A,B,C,D,E,F,G>::operator();
-};
-template <typename T, typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F>
-class DoWrapper<T,Y,A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Invocable<Y,A,B,C,D,E,F> {
-	T t;
-public:
-	DoWrapper(T templ) : t(templ) {}
-	virtual Y operator()(A a, B b, C c, D d, E e, F f, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType)
+	virtual void printTo(std::ostream &os) const
 	{
-		return t(a,b,c,d,e,f);
+		os << "(";
+		printArg<typename store_as<CA>::type>::print(os, a, false);
+		printArg<typename store_as<CB>::type>::print(os, b, true);
+		printArg<typename store_as<CC>::type>::print(os, c, true);
+		printArg<typename store_as<CD>::type>::print(os, d, true);
+		printArg<typename store_as<CE>::type>::print(os, e, true);
+		printArg<typename store_as<CF>::type>::print(os, f, true);
+		printArg<typename store_as<CG>::type>::print(os, g, true);
+		printArg<typename store_as<CH>::type>::print(os, h, true);
+		printArg<typename store_as<CI>::type>::print(os, i, true);
+		printArg<typename store_as<CJ>::type>::print(os, j, true);
+		printArg<typename store_as<CK>::type>::print(os, k, true);
+		printArg<typename store_as<CL>::type>::print(os, l, true);
+		printArg<typename store_as<CM>::type>::print(os, m, true);
+		printArg<typename store_as<CN>::type>::print(os, n, true);
+		printArg<typename store_as<CO>::type>::print(os, o, true);
+		os << ")";
 	}
-	using Invocable<Y,A,B,C,D,E,F>::operator();
 };
-template <typename T, typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E>
-class DoWrapper<T,Y,A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Invocable<Y,A,B,C,D,E> {
-	T t;
+
+template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename M, typename N, typename CA, typename CB, typename CC, typename CD, typename CE, typename CF, typename CG, typename CH, typename CI, typename CJ, typename CK, typename CL, typename CM, typename CN>
+class copy_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType,
+				 CA,CB,CC,CD,CE,CF,CG,CH,CI,CJ,CK,CL,CM,CN,NullType,NullType>
+	: public ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType>
+{
 public:
-	DoWrapper(T templ) : t(templ) {}
-	virtual Y operator()(A a, B b, C c, D d, E e, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType)
+	size_t objectSize() const { return sizeof(*this); }
+	typename store_as<CA>::type a;
+	typename store_as<CB>::type b;
+	typename store_as<CC>::type c;
+	typename store_as<CD>::type d;
+	typename store_as<CE>::type e;
+	typename store_as<CF>::type f;
+	typename store_as<CG>::type g;
+	typename store_as<CH>::type h;
+	typename store_as<CI>::type i;
+	typename store_as<CJ>::type j;
+	typename store_as<CK>::type k;
+	typename store_as<CL>::type l;
+	typename store_as<CM>::type m;
+	typename store_as<CN>::type n;
+	copy_tuple(typename store_as<CA>::type valueA, typename store_as<CB>::type valueB, typename store_as<CC>::type valueC, typename store_as<CD>::type valueD, typename store_as<CE>::type valueE, typename store_as<CF>::type valueF, typename store_as<CG>::type valueG, typename store_as<CH>::type valueH, typename store_as<CI>::type valueI, typename store_as<CJ>::type valueJ, typename store_as<CK>::type valueK, typename store_as<CL>::type valueL, typename store_as<CM>::type valueM, typename store_as<CN>::type valueN)
+		  : a(valueA), b(valueB), c(valueC), d(valueD), e(valueE), f(valueF), g(valueG), h(valueH), i(valueI), j(valueJ), k(valueK), l(valueL), m(valueM), n(valueN)
+	{
+		this->assigning = assigns_arg<typename store_as<CA>::type>::value ||
+			assigns_arg<typename store_as<CB>::type>::value ||
+			assigns_arg<typename store_as<CC>::type>::value ||
+			assigns_arg<typename store_as<CD>::type>::value ||
+			assigns_arg<typename store_as<CE>::type>::value ||
+			assigns_arg<typename store_as<CF>::type>::value ||
+			assigns_arg<typename store_as<CG>::type>::value ||
+			assigns_arg<typename store_as<CH>::type>::value ||
+			assigns_arg<typename store_as<CI>::type>::value ||
+			assigns_arg<typename store_as<CJ>::type>::value ||
+			assigns_arg<typename store_as<CK>::type>::value ||
+			assigns_arg<typename store_as<CL>::type>::value ||
+			assigns_arg<typename store_as<CM>::type>::value ||
+			assigns_arg<typename store_as<CN>::type>::value;
+		this->setKeys(*this);
+	}
+	template <typename V>
+	void visit(V &v) const
+	{
+		v.template arg<A, typename store_as<CA>::type>(a);
+		v.template arg<B, typename store_as<CB>::type>(b);
+		v.template arg<C, typename store_as<CC>::type>(c);
+		v.template arg<D, typename store_as<CD>::type>(d);
+		v.template arg<E, typename store_as<CE>::type>(e);
+		v.template arg<F, typename store_as<CF>::type>(f);
+		v.template arg<G, typename store_as<CG>::type>(g);
+		v.template arg<H, typename store_as<CH>::type>(h);
+		v.template arg<I, typename store_as<CI>::type>(i);
+		v.template arg<J, typename store_as<CJ>::type>(j);
+		v.template arg<K, typename store_as<CK>::type>(k);
+		v.template arg<L, typename store_as<CL>::type>(l);
+		v.template arg<M, typename store_as<CM>::type>(m);
+		v.template arg<N, typename store_as<CN>::type>(n);
+	}
+	bool operator==(const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &to)
 	{
-		return t(a,b,c,d,e);
-	}
-	using Invocable<Y,A,B,C,D,E>::operator();
-};
-template <typename T, typename Y,
-		  typename A, typename B, typename C, typename D>
-class DoWrapper<T,Y,A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Invocable<Y,A,B,C,D> {
-	T t;
-public:
-	DoWrapper(T templ) : t(templ) {}
-	virtual Y operator()(A a, B b, C c, D d, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType)
+		return (comparer<A>::compare(a, to.a) &&
+				comparer<B>::compare(b, to.b) &&
+				comparer<C>::compare(c, to.c) &&
+				comparer<D>::compare(d, to.d) &&
+				comparer<E>::compare(e, to.e) &&
+				comparer<F>::compare(f, to.f) &&
+				comparer<G>::compare(g, to.g) &&
+				comparer<H>::compare(h, to.h) &&
+				comparer<I>::compare(i, to.i) &&
+				comparer<J>::compare(j, to.j) &&
+				comparer<K>::compare(k, to.k) &&
+				comparer<L>::compare(l, to.l) &&
+				comparer<M>::compare(m, to.m) &&
+				comparer<N>::compare(n, to.n));
+	}
+	unsigned matchingArgs(const base_tuple &tuple)
+	{
+		const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &to = static_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &>(tuple);
+		return (comparer<A>::compare(a, to.a) ? 1 : 0) +
+				(comparer<B>::compare(b, to.b) ? 1 : 0) +
+				(comparer<C>::compare(c, to.c) ? 1 : 0) +
+				(comparer<D>::compare(d, to.d) ? 1 : 0) +
+				(comparer<E>::compare(e, to.e) ? 1 : 0) +
+				(comparer<F>::compare(f, to.f) ? 1 : 0) +
+				(comparer<G>::compare(g, to.g) ? 1 : 0) +
+				(comparer<H>::compare(h, to.h) ? 1 : 0) +
+				(comparer<I>::compare(i, to.i) ? 1 : 0) +
+				(comparer<J>::compare(j, to.j) ? 1 : 0) +
+				(comparer<K>::compare(k, to.k) ? 1 : 0) +
+				(comparer<L>::compare(l, to.l) ? 1 : 0) +
+				(comparer<M>::compare(m, to.m) ? 1 : 0) +
+				(comparer<N>::compare(n, to.n) ? 1 : 0);
+	}
+	void assign_from(ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &from)
 	{
-		return t(a,b,c,d);
+		in_assign< typename store_as<CA>::type, A>(a, from.a);
+		in_assign< typename store_as<CB>::type, B>(b, from.b);
+		in_assign< typename store_as<CC>::type, C>(c, from.c);
+		in_assign< typename store_as<CD>::type, D>(d, from.d);
+		in_assign< typename store_as<CE>::type, E>(e, from.e);
+		in_assign< typename store_as<CF>::type, F>(f, from.f);
+		in_assign< typename store_as<CG>::type, G>(g, from.g);
+		in_assign< typename store_as<CH>::type, H>(h, from.h);
+		in_assign< typename store_as<CI>::type, I>(i, from.i);
+		in_assign< typename store_as<CJ>::type, J>(j, from.j);
+		in_assign< typename store_as<CK>::type, K>(k, from.k);
+		in_assign< typename store_as<CL>::type, L>(l, from.l);
+		in_assign< typename store_as<CM>::type, M>(m, from.m);
+		in_assign< typename store_as<CN>::type, N>(n, from.n);
 	}
-	using Invocable<Y,A,B,C,D>::operator();
-};
-template <typename T, typename Y,
-		  typename A, typename B, typename C>
-class DoWrapper<T,Y,A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Invocable<Y,A,B,C> {
-	T t;
-public:
-	DoWrapper(T templ) : t(templ) {}
-	virtual Y operator()(A a, B b, C c, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType)
+	void assign_to(ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &to)
 	{
-		return t(a,b,c);
+		out_assign< typename store_as<CA>::type, A>(a, to.a);
+		out_assign< typename store_as<CB>::type, B>(b, to.b);
+		out_assign< typename store_as<CC>::type, C>(c, to.c);
+		out_assign< typename store_as<CD>::type, D>(d, to.d);
+		out_assign< typename store_as<CE>::type, E>(e, to.e);
+		out_assign< typename store_as<CF>::type, F>(f, to.f);
+		out_assign< typename store_as<CG>::type, G>(g, to.g);
+		out_assign< typename store_as<CH>::type, H>(h, to.h);
+		out_assign< typename store_as<CI>::type, I>(i, to.i);
+		out_assign< typename store_as<CJ>::type, J>(j, to.j);
+		out_assign< typename store_as<CK>::type, K>(k, to.k);
+		out_assign< typename store_as<CL>::type, L>(l, to.l);
+		out_assign< typename store_as<CM>::type, M>(m, to.m);
+		out_assign< typename store_as<CN>::type, N>(n, to.n);
 	}
-	using Invocable<Y,A,B,C>::operator();
-};
-template <typename T, typename Y, typename A, typename B>
-class DoWrapper<T,Y,A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Invocable<Y,A,B> {
-	T t;
-public:
-	DoWrapper(T templ) : t(templ) {}
-	virtual Y operator()(A a, B b, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType)
+	virtual void printTo(std::ostream &os) const
 	{
-		return t(a,b);
-	}
-	using Invocable<Y,A,B>::operator();
-};
-template <typename T, typename Y, typename A>
-class DoWrapper<T,Y,A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Invocable<Y,A> {
-	T t;
-public:
-	DoWrapper(T templ) : t(templ) {}
-	virtual Y operator()(A a, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType)
-	{
-		return t(a);
+		os << "(";
+		printArg<typename store_as<CA>::type>::print(os, a, false);
+		printArg<typename store_as<CB>::type>::print(os, b, true);
+		printArg<typename store_as<CC>::type>::print(os, c, true);
+		printArg<typename store_as<CD>::type>::print(os, d, true);
+		printArg<typename store_as<CE>::type>::print(os, e, true);
+		printArg<typename store_as<CF>::type>::print(os, f, true);
+		printArg<typename store_as<CG>::type>::print(os, g, true);
+		printArg<typename store_as<CH>::type>::print(os, h, true);
+		printArg<typename store_as<CI>::type>::print(os, i, true);
+		printArg<typename store_as<CJ>::type>::print(os, j, true);
+		printArg<typename store_as<CK>::type>::print(os, k, true);
+		printArg<typename store_as<CL>::type>::print(os, l, true);
+		printArg<typename store_as<CM>::type>::print(os, m, true);
+		printArg<typename store_as<CN>::type>::print(os, n, true);
+		os << ")";
 	}
-	using Invocable<Y,A>::operator();
 };
-template <typename T, typename Y>
-class DoWrapper<T,Y,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Invocable<Y> {
-	T t;
+
+template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename M, typename CA, typename CB, typename CC, typename CD, typename CE, typename CF, typename CG, typename CH, typename CI, typename CJ, typename CK, typename CL, typename CM>
+class copy_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType,
+				 CA,CB,CC,CD,CE,CF,CG,CH,CI,CJ,CK,CL,CM,NullType,NullType,NullType>
+	: public ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType>
+{
 public:
-	DoWrapper(T templ) : t(templ) {}
-	virtual Y operator()(NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType, NullType)
+	size_t objectSize() const { return sizeof(*this); }
+	typename store_as<CA>::type a;
+	typename store_as<CB>::type b;
+	typename store_as<CC>::type c;
+	typename store_as<CD>::type d;
+	typename store_as<CE>::type e;
+	typename store_as<CF>::type f;
+	typename store_as<CG>::type g;
+	typename store_as<CH>::type h;
+	typename store_as<CI>::type i;
+	typename store_as<CJ>::type j;
+	typename store_as<CK>::type k;
+	typename store_as<CL>::type l;
+	typename store_as<CM>::type m;
+	copy_tuple(typename store_as<CA>::type valueA, typename store_as<CB>::type valueB, typename store_as<CC>::type valueC, typename store_as<CD>::type valueD, typename store_as<CE>::type valueE, typename store_as<CF>::type valueF, typename store_as<CG>::type valueG, typename store_as<CH>::type valueH, typename store_as<CI>::type valueI, typename store_as<CJ>::type valueJ, typename store_as<CK>::type valueK, typename store_as<CL>::type valueL, typename store_as<CM>::type valueM)
+		  : a(valueA), b(valueB), c(valueC), d(valueD), e(valueE), f(valueF), g(valueG), h(valueH), i(valueI), j(valueJ), k(valueK), l(valueL), m(valueM)
+	{
+		this->assigning = assigns_arg<typename store_as<CA>::type>::value ||
+			assigns_arg<typename store_as<CB>::type>::value ||
+			assigns_arg<typename store_as<CC>::type>::value ||
+			assigns_arg<typename store_as<CD>::type>::value ||
+			assigns_arg<typename store_as<CE>::type>::value ||
+			assigns_arg<typename store_as<CF>::type>::value ||
+			assigns_arg<typename store_as<CG>::type>::value ||
+			assigns_arg<typename store_as<CH>::type>::value ||
+			assigns_arg<typename store_as<CI>::type>::value ||
+			assigns_arg<typename store_as<CJ>::type>::value ||
+			assigns_arg<typename store_as<CK>::type>::value ||
+			assigns_arg<typename store_as<CL>::type>::value ||
+			assigns_arg<typename store_as<CM>::type>::value;
+		this->setKeys(*this);
+	}
+	template <typename V>
+	void visit(V &v) const
+	{
+		v.template arg<A, typename store_as<CA>::type>(a);
+		v.template arg<B, typename store_as<CB>::type>(b);
+		v.template arg<C, typename store_as<CC>::type>(c);
+		v.template arg<D, typename store_as<CD>::type>(d);
+		v.template arg<E, typename store_as<CE>::type>(e);
+		v.template arg<F, typename store_as<CF>::type>(f);
+		v.template arg<G, typename store_as<CG>::type>(g);
+		v.template arg<H, typename store_as<CH>::type>(h);
+		v.template arg<I, typename store_as<CI>::type>(i);
+		v.template arg<J, typename store_as<CJ>::type>(j);
+		v.template arg<K, typename store_as<CK>::type>(k);
+		v.template arg<L, typename store_as<CL>::type>(l);
+		v.template arg<M, typename store_as<CM>::type>(m);
+	}
+	bool operator==(const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &to)
+	{
+		return (comparer<A>::compare(a, to.a) &&
+				comparer<B>::compare(b, to.b) &&
+				comparer<C>::compare(c, to.c) &&
+				comparer<D>::compare(d, to.d) &&
+				comparer<E>::compare(e, to.e) &&
+				comparer<F>::compare(f, to.f) &&
+				comparer<G>::compare(g, to.g) &&
+				comparer<H>::compare(h, to.h) &&
+				comparer<I>::compare(i, to.i) &&
+				comparer<J>::compare(j, to.j) &&
+				comparer<K>::compare(k, to.k) &&
+				comparer<L>::compare(l, to.l) &&
+				comparer<M>::compare(m, to.m));
+	}
+	unsigned matchingArgs(const base_tuple &tuple)
+	{
+		const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &to = static_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &>(tuple);
+		return (comparer<A>::compare(a, to.a) ? 1 : 0) +
+				(comparer<B>::compare(b, to.b) ? 1 : 0) +
+				(comparer<C>::compare(c, to.c) ? 1 : 0) +
+				(comparer<D>::compare(d, to.d) ? 1 : 0) +
+				(comparer<E>::compare(e, to.e) ? 1 : 0) +
+				(comparer<F>::compare(f, to.f) ? 1 : 0) +
+				(comparer<G>::compare(g, to.g) ? 1 : 0) +
+				(comparer<H>::compare(h, to.h) ? 1 : 0) +
+				(comparer<I>::compare(i, to.i) ? 1 : 0) +
+				(comparer<J>::compare(j, to.j) ? 1 : 0) +
+				(comparer<K>::compare(k, to.k) ? 1 : 0) +
+				(comparer<L>::compare(l, to.l) ? 1 : 0) +
+				(comparer<M>::compare(m, to.m) ? 1 : 0);
+	}
+	void assign_from(ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &from)
 	{
-		return t();
+		in_assign< typename store_as<CA>::type, A>(a, from.a);
+		in_assign< typename store_as<CB>::type, B>(b, from.b);
+		in_assign< typename store_as<CC>::type, C>(c, from.c);
+		in_assign< typename store_as<CD>::type, D>(d, from.d);
+		in_assign< typename store_as<CE>::type, E>(e, from.e);
+		in_assign< typename store_as<CF>::type, F>(f, from.f);
+		in_assign< typename store_as<CG>::type, G>(g, from.g);
+		in_assign< typename store_as<CH>::type, H>(h, from.h);
+		in_assign< typename store_as<CI>::type, I>(i, from.i);
+		in_assign< typename store_as<CJ>::type, J>(j, from.j);
+		in_assign< typename store_as<CK>::type, K>(k, from.k);
+		in_assign< typename store_as<CL>::type, L>(l, from.l);
+		in_assign< typename store_as<CM>::type, M>(m, from.m);
+	}
+	void assign_to(ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &to)
+	{
+		out_assign< typename store_as<CA>::type, A>(a, to.a);
+		out_assign< typename store_as<CB>::type, B>(b, to.b);
+		out_assign< typename store_as<CC>::type, C>(c, to.c);
+		out_assign< typename store_as<CD>::type, D>(d, to.d);
+		out_assign< typename store_as<CE>::type, E>(e, to.e);
+		out_assign< typename store_as<CF>::type, F>(f, to.f);
+		out_assign< typename store_as<CG>::type, G>(g, to.g);
+		out_assign< typename store_as<CH>::type, H>(h, to.h);
+		out_assign< typename store_as<CI>::type, I>(i, to.i);
+		out_assign< typename store_as<CJ>::type, J>(j, to.j);
+		out_assign< typename store_as<CK>::type, K>(k, to.k);
+		out_assign< typename store_as<CL>::type, L>(l, to.l);
+		out_assign< typename store_as<CM>::type, M>(m, to.m);
+	}
+	virtual void printTo(std::ostream &os) const
+	{
+		os << "(";
+		printArg<typename store_as<CA>::type>::print(os, a, false);
+		printArg<typename store_as<CB>::type>::print(os, b, true);
+		printArg<typename store_as<CC>::type>::print(os, c, true);
+		printArg<typename store_as<CD>::type>::print(os, d, true);
+		printArg<typename store_as<CE>::type>::print(os, e, true);
+		printArg<typename store_as<CF>::type>::print(os, f, true);
+		printArg<typename store_as<CG>::type>::print(os, g, true);
+		printArg<typename store_as<CH>::type>::print(os, h, true);
+		printArg<typename store_as<CI>::type>::print(os, i, true);
+		printArg<typename store_as<CJ>::type>::print(os, j, true);
+		printArg<typename store_as<CK>::type>::print(os, k, true);
+		printArg<typename store_as<CL>::type>::print(os, l, true);
+		printArg<typename store_as<CM>::type>::print(os, m, true);
+		os << ")";
 	}
-	using Invocable<Y>::operator();
-};
-
-class ReturnValueHolder {
-public:
-	virtual ~ReturnValueHolder() {}
-};
-
-template <class T>
-class ReturnValueWrapper : public ReturnValueHolder {
-public:
-   virtual T value() = 0;
-};
-
-template <class T>
-class ReturnValueWrapperCopy : public ReturnValueWrapper<T> {
-public:
-	typename no_cref<T>::type rv;
-	ReturnValueWrapperCopy(T retValue) : rv(retValue) {}
-   virtual T value() { return rv; };
-};
-
-template <class T>
-class ReturnValueWrapperRef : public ReturnValueWrapper<T> {
-public:
-	T rv;
-	ReturnValueWrapperRef(T retValue) : rv(retValue) {}
-   virtual T value() { return rv; };
 };
 
-//Call wrapping
-class Call {
+template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename CA, typename CB, typename CC, typename CD, typename CE, typename CF, typename CG, typename CH, typename CI, typename CJ, typename CK, typename CL>
+class copy_tuple<A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType,
+				 CA,CB,CC,CD,CE,CF,CG,CH,CI,CJ,CK,CL,NullType,NullType,NullType,NullType>
+	: public ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType>
+{
 public:
-	virtual bool matchesArgs(const base_tuple &tuple) = 0;
-	virtual void assignArgs(base_tuple &tuple) = 0;
-	ReturnValueHolder *retVal;
-#ifndef HM_NO_EXCEPTIONS
-	ExceptionHolder *eHolder;
-#endif
-	base_mock *mock;
-	VirtualDestructable *functor;
-	VirtualDestructable *matchFunctor;
-	std::pair<int, int> funcIndex;
-	std::list<Call *> previousCalls;
-	unsigned called;
-	RegistrationType expectation;
-	bool satisfied;
-	int lineno;
-	const char *funcName;
-	const char *fileName;
-protected:
-	Call(RegistrationType expect, base_mock *baseMock, const std::pair<int, int> &index, int X, const char *func, const char *file)
-		: retVal(0),
-#ifndef HM_NO_EXCEPTIONS
-		eHolder(0),
-#endif
-		mock(baseMock),
-		functor(0),
-		matchFunctor(0),
-		funcIndex(index),
-		called( 0 ),
-		expectation(expect),
-		satisfied(false),
-		lineno(X),
-		funcName(func),
-		fileName(file)
+	size_t objectSize() const { return sizeof(*this); }
+	typename store_as<CA>::type a;
+	typename store_as<CB>::type b;
+	typename store_as<CC>::type c;
+	typename store_as<CD>::type d;
+	typename store_as<CE>::type e;
+	typename store_as<CF>::type f;
+	typename store_as<CG>::type g;
+	typename store_as<CH>::type h;
+	typename store_as<CI>::type i;
+	typename store_as<CJ>::type j;
+	typename store_as<CK>::type k;
+	typename store_as<CL>::type l;
+	copy_tuple(typename store_as<CA>::type valueA, typename store_as<CB>::type valueB, typename store_as<CC>::type valueC, typename store_as<CD>::type valueD, typename store_as<CE>::type valueE, typename store_as<CF>::type valueF, typename store_as<CG>::type valueG, typename store_as<CH>::type valueH, typename store_as<CI>::type valueI, typename store_as<CJ>::type valueJ, typename store_as<CK>::type valueK, typename store_as<CL>::type valueL)
+		  : a(valueA), b(valueB), c(valueC), d(valueD), e(valueE), f(valueF), g(valueG), h(valueH), i(valueI), j(valueJ), k(valueK), l(valueL)
+	{
+		this->assigning = assigns_arg<typename store_as<CA>::type>::value ||
+			assigns_arg<typename store_as<CB>::type>::value ||
+			assigns_arg<typename store_as<CC>::type>::value ||
+			assigns_arg<typename store_as<CD>::type>::value ||
+			assigns_arg<typename store_as<CE>::type>::value ||
+			assigns_arg<typename store_as<CF>::type>::value ||
+			assigns_arg<typename store_as<CG>::type>::value ||
+			assigns_arg<typename store_as<CH>::type>::value ||
+			assigns_arg<typename store_as<CI>::type>::value ||
+			assigns_arg<typename store_as<CJ>::type>::value ||
+			assigns_arg<typename store_as<CK>::type>::value ||
+			assigns_arg<typename store_as<CL>::type>::value;
+		this->setKeys(*this);
+	}
+	template <typename V>
+	void visit(V &v) const
+	{
+		v.template arg<A, typename store_as<CA>::type>(a);
+		v.template arg<B, typename store_as<CB>::type>(b);
+		v.template arg<C, typename store_as<CC>::type>(c);
+		v.template arg<D, typename store_as<CD>::type>(d);
+		v.template arg<E, typename store_as<CE>::type>(e);
+		v.template arg<F, typename store_as<CF>::type>(f);
+		v.template arg<G, typename store_as<CG>::type>(g);
+		v.template arg<H, typename store_as<CH>::type>(h);
+		v.template arg<I, typename store_as<CI>::type>(i);
+		v.template arg<J, typename store_as<CJ>::type>(j);
+		v.template arg<K, typename store_as<CK>::type>(k);
+		v.template arg<L, typename store_as<CL>::type>(l);
+	}
+	bool operator==(const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &to)
+	{
+		return (comparer<A>::compare(a, to.a) &&
+				comparer<B>::compare(b, to.b) &&
+				comparer<C>::compare(c, to.c) &&
+				comparer<D>::compare(d, to.d) &&
+				comparer<E>::compare(e, to.e) &&
+				comparer<F>::compare(f, to.f) &&
+				comparer<G>::compare(g, to.g) &&
+				comparer<H>::compare(h, to.h) &&
+				comparer<I>::compare(i, to.i) &&
+				comparer<J>::compare(j, to.j) &&
+				comparer<K>::compare(k, to.k) &&
+				comparer<L>::compare(l, to.l));
+	}
+	unsigned matchingArgs(const base_tuple &tuple)
+	{
+		const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &to = static_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &>(tuple);
+		return (comparer<A>::compare(a, to.a) ? 1 : 0) +
+				(comparer<B>::compare(b, to.b) ? 1 : 0) +
+				(comparer<C>::compare(c, to.c) ? 1 : 0) +
+				(comparer<D>::compare(d, to.d) ? 1 : 0) +
+				(comparer<E>::compare(e, to.e) ? 1 : 0) +
+				(comparer<F>::compare(f, to.f) ? 1 : 0) +
+				(comparer<G>::compare(g, to.g) ? 1 : 0) +
+				(comparer<H>::compare(h, to.h) ? 1 : 0) +
+				(comparer<I>::compare(i, to.i) ? 1 : 0) +
+				(comparer<J>::compare(j, to.j) ? 1 : 0) +
+				(comparer<K>::compare(k, to.k) ? 1 : 0) +
+				(comparer<L>::compare(l, to.l) ? 1 : 0);
+	}
+	void assign_from(ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &from)
 	{
+		in_assign< typename store_as<CA>::type, A>(a, from.a);
+		in_assign< typename store_as<CB>::type, B>(b, from.b);
+		in_assign< typename store_as<CC>::type, C>(c, from.c);
+		in_assign< typename store_as<CD>::type, D>(d, from.d);
+		in_assign< typename store_as<CE>::type, E>(e, from.e);
+		in_assign< typename store_as<CF>::type, F>(f, from.f);
+		in_assign< typename store_as<CG>::type, G>(g, from.g);
+		in_assign< typename store_as<CH>::type, H>(h, from.h);
+		in_assign< typename store_as<CI>::type, I>(i, from.i);
+		in_assign< typename store_as<CJ>::type, J>(j, from.j);
+		in_assign< typename store_as<CK>::type, K>(k, from.k);
+		in_assign< typename store_as<CL>::type, L>(l, from.l);
 	}
-public:
-	virtual const base_tuple *getArgs() const = 0;
-	virtual ~Call()
+	void assign_to(ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &to)
 	{
-#ifndef HM_NO_EXCEPTIONS
-		delete eHolder;
-#endif
-		delete functor;
-		delete matchFunctor;
-		delete retVal;
+		out_assign< typename store_as<CA>::type, A>(a, to.a);
+		out_assign< typename store_as<CB>::type, B>(b, to.b);
+		out_assign< typename store_as<CC>::type, C>(c, to.c);
+		out_assign< typename store_as<CD>::type, D>(d, to.d);
+		out_assign< typename store_as<CE>::type, E>(e, to.e);
+		out_assign< typename store_as<CF>::type, F>(f, to.f);
+		out_assign< typename store_as<CG>::type, G>(g, to.g);
+		out_assign< typename store_as<CH>::type, H>(h, to.h);
+		out_assign< typename store_as<CI>::type, I>(i, to.i);
+		out_assign< typename store_as<CJ>::type, J>(j, to.j);
+		out_assign< typename store_as<CK>::type, K>(k, to.k);
+		out_assign< typename store_as<CL>::type, L>(l, to.l);
+	}
+	virtual void printTo(std::ostream &os) const
+	{
+		os << "(";
+		printArg<typename store_as<CA>::type>::print(os, a, false);
+		printArg<typename store_as<CB>::type>::print(os, b, true);
+		printArg<typename store_as<CC>::type>::print(os, c, true);
+		printArg<typename store_as<CD>::type>::print(os, d, true);
+		printArg<typename store_as<CE>::type>::print(os, e, true);
+		printArg<typename store_as<CF>::type>::print(os, f, true);
+		printArg<typename store_as<CG>::type>::print(os, g, true);
+		printArg<typename store_as<CH>::type>::print(os, h, true);
+		printArg<typename store_as<CI>::type>::print(os, i, true);
+		printArg<typename store_as<CJ>::type>::print(os, j, true);
+		printArg<typename store_as<CK>::type>::print(os, k, true);
+		printArg<typename store_as<CL>::type>::print(os, l, true);
+		os << ")";
 	}
 };
 
-std::ostream &operator<<(std::ostream &os, const Call &call);
-
-template <typename Y,
-		  typename A = NullType, typename B = NullType, typename C = NullType, typename D = NullType,
-		  typename E = NullType, typename F = NullType, typename G = NullType, typename H = NullType,
-		  typename I = NullType, typename J = NullType, typename K = NullType, typename L = NullType,
-		  typename M = NullType, typename N = NullType, typename O = NullType, typename P = NullType>
-class TCall : public Call {
-private:
-	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> *args;
+template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename CA, typename CB, typename CC, typename CD, typename CE, typename CF, typename CG, typename CH, typename CI, typename CJ, typename CK>
+class copy_tuple<A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType,
+				 CA,CB,CC,CD,CE,CF,CG,CH,CI,CJ,CK,NullType,NullType,NullType,NullType,NullType>
+	: public ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType>
+{
 public:
-		const base_tuple *getArgs() const { return args; }
-	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
-	~TCall() { delete args; }
-	bool matchesArgs(const base_tuple &tupl) {
-		return (!args && !matchFunctor) ||
-			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &>(tupl))) ||
-			(matchFunctor && (*(TupleInvocable<bool> *)(matchFunctor))(tupl));
+	size_t objectSize() const { return sizeof(*this); }
+	typename store_as<CA>::type a;
+	typename store_as<CB>::type b;
+	typename store_as<CC>::type c;
+	typename store_as<CD>::type d;
+	typename store_as<CE>::type e;
+	typename store_as<CF>::type f;
+	typename store_as<CG>::type g;
+	typename store_as<CH>::type h;
+	typename store_as<CI>::type i;
+	typename store_as<CJ>::type j;
+	typename store_as<CK>::type k;
+	copy_tuple(typename store_as<CA>::type valueA, typename store_as<CB>::type valueB, typename store_as<CC>::type valueC, typename store_as<CD>::type valueD, typename store_as<CE>::type valueE, typename store_as<CF>::type valueF, typename store_as<CG>::type valueG, typename store_as<CH>::type valueH, typename store_as<CI>::type valueI, typename store_as<CJ>::type valueJ, typename store_as<CK>::type valueK)
+		  : a(valueA), b(valueB), c(valueC), d(valueD), e(valueE), f(valueF), g(valueG), h(valueH), i(valueI), j(valueJ), k(valueK)
+	{
+		this->assigning = assigns_arg<typename store_as<CA>::type>::value ||
+			assigns_arg<typename store_as<CB>::type>::value ||
+			assigns_arg<typename store_as<CC>::type>::value ||
+			assigns_arg<typename store_as<CD>::type>::value ||
+			assigns_arg<typename store_as<CE>::type>::value ||
+			assigns_arg<typename store_as<CF>::type>::value ||
+			assigns_arg<typename store_as<CG>::type>::value ||
+			assigns_arg<typename store_as<CH>::type>::value ||
+			assigns_arg<typename store_as<CI>::type>::value ||
+			assigns_arg<typename store_as<CJ>::type>::value ||
+			assigns_arg<typename store_as<CK>::type>::value;
+		this->setKeys(*this);
+	}
+	template <typename V>
+	void visit(V &v) const
+	{
+		v.template arg<A, typename store_as<CA>::type>(a);
+		v.template arg<B, typename store_as<CB>::type>(b);
+		v.template arg<C, typename store_as<CC>::type>(c);
+		v.template arg<D, typename store_as<CD>::type>(d);
+		v.template arg<E, typename store_as<CE>::type>(e);
+		v.template arg<F, typename store_as<CF>::type>(f);
+		v.template arg<G, typename store_as<CG>::type>(g);
+		v.template arg<H, typename store_as<CH>::type>(h);
+		v.template arg<I, typename store_as<CI>::type>(i);
+		v.template arg<J, typename store_as<CJ>::type>(j);
+		v.template arg<K, typename store_as<CK>::type>(k);
+	}
+	bool operator==(const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &to)
+	{
+		return (comparer<A>::compare(a, to.a) &&
+				comparer<B>::compare(b, to.b) &&
+				comparer<C>::compare(c, to.c) &&
+				comparer<D>::compare(d, to.d) &&
+				comparer<E>::compare(e, to.e) &&
+				comparer<F>::compare(f, to.f) &&
+				comparer<G>::compare(g, to.g) &&
+				comparer<H>::compare(h, to.h) &&
+				comparer<I>::compare(i, to.i) &&
+				comparer<J>::compare(j, to.j) &&
+				comparer<K>::compare(k, to.k));
 	}
-	void assignArgs(base_tuple &tupl) {
-		if(args) {
-			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &>(tupl));
-			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &>(tupl));
-		}
+	unsigned matchingArgs(const base_tuple &tuple)
+	{
+		const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &to = static_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &>(tuple);
+		return (comparer<A>::compare(a, to.a) ? 1 : 0) +
+				(comparer<B>::compare(b, to.b) ? 1 : 0) +
+				(comparer<C>::compare(c, to.c) ? 1 : 0) +
+				(comparer<D>::compare(d, to.d) ? 1 : 0) +
+				(comparer<E>::compare(e, to.e) ? 1 : 0) +
+				(comparer<F>::compare(f, to.f) ? 1 : 0) +
+				(comparer<G>::compare(g, to.g) ? 1 : 0) +
+				(comparer<H>::compare(h, to.h) ? 1 : 0) +
+				(comparer<I>::compare(i, to.i) ? 1 : 0) +
+				(comparer<J>::compare(j, to.j) ? 1 : 0) +
+				(comparer<K>::compare(k, to.k) ? 1 : 0);
 	}
-	template <typename CA, typename CB, typename CC, typename CD,
-			  typename CE, typename CF, typename CG, typename CH,
-			  typename CI, typename CJ, typename CK, typename CL,
-			  typename CM, typename CN, typename CO, typename CP>
-	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g, const CH & h, const CI & i, const CJ & j, const CK & k, const CL & l, const CM & m, const CN & n, const CO & o, const CP & p) {
-		args = new copy_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P,
-								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,const CH &,const CI &,const CJ &,const CK &,const CL &,const CM &,const CN &,const CO &,const CP &>(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p);
-		return *this;
+	void assign_from(ref_tuple<A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &from)
+	{
+		in_assign< typename store_as<CA>::type, A>(a, from.a);
+		in_assign< typename store_as<CB>::type, B>(b, from.b);
+		in_assign< typename store_as<CC>::type, C>(c, from.c);
+		in_assign< typename store_as<CD>::type, D>(d, from.d);
+		in_assign< typename store_as<CE>::type, E>(e, from.e);
+		in_assign< typename store_as<CF>::type, F>(f, from.f);
+		in_assign< typename store_as<CG>::type, G>(g, from.g);
+		in_assign< typename store_as<CH>::type, H>(h, from.h);
+		in_assign< typename store_as<CI>::type, I>(i, from.i);
+		in_assign< typename store_as<CJ>::type, J>(j, from.j);
+		in_assign< typename store_as<CK>::type, K>(k, from.k);
 	}
-	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &After(Call &call) {
-		previousCalls.push_back(&call);
-		return *this;
+	void assign_to(ref_tuple<A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &to)
+	{
+		out_assign< typename store_as<CA>::type, A>(a, to.a);
+		out_assign< typename store_as<CB>::type, B>(b, to.b);
+		out_assign< typename store_as<CC>::type, C>(c, to.c);
+		out_assign< typename store_as<CD>::type, D>(d, to.d);
+		out_assign< typename store_as<CE>::type, E>(e, to.e);
+		out_assign< typename store_as<CF>::type, F>(f, to.f);
+		out_assign< typename store_as<CG>::type, G>(g, to.g);
+		out_assign< typename store_as<CH>::type, H>(h, to.h);
+		out_assign< typename store_as<CI>::type, I>(i, to.i);
+		out_assign< typename store_as<CJ>::type, J>(j, to.j);
+		out_assign< typename store_as<CK>::type, K>(k, to.k);
+	}
+	virtual void printTo(std::ostream &os) const
+	{
+		os << "(";
+		printArg<typename store_as<CA>::type>::print(os, a, false);
+		printArg<typename store_as<CB>::type>::print(os, b, true);
+		printArg<typename store_as<CC>::type>::print(os, c, true);
+		printArg<typename store_as<CD>::type>::print(os, d, true);
+		printArg<typename store_as<CE>::type>::print(os, e, true);
+		printArg<typename store_as<CF>::type>::print(os, f, true);
+		printArg<typename store_as<CG>::type>::print(os, g, true);
+		printArg<typename store_as<CH>::type>::print(os, h, true);
+		printArg<typename store_as<CI>::type>::print(os, i, true);
+		printArg<typename store_as<CJ>::type>::print(os, j, true);
+		printArg<typename store_as<CK>::type>::print(os, k, true);
+		os << ")";
 	}
-	template <typename T>
-	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &Do(T function) { functor = new DoWrapper<T,Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P>(function); return *this; }
-	template <typename T>
-	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &Match(T function) { matchFunctor = new DoWrapper<T,bool,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P>(function); return *this; }
-	Call &Return(Y obj) { retVal = new ReturnValueWrapperCopy<Y>(obj); return *this; }
-	Call &ReturnByRef(Y obj) { retVal = new ReturnValueWrapperRef<Y>(obj); return *this; }
-#ifndef HM_NO_EXCEPTIONS
-	template <typename Ex>
-	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
-#endif
 };
-template <typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J, typename K, typename L,
-		  typename M, typename N, typename O, typename P>
-class TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> : public Call {
-private:
-	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> *args;
+
+template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename CA, typename CB, typename CC, typename CD, typename CE, typename CF, typename CG, typename CH, typename CI, typename CJ>
+class copy_tuple<A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType,
+				 CA,CB,CC,CD,CE,CF,CG,CH,CI,CJ,NullType,NullType,NullType,NullType,NullType,NullType>
+	: public ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType>
+{
 public:
-		const base_tuple *getArgs() const { return args; }
-	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
-	~TCall() { delete args; }
-	bool matchesArgs(const base_tuple &tupl) {
-		return (!args && !matchFunctor) ||
-			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &>(tupl))) ||
-			(matchFunctor && (*(TupleInvocable<bool> *)(matchFunctor))(tupl));
+	size_t objectSize() const { return sizeof(*this); }
+	typename store_as<CA>::type a;
+	typename store_as<CB>::type b;
+	typename store_as<CC>::type c;
+	typename store_as<CD>::type d;
+	typename store_as<CE>::type e;
+	typename store_as<CF>::type f;
+	typename store_as<CG>::type g;
+	typename store_as<CH>::type h;
+	typename store_as<CI>::type i;
+	typename store_as<CJ>::type j;
+	copy_tuple(typename store_as<CA>::type valueA, typename store_as<CB>::type valueB, typename store_as<CC>::type valueC, typename store_as<CD>::type valueD, typename store_as<CE>::type valueE, typename store_as<CF>::type valueF, typename store_as<CG>::type valueG, typename store_as<CH>::type valueH, typename store_as<CI>::type valueI, typename store_as<CJ>::type valueJ)
+		  : a(valueA), b(valueB), c(valueC), d(valueD), e(valueE), f(valueF), g(valueG), h(valueH), i(valueI), j(valueJ)
+	{
+		this->assigning = assigns_arg<typename store_as<CA>::type>::value ||
+			assigns_arg<typename store_as<CB>::type>::value ||
+			assigns_arg<typename store_as<CC>::type>::value ||
+			assigns_arg<typename store_as<CD>::type>::value ||
+			assigns_arg<typename store_as<CE>::type>::value ||
+			assigns_arg<typename store_as<CF>::type>::value ||
+			assigns_arg<typename store_as<CG>::type>::value ||
+			assigns_arg<typename store_as<CH>::type>::value ||
+			assigns_arg<typename store_as<CI>::type>::value ||
+			assigns_arg<typename store_as<CJ>::type>::value;
+		this->setKeys(*this);
+	}
+	template <typename V>
+	void visit(V &v) const
+	{
+		v.template arg<A, typename store_as<CA>::type>(a);
+		v.template arg<B, typename store_as<CB>::type>(b);
+		v.template arg<C, typename store_as<CC>::type>(c);
+		v.template arg<D, typename store_as<CD>::type>(d);
+		v.template arg<E, typename store_as<CE>::type>(e);
+		v.template arg<F, typename store_as<CF>::type>(f);
+		v.template arg<G, typename store_as<CG>::type>(g);
+		v.template arg<H, typename store_as<CH>::type>(h);
+		v.template arg<I, typename store_as<CI>::type>(i);
+		v.template arg<J, typename store_as<CJ>::type>(j);
+	}
+	bool operator==(const ref_tuple<A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &to)
+	{
+		return (comparer<A>::compare(a, to.a) &&
+				comparer<B>::compare(b, to.b) &&
+				comparer<C>::compare(c, to.c) &&
+				comparer<D>::compare(d, to.d) &&
+				comparer<E>::compare(e, to.e) &&
+				comparer<F>::compare(f, to.f) &&
+				comparer<G>::compare(g, to.g) &&
+				comparer<H>::compare(h, to.h) &&
+				comparer<I>::compare(i, to.i) &&
+				comparer<J>::compare(j, to.j));
 	}
-	void assignArgs(base_tuple &tupl) {
-		if(args) {
-			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &>(tupl));
-			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &>(tupl));
-		}
+	unsigned matchingArgs(const base_tuple &tuple)
+	{
+		const ref_tuple<A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &to = static_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &>(tuple);
+		return (comparer<A>::compare(a, to.a) ? 1 : 0) +
+				(comparer<B>::compare(b, to.b) ? 1 : 0) +
+				(comparer<C>::compare(c, to.c) ? 1 : 0) +
+				(comparer<D>::compare(d, to.d) ? 1 : 0) +
+				(comparer<E>::compare(e, to.e) ? 1 : 0) +
+				(comparer<F>::compare(f, to.f) ? 1 : 0) +
+				(comparer<G>::compare(g, to.g) ? 1 : 0) +
+				(comparer<H>::compare(h, to.h) ? 1 : 0) +
+				(comparer<I>::compare(i, to.i) ? 1 : 0) +
+				(comparer<J>::compare(j, to.j) ? 1 : 0);
 	}
-	template <typename CA, typename CB, typename CC, typename CD,
-			  typename CE, typename CF, typename CG, typename CH,
-			  typename CI, typename CJ, typename CK, typename CL,
-			  typename CM, typename CN, typename CO, typename CP>
-	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g, const CH & h, const CI & i, const CJ & j, const CK & k, const CL & l, const CM & m, const CN & n, const CO & o, const CP & p) {
-		args = new copy_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P,
-								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,const CH &,const CI &,const CJ &,const CK &,const CL &,const CM &,const CN &,const CO &,const CP &>(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p);
-		return *this;
+	void assign_from(ref_tuple<A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &from)
+	{
+		in_assign< typename store_as<CA>::type, A>(a, from.a);
+		in_assign< typename store_as<CB>::type, B>(b, from.b);
+		in_assign< typename store_as<CC>::type, C>(c, from.c);
+		in_assign< typename store_as<CD>::type, D>(d, from.d);
+		in_assign< typename store_as<CE>::type, E>(e, from.e);
+		in_assign< typename store_as<CF>::type, F>(f, from.f);
+		in_assign< typename store_as<CG>::type, G>(g, from.g);
+		in_assign< typename store_as<CH>::type, H>(h, from.h);
+		in_assign< typename store_as<CI>::type, I>(i, from.i);
+		in_assign< typename store_as<CJ>::type, J>(j, from.j);
 	}
-	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &After(Call &call) {
-		previousCalls.push_back(&call);
-		return *this;
+	void assign_to(ref_tuple<A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &to)
+	{
+		out_assign< typename store_as<CA>::type, A>(a, to.a);
+		out_assign< typename store_as<CB>::type, B>(b, to.b);
+		out_assign< typename store_as<CC>::type, C>(c, to.c);
+		out_assign< typename store_as<CD>::type, D>(d, to.d);
+		out_assign< typename store_as<CE>::type, E>(e, to.e);
+		out_assign< typename store_as<CF>::type, F>(f, to.f);
+		out_assign< typename store_as<CG>::type, G>(g, to.g);
+		out_assign< typename store_as<CH>::type, H>(h, to.h);
+		out_assign< typename store_as<CI>::type, I>(i, to.i);
+		out_assign< typename store_as<CJ>::type, J>(j, to.j);
+	}
+	virtual void printTo(std::ostream &os) const
+	{
+		os << "(";
+		printArg<typename store_as<CA>::type>::print(os, a, false);
+		printArg<typename store_as<CB>::type>::print(os, b, true);
+		printArg<typename store_as<CC>::type>::print(os, c, true);
+		printArg<typename store_as<CD>::type>::print(os, d, true);
+		printArg<typename store_as<CE>::type>::print(os, e, true);
+		printArg<typename store_as<CF>::type>::print(os, f, true);
+		printArg<typename store_as<CG>::type>::print(os, g, true);
+		printArg<typename store_as<CH>::type>::print(os, h, true);
+		printArg<typename store_as<CI>::type>::print(os, i, true);
+		printArg<typename store_as<CJ>::type>::print(os, j, true);
+		os << ")";
 	}
-	template <typename T>
-	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &Do(T function) { functor = new DoWrapper<T,void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P>(function); return *this; }
-	template <typename T>
-	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &Match(T function) { matchFunctor = new DoWrapper<T,bool,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P>(function); return *this; }
-#ifndef HM_NO_EXCEPTIONS
-	template <typename Ex>
-	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
-#endif
 };
 
-template <typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J, typename K, typename L,
-		  typename M, typename N, typename O>
-class TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> : public Call {
-private:
-	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> *args;
+template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename CA, typename CB, typename CC, typename CD, typename CE, typename CF, typename CG, typename CH, typename CI>
+class copy_tuple<A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
+				 CA,CB,CC,CD,CE,CF,CG,CH,CI,NullType,NullType,NullType,NullType,NullType,NullType,NullType>
+	: public ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType>
+{
 public:
-		const base_tuple *getArgs() const { return args; }
-	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
-	~TCall() { delete args; }
-	bool matchesArgs(const base_tuple &tupl) {
-		return (!args && !matchFunctor) ||
-			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &>(tupl))) ||
-			(matchFunctor && (*(TupleInvocable<bool> *)(matchFunctor))(tupl));
+	size_t objectSize() const { return sizeof(*this); }
+	typename store_as<CA>::type a;
+	typename store_as<CB>::type b;
+	typename store_as<CC>::type c;
+	typename store_as<CD>::type d;
+	typename store_as<CE>::type e;
+	typename store_as<CF>::type f;
+	typename store_as<CG>::type g;
+	typename store_as<CH>::type h;
+	typename store_as<CI>::type i;
+	copy_tuple(typename store_as<CA>::type valueA, typename store_as<CB>::type valueB, typename store_as<CC>::type valueC, typename store_as<CD>::type valueD, typename store_as<CE>::type valueE, typename store_as<CF>::type valueF, typename store_as<CG>::type valueG, typename store_as<CH>::type valueH, typename store_as<CI>::type valueI)
+		  : a(valueA), b(valueB), c(valueC), d(valueD), e(valueE), f(valueF), g(valueG), h(valueH), i(valueI)
+	{
+		this->assigning = assigns_arg<typename store_as<CA>::type>::value ||
+			assigns_arg<typename store_as<CB>::type>::value ||
+			assigns_arg<typename store_as<CC>::type>::value ||
+			assigns_arg<typename store_as<CD>::type>::value ||
+			assigns_arg<typename store_as<CE>::type>::value ||
+			assigns_arg<typename store_as<CF>::type>::value ||
+			assigns_arg<typename store_as<CG>::type>::value ||
+			assigns_arg<typename store_as<CH>::type>::value ||
+			assigns_arg<typename store_as<CI>::type>::value;
+		this->setKeys(*this);
+	}
+	template <typename V>
+	void visit(V &v) const
+	{
+		v.template arg<A, typename store_as<CA>::type>(a);
+		v.template arg<B, typename store_as<CB>::type>(b);
+		v.template arg<C, typename store_as<CC>::type>(c);
+		v.template arg<D, typename store_as<CD>::type>(d);
+		v.template arg<E, typename store_as<CE>::type>(e);
+		v.template arg<F, typename store_as<CF>::type>(f);
+		v.template arg<G, typename store_as<CG>::type>(g);
+		v.template arg<H, typename store_as<CH>::type>(h);
+		v.template arg<I, typename store_as<CI>::type>(i);
+	}
+	bool operator==(const ref_tuple<A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &to)
+	{
+		return (comparer<A>::compare(a, to.a) &&
+				comparer<B>::compare(b, to.b) &&
+				comparer<C>::compare(c, to.c) &&
+				comparer<D>::compare(d, to.d) &&
+				comparer<E>::compare(e, to.e) &&
+				comparer<F>::compare(f, to.f) &&
+				comparer<G>::compare(g, to.g) &&
+				comparer<H>::compare(h, to.h) &&
+				comparer<I>::compare(i, to.i));
 	}
-	void assignArgs(base_tuple &tupl) {
-		if(args) {
-			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &>(tupl));
-			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &>(tupl));
-		}
+	unsigned matchingArgs(const base_tuple &tuple)
+	{
+		const ref_tuple<A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &to = static_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tuple);
+		return (comparer<A>::compare(a, to.a) ? 1 : 0) +
+				(comparer<B>::compare(b, to.b) ? 1 : 0) +
+				(comparer<C>::compare(c, to.c) ? 1 : 0) +
+				(comparer<D>::compare(d, to.d) ? 1 : 0) +
+				(comparer<E>::compare(e, to.e) ? 1 : 0) +
+				(comparer<F>::compare(f, to.f) ? 1 : 0) +
+				(comparer<G>::compare(g, to.g) ? 1 : 0) +
+				(comparer<H>::compare(h, to.h) ? 1 : 0) +
+				(comparer<I>::compare(i, to.i) ? 1 : 0);
 	}
-	template <typename CA, typename CB, typename CC, typename CD,
-			  typename CE, typename CF, typename CG, typename CH,
-			  typename CI, typename CJ, typename CK, typename CL,
-			  typename CM, typename CN, typename CO>
-	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g, const CH & h, const CI & i, const CJ & j, const CK & k, const CL & l, const CM & m, const CN & n, const CO & o) {
-		args = new copy_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType,
-								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,const CH &,const CI &,const CJ &,const CK &,const CL &,const CM &,const CN &,const CO &,NullType>(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,NullType());
-		return *this;
+	void assign_from(ref_tuple<A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &from)
+	{
+		in_assign< typename store_as<CA>::type, A>(a, from.a);
+		in_assign< typename store_as<CB>::type, B>(b, from.b);
+		in_assign< typename store_as<CC>::type, C>(c, from.c);
+		in_assign< typename store_as<CD>::type, D>(d, from.d);
+		in_assign< typename store_as<CE>::type, E>(e, from.e);
+		in_assign< typename store_as<CF>::type, F>(f, from.f);
+		in_assign< typename store_as<CG>::type, G>(g, from.g);
+		in_assign< typename store_as<CH>::type, H>(h, from.h);
+		in_assign< typename store_as<CI>::type, I>(i, from.i);
 	}
-	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &After(Call &call) {
-		previousCalls.push_back(&call);
-		return *this;
+	void assign_to(ref_tuple<A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &to)
+	{
+		out_assign< typename store_as<CA>::type, A>(a, to.a);
+		out_assign< typename store_as<CB>::type, B>(b, to.b);
+		out_assign< typename store_as<CC>::type, C>(c, to.c);
+		out_assign< typename store_as<CD>::type, D>(d, to.d);
+		out_assign< typename store_as<CE>::type, E>(e, to.e);
+		out_assign< typename store_as<CF>::type, F>(f, to.f);
+		out_assign< typename store_as<CG>::type, G>(g, to.g);
+		out_assign< typename store_as<CH>::type, H>(h, to.h);
+		out_assign< typename store_as<CI>::type, I>(i, to.i);
+	}
+	virtual void printTo(std::ostream &os) const
+	{
+		os << "(";
+		printArg<typename store_as<CA>::type>::print(os, a, false);
+		printArg<typename store_as<CB>::type>::print(os, b, true);
+		printArg<typename store_as<CC>::type>::print(os, c, true);
+		printArg<typename store_as<CD>::type>::print(os, d, true);
+		printArg<typename store_as<CE>::type>::print(os, e, true);
+		printArg<typename store_as<CF>::type>::print(os, f, true);
+		printArg<typename store_as<CG>::type>::print(os, g, true);
+		printArg<typename store_as<CH>::type>::print(os, h, true);
+		printArg<typename store_as<CI>::type>::print(os, i, true);
+		os << ")";
 	}
-	template <typename T>
-	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &Do(T function) { functor = new DoWrapper<T,Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType>(function); return *this; }
-	template <typename T>
-	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &Match(T function) { matchFunctor = new DoWrapper<T,bool,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType>(function); return *this; }
-	Call &Return(Y obj) { retVal = new ReturnValueWrapperCopy<Y>(obj); return *this; }
-	Call &ReturnByRef(Y obj) { retVal = new ReturnValueWrapperRef<Y>(obj); return *this; }
-#ifndef HM_NO_EXCEPTIONS
-	template <typename Ex>
-	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
-#endif
 };
-template <typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J, typename K, typename L,
-		  typename M, typename N, typename O>
-class TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> : public Call {
-private:
-	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> *args;
+
+template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename CA, typename CB, typename CC, typename CD, typename CE, typename CF, typename CG, typename CH>
+class copy_tuple<A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
+				 CA,CB,CC,CD,CE,CF,CG,CH,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>
+	: public ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>
+{
 public:
-		const base_tuple *getArgs() const { return args; }
-	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
-	~TCall() { delete args; }
-	bool matchesArgs(const base_tuple &tupl) {
-		return (!args && !matchFunctor) ||
-			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &>(tupl))) ||
-			(matchFunctor && (*(TupleInvocable<bool> *)(matchFunctor))(tupl));
+	size_t objectSize() const { return sizeof(*this); }
+	typename store_as<CA>::type a;
+	typename store_as<CB>::type b;
+	typename store_as<CC>::type c;
+	typename store_as<CD>::type d;
+	typename store_as<CE>::type e;
+	typename store_as<CF>::type f;
+	typename store_as<CG>::type g;
+	typename store_as<CH>::type h;
+	copy_tuple(typename store_as<CA>::type valueA, typename store_as<CB>::type valueB, typename store_as<CC>::type valueC, typename store_as<CD>::type valueD, typename store_as<CE>::type valueE, typename store_as<CF>::type valueF, typename store_as<CG>::type valueG, typename store_as<CH>::type valueH)
+		  : a(valueA), b(valueB), c(valueC), d(valueD), e(valueE), f(valueF), g(valueG), h(valueH)
+	{
+		this->assigning = assigns_arg<typename store_as<CA>::type>::value ||
+			assigns_arg<typename store_as<CB>::type>::value ||
+			assigns_arg<typename store_as<CC>::type>::value ||
+			assigns_arg<typename store_as<CD>::type>::value ||
+			assigns_arg<typename store_as<CE>::type>::value ||
+			assigns_arg<typename store_as<CF>::type>::value ||
+			assigns_arg<typename store_as<CG>::type>::value ||
+			assigns_arg<typename store_as<CH>::type>::value;
+		this->setKeys(*this);
+	}
+	template <typename V>
+	void visit(V &v) const
+	{
+		v.template arg<A, typename store_as<CA>::type>(a);
+		v.template arg<B, typename store_as<CB>::type>(b);
+		v.template arg<C, typename store_as<CC>::type>(c);
+		v.template arg<D, typename store_as<CD>::type>(d);
+		v.template arg<E, typename store_as<CE>::type>(e);
+		v.template arg<F, typename store_as<CF>::type>(f);
+		v.template arg<G, typename store_as<CG>::type>(g);
+		v.template arg<H, typename store_as<CH>::type>(h);
+	}
+	bool operator==(const ref_tuple<A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &to)
+	{
+		return (comparer<A>::compare(a, to.a) &&
+				comparer<B>::compare(b, to.b) &&
+				comparer<C>::compare(c, to.c) &&
+				comparer<D>::compare(d, to.d) &&
+				comparer<E>::compare(e, to.e) &&
+				comparer<F>::compare(f, to.f) &&
+				comparer<G>::compare(g, to.g) &&
+				comparer<H>::compare(h, to.h));
 	}
-	void assignArgs(base_tuple &tupl) {
-		if(args) {
-			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &>(tupl));
-			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &>(tupl));
-		}
+	unsigned matchingArgs(const base_tuple &tuple)
+	{
+		const ref_tuple<A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &to = static_cast<const ref_tuple<A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tuple);
+		return (comparer<A>::compare(a, to.a) ? 1 : 0) +
+				(comparer<B>::compare(b, to.b) ? 1 : 0) +
+				(comparer<C>::compare(c, to.c) ? 1 : 0) +
+				(comparer<D>::compare(d, to.d) ? 1 : 0) +
+				(comparer<E>::compare(e, to.e) ? 1 : 0) +
+				(comparer<F>::compare(f, to.f) ? 1 : 0) +
+				(comparer<G>::compare(g, to.g) ? 1 : 0) +
+				(comparer<H>::compare(h, to.h) ? 1 : 0);
 	}
-	template <typename CA, typename CB, typename CC, typename CD,
-			  typename CE, typename CF, typename CG, typename CH,
-			  typename CI, typename CJ, typename CK, typename CL,
-			  typename CM, typename CN, typename CO>
-	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g, const CH & h, const CI & i, const CJ & j, const CK & k, const CL & l, const CM & m, const CN & n, const CO & o) {
-		args = new copy_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType,
-								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,const CH &,const CI &,const CJ &,const CK &,const CL &,const CM &,const CN &,const CO &,NullType>(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,NullType());
-		return *this;
+	void assign_from(ref_tuple<A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &from)
+	{
+		in_assign< typename store_as<CA>::type, A>(a, from.a);
+		in_assign< typename store_as<CB>::type, B>(b, from.b);
+		in_assign< typename store_as<CC>::type, C>(c, from.c);
+		in_assign< typename store_as<CD>::type, D>(d, from.d);
+		in_assign< typename store_as<CE>::type, E>(e, from.e);
+		in_assign< typename store_as<CF>::type, F>(f, from.f);
+		in_assign< typename store_as<CG>::type, G>(g, from.g);
+		in_assign< typename store_as<CH>::type, H>(h, from.h);
 	}
-	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &After(Call &call) {
-		previousCalls.push_back(&call);
-		return *this;
+	void assign_to(ref_tuple<A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &to)
+	{
+		out_assign< typename store_as<CA>::type, A>(a, to.a);
+		out_assign< typename store_as<CB>::type, B>(b, to.b);
+		out_assign< typename store_as<CC>::type, C>(c, to.c);
+		out_assign< typename store_as<CD>::type, D>(d, to.d);
+		out_assign< typename store_as<CE>::type, E>(e, to.e);
+		out_assign< typename store_as<CF>::type, F>(f, to.f);
+		out_assign< typename store_as<CG>::type, G>(g, to.g);
+		out_assign< typename store_as<CH>::type, H>(h, to.h);
+	}
+	virtual void printTo(std::ostream &os) const
+	{
+		os << "(";
+		printArg<typename store_as<CA>::type>::print(os, a, false);
+		printArg<typename store_as<CB>::type>::print(os, b, true);
+		printArg<typename store_as<CC>::type>::print(os, c, true);
+		printArg<typename store_as<CD>::type>::print(os, d, true);
+		printArg<typename store_as<CE>::type>::print(os, e, true);
+		printArg<typename store_as<CF>::type>::print(os, f, true);
+		printArg<typename store_as<CG>::type>::print(os, g, true);
+		printArg<typename store_as<CH>::type>::print(os, h, true);
+		os << ")";
 	}
-	template <typename T>
-	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &Do(T function) { functor = new DoWrapper<T,void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType>(function); return *this; }
-	template <typename T>
-	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &Match(T function) { matchFunctor = new DoWrapper<T,bool,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType>(function); return *this; }
-#ifndef HM_NO_EXCEPTIONS
-	template <typename Ex>
-	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
-#endif
 };
 
-template <typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J, typename K, typename L,
-		  typename M, typename N>
-class TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> : public Call {
-private:
-	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> *args;
+template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename CA, typename CB, typename CC, typename CD, typename CE, typename CF, typename CG>
+class copy_tuple<A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
+				 CA,CB,CC,CD,CE,CF,CG,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>
+	: public ref_comparable_assignable_tuple<A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>
+{
 public:
-		const base_tuple *getArgs() const { return args; }
-	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
-	~TCall() { delete args; }
-	bool matchesArgs(const base_tuple &tupl) {
-		return (!args && !matchFunctor) ||
-			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &>(tupl))) ||
-			(matchFunctor && (*(TupleInvocable<bool> *)(matchFunctor))(tupl));
+	size_t objectSize() const { return sizeof(*this); }
+	typename store_as<CA>::type a;
+	typename store_as<CB>::type b;
+	typename store_as<CC>::type c;
+	typename store_as<CD>::type d;
+	typename store_as<CE>::type e;
+	typename store_as<CF>::type f;
+	typename store_as<CG>::type g;
+	copy_tuple(typename store_as<CA>::type valueA, typename store_as<CB>::type valueB, typename store_as<CC>::type valueC, typename store_as<CD>::type valueD, typename store_as<CE>::type valueE, typename store_as<CF>::type valueF, typename store_as<CG>::type valueG)
+		  : a(valueA), b(valueB), c(valueC), d(valueD), e(valueE), f(valueF), g(valueG)
+	{
+		this->assigning = assigns_arg<typename store_as<CA>::type>::value ||
+			assigns_arg<typename store_as<CB>::type>::value ||
+			assigns_arg<typename store_as<CC>::type>::value ||
+			assigns_arg<typename store_as<CD>::type>::value ||
+			assigns_arg<typename store_as<CE>::type>::value ||
+			assigns_arg<typename store_as<CF>::type>::value ||
+			assigns_arg<typename store_as<CG>::type>::value;
+		this->setKeys(*this);
+	}
+	template <typename V>
+	void visit(V &v) const
+	{
+		v.template arg<A, typename store_as<CA>::type>(a);
+		v.template arg<B, typename store_as<CB>::type>(b);
+		v.template arg<C, typename store_as<CC>::type>(c);
+		v.template arg<D, typename store_as<CD>::type>(d);
+		v.template arg<E, typename store_as<CE>::type>(e);
+		v.template arg<F, typename store_as<CF>::type>(f);
+		v.template arg<G, typename store_as<CG>::type>(g);
+	}
+	bool operator==(const ref_tuple<A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &to)
+	{
+		return (comparer<A>::compare(a, to.a) &&
+				comparer<B>::compare(b, to.b) &&
+				comparer<C>::compare(c, to.c) &&
+				comparer<D>::compare(d, to.d) &&
+				comparer<E>::compare(e, to.e) &&
+				comparer<F>::compare(f, to.f) &&
+				comparer<G>::compare(g, to.g));
 	}
-	void assignArgs(base_tuple &tupl) {
-		if(args) {
-			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &>(tupl));
-			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &>(tupl));
-		}
+	unsigned matchingArgs(const base_tuple &tuple)
+	{
+		const ref_tuple<A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &to = static_cast<const ref_tuple<A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tuple);
+		return (comparer<A>::compare(a, to.a) ? 1 : 0) +
+				(comparer<B>::compare(b, to.b) ? 1 : 0) +
+				(comparer<C>::compare(c, to.c) ? 1 : 0) +
+				(comparer<D>::compare(d, to.d) ? 1 : 0) +
+				(comparer<E>::compare(e, to.e) ? 1 : 0) +
+				(comparer<F>::compare(f, to.f) ? 1 : 0) +
+				(comparer<G>::compare(g, to.g) ? 1 : 0);
 	}
-	template <typename CA, typename CB, typename CC, typename CD,
-			  typename CE, typename CF, typename CG, typename CH,
-			  typename CI, typename CJ, typename CK, typename CL,
-			  typename CM, typename CN>
-	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g, const CH & h, const CI & i, const CJ & j, const CK & k, const CL & l, const CM & m, const CN & n) {
-		args = new copy_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType,
-								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,const CH &,const CI &,const CJ &,const CK &,const CL &,const CM &,const CN &,NullType,NullType>(a,b,c,d,e,f,g,h,i,j,k,l,m,n,NullType(),NullType());
-		return *this;
+	void assign_from(ref_tuple<A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &from)
+	{
+		in_assign< typename store_as<CA>::type, A>(a, from.a);
+		in_assign< typename store_as<CB>::type, B>(b, from.b);
+		in_assign< typename store_as<CC>::type, C>(c, from.c);
+		in_assign< typename store_as<CD>::type, D>(d, from.d);
+		in_assign< typename store_as<CE>::type, E>(e, from.e);
+		in_assign< typename store_as<CF>::type, F>(f, from.f);
+		in_assign< typename store_as<CG>::type, G>(g, from.g);
 	}
-	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &After(Call &call) {
-		previousCalls.push_back(&call);
-		return *this;
+	void assign_to(ref_tuple<A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &to)
+	{
+		out_assign< typename store_as<CA>::type, A>(a, to.a);
+		out_assign< typename store_as<CB>::type, B>(b, to.b);
+		out_assign< typename store_as<CC>::type, C>(c, to.c);
+		out_assign< typename store_as<CD>::type, D>(d, to.d);
+		out_assign< typename store_as<CE>::type, E>(e, to.e);
+		out_assign< typename store_as<CF>::type, F>(f, to.f);
+		out_assign< typename store_as<CG>::type, G>(g, to.g);
+	}
+	virtual void printTo(std::ostream &os) const
+	{
+		os << "(";
+		printArg<typename store_as<CA>::type>::print(os, a, false);
+		printArg<typename store_as<CB>::type>::print(os, b, true);
+		printArg<typename store_as<CC>::type>::print(os, c, true);
+		printArg<typename store_as<CD>::type>::print(os, d, true);
+		printArg<typename store_as<CE>::type>::print(os, e, true);
+		printArg<typename store_as<CF>::type>::print(os, f, true);
+		printArg<typename store_as<CG>::type>::print(os, g, true);
+		os << ")";
 	}
-	template <typename T>
-	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &Do(T function) { functor = new DoWrapper<T,Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType>(function); return *this; }
-	template <typename T>
-	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &Match(T function) { matchFunctor = new DoWrapper<T,bool,A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType>(function); return *this; }
-	Call &Return(Y obj) { retVal = new ReturnValueWrapperCopy<Y>(obj); return *this; }
-	Call &ReturnByRef(Y obj) { retVal = new ReturnValueWrapperRef<Y>(obj); return *this; }
-#ifndef HM_NO_EXCEPTIONS
-	template <typename Ex>
-	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
-#endif
 };
-template <typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J, typename K, typename L,
-		  typename M, typename N>
-class TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> : public Call {
-private:
-	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> *args;
+
+template <typename A, typename B, typename C, typename D, typename E, typename F, typename CA, typename CB, typename CC, typename CD, typename CE, typename CF>
+class copy_tuple<A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
+				 CA,CB,CC,CD,CE,CF,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>
+	: public ref_comparable_assignable_tuple<A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>
+{
 public:
-		const base_tuple *getArgs() const { return args; }
-	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
-	~TCall() { delete args; }
-	bool matchesArgs(const base_tuple &tupl) {
-		return (!args && !matchFunctor) ||
-			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &>(tupl))) ||
-			(matchFunctor && (*(TupleInvocable<bool> *)(matchFunctor))(tupl));
+	size_t objectSize() const { return sizeof(*this); }
+	typename store_as<CA>::type a;
+	typename store_as<CB>::type b;
+	typename store_as<CC>::type c;
+	typename store_as<CD>::type d;
+	typename store_as<CE>::type e;
+	typename store_as<CF>::type f;
+	copy_tuple(typename store_as<CA>::type valueA, typename store_as<CB>::type valueB, typename store_as<CC>::type valueC, typename store_as<CD>::type valueD, typename store_as<CE>::type valueE, typename store_as<CF>::type valueF)
+		  : a(valueA), b(valueB), c(valueC), d(valueD), e(valueE), f(valueF)
+	{
+		this->assigning = assigns_arg<typename store_as<CA>::type>::value ||
+			assigns_arg<typename store_as<CB>::type>::value ||
+			assigns_arg<typename store_as<CC>::type>::value ||
+			assigns_arg<typename store_as<CD>::type>::value ||
+			assigns_arg<typename store_as<CE>::type>::value ||
+			assigns_arg<typename store_as<CF>::type>::value;
+		this->setKeys(*this);
 	}
-	void assignArgs(base_tuple &tupl) {
-		if(args) {
-			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &>(tupl));
-			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &>(tupl));
-		}
+	template <typename V>
+	void visit(V &v) const
+	{
+		v.template arg<A, typename store_as<CA>::type>(a);
+		v.template arg<B, typename store_as<CB>::type>(b);
+		v.template arg<C, typename store_as<CC>::type>(c);
+		v.template arg<D, typename store_as<CD>::type>(d);
+		v.template arg<E, typename store_as<CE>::type>(e);
+		v.template arg<F, typename store_as<CF>::type>(f);
 	}
-	template <typename CA, typename CB, typename CC, typename CD,
-			  typename CE, typename CF, typename CG, typename CH,
-			  typename CI, typename CJ, typename CK, typename CL,
-			  typename CM, typename CN>
-	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g, const CH & h, const CI & i, const CJ & j, const CK & k, const CL & l, const CM & m, const CN & n) {
-		args = new copy_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType,
-								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,const CH &,const CI &,const CJ &,const CK &,const CL &,const CM &,const CN &,NullType,NullType>(a,b,c,d,e,f,g,h,i,j,k,l,m,n,NullType(),NullType());
-		return *this;
+	bool operator==(const ref_tuple<A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &to)
+	{
+		return (comparer<A>::compare(a, to.a) &&
+				comparer<B>::compare(b, to.b) &&
+				comparer<C>::compare(c, to.c) &&
+				comparer<D>::compare(d, to.d) &&
+				comparer<E>::compare(e, to.e) &&
+				comparer<F>::compare(f, to.f));
 	}
-	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &After(Call &call) {
-		previousCalls.push_back(&call);
-		return *this;
+	unsigned matchingArgs(const base_tuple &tuple)
+	{
+		const ref_tuple<A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &to = static_cast<const ref_tuple<A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tuple);
+		return (comparer<A>::compare(a, to.a) ? 1 : 0) +
+				(comparer<B>::compare(b, to.b) ? 1 : 0) +
+				(comparer<C>::compare(c, to.c) ? 1 : 0) +
+				(comparer<D>::compare(d, to.d) ? 1 : 0) +
+				(comparer<E>::compare(e, to.e) ? 1 : 0) +
+				(comparer<F>::compare(f, to.f) ? 1 : 0);
+	}
+	void assign_from(ref_tuple<A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &from)
+	{
+		in_assign< typename store_as<CA>::type, A>(a, from.a);
+		in_assign< typename store_as<CB>::type, B>(b, from.b);
+		in_assign< typename store_as<CC>::type, C>(c, from.c);
+		in_assign< typename store_as<CD>::type, D>(d, from.d);
+		in_assign< typename store_as<CE>::type, E>(e, from.e);
+		in_assign< typename store_as<CF>::type, F>(f, from.f);
+	}
+	void assign_to(ref_tuple<A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &to)
+	{
+		out_assign< typename store_as<CA>::type, A>(a, to.a);
+		out_assign< typename store_as<CB>::type, B>(b, to.b);
+		out_assign< typename store_as<CC>::type, C>(c, to.c);
+		out_assign< typename store_as<CD>::type, D>(d, to.d);
+		out_assign< typename store_as<CE>::type, E>(e, to.e);
+		out_assign< typename store_as<CF>::type, F>(f, to.f);
+	}
+	virtual void printTo(std::ostream &os) const
+	{
+		os << "(";
+		printArg<typename store_as<CA>::type>::print(os, a, false);
+		printArg<typename store_as<CB>::type>::print(os, b, true);
+		printArg<typename store_as<CC>::type>::print(os, c, true);
+		printArg<typename store_as<CD>::type>::print(os, d, true);
+		printArg<typename store_as<CE>::type>::print(os, e, true);
+		printArg<typename store_as<CF>::type>::print(os, f, true);
+		os << ")";
 	}
-	template <typename T>
-	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &Do(T function) { functor = new DoWrapper<T,void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType>(function); return *this; }
-	template <typename T>
-	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &Match(T function) { matchFunctor = new DoWrapper<T,bool,A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType>(function); return *this; }
-#ifndef HM_NO_EXCEPTIONS
-	template <typename Ex>
-	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
-#endif
 };
 
-template <typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J, typename K, typename L,
-		  typename M>
-class TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> : public Call {
-private:
-	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> *args;
+template <typename A, typename B, typename C, typename D, typename E, typename CA, typename CB, typename CC, typename CD, typename CE>
+class copy_tuple<A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
+				 CA,CB,CC,CD,CE,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>
+	: public ref_comparable_assignable_tuple<A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>
+{
 public:
-		const base_tuple *getArgs() const { return args; }
-	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
-	~TCall() { delete args; }
-	bool matchesArgs(const base_tuple &tupl) {
-		return (!args && !matchFunctor) ||
-			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &>(tupl))) ||
-			(matchFunctor && (*(TupleInvocable<bool> *)(matchFunctor))(tupl));
+	size_t objectSize() const { return sizeof(*this); }
+	typename store_as<CA>::type a;
+	typename store_as<CB>::type b;
+	typename store_as<CC>::type c;
+	typename store_as<CD>::type d;
+	typename store_as<CE>::type e;
+	copy_tuple(typename store_as<CA>::type valueA, typename store_as<CB>::type valueB, typename store_as<CC>::type valueC, typename store_as<CD>::type valueD, typename store_as<CE>::type valueE)
+		  : a(valueA), b(valueB), c(valueC), d(valueD), e(valueE)
+	{
+		this->assigning = assigns_arg<typename store_as<CA>::type>::value ||
+			assigns_arg<typename store_as<CB>::type>::value ||
+			assigns_arg<typename store_as<CC>::type>::value ||
+			assigns_arg<typename store_as<CD>::type>::value ||
+			assigns_arg<typename store_as<CE>::type>::value;
+		this->setKeys(*this);
 	}
-	void assignArgs(base_tuple &tupl) {
-		if(args) {
-			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &>(tupl));
-			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &>(tupl));
-		}
+	template <typename V>
+	void visit(V &v) const
+	{
+		v.template arg<A, typename store_as<CA>::type>(a);
+		v.template arg<B, typename store_as<CB>::type>(b);
+		v.template arg<C, typename store_as<CC>::type>(c);
+		v.template arg<D, typename store_as<CD>::type>(d);
+		v.template arg<E, typename store_as<CE>::type>(e);
 	}
-	template <typename CA, typename CB, typename CC, typename CD,
-			  typename CE, typename CF, typename CG, typename CH,
-			  typename CI, typename CJ, typename CK, typename CL,
-			  typename CM>
-	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g, const CH & h, const CI & i, const CJ & j, const CK & k, const CL & l, const CM & m) {
-		args = new copy_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType,
-								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,const CH &,const CI &,const CJ &,const CK &,const CL &,const CM &,NullType,NullType,NullType>(a,b,c,d,e,f,g,h,i,j,k,l,m,NullType(),NullType(),NullType());
-		return *this;
+	bool operator==(const ref_tuple<A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &to)
+	{
+		return (comparer<A>::compare(a, to.a) &&
+				comparer<B>::compare(b, to.b) &&
+				comparer<C>::compare(c, to.c) &&
+				comparer<D>::compare(d, to.d) &&
+				comparer<E>::compare(e, to.e));
 	}
-	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &After(Call &call) {
-		previousCalls.push_back(&call);
-		return *this;
+	unsigned matchingArgs(const base_tuple &tuple)
+	{
+		const ref_tuple<A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &to = static_cast<const ref_tuple<A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tuple);
+		return (comparer<A>::compare(a, to.a) ? 1 : 0) +
+				(comparer<B>::compare(b, to.b) ? 1 : 0) +
+				(comparer<C>::compare(c, to.c) ? 1 : 0) +
+				(comparer<D>::compare(d, to.d) ? 1 : 0) +
+				(comparer<E>::compare(e, to.e) ? 1 : 0);
+	}
+	void assign_from(ref_tuple<A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &from)
+	{
+		in_assign< typename store_as<CA>::type, A>(a, from.a);
+		in_assign< typename store_as<CB>::type, B>(b, from.b);
+		in_assign< typename store_as<CC>::type, C>(c, from.c);
+		in_assign< typename store_as<CD>::type, D>(d, from.d);
+		in_assign< typename store_as<CE>::type, E>(e, from.e);
+	}
+	void assign_to(ref_tuple<A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &to)
+	{
+		out_assign< typename store_as<CA>::type, A>(a, to.a);
+		out_assign< typename store_as<CB>::type, B>(b, to.b);
+		out_assign< typename store_as<CC>::type, C>(c, to.c);
+		out_assign< typename store_as<CD>::type, D>(d, to.d);
+		out_assign< typename store_as<CE>::type, E>(e, to.e);
+	}
+	virtual void printTo(std::ostream &os) const
+	{
+		os << "(";
+		printArg<typename store_as<CA>::type>::print(os, a, false);
+		printArg<typename store_as<CB>::type>::print(os, b, true);
+		printArg<typename store_as<CC>::type>::print(os, c, true);
+		printArg<typename store_as<CD>::type>::print(os, d, true);
+		printArg<typename store_as<CE>::type>::print(os, e, true);
+		os << ")";
 	}
-	template <typename T>
-	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &Do(T function) { functor = new DoWrapper<T,Y,A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType>(function); return *this; }
-	template <typename T>
-	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &Match(T function) { matchFunctor = new DoWrapper<T,bool,A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType>(function); return *this; }
-	Call &Return(Y obj) { retVal = new ReturnValueWrapperCopy<Y>(obj); return *this; }
-	Call &ReturnByRef(Y obj) { retVal = new ReturnValueWrapperRef<Y>(obj); return *this; }
-#ifndef HM_NO_EXCEPTIONS
-	template <typename Ex>
-	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
-#endif
 };
-template <typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J, typename K, typename L,
-		  typename M>
-class TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> : public Call {
-private:
-	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> *args;
+
+template <typename A, typename B, typename C, typename D, typename CA, typename CB, typename CC, typename CD>
+class copy_tuple<A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
+				 CA,CB,CC,CD,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>
+	: public ref_comparable_assignable_tuple<A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>
+{
 public:
-		const base_tuple *getArgs() const { return args; }
-	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
-	~TCall() { delete args; }
-	bool matchesArgs(const base_tuple &tupl) {
-		return (!args && !matchFunctor) ||
-			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &>(tupl))) ||
-			(matchFunctor && (*(TupleInvocable<bool> *)(matchFunctor))(tupl));
+	size_t objectSize() const { return sizeof(*this); }
+	typename store_as<CA>::type a;
+	typename store_as<CB>::type b;
+	typename store_as<CC>::type c;
+	typename store_as<CD>::type d;
+	copy_tuple(typename store_as<CA>::type valueA, typename store_as<CB>::type valueB, typename store_as<CC>::type valueC, typename store_as<CD>::type valueD)
+		  : a(valueA), b(valueB), c(valueC), d(valueD)
+	{
+		this->assigning = assigns_arg<typename store_as<CA>::type>::value ||
+			assigns_arg<typename store_as<CB>::type>::value ||
+			assigns_arg<typename store_as<CC>::type>::value ||
+			assigns_arg<typename store_as<CD>::type>::value;
+		this->setKeys(*this);
 	}
-	void assignArgs(base_tuple &tupl) {
-		if(args) {
-			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &>(tupl));
-			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &>(tupl));
-		}
+	template <typename V>
+	void visit(V &v) const
+	{
+		v.template arg<A, typename store_as<CA>::type>(a);
+		v.template arg<B, typename store_as<CB>::type>(b);
+		v.template arg<C, typename store_as<CC>::type>(c);
+		v.template arg<D, typename store_as<CD>::type>(d);
 	}
-	template <typename CA, typename CB, typename CC, typename CD,
-			  typename CE, typename CF, typename CG, typename CH,
-			  typename CI, typename CJ, typename CK, typename CL,
-			  typename CM>
-	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g, const CH & h, const CI & i, const CJ & j, const CK & k, const CL & l, const CM & m) {
-		args = new copy_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType,
-								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,const CH &,const CI &,const CJ &,const CK &,const CL &,const CM &,NullType,NullType,NullType>(a,b,c,d,e,f,g,h,i,j,k,l,m,NullType(),NullType(),NullType());
-		return *this;
+	bool operator==(const ref_tuple<A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &to)
+	{
+		return (comparer<A>::compare(a, to.a) &&
+				comparer<B>::compare(b, to.b) &&
+				comparer<C>::compare(c, to.c) &&
+				comparer<D>::compare(d, to.d));
 	}
-	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &After(Call &call) {
-		previousCalls.push_back(&call);
-		return *this;
+	unsigned matchingArgs(const base_tuple &tuple)
+	{
+		const ref_tuple<A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &to = static_cast<const ref_tuple<A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tuple);
+		return (comparer<A>::compare(a, to.a) ? 1 : 0) +
+				(comparer<B>::compare(b, to.b) ? 1 : 0) +
+				(comparer<C>::compare(c, to.c) ? 1 : 0) +
+				(comparer<D>::compare(d, to.d) ? 1 : 0);
+	}
+	void assign_from(ref_tuple<A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &from)
+	{
+		in_assign< typename store_as<CA>::type, A>(a, from.a);
+		in_assign< typename store_as<CB>::type, B>(b, from.b);
+		in_assign< typename store_as<CC>::type, C>(c, from.c);
+		in_assign< typename store_as<CD>::type, D>(d, from.d);
+	}
+	void assign_to(ref_tuple<A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &to)
+	{
+		out_assign< typename store_as<CA>::type, A>(a, to.a);
+		out_assign< typename store_as<CB>::type, B>(b, to.b);
+		out_assign< typename store_as<CC>::type, C>(c, to.c);
+		out_assign< typename store_as<CD>::type, D>(d, to.d);
+	}
+	virtual void printTo(std::ostream &os) const
+	{
+		os << "(";
+		printArg<typename store_as<CA>::type>::print(os, a, false);
+		printArg<typename store_as<CB>::type>::print(os, b, true);
+		printArg<typename store_as<CC>::type>::print(os, c, true);
+		printArg<typename store_as<CD>::type>::print(os, d, true);
+		os << ")";
 	}
-	template <typename T>
-	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &Do(T function) { functor = new DoWrapper<T,void,A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType>(function); return *this; }
-	template <typename T>
-	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &Match(T function) { matchFunctor = new DoWrapper<T,bool,A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType>(function); return *this; }
-#ifndef HM_NO_EXCEPTIONS
-	template <typename Ex>
-	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
-#endif
 };
 
-template <typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J, typename K, typename L>
-class TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> : public Call {
-private:
-	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> *args;
+template <typename A, typename B, typename C, typename CA, typename CB, typename CC>
+class copy_tuple<A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
+				 CA,CB,CC,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>
+	: public ref_comparable_assignable_tuple<A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>
+{
 public:
-		const base_tuple *getArgs() const { return args; }
-	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
-	~TCall() { delete args; }
-	bool matchesArgs(const base_tuple &tupl) {
-		return (!args && !matchFunctor) ||
-			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &>(tupl))) ||
-			(matchFunctor && (*(TupleInvocable<bool> *)(matchFunctor))(tupl));
+	size_t objectSize() const { return sizeof(*this); }
+	typename store_as<CA>::type a;
+	typename store_as<CB>::type b;
+	typename store_as<CC>::type c;
+	copy_tuple(typename store_as<CA>::type valueA, typename store_as<CB>::type valueB, typename store_as<CC>::type valueC)
+		  : a(valueA), b(valueB), c(valueC)
+	{
+		this->assigning = assigns_arg<typename store_as<CA>::type>::value ||
+			assigns_arg<typename store_as<CB>::type>::value ||
+			assigns_arg<typename store_as<CC>::type>::value;
+		this->setKeys(*this);
 	}
-	void assignArgs(base_tuple &tupl) {
-		if(args) {
-			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &>(tupl));
-			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &>(tupl));
-		}
+	template <typename V>
+	void visit(V &v) const
+	{
+		v.template arg<A, typename store_as<CA>::type>(a);
+		v.template arg<B, typename store_as<CB>::type>(b);
+		v.template arg<C, typename store_as<CC>::type>(c);
 	}
-	template <typename CA, typename CB, typename CC, typename CD,
-			  typename CE, typename CF, typename CG, typename CH,
-			  typename CI, typename CJ, typename CK, typename CL>
-	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g, const CH & h, const CI & i, const CJ & j, const CK & k, const CL & l) {
-		args = new copy_tuple<A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType,
-								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,const CH &,const CI &,const CJ &,const CK &,const CL &,NullType,NullType,NullType,NullType>(a,b,c,d,e,f,g,h,i,j,k,l,NullType(),NullType(),NullType(),NullType());
-		return *this;
+	bool operator==(const ref_tuple<A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &to)
+	{
+		return (comparer<A>::compare(a, to.a) &&
+				comparer<B>::compare(b, to.b) &&
+				comparer<C>::compare(c, to.c));
 	}
-	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &After(Call &call) {
-		previousCalls.push_back(&call);
-		return *this;
+	unsigned matchingArgs(const base_tuple &tuple)
+	{
+		const ref_tuple<A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &to = static_cast<const ref_tuple<A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tuple);
+		return (comparer<A>::compare(a, to.a) ? 1 : 0) +
+				(comparer<B>::compare(b, to.b) ? 1 : 0) +
+				(comparer<C>::compare(c, to.c) ? 1 : 0);
+	}
+	void assign_from(ref_tuple<A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &from)
+	{
+		in_assign< typename store_as<CA>::type, A>(a, from.a);
+		in_assign< typename store_as<CB>::type, B>(b, from.b);
+		in_assign< typename store_as<CC>::type, C>(c, from.c);
+	}
+	void assign_to(ref_tuple<A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &to)
+	{
+		out_assign< typename store_as<CA>::type, A>(a, to.a);
+		out_assign< typename store_as<CB>::type, B>(b, to.b);
+		out_assign< typename store_as<CC>::type, C>(c, to.c);
+	}
+	virtual void printTo(std::ostream &os) const
+	{
+		os << "(";
+		printArg<typename store_as<CA>::type>::print(os, a, false);
+		printArg<typename store_as<CB>::type>::print(os, b, true);
+		printArg<typename store_as<CC>::type>::print(os, c, true);
+		os << ")";
 	}
-	template <typename T>
-	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &Do(T function) { functor = new DoWrapper<T,Y,A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType>(function); return *this; }
-	template <typename T>
-	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor = new DoWrapper<T,bool,A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType>(function); return *this; }
-	Call &Return(Y obj) { retVal = new ReturnValueWrapperCopy<Y>(obj); return *this; }
-	Call &ReturnByRef(Y obj) { retVal = new ReturnValueWrapperRef<Y>(obj); return *this; }
-#ifndef HM_NO_EXCEPTIONS
-	template <typename Ex>
-	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
-#endif
 };
-template <typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J, typename K, typename L>
-class TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> : public Call {
-private:
-	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> *args;
+
+template <typename A, typename B, typename CA, typename CB>
+class copy_tuple<A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
+				 CA,CB,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>
+	: public ref_comparable_assignable_tuple<A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>
+{
 public:
-		const base_tuple *getArgs() const { return args; }
-	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
-	~TCall() { delete args; }
-	bool matchesArgs(const base_tuple &tupl) {
-		return (!args && !matchFunctor) ||
-			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &>(tupl))) ||
-			(matchFunctor && (*(TupleInvocable<bool> *)(matchFunctor))(tupl));
+	size_t objectSize() const { return sizeof(*this); }
+	typename store_as<CA>::type a;
+	typename store_as<CB>::type b;
+	copy_tuple(typename store_as<CA>::type valueA, typename store_as<CB>::type valueB)
+		  : a(valueA), b(valueB)
+	{
+		this->assigning = assigns_arg<typename store_as<CA>::type>::value ||
+			assigns_arg<typename store_as<CB>::type>::value;
+		this->setKeys(*this);
 	}
-	void assignArgs(base_tuple &tupl) {
-		if(args) {
-			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &>(tupl));
-			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &>(tupl));
-		}
+	template <typename V>
+	void visit(V &v) const
+	{
+		v.template arg<A, typename store_as<CA>::type>(a);
+		v.template arg<B, typename store_as<CB>::type>(b);
 	}
-	template <typename CA, typename CB, typename CC, typename CD,
-			  typename CE, typename CF, typename CG, typename CH,
-			  typename CI, typename CJ, typename CK, typename CL>
-	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g, const CH & h, const CI & i, const CJ & j, const CK & k, const CL & l) {
-		args = new copy_tuple<A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType,
-								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,const CH &,const CI &,const CJ &,const CK &,const CL &,NullType,NullType,NullType,NullType>(a,b,c,d,e,f,g,h,i,j,k,l,NullType(),NullType(),NullType(),NullType());
-		return *this;
+	bool operator==(const ref_tuple<A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &to)
+	{
+		return (comparer<A>::compare(a, to.a) &&
+				comparer<B>::compare(b, to.b));
 	}
-	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &After(Call &call) {
-		previousCalls.push_back(&call);
-		return *this;
+	unsigned matchingArgs(const base_tuple &tuple)
+	{
+		const ref_tuple<A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &to = static_cast<const ref_tuple<A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tuple);
+		return (comparer<A>::compare(a, to.a) ? 1 : 0) +
+				(comparer<B>::compare(b, to.b) ? 1 : 0);
+	}
+	void assign_from(ref_tuple<A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &from)
+	{
+		in_assign< typename store_as<CA>::type, A>(a, from.a);
+		in_assign< typename store_as<CB>::type, B>(b, from.b);
+	}
+	void assign_to(ref_tuple<A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &to)
+	{
+		out_assign< typename store_as<CA>::type, A>(a, to.a);
+		out_assign< typename store_as<CB>::type, B>(b, to.b);
+	}
+	virtual void printTo(std::ostream &os) const
+	{
+		os << "(";
+		printArg<typename store_as<CA>::type>::print(os, a, false);
+		printArg<typename store_as<CB>::type>::print(os, b, true);
+		os << ")";
 	}
-	template <typename T>
-	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &Do(T function) { functor = new DoWrapper<T,void,A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType>(function); return *this; }
-	template <typename T>
-	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor = new DoWrapper<T,bool,A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType>(function); return *this; }
-#ifndef HM_NO_EXCEPTIONS
-	template <typename Ex>
-	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
-#endif
 };
 
-template <typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J, typename K>
-class TCall<Y,A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> : public Call {
-private:
-	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> *args;
+template <typename A, typename CA>
+class copy_tuple<A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
+				 CA,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>
+	: public ref_comparable_assignable_tuple<A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>
+{
 public:
-		const base_tuple *getArgs() const { return args; }
-	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
-	~TCall() { delete args; }
-	bool matchesArgs(const base_tuple &tupl) {
-		return (!args && !matchFunctor) ||
-			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
-			(matchFunctor && (*(TupleInvocable<bool> *)(matchFunctor))(tupl));
+	size_t objectSize() const { return sizeof(*this); }
+	typename store_as<CA>::type a;
+	copy_tuple(typename store_as<CA>::type valueA)
+		  : a(valueA)
+	{
+		this->assigning = assigns_arg<typename store_as<CA>::type>::value;
+		this->setKeys(*this);
 	}
-	void assignArgs(base_tuple &tupl) {
-		if(args) {
-			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-		}
+	template <typename V>
+	void visit(V &v) const
+	{
+		v.template arg<A, typename store_as<CA>::type>(a);
 	}
-	template <typename CA, typename CB, typename CC, typename CD,
-			  typename CE, typename CF, typename CG, typename CH,
-			  typename CI, typename CJ, typename CK>
-	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g, const CH & h, const CI & i, const CJ & j, const CK & k) {
-		args = new copy_tuple<A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType,
-								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,const CH &,const CI &,const CJ &,const CK &,NullType,NullType,NullType,NullType,NullType>(a,b,c,d,e,f,g,h,i,j,k,NullType(),NullType(),NullType(),NullType(),NullType());
-		return *this;
-	}
-	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
-		previousCalls.push_back(&call);
-		return *this;
+	bool operator==(const ref_tuple<A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &to)
+	{
+		return (comparer<A>::compare(a, to.a));
 	}
-	template <typename T>
-	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor = new DoWrapper<T,Y,A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-	template <typename T>
-	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor = new DoWrapper<T,bool,A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-	Call &Return(Y obj) { retVal = new ReturnValueWrapperCopy<Y>(obj); return *this; }
-	Call &ReturnByRef(Y obj) { retVal = new ReturnValueWrapperRef<Y>(obj); return *this; }
-#ifndef HM_NO_EXCEPTIONS
-	template <typename Ex>
-	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
-#endif
-};
-template <typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J, typename K>
-class TCall<void,A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> : public Call {
-private:
-	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> *args;
-public:
-		const base_tuple *getArgs() const { return args; }
-	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
-	~TCall() { delete args; }
-	bool matchesArgs(const base_tuple &tupl) {
-		return (!args && !matchFunctor) ||
-			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
-			(matchFunctor && (*(TupleInvocable<bool> *)(matchFunctor))(tupl));
+	unsigned matchingArgs(const base_tuple &tuple)
+	{
+		const ref_tuple<A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &to = static_cast<const ref_tuple<A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tuple);
+		return (comparer<A>::compare(a, to.a) ? 1 : 0);
 	}
-	void assignArgs(base_tuple &tupl) {
-		if(args) {
-			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-		}
+	void assign_from(ref_tuple<A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &from)
+	{
+		in_assign< typename store_as<CA>::type, A>(a, from.a);
 	}
-	template <typename CA, typename CB, typename CC, typename CD,
-			  typename CE, typename CF, typename CG, typename CH,
-			  typename CI, typename CJ, typename CK>
-	TCall<void,A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g, const CH & h, const CI & i, const CJ & j, const CK & k) {
-		args = new copy_tuple<A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType,
-								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,const CH &,const CI &,const CJ &,const CK &,NullType,NullType,NullType,NullType,NullType>(a,b,c,d,e,f,g,h,i,j,k,NullType(),NullType(),NullType(),NullType(),NullType());
-		return *this;
+	void assign_to(ref_tuple<A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &to)
+	{
+		out_assign< typename store_as<CA>::type, A>(a, to.a);
 	}
-	TCall<void,A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
-		previousCalls.push_back(&call);
-		return *this;
+	virtual void printTo(std::ostream &os) const
+	{
+		os << "(";
+		printArg<typename store_as<CA>::type>::print(os, a, false);
+		os << ")";
 	}
-	template <typename T>
-	TCall<void,A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor = new DoWrapper<T,void,A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-	template <typename T>
-	TCall<void,A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor = new DoWrapper<T,bool,A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-#ifndef HM_NO_EXCEPTIONS
-	template <typename Ex>
-	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
-#endif
 };
 
-template <typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J>
-class TCall<Y,A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
-private:
-	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> *args;
+template <>
+class copy_tuple<NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
+				 NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>
+	: public ref_comparable_assignable_tuple<NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>
+{
 public:
-		const base_tuple *getArgs() const { return args; }
-	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
-	~TCall() { delete args; }
-	bool matchesArgs(const base_tuple &tupl) {
-		return (!args && !matchFunctor) ||
-			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
-			(matchFunctor && (*(TupleInvocable<bool> *)(matchFunctor))(tupl));
+	size_t objectSize() const { return sizeof(*this); }
+	copy_tuple() {}
+	bool operator==(const ref_tuple<NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &)
+	{
+		return true;
 	}
-	void assignArgs(base_tuple &tupl) {
-		if(args) {
-			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-		}
+	void assign_from(ref_tuple<NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &)
+	{
 	}
-	template <typename CA, typename CB, typename CC, typename CD,
-			  typename CE, typename CF, typename CG, typename CH,
-			  typename CI, typename CJ>
-	TCall<Y,A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g, const CH & h, const CI & i, const CJ & j) {
-		args = new copy_tuple<A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType,
-								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,const CH &,const CI &,const CJ &,NullType,NullType,NullType,NullType,NullType,NullType>(a,b,c,d,e,f,g,h,i,j,NullType(),NullType(),NullType(),NullType(),NullType(),NullType());
-		return *this;
+	void assign_to(ref_tuple<NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &)
+	{
 	}
-	TCall<Y,A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
-		previousCalls.push_back(&call);
-		return *this;
+	virtual void printTo(std::ostream &os) const
+	{
+		os << "(";
+		os << ")";
 	}
-	template <typename T>
-	TCall<Y,A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor = new DoWrapper<T,Y,A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-	template <typename T>
-	TCall<Y,A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor = new DoWrapper<T,bool,A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-	Call &Return(Y obj) { retVal = new ReturnValueWrapperCopy<Y>(obj); return *this; }
-	Call &ReturnByRef(Y obj) { retVal = new ReturnValueWrapperRef<Y>(obj); return *this; }
-#ifndef HM_NO_EXCEPTIONS
-	template <typename Ex>
-	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
-#endif
 };
-template <typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J>
-class TCall<void,A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
-private:
-	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> *args;
+
+HM_INLINE std::ostream &operator<<(std::ostream &os, const MockRepository &repo);
+
+template <int X>
+class MockRepoInstanceHolder {
 public:
-		const base_tuple *getArgs() const { return args; }
-	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
-	~TCall() { delete args; }
-	bool matchesArgs(const base_tuple &tupl) {
-		return (!args && !matchFunctor) ||
-			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
-			(matchFunctor && (*(TupleInvocable<bool> *)(matchFunctor))(tupl));
-	}
-	void assignArgs(base_tuple &tupl) {
-		if(args) {
-			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-		}
-	}
-	template <typename CA, typename CB, typename CC, typename CD,
-			  typename CE, typename CF, typename CG, typename CH,
-			  typename CI, typename CJ>
-	TCall<void,A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g, const CH & h, const CI & i, const CJ & j) {
-		args = new copy_tuple<A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType,
-								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,const CH &,const CI &,const CJ &,NullType,NullType,NullType,NullType,NullType,NullType>(a,b,c,d,e,f,g,h,i,j,NullType(),NullType(),NullType(),NullType(),NullType(),NullType());
-		return *this;
-	}
-	TCall<void,A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
-		previousCalls.push_back(&call);
-		return *this;
-	}
-	template <typename T>
-	TCall<void,A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor = new DoWrapper<T,void,A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-	template <typename T>
-	TCall<void,A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor = new DoWrapper<T,bool,A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
+	static MockRepository *instance;
+};
+
+template <int X>
+MockRepository *MockRepoInstanceHolder<X>::instance;
+
+class BaseException
 #ifndef HM_NO_EXCEPTIONS
-	template <typename Ex>
-	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
+	: public BASE_EXCEPTION
 #endif
+{
+public:
+	~BaseException() throw() {}
+	const char *what() const throw() { return txt.c_str(); }
+protected:
+	std::string txt;
 };
 
-template <typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I>
-class TCall<Y,A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
-private:
-	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
+// exception types
+class ExpectationException : public BaseException {
 public:
-		const base_tuple *getArgs() const { return args; }
-	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
-	~TCall() { delete args; }
-	bool matchesArgs(const base_tuple &tupl) {
-		return (!args && !matchFunctor) ||
-			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
-			(matchFunctor && (*(TupleInvocable<bool> *)(matchFunctor))(tupl));
-	}
-	void assignArgs(base_tuple &tupl) {
-		if(args) {
-			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-		}
-	}
-	template <typename CA, typename CB, typename CC, typename CD,
-			  typename CE, typename CF, typename CG, typename CH,
-			  typename CI>
-	TCall<Y,A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g, const CH & h, const CI & i) {
-		args = new copy_tuple<A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
-								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,const CH &,const CI &,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(a,b,c,d,e,f,g,h,i,NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType());
-		return *this;
-	}
-	TCall<Y,A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
-		previousCalls.push_back(&call);
-		return *this;
-	}
-	template <typename T>
-	TCall<Y,A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor = new DoWrapper<T,Y,A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-	template <typename T>
-	TCall<Y,A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor = new DoWrapper<T,bool,A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-	Call &Return(Y obj) { retVal = new ReturnValueWrapperCopy<Y>(obj); return *this; }
-	Call &ReturnByRef(Y obj) { retVal = new ReturnValueWrapperRef<Y>(obj); return *this; }
-#ifndef HM_NO_EXCEPTIONS
-	template <typename Ex>
-	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
+	// Lists the registrations nearest to a call of funcno on mock with the arguments actual, if known.
+	ExpectationException(MockRepository *repo, const base_tuple *tuple, const char *funcName,
+	                     base_mock *mock = 0, std::pair<int, int> funcno = std::pair<int, int>(-1, -1),
+	                     const base_tuple *actual = 0);
+};
+
+#ifdef LINUX_TARGET
+#include <execinfo.h>
 #endif
+
+class NotImplementedException : public BaseException {
+public:
+	NotImplementedException(MockRepository *repo);
 };
-template <typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I>
-class TCall<void,A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
-private:
-	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
+
+class CallMissingException : public BaseException {
 public:
-		const base_tuple *getArgs() const { return args; }
-	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
-	~TCall() { delete args; }
-	bool matchesArgs(const base_tuple &tupl) {
-		return (!args && !matchFunctor) ||
-			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
-			(matchFunctor && (*(TupleInvocable<bool> *)(matchFunctor))(tupl));
-	}
-	void assignArgs(base_tuple &tupl) {
-		if(args) {
-			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-		}
-	}
-	template <typename CA, typename CB, typename CC, typename CD,
-			  typename CE, typename CF, typename CG, typename CH,
-			  typename CI>
-	TCall<void,A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g, const CH & h, const CI & i) {
-		args = new copy_tuple<A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
-								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,const CH &,const CI &,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(a,b,c,d,e,f,g,h,i,NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType());
-		return *this;
-	}
-	TCall<void,A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
-		previousCalls.push_back(&call);
-		return *this;
-	}
-	template <typename T>
-	TCall<void,A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor = new DoWrapper<T,void,A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-	template <typename T>
-	TCall<void,A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor = new DoWrapper<T,bool,A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-#ifndef HM_NO_EXCEPTIONS
-	template <typename Ex>
-	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
-#endif
+	CallMissingException(MockRepository *repo);
 };
 
-template <typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H>
-class TCall<Y,A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
-private:
-	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
+class ZombieMockException : public BaseException {
 public:
-		const base_tuple *getArgs() const { return args; }
-	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
-	~TCall() { delete args; }
-	bool matchesArgs(const base_tuple &tupl) {
-		return (!args && !matchFunctor) ||
-			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
-			(matchFunctor && (*(TupleInvocable<bool> *)(matchFunctor))(tupl));
-	}
-	void assignArgs(base_tuple &tupl) {
-		if(args) {
-			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-		}
-	}
-	template <typename CA, typename CB, typename CC, typename CD,
-			  typename CE, typename CF, typename CG, typename CH>
-	TCall<Y,A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g, const CH & h) {
-		args = new copy_tuple<A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
-								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,const CH &,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(a,b,c,d,e,f,g,h,NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType());
-		return *this;
-	}
-	TCall<Y,A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
-		previousCalls.push_back(&call);
-		return *this;
-	}
-	template <typename T>
-	TCall<Y,A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor = new DoWrapper<T,Y,A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-	template <typename T>
-	TCall<Y,A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor = new DoWrapper<T,bool,A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-	Call &Return(Y obj) { retVal = new ReturnValueWrapperCopy<Y>(obj); return *this; }
-	Call &ReturnByRef(Y obj) { retVal = new ReturnValueWrapperRef<Y>(obj); return *this; }
-#ifndef HM_NO_EXCEPTIONS
-	template <typename Ex>
-	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
-#endif
-};
-template <typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H>
-class TCall<void,A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
-private:
-	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
-public:
-		const base_tuple *getArgs() const { return args; }
-	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
-	~TCall() { delete args; }
-	bool matchesArgs(const base_tuple &tupl) {
-		return (!args && !matchFunctor) ||
-			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
-			(matchFunctor && (*(TupleInvocable<bool> *)(matchFunctor))(tupl));
-	}
-	void assignArgs(base_tuple &tupl) {
-		if(args) {
-			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-		}
-	}
-	template <typename CA, typename CB, typename CC, typename CD,
-			  typename CE, typename CF, typename CG, typename CH>
-	TCall<void,A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g, const CH & h) {
-		args = new copy_tuple<A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
-								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,const CH &,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(a,b,c,d,e,f,g,h,NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType());
-		return *this;
-	}
-	TCall<void,A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
-		previousCalls.push_back(&call);
-		return *this;
-	}
-	template <typename T>
-	TCall<void,A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor = new DoWrapper<T,void,A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-	template <typename T>
-	TCall<void,A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor = new DoWrapper<T,bool,A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-#ifndef HM_NO_EXCEPTIONS
-	template <typename Ex>
-	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
-#endif
+	ZombieMockException(MockRepository *repo);
 };
 
-template <typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G>
-class TCall<Y,A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
-private:
-	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
-public:
-		const base_tuple *getArgs() const { return args; }
-	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
-	~TCall() { delete args; }
-	bool matchesArgs(const base_tuple &tupl) {
-		return (!args && !matchFunctor) ||
-			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
-			(matchFunctor && (*(TupleInvocable<bool> *)(matchFunctor))(tupl));
-	}
-	void assignArgs(base_tuple &tupl) {
-		if(args) {
-			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-		}
-	}
-	template <typename CA, typename CB, typename CC, typename CD,
-			  typename CE, typename CF, typename CG>
-	TCall<Y,A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g) {
-		args = new copy_tuple<A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
-								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(a,b,c,d,e,f,g,NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType());
-		return *this;
-	}
-	TCall<Y,A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
-		previousCalls.push_back(&call);
-		return *this;
-	}
-	template <typename T>
-	TCall<Y,A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor = new DoWrapper<T,Y,A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-	template <typename T>
-	TCall<Y,A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor = new DoWrapper<T,bool,A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-	Call &Return(Y obj) { retVal = new ReturnValueWrapperCopy<Y>(obj); return *this; }
-	Call &ReturnByRef(Y obj) { retVal = new ReturnValueWrapperRef<Y>(obj); return *this; }
-#ifndef HM_NO_EXCEPTIONS
-	template <typename Ex>
-	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
-#endif
-};
-template <typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G>
-class TCall<void,A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
-private:
-	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
+class NoResultSetUpException : public BaseException {
 public:
-		const base_tuple *getArgs() const { return args; }
-	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
-	~TCall() { delete args; }
-	bool matchesArgs(const base_tuple &tupl) {
-		return (!args && !matchFunctor) ||
-			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
-			(matchFunctor && (*(TupleInvocable<bool> *)(matchFunctor))(tupl));
-	}
-	void assignArgs(base_tuple &tupl) {
-		if(args) {
-			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-		}
-	}
-	template <typename CA, typename CB, typename CC, typename CD,
-			  typename CE, typename CF, typename CG>
-	TCall<void,A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g) {
-		args = new copy_tuple<A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
-								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(a,b,c,d,e,f,g,NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType());
-		return *this;
-	}
-	TCall<void,A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
-		previousCalls.push_back(&call);
-		return *this;
-	}
-	template <typename T>
-	TCall<void,A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor = new DoWrapper<T,void,A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-	template <typename T>
-	TCall<void,A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor = new DoWrapper<T,bool,A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-#ifndef HM_NO_EXCEPTIONS
-	template <typename Ex>
-	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
-#endif
+	NoResultSetUpException(MockRepository *repo, const base_tuple *tuple, const char *funcName);
 };
 
-template <typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F>
-class TCall<Y,A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
-private:
-	ref_comparable_assignable_tuple<A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
+class RecordingFileException : public BaseException {
 public:
-		const base_tuple *getArgs() const { return args; }
-	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
-	~TCall() { delete args; }
-	bool matchesArgs(const base_tuple &tupl) {
-		return (!args && !matchFunctor) ||
-			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
-			(matchFunctor && (*(TupleInvocable<bool> *)(matchFunctor))(tupl));
-	}
-	void assignArgs(base_tuple &tupl) {
-		if(args) {
-			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-		}
-	}
-	template <typename CA, typename CB, typename CC, typename CD,
-			  typename CE, typename CF>
-	TCall<Y,A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f) {
-		args = new copy_tuple<A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
-								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(a,b,c,d,e,f,NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType());
-		return *this;
-	}
-	TCall<Y,A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
-		previousCalls.push_back(&call);
-		return *this;
-	}
-	template <typename T>
-	TCall<Y,A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor = new DoWrapper<T,Y,A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-	template <typename T>
-	TCall<Y,A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor = new DoWrapper<T,bool,A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-	Call &Return(Y obj) { retVal = new ReturnValueWrapperCopy<Y>(obj); return *this; }
-	Call &ReturnByRef(Y obj) { retVal = new ReturnValueWrapperRef<Y>(obj); return *this; }
-#ifndef HM_NO_EXCEPTIONS
-	template <typename Ex>
-	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
-#endif
+	RecordingFileException(const char *fileName);
 };
-template <typename A, typename B, typename C, typename D,
-		  typename E, typename F>
-class TCall<void,A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
-private:
-	ref_comparable_assignable_tuple<A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
+
+class EmptyCycleException : public BaseException {
 public:
-		const base_tuple *getArgs() const { return args; }
-	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
-	~TCall() { delete args; }
-	bool matchesArgs(const base_tuple &tupl) {
-		return (!args && !matchFunctor) ||
-			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
-			(matchFunctor && (*(TupleInvocable<bool> *)(matchFunctor))(tupl));
-	}
-	void assignArgs(base_tuple &tupl) {
-		if(args) {
-			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-		}
-	}
-	template <typename CA, typename CB, typename CC, typename CD,
-			  typename CE, typename CF>
-	TCall<void,A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f) {
-		args = new copy_tuple<A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
-								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(a,b,c,d,e,f,NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType());
-		return *this;
-	}
-	TCall<void,A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
-		previousCalls.push_back(&call);
-		return *this;
-	}
-	template <typename T>
-	TCall<void,A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor = new DoWrapper<T,void,A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-	template <typename T>
-	TCall<void,A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor = new DoWrapper<T,bool,A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-#ifndef HM_NO_EXCEPTIONS
-	template <typename Ex>
-	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
-#endif
+	EmptyCycleException(const char *funcName);
 };
 
-template <typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E>
-class TCall<Y,A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
-private:
-	ref_comparable_assignable_tuple<A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
+class EmptySequenceException : public BaseException {
 public:
-		const base_tuple *getArgs() const { return args; }
-	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
-	~TCall() { delete args; }
-	bool matchesArgs(const base_tuple &tupl) {
-		return (!args && !matchFunctor) ||
-			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
-			(matchFunctor && (*(TupleInvocable<bool> *)(matchFunctor))(tupl));
-	}
-	void assignArgs(base_tuple &tupl) {
-		if(args) {
-			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-		}
-	}
-	template <typename CA, typename CB, typename CC, typename CD,
-			  typename CE>
-	TCall<Y,A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e) {
-		args = new copy_tuple<A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
-								const CA &,const CB &,const CC &,const CD &,const CE &,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(a,b,c,d,e,NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType());
-		return *this;
-	}
-	TCall<Y,A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
-		previousCalls.push_back(&call);
-		return *this;
-	}
-	template <typename T>
-	TCall<Y,A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor = new DoWrapper<T,Y,A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-	template <typename T>
-	TCall<Y,A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor = new DoWrapper<T,bool,A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-	Call &Return(Y obj) { retVal = new ReturnValueWrapperCopy<Y>(obj); return *this; }
-	Call &ReturnByRef(Y obj) { retVal = new ReturnValueWrapperRef<Y>(obj); return *this; }
-#ifndef HM_NO_EXCEPTIONS
-	template <typename Ex>
-	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
-#endif
+	EmptySequenceException(const char *funcName);
 };
-template <typename A, typename B, typename C, typename D,
-		  typename E>
-class TCall<void,A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
-private:
-	ref_comparable_assignable_tuple<A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
+
+class CallCountConflictException : public BaseException {
 public:
-		const base_tuple *getArgs() const { return args; }
-	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
-	~TCall() { delete args; }
-	bool matchesArgs(const base_tuple &tupl) {
-		return (!args && !matchFunctor) ||
-			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
-			(matchFunctor && (*(TupleInvocable<bool> *)(matchFunctor))(tupl));
-	}
-	void assignArgs(base_tuple &tupl) {
-		if(args) {
-			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-		}
-	}
-	template <typename CA, typename CB, typename CC, typename CD,
-			  typename CE>
-	TCall<void,A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e) {
-		args = new copy_tuple<A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
-								const CA &,const CB &,const CC &,const CD &,const CE &,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(a,b,c,d,e,NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType());
-		return *this;
-	}
-	TCall<void,A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
-		previousCalls.push_back(&call);
-		return *this;
-	}
-	template <typename T>
-	TCall<void,A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor = new DoWrapper<T,void,A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-	template <typename T>
-	TCall<void,A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor = new DoWrapper<T,bool,A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-#ifndef HM_NO_EXCEPTIONS
-	template <typename Ex>
-	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
-#endif
+	CallCountConflictException(const char *funcName, unsigned expected, size_t results);
 };
 
-template <typename Y,
-		  typename A, typename B, typename C, typename D>
-class TCall<Y,A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
-private:
-	ref_comparable_assignable_tuple<A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
-public:
-		const base_tuple *getArgs() const { return args; }
-	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
-	~TCall() { delete args; }
-	bool matchesArgs(const base_tuple &tupl) {
-		return (!args && !matchFunctor) ||
-			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
-			(matchFunctor && (*(TupleInvocable<bool> *)(matchFunctor))(tupl));
-	}
-	void assignArgs(base_tuple &tupl) {
-		if(args) {
-			args->assign_to(static_cast<ref_tuple<A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-			args->assign_from(static_cast<ref_tuple<A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-		}
-	}
-	template <typename CA, typename CB, typename CC, typename CD>
-	TCall<Y,A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d) {
-		args = new copy_tuple<A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
-								const CA &,const CB &,const CC &,const CD &,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(a,b,c,d,NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType());
-		return *this;
-	}
-	TCall<Y,A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
-		previousCalls.push_back(&call);
-		return *this;
-	}
-	template <typename T>
-	TCall<Y,A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor = new DoWrapper<T,Y,A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-	template <typename T>
-	TCall<Y,A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor = new DoWrapper<T,bool,A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-	Call &Return(Y obj) { retVal = new ReturnValueWrapperCopy<Y>(obj); return *this; }
-	Call &ReturnByRef(Y obj) { retVal = new ReturnValueWrapperRef<Y>(obj); return *this; }
-#ifndef HM_NO_EXCEPTIONS
-	template <typename Ex>
-	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
-#endif
-};
-template <typename A, typename B, typename C, typename D>
-class TCall<void,A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
-private:
-	ref_comparable_assignable_tuple<A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
-public:
-		const base_tuple *getArgs() const { return args; }
-	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
-	~TCall() { delete args; }
-	bool matchesArgs(const base_tuple &tupl) {
-		return (!args && !matchFunctor) ||
-			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
-			(matchFunctor && (*(TupleInvocable<bool> *)(matchFunctor))(tupl));
-	}
-	void assignArgs(base_tuple &tupl) {
-		if(args) {
-			args->assign_to(static_cast<ref_tuple<A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-			args->assign_from(static_cast<ref_tuple<A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-		}
-	}
-	template <typename CA, typename CB, typename CC, typename CD>
-	TCall<void,A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d) {
-		args = new copy_tuple<A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
-								const CA &,const CB &,const CC &,const CD &,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(a,b,c,d,NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType());
-		return *this;
-	}
-	TCall<void,A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
-		previousCalls.push_back(&call);
-		return *this;
-	}
-	template <typename T>
-	TCall<void,A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor = new DoWrapper<T,void,A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-	template <typename T>
-	TCall<void,A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor = new DoWrapper<T,bool,A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-#ifndef HM_NO_EXCEPTIONS
-	template <typename Ex>
-	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
-#endif
-};
-
-template <typename Y,
-		  typename A, typename B, typename C>
-class TCall<Y,A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
-private:
-	ref_comparable_assignable_tuple<A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
-public:
-		const base_tuple *getArgs() const { return args; }
-	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
-	~TCall() { delete args; }
-	bool matchesArgs(const base_tuple &tupl) {
-		return (!args && !matchFunctor) ||
-			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
-			(matchFunctor && (*(TupleInvocable<bool> *)(matchFunctor))(tupl));
-	}
-	void assignArgs(base_tuple &tupl) {
-		if(args) {
-			args->assign_to(static_cast<ref_tuple<A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-			args->assign_from(static_cast<ref_tuple<A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-		}
-	}
-	template <typename CA, typename CB, typename CC>
-	TCall<Y,A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c) {
-		args = new copy_tuple<A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
-								const CA &,const CB &,const CC &,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(a,b,c,NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType());
-		return *this;
-	}
-	TCall<Y,A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
-		previousCalls.push_back(&call);
-		return *this;
-	}
-	template <typename T>
-	TCall<Y,A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor = new DoWrapper<T,Y,A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-	template <typename T>
-	TCall<Y,A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor = new DoWrapper<T,bool,A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-	Call &Return(Y obj) { retVal = new ReturnValueWrapperCopy<Y>(obj); return *this; }
-	Call &ReturnByRef(Y obj) { retVal = new ReturnValueWrapperRef<Y>(obj); return *this; }
-#ifndef HM_NO_EXCEPTIONS
-	template <typename Ex>
-	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
-#endif
-};
-template <typename A, typename B, typename C>
-class TCall<void,A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
-private:
-	ref_comparable_assignable_tuple<A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
-public:
-		const base_tuple *getArgs() const { return args; }
-	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
-	~TCall() { delete args; }
-	bool matchesArgs(const base_tuple &tupl) {
-		return (!args && !matchFunctor) ||
-			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
-			(matchFunctor && (*(TupleInvocable<bool> *)(matchFunctor))(tupl));
-	}
-	void assignArgs(base_tuple &tupl) {
-		if(args) {
-			args->assign_to(static_cast<ref_tuple<A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-			args->assign_from(static_cast<ref_tuple<A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-		}
-	}
-	template <typename CA, typename CB, typename CC>
-	TCall<void,A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c) {
-		args = new copy_tuple<A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
-								const CA &,const CB &,const CC &,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(a,b,c,NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType());
-		return *this;
-	}
-	TCall<void,A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
-		previousCalls.push_back(&call);
-		return *this;
-	}
-	template <typename T>
-	TCall<void,A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor = new DoWrapper<T,void,A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-	template <typename T>
-	TCall<void,A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor = new DoWrapper<T,bool,A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-#ifndef HM_NO_EXCEPTIONS
-	template <typename Ex>
-	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
-#endif
-};
-
-template <typename Y,
-		  typename A, typename B>
-class TCall<Y,A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
-private:
-	ref_comparable_assignable_tuple<A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
-public:
-		const base_tuple *getArgs() const { return args; }
-	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
-	~TCall() { delete args; }
-	bool matchesArgs(const base_tuple &tupl) {
-		return (!args && !matchFunctor) ||
-			(args && (*args == reinterpret_cast<const ref_tuple<A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
-			(matchFunctor && (*(TupleInvocable<bool> *)(matchFunctor))(tupl));
-	}
-	void assignArgs(base_tuple &tupl) {
-		if(args) {
-			args->assign_to(static_cast<ref_tuple<A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-			args->assign_from(static_cast<ref_tuple<A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-		}
-	}
-	template <typename CA, typename CB>
-	TCall<Y,A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b) {
-		args = new copy_tuple<A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
-								const CA &,const CB &,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(a,b,NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType());
-		return *this;
-	}
-	TCall<Y,A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
-		previousCalls.push_back(&call);
-		return *this;
-	}
-	template <typename T>
-	TCall<Y,A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor = new DoWrapper<T,Y,A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-	template <typename T>
-	TCall<Y,A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor = new DoWrapper<T,bool,A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-	Call &Return(Y obj) { retVal = new ReturnValueWrapperCopy<Y>(obj); return *this; }
-	Call &ReturnByRef(Y obj) { retVal = new ReturnValueWrapperRef<Y>(obj); return *this; }
-#ifndef HM_NO_EXCEPTIONS
-	template <typename Ex>
-	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
-#endif
-};
-template <typename A, typename B>
-class TCall<void,A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
-private:
-	ref_comparable_assignable_tuple<A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
-public:
-		const base_tuple *getArgs() const { return args; }
-	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
-	~TCall() { delete args; }
-	bool matchesArgs(const base_tuple &tupl) {
-		return (!args && !matchFunctor) ||
-			(args && (*args == reinterpret_cast<const ref_tuple<A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
-			(matchFunctor && (*(TupleInvocable<bool> *)(matchFunctor))(tupl));
-	}
-	void assignArgs(base_tuple &tupl) {
-		if(args) {
-			args->assign_to(static_cast<ref_tuple<A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-			args->assign_from(static_cast<ref_tuple<A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-		}
-	}
-	template <typename CA, typename CB>
-	TCall<void,A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b) {
-		args = new copy_tuple<A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
-								const CA &,const CB &,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(a,b,NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType());
-		return *this;
-	}
-	TCall<void,A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
-		previousCalls.push_back(&call);
-		return *this;
-	}
-	template <typename T>
-	TCall<void,A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor = new DoWrapper<T,void,A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-	template <typename T>
-	TCall<void,A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor = new DoWrapper<T,bool,A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-#ifndef HM_NO_EXCEPTIONS
-	template <typename Ex>
-	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
-#endif
-};
-
-template <typename Y,
-		  typename A>
-class TCall<Y,A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
-private:
-	ref_comparable_assignable_tuple<A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
-public:
-		const base_tuple *getArgs() const { return args; }
-	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
-	~TCall() { delete args; }
-	bool matchesArgs(const base_tuple &tupl) {
-		return (!args && !matchFunctor) ||
-			(args && (*args == reinterpret_cast<const ref_tuple<A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
-			(matchFunctor && (*(TupleInvocable<bool> *)(matchFunctor))(tupl));
-	}
-	void assignArgs(base_tuple &tupl) {
-		if(args) {
-			args->assign_to(static_cast<ref_tuple<A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-			args->assign_from(static_cast<ref_tuple<A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
-		}
-	}
-	template <typename CA>
-	TCall<Y,A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a) {
-		args = new copy_tuple<A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
-								const CA &,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(a,NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType());
-		return *this;
-	}
-	TCall<Y,A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
-		previousCalls.push_back(&call);
-		return *this;
-	}
-	template <typename T>
-	TCall<Y,A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor = new DoWrapper<T,Y,A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-	template <typename T>
-	TCall<Y,A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor = new DoWrapper<T,bool,A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-	Call &Return(Y obj) { retVal = new ReturnValueWrapperCopy<Y>(obj); return *this; }
-	Call &ReturnByRef(Y obj) { retVal = new ReturnValueWrapperRef<Y>(obj); return *this; }
-#ifndef HM_NO_EXCEPTIONS
-	template <typename Ex>
-	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
-#endif
-};
-template <typename A>
-class TCall<void,A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
-private:
-	ref_comparable_assignable_tuple<A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
+// function-index-of-type
+class func_index {
 public:
-		const base_tuple *getArgs() const { return args; }
-	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
-	~TCall() { delete args; }
-	bool matchesArgs(const base_tuple &tupl) {
-		return (!args && !matchFunctor) ||
-			(args && (*args == reinterpret_cast<const ref_tuple<A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
-			(matchFunctor && (*(TupleInvocable<bool> *)(matchFunctor))(tupl));
-	}
-	void assignArgs(base_tuple &tupl) {
-		if(args) {
+	int lci;
+	virtual int f0(int) { return lci=0; }			virtual int f1(int) { return lci=1; }			virtual int f2(int) { return lci=2; }			virtual int f3(int) { return lci=3; }
+	virtual int f4(int) { return lci=4; }			virtual int f5(int) { return lci=5; }			virtual int f6(int) { return lci=6; }			virtual int f7(int) { return lci=7; }
+	virtual int f8(int) { return lci=8; }			virtual int f9(int) { return lci=9; }			virtual int f10(int) { return lci=10; }		virtual int f11(int) { return lci=11; }
+	virtual int f12(int) { return lci=12; }		virtual int f13(int) { return lci=13; }		virtual int f14(int) { return lci=14; }		virtual int f15(int) { return lci=15; }
+	virtual int f16(int) { return lci=16; }		virtual int f17(int) { return lci=17; }		virtual int f18(int) { return lci=18; }		virtual int f19(int) { return lci=19; }
+	virtual int f20(int) { return lci=20; }		virtual int f21(int) { return lci=21; }		virtual int f22(int) { return lci=22; }		virtual int f23(int) { return lci=23; }
+	virtual int f24(int) { return lci=24; }		virtual int f25(int) { return lci=25; }		virtual int f26(int) { return lci=26; }		virtual int f27(int) { return lci=27; }
+	virtual int f28(int) { return lci=28; }		virtual int f29(int) { return lci=29; }		virtual int f30(int) { return lci=30; }		virtual int f31(int) { return lci=31; }
+	virtual int f32(int) { return lci=32; }		virtual int f33(int) { return lci=33; }		virtual int f34(int) { return lci=34; }		virtual int f35(int) { return lci=35; }
+	virtual int f36(int) { return lci=36; }		virtual int f37(int) { return lci=37; }		virtual int f38(int) { return lci=38; }		virtual int f39(int) { return lci=39; }
+	virtual int f40(int) { return lci=40; }		virtual int f41(int) { return lci=41; }		virtual int f42(int) { return lci=42; }		virtual int f43(int) { return lci=43; }
+	virtual int f44(int) { return lci=44; }		virtual int f45(int) { return lci=45; }		virtual int f46(int) { return lci=46; }		virtual int f47(int) { return lci=47; }
+	virtual int f48(int) { return lci=48; }		virtual int f49(int) { return lci=49; }		virtual int f50(int) { return lci=50; }		virtual int f51(int) { return lci=51; }
+	virtual int f52(int) { return lci=52; }		virtual int f53(int) { return lci=53; }		virtual int f54(int) { return lci=54; }		virtual int f55(int) { return lci=55; }
+	virtual int f56(int) { return lci=56; }		virtual int f57(int) { return lci=57; }		virtual int f58(int) { return lci=58; }		virtual int f59(int) { return lci=59; }
+	virtual int f60(int) { return lci=60; }		virtual int f61(int) { return lci=61; }		virtual int f62(int) { return lci=62; }		virtual int f63(int) { return lci=63; }
+	virtual int f64(int) { return lci=64; }		virtual int f65(int) { return lci=65; }		virtual int f66(int) { return lci=66; }		virtual int f67(int) { return lci=67; }
+	virtual int f68(int) { return lci=68; }		virtual int f69(int) { return lci=69; }		virtual int f70(int) { return lci=70; }		virtual int f71(int) { return lci=71; }
+	virtual int f72(int) { return lci=72; }		virtual int f73(int) { return lci=73; }		virtual int f74(int) { return lci=74; }		virtual int f75(int) { return lci=75; }
+	virtual int f76(int) { return lci=76; }		virtual int f77(int) { return lci=77; }		virtual int f78(int) { return lci=78; }		virtual int f79(int) { return lci=79; }
+	virtual int f80(int) { return lci=80; }		virtual int f81(int) { return lci=81; }		virtual int f82(int) { return lci=82; }		virtual int f83(int) { return lci=83; }
+	virtual int f84(int) { return lci=84; }		virtual int f85(int) { return lci=85; }		virtual int f86(int) { return lci=86; }		virtual int f87(int) { return lci=87; }
+	virtual int f88(int) { return lci=88; }		virtual int f89(int) { return lci=89; }		virtual int f90(int) { return lci=90; }		virtual int f91(int) { return lci=91; }
+	virtual int f92(int) { return lci=92; }		virtual int f93(int) { return lci=93; }		virtual int f94(int) { return lci=94; }		virtual int f95(int) { return lci=95; }
+	virtual int f96(int) { return lci=96; }		virtual int f97(int) { return lci=97; }		virtual int f98(int) { return lci=98; }		virtual int f99(int) { return lci=99; }
+	virtual int f100(int) { return lci=100; }		virtual int f101(int) { return lci=101; }		virtual int f102(int) { return lci=102; }		virtual int f103(int) { return lci=103; }
+	virtual int f104(int) { return lci=104; }		virtual int f105(int) { return lci=105; }		virtual int f106(int) { return lci=106; }		virtual int f107(int) { return lci=107; }
+	virtual int f108(int) { return lci=108; }		virtual int f109(int) { return lci=109; }		virtual int f110(int) { return lci=110; }		virtual int f111(int) { return lci=111; }
+	virtual int f112(int) { return lci=112; }		virtual int f113(int) { return lci=113; }		virtual int f114(int) { return lci=114; }		virtual int f115(int) { return lci=115; }
+	virtual int f116(int) { return lci=116; }		virtual int f117(int) { return lci=117; }		virtual int f118(int) { return lci=118; }		virtual int f119(int) { return lci=119; }
+	virtual int f120(int) { return lci=120; }		virtual int f121(int) { return lci=121; }		virtual int f122(int) { return lci=122; }		virtual int f123(int) { return lci=123; }
+	virtual int f124(int) { return lci=124; }		virtual int f125(int) { return lci=125; }		virtual int f126(int) { return lci=126; }		virtual int f127(int) { return lci=127; }
+	virtual int f128(int) { return lci=128; }		virtual int f129(int) { return lci=129; }		virtual int f130(int) { return lci=130; }		virtual int f131(int) { return lci=131; }
+	virtual int f132(int) { return lci=132; }		virtual int f133(int) { return lci=133; }		virtual int f134(int) { return lci=134; }		virtual int f135(int) { return lci=135; }
+	virtual int f136(int) { return lci=136; }		virtual int f137(int) { return lci=137; }		virtual int f138(int) { return lci=138; }		virtual int f139(int) { return lci=139; }
+	virtual int f140(int) { return lci=140; }		virtual int f141(int) { return lci=141; }		virtual int f142(int) { return lci=142; }		virtual int f143(int) { return lci=143; }
+	virtual int f144(int) { return lci=144; }		virtual int f145(int) { return lci=145; }		virtual int f146(int) { return lci=146; }		virtual int f147(int) { return lci=147; }
+	virtual int f148(int) { return lci=148; }		virtual int f149(int) { return lci=149; }		virtual int f150(int) { return lci=150; }		virtual int f151(int) { return lci=151; }
+	virtual int f152(int) { return lci=152; }		virtual int f153(int) { return lci=153; }		virtual int f154(int) { return lci=154; }		virtual int f155(int) { return lci=155; }
+	virtual int f156(int) { return lci=156; }		virtual int f157(int) { return lci=157; }		virtual int f158(int) { return lci=158; }		virtual int f159(int) { return lci=159; }
+	virtual int f160(int) { return lci=160; }		virtual int f161(int) { return lci=161; }		virtual int f162(int) { return lci=162; }		virtual int f163(int) { return lci=163; }
+	virtual int f164(int) { return lci=164; }		virtual int f165(int) { return lci=165; }		virtual int f166(int) { return lci=166; }		virtual int f167(int) { return lci=167; }
+	virtual int f168(int) { return lci=168; }		virtual int f169(int) { return lci=169; }		virtual int f170(int) { return lci=170; }		virtual int f171(int) { return lci=171; }
+	virtual int f172(int) { return lci=172; }		virtual int f173(int) { return lci=173; }		virtual int f174(int) { return lci=174; }		virtual int f175(int) { return lci=175; }
+	virtual int f176(int) { return lci=176; }		virtual int f177(int) { return lci=177; }		virtual int f178(int) { return lci=178; }		virtual int f179(int) { return lci=179; }
+	virtual int f180(int) { return lci=180; }		virtual int f181(int) { return lci=181; }		virtual int f182(int) { return lci=182; }		virtual int f183(int) { return lci=183; }
+	virtual int f184(int) { return lci=184; }		virtual int f185(int) { return lci=185; }		virtual int f186(int) { return lci=186; }		virtual int f187(int) { return lci=187; }
+	virtual int f188(int) { return lci=188; }		virtual int f189(int) { return lci=189; }		virtual int f190(int) { return lci=190; }		virtual int f191(int) { return lci=191; }
+	virtual int f192(int) { return lci=192; }		virtual int f193(int) { return lci=193; }		virtual int f194(int) { return lci=194; }		virtual int f195(int) { return lci=195; }
+	virtual int f196(int) { return lci=196; }		virtual int f197(int) { return lci=197; }		virtual int f198(int) { return lci=198; }		virtual int f199(int) { return lci=199; }
+	virtual int f200(int) { return lci=200; }		virtual int f201(int) { return lci=201; }		virtual int f202(int) { return lci=202; }		virtual int f203(int) { return lci=203; }
+	virtual int f204(int) { return lci=204; }		virtual int f205(int) { return lci=205; }		virtual int f206(int) { return lci=206; }		virtual int f207(int) { return lci=207; }
+	virtual int f208(int) { return lci=208; }		virtual int f209(int) { return lci=209; }		virtual int f210(int) { return lci=210; }		virtual int f211(int) { return lci=211; }
+	virtual int f212(int) { return lci=212; }		virtual int f213(int) { return lci=213; }		virtual int f214(int) { return lci=214; }		virtual int f215(int) { return lci=215; }
+	virtual int f216(int) { return lci=216; }		virtual int f217(int) { return lci=217; }		virtual int f218(int) { return lci=218; }		virtual int f219(int) { return lci=219; }
+	virtual int f220(int) { return lci=220; }		virtual int f221(int) { return lci=221; }		virtual int f222(int) { return lci=222; }		virtual int f223(int) { return lci=223; }
+	virtual int f224(int) { return lci=224; }		virtual int f225(int) { return lci=225; }		virtual int f226(int) { return lci=226; }		virtual int f227(int) { return lci=227; }
+	virtual int f228(int) { return lci=228; }		virtual int f229(int) { return lci=229; }		virtual int f230(int) { return lci=230; }		virtual int f231(int) { return lci=231; }
+	virtual int f232(int) { return lci=232; }		virtual int f233(int) { return lci=233; }		virtual int f234(int) { return lci=234; }		virtual int f235(int) { return lci=235; }
+	virtual int f236(int) { return lci=236; }		virtual int f237(int) { return lci=237; }		virtual int f238(int) { return lci=238; }		virtual int f239(int) { return lci=239; }
+	virtual int f240(int) { return lci=240; }		virtual int f241(int) { return lci=241; }		virtual int f242(int) { return lci=242; }		virtual int f243(int) { return lci=243; }
+	virtual int f244(int) { return lci=244; }		virtual int f245(int) { return lci=245; }		virtual int f246(int) { return lci=246; }		virtual int f247(int) { return lci=247; }
+	virtual int f248(int) { return lci=248; }		virtual int f249(int) { return lci=249; }		virtual int f250(int) { return lci=250; }		virtual int f251(int) { return lci=251; }
+	virtual int f252(int) { return lci=252; }		virtual int f253(int) { return lci=253; }		virtual int f254(int) { return lci=254; }		virtual int f255(int) { return lci=255; }
+	virtual int f256(int) { return lci=256; }		virtual int f257(int) { return lci=257; }		virtual int f258(int) { return lci=258; }		virtual int f259(int) { return lci=259; }
+	virtual int f260(int) { return lci=260; }		virtual int f261(int) { return lci=261; }		virtual int f262(int) { return lci=262; }		virtual int f263(int) { return lci=263; }
+	virtual int f264(int) { return lci=264; }		virtual int f265(int) { return lci=265; }		virtual int f266(int) { return lci=266; }		virtual int f267(int) { return lci=267; }
+	virtual int f268(int) { return lci=268; }		virtual int f269(int) { return lci=269; }		virtual int f270(int) { return lci=270; }		virtual int f271(int) { return lci=271; }
+	virtual int f272(int) { return lci=272; }		virtual int f273(int) { return lci=273; }		virtual int f274(int) { return lci=274; }		virtual int f275(int) { return lci=275; }
+	virtual int f276(int) { return lci=276; }		virtual int f277(int) { return lci=277; }		virtual int f278(int) { return lci=278; }		virtual int f279(int) { return lci=279; }
+	virtual int f280(int) { return lci=280; }		virtual int f281(int) { return lci=281; }		virtual int f282(int) { return lci=282; }		virtual int f283(int) { return lci=283; }
+	virtual int f284(int) { return lci=284; }		virtual int f285(int) { return lci=285; }		virtual int f286(int) { return lci=286; }		virtual int f287(int) { return lci=287; }
+	virtual int f288(int) { return lci=288; }		virtual int f289(int) { return lci=289; }		virtual int f290(int) { return lci=290; }		virtual int f291(int) { return lci=291; }
+	virtual int f292(int) { return lci=292; }		virtual int f293(int) { return lci=293; }		virtual int f294(int) { return lci=294; }		virtual int f295(int) { return lci=295; }
+	virtual int f296(int) { return lci=296; }		virtual int f297(int) { return lci=297; }		virtual int f298(int) { return lci=298; }		virtual int f299(int) { return lci=299; }
+	virtual int f300(int) { return lci=300; }		virtual int f301(int) { return lci=301; }		virtual int f302(int) { return lci=302; }		virtual int f303(int) { return lci=303; }
+	virtual int f304(int) { return lci=304; }		virtual int f305(int) { return lci=305; }		virtual int f306(int) { return lci=306; }		virtual int f307(int) { return lci=307; }
+	virtual int f308(int) { return lci=308; }		virtual int f309(int) { return lci=309; }		virtual int f310(int) { return lci=310; }		virtual int f311(int) { return lci=311; }
+	virtual int f312(int) { return lci=312; }		virtual int f313(int) { return lci=313; }		virtual int f314(int) { return lci=314; }		virtual int f315(int) { return lci=315; }
+	virtual int f316(int) { return lci=316; }		virtual int f317(int) { return lci=317; }		virtual int f318(int) { return lci=318; }		virtual int f319(int) { return lci=319; }
+	virtual int f320(int) { return lci=320; }		virtual int f321(int) { return lci=321; }		virtual int f322(int) { return lci=322; }		virtual int f323(int) { return lci=323; }
+	virtual int f324(int) { return lci=324; }		virtual int f325(int) { return lci=325; }		virtual int f326(int) { return lci=326; }		virtual int f327(int) { return lci=327; }
+	virtual int f328(int) { return lci=328; }		virtual int f329(int) { return lci=329; }		virtual int f330(int) { return lci=330; }		virtual int f331(int) { return lci=331; }
+	virtual int f332(int) { return lci=332; }		virtual int f333(int) { return lci=333; }		virtual int f334(int) { return lci=334; }		virtual int f335(int) { return lci=335; }
+	virtual int f336(int) { return lci=336; }		virtual int f337(int) { return lci=337; }		virtual int f338(int) { return lci=338; }		virtual int f339(int) { return lci=339; }
+	virtual int f340(int) { return lci=340; }		virtual int f341(int) { return lci=341; }		virtual int f342(int) { return lci=342; }		virtual int f343(int) { return lci=343; }
+	virtual int f344(int) { return lci=344; }		virtual int f345(int) { return lci=345; }		virtual int f346(int) { return lci=346; }		virtual int f347(int) { return lci=347; }
+	virtual int f348(int) { return lci=348; }		virtual int f349(int) { return lci=349; }		virtual int f350(int) { return lci=350; }		virtual int f351(int) { return lci=351; }
+	virtual int f352(int) { return lci=352; }		virtual int f353(int) { return lci=353; }		virtual int f354(int) { return lci=354; }		virtual int f355(int) { return lci=355; }
+	virtual int f356(int) { return lci=356; }		virtual int f357(int) { return lci=357; }		virtual int f358(int) { return lci=358; }		virtual int f359(int) { return lci=359; }
+	virtual int f360(int) { return lci=360; }		virtual int f361(int) { return lci=361; }		virtual int f362(int) { return lci=362; }		virtual int f363(int) { return lci=363; }
+	virtual int f364(int) { return lci=364; }		virtual int f365(int) { return lci=365; }		virtual int f366(int) { return lci=366; }		virtual int f367(int) { return lci=367; }
+	virtual int f368(int) { return lci=368; }		virtual int f369(int) { return lci=369; }		virtual int f370(int) { return lci=370; }		virtual int f371(int) { return lci=371; }
+	virtual int f372(int) { return lci=372; }		virtual int f373(int) { return lci=373; }		virtual int f374(int) { return lci=374; }		virtual int f375(int) { return lci=375; }
+	virtual int f376(int) { return lci=376; }		virtual int f377(int) { return lci=377; }		virtual int f378(int) { return lci=378; }		virtual int f379(int) { return lci=379; }
+	virtual int f380(int) { return lci=380; }		virtual int f381(int) { return lci=381; }		virtual int f382(int) { return lci=382; }		virtual int f383(int) { return lci=383; }
+	virtual int f384(int) { return lci=384; }		virtual int f385(int) { return lci=385; }		virtual int f386(int) { return lci=386; }		virtual int f387(int) { return lci=387; }
+	virtual int f388(int) { return lci=388; }		virtual int f389(int) { return lci=389; }		virtual int f390(int) { return lci=390; }		virtual int f391(int) { return lci=391; }
+	virtual int f392(int) { return lci=392; }		virtual int f393(int) { return lci=393; }		virtual int f394(int) { return lci=394; }		virtual int f395(int) { return lci=395; }
+	virtual int f396(int) { return lci=396; }		virtual int f397(int) { return lci=397; }		virtual int f398(int) { return lci=398; }		virtual int f399(int) { return lci=399; }
+	virtual int f400(int) { return lci=400; }		virtual int f401(int) { return lci=401; }		virtual int f402(int) { return lci=402; }		virtual int f403(int) { return lci=403; }
+	virtual int f404(int) { return lci=404; }		virtual int f405(int) { return lci=405; }		virtual int f406(int) { return lci=406; }		virtual int f407(int) { return lci=407; }
+	virtual int f408(int) { return lci=408; }		virtual int f409(int) { return lci=409; }		virtual int f410(int) { return lci=410; }		virtual int f411(int) { return lci=411; }
+	virtual int f412(int) { return lci=412; }		virtual int f413(int) { return lci=413; }		virtual int f414(int) { return lci=414; }		virtual int f415(int) { return lci=415; }
+	virtual int f416(int) { return lci=416; }		virtual int f417(int) { return lci=417; }		virtual int f418(int) { return lci=418; }		virtual int f419(int) { return lci=419; }
+	virtual int f420(int) { return lci=420; }		virtual int f421(int) { return lci=421; }		virtual int f422(int) { return lci=422; }		virtual int f423(int) { return lci=423; }
+	virtual int f424(int) { return lci=424; }		virtual int f425(int) { return lci=425; }		virtual int f426(int) { return lci=426; }		virtual int f427(int) { return lci=427; }
+	virtual int f428(int) { return lci=428; }		virtual int f429(int) { return lci=429; }		virtual int f430(int) { return lci=430; }		virtual int f431(int) { return lci=431; }
+	virtual int f432(int) { return lci=432; }		virtual int f433(int) { return lci=433; }		virtual int f434(int) { return lci=434; }		virtual int f435(int) { return lci=435; }
+	virtual int f436(int) { return lci=436; }		virtual int f437(int) { return lci=437; }		virtual int f438(int) { return lci=438; }		virtual int f439(int) { return lci=439; }
+	virtual int f440(int) { return lci=440; }		virtual int f441(int) { return lci=441; }		virtual int f442(int) { return lci=442; }		virtual int f443(int) { return lci=443; }
+	virtual int f444(int) { return lci=444; }		virtual int f445(int) { return lci=445; }		virtual int f446(int) { return lci=446; }		virtual int f447(int) { return lci=447; }
+	virtual int f448(int) { return lci=448; }		virtual int f449(int) { return lci=449; }		virtual int f450(int) { return lci=450; }		virtual int f451(int) { return lci=451; }
+	virtual int f452(int) { return lci=452; }		virtual int f453(int) { return lci=453; }		virtual int f454(int) { return lci=454; }		virtual int f455(int) { return lci=455; }
+	virtual int f456(int) { return lci=456; }		virtual int f457(int) { return lci=457; }		virtual int f458(int) { return lci=458; }		virtual int f459(int) { return lci=459; }
+	virtual int f460(int) { return lci=460; }		virtual int f461(int) { return lci=461; }		virtual int f462(int) { return lci=462; }		virtual int f463(int) { return lci=463; }
+	virtual int f464(int) { return lci=464; }		virtual int f465(int) { return lci=465; }		virtual int f466(int) { return lci=466; }		virtual int f467(int) { return lci=467; }
+	virtual int f468(int) { return lci=468; }		virtual int f469(int) { return lci=469; }		virtual int f470(int) { return lci=470; }		virtual int f471(int) { return lci=471; }
+	virtual int f472(int) { return lci=472; }		virtual int f473(int) { return lci=473; }		virtual int f474(int) { return lci=474; }		virtual int f475(int) { return lci=475; }
+	virtual int f476(int) { return lci=476; }		virtual int f477(int) { return lci=477; }		virtual int f478(int) { return lci=478; }		virtual int f479(int) { return lci=479; }
+	virtual int f480(int) { return lci=480; }		virtual int f481(int) { return lci=481; }		virtual int f482(int) { return lci=482; }		virtual int f483(int) { return lci=483; }
+	virtual int f484(int) { return lci=484; }		virtual int f485(int) { return lci=485; }		virtual int f486(int) { return lci=486; }		virtual int f487(int) { return lci=487; }
+	virtual int f488(int) { return lci=488; }		virtual int f489(int) { return lci=489; }		virtual int f490(int) { return lci=490; }		virtual int f491(int) { return lci=491; }
+	virtual int f492(int) { return lci=492; }		virtual int f493(int) { return lci=493; }		virtual int f494(int) { return lci=494; }		virtual int f495(int) { return lci=495; }
+	virtual int f496(int) { return lci=496; }		virtual int f497(int) { return lci=497; }		virtual int f498(int) { return lci=498; }		virtual int f499(int) { return lci=499; }
+	virtual int f500(int) { return lci=500; }		virtual int f501(int) { return lci=501; }		virtual int f502(int) { return lci=502; }		virtual int f503(int) { return lci=503; }
+	virtual int f504(int) { return lci=504; }		virtual int f505(int) { return lci=505; }		virtual int f506(int) { return lci=506; }		virtual int f507(int) { return lci=507; }
+	virtual int f508(int) { return lci=508; }		virtual int f509(int) { return lci=509; }		virtual int f510(int) { return lci=510; }		virtual int f511(int) { return lci=511; }
+	virtual int f512(int) { return lci=512; }		virtual int f513(int) { return lci=513; }		virtual int f514(int) { return lci=514; }		virtual int f515(int) { return lci=515; }
+	virtual int f516(int) { return lci=516; }		virtual int f517(int) { return lci=517; }		virtual int f518(int) { return lci=518; }		virtual int f519(int) { return lci=519; }
+	virtual int f520(int) { return lci=520; }		virtual int f521(int) { return lci=521; }		virtual int f522(int) { return lci=522; }		virtual int f523(int) { return lci=523; }
+	virtual int f524(int) { return lci=524; }		virtual int f525(int) { return lci=525; }		virtual int f526(int) { return lci=526; }		virtual int f527(int) { return lci=527; }
+	virtual int f528(int) { return lci=528; }		virtual int f529(int) { return lci=529; }		virtual int f530(int) { return lci=530; }		virtual int f531(int) { return lci=531; }
+	virtual int f532(int) { return lci=532; }		virtual int f533(int) { return lci=533; }		virtual int f534(int) { return lci=534; }		virtual int f535(int) { return lci=535; }
+	virtual int f536(int) { return lci=536; }		virtual int f537(int) { return lci=537; }		virtual int f538(int) { return lci=538; }		virtual int f539(int) { return lci=539; }
+	virtual int f540(int) { return lci=540; }		virtual int f541(int) { return lci=541; }		virtual int f542(int) { return lci=542; }		virtual int f543(int) { return lci=543; }
+	virtual int f544(int) { return lci=544; }		virtual int f545(int) { return lci=545; }		virtual int f546(int) { return lci=546; }		virtual int f547(int) { return lci=547; }
+	virtual int f548(int) { return lci=548; }		virtual int f549(int) { return lci=549; }		virtual int f550(int) { return lci=550; }		virtual int f551(int) { return lci=551; }
+	virtual int f552(int) { return lci=552; }		virtual int f553(int) { return lci=553; }		virtual int f554(int) { return lci=554; }		virtual int f555(int) { return lci=555; }
+	virtual int f556(int) { return lci=556; }		virtual int f557(int) { return lci=557; }		virtual int f558(int) { return lci=558; }		virtual int f559(int) { return lci=559; }
+	virtual int f560(int) { return lci=560; }		virtual int f561(int) { return lci=561; }		virtual int f562(int) { return lci=562; }		virtual int f563(int) { return lci=563; }
+	virtual int f564(int) { return lci=564; }		virtual int f565(int) { return lci=565; }		virtual int f566(int) { return lci=566; }		virtual int f567(int) { return lci=567; }
+	virtual int f568(int) { return lci=568; }		virtual int f569(int) { return lci=569; }		virtual int f570(int) { return lci=570; }		virtual int f571(int) { return lci=571; }
+	virtual int f572(int) { return lci=572; }		virtual int f573(int) { return lci=573; }		virtual int f574(int) { return lci=574; }		virtual int f575(int) { return lci=575; }
+	virtual int f576(int) { return lci=576; }		virtual int f577(int) { return lci=577; }		virtual int f578(int) { return lci=578; }		virtual int f579(int) { return lci=579; }
+	virtual int f580(int) { return lci=580; }		virtual int f581(int) { return lci=581; }		virtual int f582(int) { return lci=582; }		virtual int f583(int) { return lci=583; }
+	virtual int f584(int) { return lci=584; }		virtual int f585(int) { return lci=585; }		virtual int f586(int) { return lci=586; }		virtual int f587(int) { return lci=587; }
+	virtual int f588(int) { return lci=588; }		virtual int f589(int) { return lci=589; }		virtual int f590(int) { return lci=590; }		virtual int f591(int) { return lci=591; }
+	virtual int f592(int) { return lci=592; }		virtual int f593(int) { return lci=593; }		virtual int f594(int) { return lci=594; }		virtual int f595(int) { return lci=595; }
+	virtual int f596(int) { return lci=596; }		virtual int f597(int) { return lci=597; }		virtual int f598(int) { return lci=598; }		virtual int f599(int) { return lci=599; }
+	virtual int f600(int) { return lci=600; }		virtual int f601(int) { return lci=601; }		virtual int f602(int) { return lci=602; }		virtual int f603(int) { return lci=603; }
+	virtual int f604(int) { return lci=604; }		virtual int f605(int) { return lci=605; }		virtual int f606(int) { return lci=606; }		virtual int f607(int) { return lci=607; }
+	virtual int f608(int) { return lci=608; }		virtual int f609(int) { return lci=609; }		virtual int f610(int) { return lci=610; }		virtual int f611(int) { return lci=611; }
+	virtual int f612(int) { return lci=612; }		virtual int f613(int) { return lci=613; }		virtual int f614(int) { return lci=614; }		virtual int f615(int) { return lci=615; }
+	virtual int f616(int) { return lci=616; }		virtual int f617(int) { return lci=617; }		virtual int f618(int) { return lci=618; }		virtual int f619(int) { return lci=619; }
+	virtual int f620(int) { return lci=620; }		virtual int f621(int) { return lci=621; }		virtual int f622(int) { return lci=622; }		virtual int f623(int) { return lci=623; }
+	virtual int f624(int) { return lci=624; }		virtual int f625(int) { return lci=625; }		virtual int f626(int) { return lci=626; }		virtual int f627(int) { return lci=627; }
+	virtual int f628(int) { return lci=628; }		virtual int f629(int) { return lci=629; }		virtual int f630(int) { return lci=630; }		virtual int f631(int) { return lci=631; }
+	virtual int f632(int) { return lci=632; }		virtual int f633(int) { return lci=633; }		virtual int f634(int) { return lci=634; }		virtual int f635(int) { return lci=635; }
+	virtual int f636(int) { return lci=636; }		virtual int f637(int) { return lci=637; }		virtual int f638(int) { return lci=638; }		virtual int f639(int) { return lci=639; }
+	virtual int f640(int) { return lci=640; }		virtual int f641(int) { return lci=641; }		virtual int f642(int) { return lci=642; }		virtual int f643(int) { return lci=643; }
+	virtual int f644(int) { return lci=644; }		virtual int f645(int) { return lci=645; }		virtual int f646(int) { return lci=646; }		virtual int f647(int) { return lci=647; }
+	virtual int f648(int) { return lci=648; }		virtual int f649(int) { return lci=649; }		virtual int f650(int) { return lci=650; }		virtual int f651(int) { return lci=651; }
+	virtual int f652(int) { return lci=652; }		virtual int f653(int) { return lci=653; }		virtual int f654(int) { return lci=654; }		virtual int f655(int) { return lci=655; }
+	virtual int f656(int) { return lci=656; }		virtual int f657(int) { return lci=657; }		virtual int f658(int) { return lci=658; }		virtual int f659(int) { return lci=659; }
+	virtual int f660(int) { return lci=660; }		virtual int f661(int) { return lci=661; }		virtual int f662(int) { return lci=662; }		virtual int f663(int) { return lci=663; }
+	virtual int f664(int) { return lci=664; }		virtual int f665(int) { return lci=665; }		virtual int f666(int) { return lci=666; }		virtual int f667(int) { return lci=667; }
+	virtual int f668(int) { return lci=668; }		virtual int f669(int) { return lci=669; }		virtual int f670(int) { return lci=670; }		virtual int f671(int) { return lci=671; }
+	virtual int f672(int) { return lci=672; }		virtual int f673(int) { return lci=673; }		virtual int f674(int) { return lci=674; }		virtual int f675(int) { return lci=675; }
+	virtual int f676(int) { return lci=676; }		virtual int f677(int) { return lci=677; }		virtual int f678(int) { return lci=678; }		virtual int f679(int) { return lci=679; }
+	virtual int f680(int) { return lci=680; }		virtual int f681(int) { return lci=681; }		virtual int f682(int) { return lci=682; }		virtual int f683(int) { return lci=683; }
+	virtual int f684(int) { return lci=684; }		virtual int f685(int) { return lci=685; }		virtual int f686(int) { return lci=686; }		virtual int f687(int) { return lci=687; }
+	virtual int f688(int) { return lci=688; }		virtual int f689(int) { return lci=689; }		virtual int f690(int) { return lci=690; }		virtual int f691(int) { return lci=691; }
+	virtual int f692(int) { return lci=692; }		virtual int f693(int) { return lci=693; }		virtual int f694(int) { return lci=694; }		virtual int f695(int) { return lci=695; }
+	virtual int f696(int) { return lci=696; }		virtual int f697(int) { return lci=697; }		virtual int f698(int) { return lci=698; }		virtual int f699(int) { return lci=699; }
+	virtual int f700(int) { return lci=700; }		virtual int f701(int) { return lci=701; }		virtual int f702(int) { return lci=702; }		virtual int f703(int) { return lci=703; }
+	virtual int f704(int) { return lci=704; }		virtual int f705(int) { return lci=705; }		virtual int f706(int) { return lci=706; }		virtual int f707(int) { return lci=707; }
+	virtual int f708(int) { return lci=708; }		virtual int f709(int) { return lci=709; }		virtual int f710(int) { return lci=710; }		virtual int f711(int) { return lci=711; }
+	virtual int f712(int) { return lci=712; }		virtual int f713(int) { return lci=713; }		virtual int f714(int) { return lci=714; }		virtual int f715(int) { return lci=715; }
+	virtual int f716(int) { return lci=716; }		virtual int f717(int) { return lci=717; }		virtual int f718(int) { return lci=718; }		virtual int f719(int) { return lci=719; }
+	virtual int f720(int) { return lci=720; }		virtual int f721(int) { return lci=721; }		virtual int f722(int) { return lci=722; }		virtual int f723(int) { return lci=723; }
+	virtual int f724(int) { return lci=724; }		virtual int f725(int) { return lci=725; }		virtual int f726(int) { return lci=726; }		virtual int f727(int) { return lci=727; }
+	virtual int f728(int) { return lci=728; }		virtual int f729(int) { return lci=729; }		virtual int f730(int) { return lci=730; }		virtual int f731(int) { return lci=731; }
+	virtual int f732(int) { return lci=732; }		virtual int f733(int) { return lci=733; }		virtual int f734(int) { return lci=734; }		virtual int f735(int) { return lci=735; }
+	virtual int f736(int) { return lci=736; }		virtual int f737(int) { return lci=737; }		virtual int f738(int) { return lci=738; }		virtual int f739(int) { return lci=739; }
+	virtual int f740(int) { return lci=740; }		virtual int f741(int) { return lci=741; }		virtual int f742(int) { return lci=742; }		virtual int f743(int) { return lci=743; }
+	virtual int f744(int) { return lci=744; }		virtual int f745(int) { return lci=745; }		virtual int f746(int) { return lci=746; }		virtual int f747(int) { return lci=747; }
+	virtual int f748(int) { return lci=748; }		virtual int f749(int) { return lci=749; }		virtual int f750(int) { return lci=750; }		virtual int f751(int) { return lci=751; }
+	virtual int f752(int) { return lci=752; }		virtual int f753(int) { return lci=753; }		virtual int f754(int) { return lci=754; }		virtual int f755(int) { return lci=755; }
+	virtual int f756(int) { return lci=756; }		virtual int f757(int) { return lci=757; }		virtual int f758(int) { return lci=758; }		virtual int f759(int) { return lci=759; }
+	virtual int f760(int) { return lci=760; }		virtual int f761(int) { return lci=761; }		virtual int f762(int) { return lci=762; }		virtual int f763(int) { return lci=763; }
+	virtual int f764(int) { return lci=764; }		virtual int f765(int) { return lci=765; }		virtual int f766(int) { return lci=766; }		virtual int f767(int) { return lci=767; }
+	virtual int f768(int) { return lci=768; }		virtual int f769(int) { return lci=769; }		virtual int f770(int) { return lci=770; }		virtual int f771(int) { return lci=771; }
+	virtual int f772(int) { return lci=772; }		virtual int f773(int) { return lci=773; }		virtual int f774(int) { return lci=774; }		virtual int f775(int) { return lci=775; }
+	virtual int f776(int) { return lci=776; }		virtual int f777(int) { return lci=777; }		virtual int f778(int) { return lci=778; }		virtual int f779(int) { return lci=779; }
+	virtual int f780(int) { return lci=780; }		virtual int f781(int) { return lci=781; }		virtual int f782(int) { return lci=782; }		virtual int f783(int) { return lci=783; }
+	virtual int f784(int) { return lci=784; }		virtual int f785(int) { return lci=785; }		virtual int f786(int) { return lci=786; }		virtual int f787(int) { return lci=787; }
+	virtual int f788(int) { return lci=788; }		virtual int f789(int) { return lci=789; }		virtual int f790(int) { return lci=790; }		virtual int f791(int) { return lci=791; }
+	virtual int f792(int) { return lci=792; }		virtual int f793(int) { return lci=793; }		virtual int f794(int) { return lci=794; }		virtual int f795(int) { return lci=795; }
+	virtual int f796(int) { return lci=796; }		virtual int f797(int) { return lci=797; }		virtual int f798(int) { return lci=798; }		virtual int f799(int) { return lci=799; }
+	virtual int f800(int) { return lci=800; }		virtual int f801(int) { return lci=801; }		virtual int f802(int) { return lci=802; }		virtual int f803(int) { return lci=803; }
+	virtual int f804(int) { return lci=804; }		virtual int f805(int) { return lci=805; }		virtual int f806(int) { return lci=806; }		virtual int f807(int) { return lci=807; }
+	virtual int f808(int) { return lci=808; }		virtual int f809(int) { return lci=809; }		virtual int f810(int) { return lci=810; }		virtual int f811(int) { return lci=811; }
+	virtual int f812(int) { return lci=812; }		virtual int f813(int) { return lci=813; }		virtual int f814(int) { return lci=814; }		virtual int f815(int) { return lci=815; }
+	virtual int f816(int) { return lci=816; }		virtual int f817(int) { return lci=817; }		virtual int f818(int) { return lci=818; }		virtual int f819(int) { return lci=819; }
+	virtual int f820(int) { return lci=820; }		virtual int f821(int) { return lci=821; }		virtual int f822(int) { return lci=822; }		virtual int f823(int) { return lci=823; }
+	virtual int f824(int) { return lci=824; }		virtual int f825(int) { return lci=825; }		virtual int f826(int) { return lci=826; }		virtual int f827(int) { return lci=827; }
+	virtual int f828(int) { return lci=828; }		virtual int f829(int) { return lci=829; }		virtual int f830(int) { return lci=830; }		virtual int f831(int) { return lci=831; }
+	virtual int f832(int) { return lci=832; }		virtual int f833(int) { return lci=833; }		virtual int f834(int) { return lci=834; }		virtual int f835(int) { return lci=835; }
+	virtual int f836(int) { return lci=836; }		virtual int f837(int) { return lci=837; }		virtual int f838(int) { return lci=838; }		virtual int f839(int) { return lci=839; }
+	virtual int f840(int) { return lci=840; }		virtual int f841(int) { return lci=841; }		virtual int f842(int) { return lci=842; }		virtual int f843(int) { return lci=843; }
+	virtual int f844(int) { return lci=844; }		virtual int f845(int) { return lci=845; }		virtual int f846(int) { return lci=846; }		virtual int f847(int) { return lci=847; }
+	virtual int f848(int) { return lci=848; }		virtual int f849(int) { return lci=849; }		virtual int f850(int) { return lci=850; }		virtual int f851(int) { return lci=851; }
+	virtual int f852(int) { return lci=852; }		virtual int f853(int) { return lci=853; }		virtual int f854(int) { return lci=854; }		virtual int f855(int) { return lci=855; }
+	virtual int f856(int) { return lci=856; }		virtual int f857(int) { return lci=857; }		virtual int f858(int) { return lci=858; }		virtual int f859(int) { return lci=859; }
+	virtual int f860(int) { return lci=860; }		virtual int f861(int) { return lci=861; }		virtual int f862(int) { return lci=862; }		virtual int f863(int) { return lci=863; }
+	virtual int f864(int) { return lci=864; }		virtual int f865(int) { return lci=865; }		virtual int f866(int) { return lci=866; }		virtual int f867(int) { return lci=867; }
+	virtual int f868(int) { return lci=868; }		virtual int f869(int) { return lci=869; }		virtual int f870(int) { return lci=870; }		virtual int f871(int) { return lci=871; }
+	virtual int f872(int) { return lci=872; }		virtual int f873(int) { return lci=873; }		virtual int f874(int) { return lci=874; }		virtual int f875(int) { return lci=875; }
+	virtual int f876(int) { return lci=876; }		virtual int f877(int) { return lci=877; }		virtual int f878(int) { return lci=878; }		virtual int f879(int) { return lci=879; }
+	virtual int f880(int) { return lci=880; }		virtual int f881(int) { return lci=881; }		virtual int f882(int) { return lci=882; }		virtual int f883(int) { return lci=883; }
+	virtual int f884(int) { return lci=884; }		virtual int f885(int) { return lci=885; }		virtual int f886(int) { return lci=886; }		virtual int f887(int) { return lci=887; }
+	virtual int f888(int) { return lci=888; }		virtual int f889(int) { return lci=889; }		virtual int f890(int) { return lci=890; }		virtual int f891(int) { return lci=891; }
+	virtual int f892(int) { return lci=892; }		virtual int f893(int) { return lci=893; }		virtual int f894(int) { return lci=894; }		virtual int f895(int) { return lci=895; }
+	virtual int f896(int) { return lci=896; }		virtual int f897(int) { return lci=897; }		virtual int f898(int) { return lci=898; }		virtual int f899(int) { return lci=899; }
+	virtual int f900(int) { return lci=900; }		virtual int f901(int) { return lci=901; }		virtual int f902(int) { return lci=902; }		virtual int f903(int) { return lci=903; }
+	virtual int f904(int) { return lci=904; }		virtual int f905(int) { return lci=905; }		virtual int f906(int) { return lci=906; }		virtual int f907(int) { return lci=907; }
+	virtual int f908(int) { return lci=908; }		virtual int f909(int) { return lci=909; }		virtual int f910(int) { return lci=910; }		virtual int f911(int) { return lci=911; }
+	virtual int f912(int) { return lci=912; }		virtual int f913(int) { return lci=913; }		virtual int f914(int) { return lci=914; }		virtual int f915(int) { return lci=915; }
+	virtual int f916(int) { return lci=916; }		virtual int f917(int) { return lci=917; }		virtual int f918(int) { return lci=918; }		virtual int f919(int) { return lci=919; }
+	virtual int f920(int) { return lci=920; }		virtual int f921(int) { return lci=921; }		virtual int f922(int) { return lci=922; }		virtual int f923(int) { return lci=923; }
+	virtual int f924(int) { return lci=924; }		virtual int f925(int) { return lci=925; }		virtual int f926(int) { return lci=926; }		virtual int f927(int) { return lci=927; }
+	virtual int f928(int) { return lci=928; }		virtual int f929(int) { return lci=929; }		virtual int f930(int) { return lci=930; }		virtual int f931(int) { return lci=931; }
+	virtual int f932(int) { return lci=932; }		virtual int f933(int) { return lci=933; }		virtual int f934(int) { return lci=934; }		virtual int f935(int) { return lci=935; }
+	virtual int f936(int) { return lci=936; }		virtual int f937(int) { return lci=937; }		virtual int f938(int) { return lci=938; }		virtual int f939(int) { return lci=939; }
+	virtual int f940(int) { return lci=940; }		virtual int f941(int) { return lci=941; }		virtual int f942(int) { return lci=942; }		virtual int f943(int) { return lci=943; }
+	virtual int f944(int) { return lci=944; }		virtual int f945(int) { return lci=945; }		virtual int f946(int) { return lci=946; }		virtual int f947(int) { return lci=947; }
+	virtual int f948(int) { return lci=948; }		virtual int f949(int) { return lci=949; }		virtual int f950(int) { return lci=950; }		virtual int f951(int) { return lci=951; }
+	virtual int f952(int) { return lci=952; }		virtual int f953(int) { return lci=953; }		virtual int f954(int) { return lci=954; }		virtual int f955(int) { return lci=955; }
+	virtual int f956(int) { return lci=956; }		virtual int f957(int) { return lci=957; }		virtual int f958(int) { return lci=958; }		virtual int f959(int) { return lci=959; }
+	virtual int f960(int) { return lci=960; }		virtual int f961(int) { return lci=961; }		virtual int f962(int) { return lci=962; }		virtual int f963(int) { return lci=963; }
+	virtual int f964(int) { return lci=964; }		virtual int f965(int) { return lci=965; }		virtual int f966(int) { return lci=966; }		virtual int f967(int) { return lci=967; }
+	virtual int f968(int) { return lci=968; }		virtual int f969(int) { return lci=969; }		virtual int f970(int) { return lci=970; }		virtual int f971(int) { return lci=971; }
+	virtual int f972(int) { return lci=972; }		virtual int f973(int) { return lci=973; }		virtual int f974(int) { return lci=974; }		virtual int f975(int) { return lci=975; }
+	virtual int f976(int) { return lci=976; }		virtual int f977(int) { return lci=977; }		virtual int f978(int) { return lci=978; }		virtual int f979(int) { return lci=979; }
+	virtual int f980(int) { return lci=980; }		virtual int f981(int) { return lci=981; }		virtual int f982(int) { return lci=982; }		virtual int f983(int) { return lci=983; }
+	virtual int f984(int) { return lci=984; }		virtual int f985(int) { return lci=985; }		virtual int f986(int) { return lci=986; }		virtual int f987(int) { return lci=987; }
+	virtual int f988(int) { return lci=988; }		virtual int f989(int) { return lci=989; }		virtual int f990(int) { return lci=990; }		virtual int f991(int) { return lci=991; }
+	virtual int f992(int) { return lci=992; }		virtual int f993(int) { return lci=993; }		virtual int f994(int) { return lci=994; }		virtual int f995(int) { return lci=995; }
+	virtual int f996(int) { return lci=996; }		virtual int f997(int) { return lci=997; }		virtual int f998(int) { return lci=998; }		virtual int f999(int) { return lci=999; }
+	virtual int f1000(int) { return lci=1000; }	virtual int f1001(int) { return lci=1001; }	virtual int f1002(int) { return lci=1002; }	virtual int f1003(int) { return lci=1003; }
+	virtual int f1004(int) { return lci=1004; }	virtual int f1005(int) { return lci=1005; }	virtual int f1006(int) { return lci=1006; }	virtual int f1007(int) { return lci=1007; }
+	virtual int f1008(int) { return lci=1008; }	virtual int f1009(int) { return lci=1009; }	virtual int f1010(int) { return lci=1010; }	virtual int f1011(int) { return lci=1011; }
+	virtual int f1012(int) { return lci=1012; }	virtual int f1013(int) { return lci=1013; }	virtual int f1014(int) { return lci=1014; }	virtual int f1015(int) { return lci=1015; }
+	virtual int f1016(int) { return lci=1016; }	virtual int f1017(int) { return lci=1017; }	virtual int f1018(int) { return lci=1018; }	virtual int f1019(int) { return lci=1019; }
+	virtual int f1020(int) { return lci=1020; }	virtual int f1021(int) { return lci=1021; }	virtual int f1022(int) { return lci=1022; }	virtual int f1023(int) { return lci=1023; }
+	virtual ~func_index() {}
+};
+
+#ifdef _MSC_VER
+template <int s>
+int virtual_function_index(unsigned char *func)
+{
+	if (*func == 0xE9)
+	{
+		return virtual_function_index<0>(func + 5 + *(unsigned int *)(func + 1));
+	}
+	else
+	{
+#ifdef _WIN64
+		func++; // Add one to the pointer to skip the REX prefix used to access 64-bit registers.
+#endif
+		switch (*(unsigned int *)func)
+		{ // mov ecx, this; jump [eax + v/Ib/Iw]
+		case 0x20ff018b: return 0;
+#ifdef _WIN32
+		case 0x0424448b:
+			if (func[7] == 0x20)
+				return 0;
+			return *(unsigned char *)(func + 8) / sizeof(void*);
+#endif
+		case 0x60ff018b: return *(unsigned char *)(func + sizeof(int)) / sizeof(void*);
+		case 0xA0ff018b: return *(unsigned long *)(func + sizeof(int)) / sizeof(void*);
+		default: return -1;
+		}
+	}
+}
+
+#endif
+
+template <typename T>
+std::pair<int, int> virtual_index(T t)
+{
+#if defined(__GNUG__)
+	union {
+		T t;
+		struct
+		{
+			unsigned long value;
+			unsigned long baseoffs;
+		} u;
+	} conv = {};
+	conv.t = t;
+#if defined(SOME_ARM)
+	// ARM ABI says the bit is in bsaeoffs instead, and that the value is shiffted left 1.
+	// This because valid ARM pointers may have the LSB set, so the "is virtual" bit had to be moved.
+	if (conv.u.baseoffs & 1)
+		return std::pair<int, int>(conv.u.baseoffs / (sizeof(void*) * 2), conv.u.value / sizeof(void *));
+#else
+	// simple Itanium ABI implementation, used by everything but Microsoft and embedded EDG-based compilers
+	if (conv.u.value & 1)
+		return std::pair<int, int>(conv.u.baseoffs / sizeof(void*), conv.u.value / sizeof(void *));
+#endif
+
+#elif defined(_MSC_VER)
+	union {
+		T t;
+		struct
+		{
+			unsigned char *value;
+			unsigned long baseoffs;
+		} u;
+	} conv = {};
+	conv.t = t;
+
+	int value = virtual_function_index<0>((unsigned char *)conv.u.value);
+	if (value != -1)
+		return std::pair<int, int>((int)(conv.u.baseoffs/sizeof(void*)), value);
+#elif defined(__EDG__)
+	union {
+		T t;
+		struct {
+			short delta;
+			short vindex;
+			long vtordisp;
+		} u;
+	} conv;
+	conv.t = t;
+
+	if (conv.u.vindex != 0)
+		return std::pair<int, int>((conv.u.delta + conv.u.vtordisp)/sizeof(void*), conv.u.vindex * 2 + 1);
+
+#elif defined (__SUNPRO_CC)
+    union {
+        T t;
+        struct
+        {
+            unsigned char *value;
+            unsigned long baseoffs;
+        } u;
+    } conv;
+    conv.t = t;
+   //is virtual call
+    unsigned char prolog[]= {0x55, 0x8b, 0xec, 0x83, 0xec,
+            0x04, 0x89, 0x5d, 0xfc,
+            0x8b, 0x45};//, 0x08, 0x8b, 0x40, 0x00,
+            //0x8b, 0x40}; //movl <index>
+	unsigned char* opcodes = conv.u.value;
+    if (0 == memcmp(opcodes, prolog, sizeof(prolog)))
+    {
+        if (opcodes[11] == 0x08 || opcodes[11] == 0x0c)
+        {
+            unsigned char epilogue[] = { 0x8b, 0x5d, 0xfc, 0xc9, 0xff, 0xe0 };
+
+            int i;
+            for (i = 0; i < 4; i++)
+            {
+                if (0 == memcmp(&opcodes[18 + i], epilogue, sizeof(epilogue)))
+                {
+                    break;
+                }
+            }
+            //is virtual call prologue
+            int index = 0;// = opcodes[17] / 4; //offset of function index
+
+            switch (i)
+            {
+                case 3:
+                    index += static_cast<unsigned int>(opcodes[17 + 3]) << (8 * 3);
+                case 2:
+                    index += static_cast<unsigned int>(opcodes[17 + 2]) << (8 * 2);
+                case 1:
+                    index += static_cast<unsigned int>(opcodes[17 + 1]) << (8 * 1);
+                case 0:
+                default:
+                    index += static_cast<unsigned int>(opcodes[17]);
+            }
+            index = index / 4;
+
+            return std::pair<int, int>(conv.u.baseoffs / 4, index);
+        }
+    }
+#else
+#error No virtual indexing found for this compiler! Please contact the maintainers of HippoMocks
+#endif
+
+	return std::pair<int, int>(-1, 0);
+}
+
+template <typename T, typename U>
+T getNonvirtualMemberFunctionAddress(U u)
+{
+#ifdef __EDG__
+	// Edison Design Group C++ frontend (Comeau, Portland Group, Greenhills, etc)
+	union {
+	  struct {
+			short delta;
+			short vindex;
+			T t;
+	  } mfp_structure;
+	  U u;
+	} conv;
+#else
+	// Visual Studio, GCC, others
+	union {
+	  struct {
+			T t;
+		} mfp_structure;
+		U u;
+	} conv;
+#endif
+	conv.u = u;
+	return conv.mfp_structure.t;
+}
+
+class TypeDestructable : public MockAllocated {
+public:
+	virtual ~TypeDestructable() {}
+};
+
+template <typename A>
+class MemberWrap : public TypeDestructable {
+private:
+	A *member;
+public:
+	MemberWrap(A *mem)
+		: member(mem)
+	{
+		new (member) A();
+	}
+	~MemberWrap()
+	{
+		member->~A();
+	}
+};
+
+class VirtualDestructable : public MockAllocated
+{
+public:
+	virtual ~VirtualDestructable() {}
+	// The bytes of the object, for MockRepository::memoryUsage().
+	virtual size_t objectSize() const = 0;
+};
+
+template <class T>
+class mock;
+
+// The idle mocks of type T; see DEFAULT_POOLMOCKS.
+template <class T>
+class MockPool
+{
+public:
+	static mock<T> *borrow(MockRepository *repository, bool stub)
+	{
+		std::vector<mock<T> *> &idle = instance().idle;
+		mock<T> *m;
+		if (idle.empty())
+			m = new mock<T>(repository, stub);
+		else
+		{
+			m = idle.back();
+			idle.pop_back();
+			m->prepare(repository, stub);
+		}
+		m->pooled = true;
+		return m;
+	}
+	static void release(mock<T> *m)
+	{
+		std::vector<mock<T> *> &idle = instance().idle;
+		if (idle.size() < HM_MOCK_POOL_SIZE && m->poolable())
+			idle.push_back(m);
+		else
+			delete m;
+	}
+private:
+	~MockPool()
+	{
+		for (typename std::vector<mock<T> *>::iterator i = idle.begin(); i != idle.end(); ++i)
+			delete *i;
+	}
+	static MockPool &instance()
+	{
+#if __cplusplus > 199711L
+		static thread_local MockPool pool;
+#else
+		static MockPool pool;
+#endif
+		return pool;
+	}
+	std::vector<mock<T> *> idle;
+};
+
+// A map kept as a sorted vector. A mock only has a few function tables and registered functions,
+// which are faster to find in one contiguous block than in the nodes of a std::map.
+template <typename K, typename V>
+class flat_map
+{
+public:
+	typedef std::pair<K, V> value_type;
+	typedef typename std::vector<value_type, MockStlAllocator<value_type> >::iterator iterator;
+	iterator begin() { return items.begin(); }
+	iterator end() { return items.end(); }
+	void clear() { items.clear(); }
+	void swap(flat_map &other) { items.swap(other.items); }
+	iterator find(const K &key)
+	{
+		iterator i = lowerBound(key);
+		return i != items.end() && i->first == key ? i : items.end();
+	}
+	V &operator[](const K &key)
+	{
+		iterator i = lowerBound(key);
+		if (i == items.end() || !(i->first == key))
+			i = items.insert(i, value_type(key, V()));
+		return i->second;
+	}
+private:
+	static bool keyLess(const value_type &item, const K &key) { return item.first < key; }
+	iterator lowerBound(const K &key) { return std::lower_bound(items.begin(), items.end(), key, keyLess); }
+	std::vector<value_type, MockStlAllocator<value_type> > items;
+};
+
+// mock types
+template <class T>
+class mock : public base_mock
+{
+	typedef void (*funcptr)();
+	friend class MockRepository;
+	unsigned char remaining[sizeof(T)];
+	void NotImplemented() {
+		RAISEEXCEPTION(:: HM_NS NotImplementedException(MockRepoInstanceHolder<0>::instance));
+	}
+#ifdef _HIPPOMOCKS__ENABLE_STUB_SUPPORT
+#if defined(__x86_64__) && !defined(_WIN32)
+	// Returned in rax and xmm0, so a stubbed function returns 0, false, NULL or 0.0.
+	struct StubResult { unsigned long long integer; double floating; };
+	StubResult Stubbed() {
+		StubResult result = { 0, 0.0 };
+		return result;
+	}
+#else
+	// Clears the integer return registers, so a stubbed function returns 0, false or NULL.
+	unsigned long long Stubbed() {
+		return 0;
+	}
+#endif
+#endif
+protected:
+	flat_map<int, void (**)()> funcTables;
+	void (*notimplementedfuncs[VIRT_FUNC_LIMIT])();
+public:
+	bool isZombie;
+	typedef std::vector<TypeDestructable *, MockStlAllocator<TypeDestructable *> > MemberList;
+	MemberList members;
+	MockRepository *repo;
+	flat_map<std::pair<int, int>, int> funcMap;
+#if __cplusplus > 199711L
+	// Where each function registered with ReplayCall() reads its results from.
+	struct ReplaySlot {
+		CallReplay *replay;
+		const char *funcName;
+	};
+	flat_map<std::pair<int, int>, ReplaySlot> replays;
+#endif
+	bool stubbed;
+	// Whether the mock lives in a MockStorage, which also holds its function table.
+	bool placed;
+	// Whether the mock goes back to its MockPool when released, rather than being deleted.
+	bool pooled;
+	MockCalls calls;
+	mock(MockRepository *repository, bool stub = false, funcptr *table = 0)
+		: isZombie(false)
+		, repo(repository)
+		, stubbed(stub)
+		, placed(table != 0)
+		, pooled(false)
+	{
+		fillNotImplemented();
+		funcptr *funcTable = placed ? table : static_cast<funcptr *>(MockAllocated::allocate(sizeof(funcptr) * (VIRT_FUNC_LIMIT+4)));
+		memcpy(funcTable, notimplementedfuncs, sizeof(funcptr) * VIRT_FUNC_LIMIT);
+		((void **)funcTable)[VIRT_FUNC_LIMIT] = this;
+		((void **)funcTable)[VIRT_FUNC_LIMIT+1] = *(void **)this;
+		((void **)funcTable)[VIRT_FUNC_LIMIT+2] = 0;
+		((void **)funcTable)[VIRT_FUNC_LIMIT+3] = &calls;
+		funcTables[0] = funcTable;
+		installTables();
+	}
+	~mock()
+	{
+		clear();
+		if (!placed)
+			MockAllocated::deallocate(funcTables[0]);
+	}
+	void mock_reset()
+	{
+		clear();
+		prepare(repo, stubbed);
+	}
+	void mock_release()
+	{
+		clear();
+		if (placed)
+			this->~mock();
+		else if (pooled)
+			MockPool<T>::release(this);
+		else
+			delete this;
+	}
+	void mock_memoryUsage(MemoryUsage &usage)
+	{
+		usage.notImplementedTables += sizeof(notimplementedfuncs);
+		for (flat_map<int, void (**)()>::iterator i = funcTables.begin(); i != funcTables.end(); ++i)
+		{
+			usage.functionTables += sizeof(funcptr) * (i->first == 0 ? VIRT_FUNC_LIMIT+4 : VIRT_FUNC_LIMIT+3);
+			VirtualDestructable **fakes = ((VirtualDestructable ***)i->second)[VIRT_FUNC_LIMIT+2];
+			if (fakes)
+			{
+				usage.functionTables += sizeof(VirtualDestructable *) * VIRT_FUNC_LIMIT;
+				for (int j = 0; j < VIRT_FUNC_LIMIT; j++)
+					usage.functors += fakes[j] ? fakes[j]->objectSize() : 0;
+			}
+		}
+	}
+	std::string mock_typeName()
+	{
+		return TypeName<T>::get();
+	}
+	// Undoes everything registered on the mock, except that its own function table is kept.
+	void clear()
+	{
+		for (typename MemberList::iterator i = members.begin(); i != members.end(); ++i)
+		{
+			delete *i;
+		}
+		members.clear();
+		funcptr *funcTable = funcTables[0];
+		for (flat_map<int, void (**)()>::iterator i = funcTables.begin(); i != funcTables.end(); ++i)
+		{
+			VirtualDestructable **&fakes = ((VirtualDestructable ***)i->second)[VIRT_FUNC_LIMIT+2];
+			if (fakes)
+			{
+				for (int j = 0; j < VIRT_FUNC_LIMIT; j++)
+					delete fakes[j];
+				MockAllocated::deallocate(fakes);
+				fakes = 0;
+			}
+			if (i->second != funcTable)
+				MockAllocated::deallocate(i->second);
+		}
+		funcTables.clear();
+		funcTables[0] = funcTable;
+		for (flat_map<std::pair<int, int>, int>::iterator i = funcMap.begin(); i != funcMap.end(); ++i)
+		{
+			if (i->first.first == 0 && i->first.second < VIRT_FUNC_LIMIT)
+				funcTable[i->first.second] = notimplementedfuncs[i->first.second];
+		}
+		funcMap.clear();
+#if __cplusplus > 199711L
+		replays.clear();
+#endif
+		calls = MockCalls();
+	}
+#ifdef HM_MOCK_ALLOCATOR
+	// Whether the cleared mock can be kept in its MockPool, which needs the mock and its function
+	// table to come from the heap. The rest of its storage may have grown while a MockAllocator was
+	// in use, so that is given back and starts over on the heap.
+	bool poolable()
+	{
+		funcptr *funcTable = funcTables[0];
+		if (MockAllocated::allocatorOf(this) || MockAllocated::allocatorOf(funcTable))
+			return false;
+		MockAllocator *allocator = MockAllocatorHolder<0>::current;
+		MockAllocatorHolder<0>::current = 0;
+		flat_map<int, void (**)()>().swap(funcTables);
+		funcTables[0] = funcTable;
+		flat_map<std::pair<int, int>, int>().swap(funcMap);
+#if __cplusplus > 199711L
+		flat_map<std::pair<int, int>, ReplaySlot>().swap(replays);
+#endif
+		MemberList().swap(members);
+		MockAllocatorHolder<0>::current = allocator;
+		return true;
+	}
+#else
+	bool poolable() { return true; }
+#endif
+	// Hands a cleared mock to repository as if it had just been constructed.
+	void prepare(MockRepository *repository, bool stub)
+	{
+		repo = repository;
+		isZombie = false;
+		if (stub != stubbed)
+		{
+			stubbed = stub;
+			fillNotImplemented();
+			memcpy(funcTables[0], notimplementedfuncs, sizeof(funcptr) * VIRT_FUNC_LIMIT);
+		}
+		installTables();
+	}
+	void fillNotImplemented()
+	{
+		funcptr unregistered = getNonvirtualMemberFunctionAddress<void (*)()>(&mock<T>::NotImplemented);
+#ifdef _HIPPOMOCKS__ENABLE_STUB_SUPPORT
+		if (stubbed)
+			unregistered = getNonvirtualMemberFunctionAddress<void (*)()>(&mock<T>::Stubbed);
+#endif
+		for (int i = 0; i < VIRT_FUNC_LIMIT; i++)
+		{
+			notimplementedfuncs[i] = unregistered;
+		}
+	}
+	void installTables()
+	{
+		*(void **)this = funcTables[0];
+		for (unsigned int i = 1; i < sizeof(remaining) / sizeof(funcptr); i++)
+		{
+			((void **)this)[i] = (void *)notimplementedfuncs;
+		}
+	}
+	mock<T> *getRealThis()
+	{
+		void ***base = (void ***)this;
+		return (mock<T> *)((*base)[VIRT_FUNC_LIMIT]);
+	}
+	std::pair<int, int> translateX(int x)
+	{
+		for (flat_map<std::pair<int, int>, int>::iterator i = funcMap.begin(); i != funcMap.end(); ++i)
+		{
+			if (i->second == x+1) return i->first;
+		}
+		return std::pair<int, int>(-1, 0);
+	}
+	template <int X>
+	void mockedDestructor(int);
+};
+
+// Room for a mock of T and its function table, for MockRepository::MockAt().
+template <typename T>
+union MockStorage
+{
+	unsigned char bytes[sizeof(mock<T>) + sizeof(void (*)()) * (VIRT_FUNC_LIMIT+4)];
+	void *pointer;
+	long double number;
+};
+
+// Do() and Match() function wrapping. A Call keeps its functors in a FunctorHolder, which stores
+// a functor in place when it fits the buffer (function pointers, functor objects and lambdas with
+// a few captures) and allocates it otherwise. It is invoked through a single function pointer that
+// unpacks only as many tuple fields as the function takes.
+#ifndef HM_FUNCTOR_BUFFER_SIZE
+#define HM_FUNCTOR_BUFFER_SIZE (4 * sizeof(void *))
+#endif
+
+union FunctorBuffer
+{
+	char data[HM_FUNCTOR_BUFFER_SIZE];
+	void *pointer;
+	void (*function)();
+	long long integer;
+	long double floating;
+	// The size of a functor that did not fit, and was allocated instead.
+	size_t size;
+};
+
+template <typename T>
+struct functor_fits
+{
+#if __cplusplus > 199711L
+	static const bool value = sizeof(T) <= sizeof(FunctorBuffer) && std::alignment_of<T>::value <= std::alignment_of<FunctorBuffer>::value;
+#else
+	static const bool value = sizeof(T) <= sizeof(FunctorBuffer);
+#endif
+};
+
+template <bool fits>
+struct functor_placement
+{
+	template <typename T>
+	static void *place(FunctorBuffer &buffer, const T &function) { return new (buffer.data) T(function); }
+	template <typename T>
+	static void destroy(void *function) { static_cast<T *>(function)->~T(); }
+};
+
+template <>
+struct functor_placement<false>
+{
+	template <typename T>
+	static void *place(FunctorBuffer &buffer, const T &function)
+	{
+		buffer.size = sizeof(T);
+		return new (MockAllocated::allocate(sizeof(T))) T(function);
+	}
+	template <typename T>
+	static void destroy(void *function) { static_cast<T *>(function)->~T(); MockAllocated::deallocate(function); }
+};
+
+class FunctorHolder
+{
+public:
+	FunctorHolder() : target(0), invoker(0), destroyer(0) {}
+	~FunctorHolder() { clear(); }
+	bool isSet() const { return target != 0; }
+	// Invoker is a DoWrapper, whose static invoke() calls a T with the tuple's arguments.
+	template <typename Invoker, typename T>
+	void set(const T &function)
+	{
+		clear();
+		target = functor_placement<functor_fits<T>::value>::place(buffer, function);
+		invoker = reinterpret_cast<void (*)()>(&Invoker::invoke);
+		destroyer = &functor_placement<functor_fits<T>::value>::template destroy<T>;
+	}
+	template <typename Y>
+	Y invoke(const base_tuple &tupl) const
+	{
+		return reinterpret_cast<Y (*)(void *, const base_tuple &)>(invoker)(target, tupl);
+	}
+	// The bytes allocated for a functor that did not fit in the buffer.
+	size_t allocatedSize() const
+	{
+		return target && target != buffer.data ? buffer.size : 0;
+	}
+private:
+	FunctorHolder(const FunctorHolder &);
+	FunctorHolder &operator=(const FunctorHolder &);
+	void clear()
+	{
+		if (target)
+			destroyer(target);
+		target = 0;
+	}
+	void *target;
+	void (*invoker)();
+	void (*destroyer)(void *);
+	FunctorBuffer buffer;
+};
+
+template <typename T, typename Y,
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I, typename J, typename K, typename L,
+		  typename M, typename N, typename O, typename P>
+struct DoWrapper {
+	static Y invoke(void *function, const base_tuple &tupl)
+	{
+		ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &rTupl = const_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &>(reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &>(tupl));
+		return (*static_cast<T *>(function))(rTupl.a, rTupl.b, rTupl.c, rTupl.d, rTupl.e, rTupl.f, rTupl.g, rTupl.h, rTupl.i, rTupl.j, rTupl.k, rTupl.l, rTupl.m, rTupl.n, rTupl.o, rTupl.p);
+	}
+};
+template <typename T, typename Y, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename M, typename N, typename O>
+struct DoWrapper<T,Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> {
+	static Y invoke(void *function, const base_tuple &tupl)
+	{
+		ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &rTupl = const_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &>(reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &>(tupl));
+		return (*static_cast<T *>(function))(rTupl.a, rTupl.b, rTupl.c, rTupl.d, rTupl.e, rTupl.f, rTupl.g, rTupl.h, rTupl.i, rTupl.j, rTupl.k, rTupl.l, rTupl.m, rTupl.n, rTupl.o);
+	}
+};
+template <typename T, typename Y, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename M, typename N>
+struct DoWrapper<T,Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> {
+	static Y invoke(void *function, const base_tuple &tupl)
+	{
+		ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &rTupl = const_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &>(reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &>(tupl));
+		return (*static_cast<T *>(function))(rTupl.a, rTupl.b, rTupl.c, rTupl.d, rTupl.e, rTupl.f, rTupl.g, rTupl.h, rTupl.i, rTupl.j, rTupl.k, rTupl.l, rTupl.m, rTupl.n);
+	}
+};
+template <typename T, typename Y, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename M>
+struct DoWrapper<T,Y,A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> {
+	static Y invoke(void *function, const base_tuple &tupl)
+	{
+		ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &rTupl = const_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &>(reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &>(tupl));
+		return (*static_cast<T *>(function))(rTupl.a, rTupl.b, rTupl.c, rTupl.d, rTupl.e, rTupl.f, rTupl.g, rTupl.h, rTupl.i, rTupl.j, rTupl.k, rTupl.l, rTupl.m);
+	}
+};
+template <typename T, typename Y, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L>
+struct DoWrapper<T,Y,A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> {
+	static Y invoke(void *function, const base_tuple &tupl)
+	{
+		ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &rTupl = const_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &>(reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &>(tupl));
+		return (*static_cast<T *>(function))(rTupl.a, rTupl.b, rTupl.c, rTupl.d, rTupl.e, rTupl.f, rTupl.g, rTupl.h, rTupl.i, rTupl.j, rTupl.k, rTupl.l);
+	}
+};
+template <typename T, typename Y, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K>
+struct DoWrapper<T,Y,A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> {
+	static Y invoke(void *function, const base_tuple &tupl)
+	{
+		ref_tuple<A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &rTupl = const_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &>(reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+		return (*static_cast<T *>(function))(rTupl.a, rTupl.b, rTupl.c, rTupl.d, rTupl.e, rTupl.f, rTupl.g, rTupl.h, rTupl.i, rTupl.j, rTupl.k);
+	}
+};
+template <typename T, typename Y, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J>
+struct DoWrapper<T,Y,A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> {
+	static Y invoke(void *function, const base_tuple &tupl)
+	{
+		ref_tuple<A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &rTupl = const_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &>(reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+		return (*static_cast<T *>(function))(rTupl.a, rTupl.b, rTupl.c, rTupl.d, rTupl.e, rTupl.f, rTupl.g, rTupl.h, rTupl.i, rTupl.j);
+	}
+};
+template <typename T, typename Y, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I>
+struct DoWrapper<T,Y,A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> {
+	static Y invoke(void *function, const base_tuple &tupl)
+	{
+		ref_tuple<A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &rTupl = const_cast<ref_tuple<A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+		return (*static_cast<T *>(function))(rTupl.a, rTupl.b, rTupl.c, rTupl.d, rTupl.e, rTupl.f, rTupl.g, rTupl.h, rTupl.i);
+	}
+};
+template <typename T, typename Y, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H>
+struct DoWrapper<T,Y,A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> {
+	static Y invoke(void *function, const base_tuple &tupl)
+	{
+		ref_tuple<A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &rTupl = const_cast<ref_tuple<A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+		return (*static_cast<T *>(function))(rTupl.a, rTupl.b, rTupl.c, rTupl.d, rTupl.e, rTupl.f, rTupl.g, rTupl.h);
+	}
+};
+template <typename T, typename Y, typename A, typename B, typename C, typename D, typename E, typename F, typename G>
+struct DoWrapper<T,Y,A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> {
+	static Y invoke(void *function, const base_tuple &tupl)
+	{
+		ref_tuple<A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &rTupl = const_cast<ref_tuple<A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+		return (*static_cast<T *>(function))(rTupl.a, rTupl.b, rTupl.c, rTupl.d, rTupl.e, rTupl.f, rTupl.g);
+	}
+};
+template <typename T, typename Y, typename A, typename B, typename C, typename D, typename E, typename F>
+struct DoWrapper<T,Y,A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> {
+	static Y invoke(void *function, const base_tuple &tupl)
+	{
+		ref_tuple<A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &rTupl = const_cast<ref_tuple<A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(reinterpret_cast<const ref_tuple<A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+		return (*static_cast<T *>(function))(rTupl.a, rTupl.b, rTupl.c, rTupl.d, rTupl.e, rTupl.f);
+	}
+};
+template <typename T, typename Y, typename A, typename B, typename C, typename D, typename E>
+struct DoWrapper<T,Y,A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> {
+	static Y invoke(void *function, const base_tuple &tupl)
+	{
+		ref_tuple<A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &rTupl = const_cast<ref_tuple<A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(reinterpret_cast<const ref_tuple<A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+		return (*static_cast<T *>(function))(rTupl.a, rTupl.b, rTupl.c, rTupl.d, rTupl.e);
+	}
+};
+template <typename T, typename Y, typename A, typename B, typename C, typename D>
+struct DoWrapper<T,Y,A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> {
+	static Y invoke(void *function, const base_tuple &tupl)
+	{
+		ref_tuple<A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &rTupl = const_cast<ref_tuple<A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(reinterpret_cast<const ref_tuple<A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+		return (*static_cast<T *>(function))(rTupl.a, rTupl.b, rTupl.c, rTupl.d);
+	}
+};
+template <typename T, typename Y, typename A, typename B, typename C>
+struct DoWrapper<T,Y,A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> {
+	static Y invoke(void *function, const base_tuple &tupl)
+	{
+		ref_tuple<A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &rTupl = const_cast<ref_tuple<A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(reinterpret_cast<const ref_tuple<A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+		return (*static_cast<T *>(function))(rTupl.a, rTupl.b, rTupl.c);
+	}
+};
+template <typename T, typename Y, typename A, typename B>
+struct DoWrapper<T,Y,A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> {
+	static Y invoke(void *function, const base_tuple &tupl)
+	{
+		ref_tuple<A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &rTupl = const_cast<ref_tuple<A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(reinterpret_cast<const ref_tuple<A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+		return (*static_cast<T *>(function))(rTupl.a, rTupl.b);
+	}
+};
+template <typename T, typename Y, typename A>
+struct DoWrapper<T,Y,A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> {
+	static Y invoke(void *function, const base_tuple &tupl)
+	{
+		ref_tuple<A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &rTupl = const_cast<ref_tuple<A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(reinterpret_cast<const ref_tuple<A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+		return (*static_cast<T *>(function))(rTupl.a);
+	}
+};
+template <typename T, typename Y>
+struct DoWrapper<T,Y,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> {
+	static Y invoke(void *function, const base_tuple &)
+	{
+		return (*static_cast<T *>(function))();
+	}
+};
+
+// Capture(container) appends the arguments of every call to container with push_back. A single
+// argument is converted to the container's value_type, or its address taken if that is a pointer;
+// several arguments are passed to the value_type's constructor. The value_type decides whether
+// arguments are copied or referred to.
+template <typename T>
+struct captured
+{
+	template <typename A>
+	static T from(A &a) { return T(a); }
+};
+
+template <typename T>
+struct captured<T *>
+{
+	static T *from(T *a) { return a; }
+	static T *from(T &a) { return &a; }
+};
+
+template <typename T>
+class Capturer
+{
+public:
+	Capturer(T &target) : container(&target) {}
+	template <typename A>
+	void operator()(A &a) { container->push_back(captured<typename T::value_type>::from(a)); }
+	template <typename A, typename B>
+	void operator()(A &a, B &b) { container->push_back(typename T::value_type(a,b)); }
+	template <typename A, typename B, typename C>
+	void operator()(A &a, B &b, C &c) { container->push_back(typename T::value_type(a,b,c)); }
+	template <typename A, typename B, typename C, typename D>
+	void operator()(A &a, B &b, C &c, D &d) { container->push_back(typename T::value_type(a,b,c,d)); }
+	template <typename A, typename B, typename C, typename D, typename E>
+	void operator()(A &a, B &b, C &c, D &d, E &e) { container->push_back(typename T::value_type(a,b,c,d,e)); }
+	template <typename A, typename B, typename C, typename D, typename E, typename F>
+	void operator()(A &a, B &b, C &c, D &d, E &e, F &f) { container->push_back(typename T::value_type(a,b,c,d,e,f)); }
+	template <typename A, typename B, typename C, typename D, typename E, typename F, typename G>
+	void operator()(A &a, B &b, C &c, D &d, E &e, F &f, G &g) { container->push_back(typename T::value_type(a,b,c,d,e,f,g)); }
+	template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H>
+	void operator()(A &a, B &b, C &c, D &d, E &e, F &f, G &g, H &h) { container->push_back(typename T::value_type(a,b,c,d,e,f,g,h)); }
+	template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I>
+	void operator()(A &a, B &b, C &c, D &d, E &e, F &f, G &g, H &h, I &i) { container->push_back(typename T::value_type(a,b,c,d,e,f,g,h,i)); }
+	template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J>
+	void operator()(A &a, B &b, C &c, D &d, E &e, F &f, G &g, H &h, I &i, J &j) { container->push_back(typename T::value_type(a,b,c,d,e,f,g,h,i,j)); }
+	template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K>
+	void operator()(A &a, B &b, C &c, D &d, E &e, F &f, G &g, H &h, I &i, J &j, K &k) { container->push_back(typename T::value_type(a,b,c,d,e,f,g,h,i,j,k)); }
+	template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L>
+	void operator()(A &a, B &b, C &c, D &d, E &e, F &f, G &g, H &h, I &i, J &j, K &k, L &l) { container->push_back(typename T::value_type(a,b,c,d,e,f,g,h,i,j,k,l)); }
+	template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename M>
+	void operator()(A &a, B &b, C &c, D &d, E &e, F &f, G &g, H &h, I &i, J &j, K &k, L &l, M &m) { container->push_back(typename T::value_type(a,b,c,d,e,f,g,h,i,j,k,l,m)); }
+	template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename M, typename N>
+	void operator()(A &a, B &b, C &c, D &d, E &e, F &f, G &g, H &h, I &i, J &j, K &k, L &l, M &m, N &n) { container->push_back(typename T::value_type(a,b,c,d,e,f,g,h,i,j,k,l,m,n)); }
+	template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename M, typename N, typename O>
+	void operator()(A &a, B &b, C &c, D &d, E &e, F &f, G &g, H &h, I &i, J &j, K &k, L &l, M &m, N &n, O &o) { container->push_back(typename T::value_type(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o)); }
+	template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename M, typename N, typename O, typename P>
+	void operator()(A &a, B &b, C &c, D &d, E &e, F &f, G &g, H &h, I &i, J &j, K &k, L &l, M &m, N &n, O &o, P &p) { container->push_back(typename T::value_type(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p)); }
+private:
+	T *container;
+};
+
+// A fixed-capacity container for Capture() that keeps the last N values in place, so capturing
+// never allocates. It counts every value pushed, so a test can tell how many were dropped.
+template <typename T, size_t N>
+class CaptureRing
+{
+public:
+	typedef T value_type;
+	CaptureRing() : next(0), pushed(0) {}
+	void push_back(const T &value)
+	{
+		items[next] = value;
+		if (++next == N)
+			next = 0;
+		++pushed;
+	}
+	size_t size() const { return pushed < N ? (size_t)pushed : N; }
+	size_t capacity() const { return N; }
+	bool empty() const { return pushed == 0; }
+	unsigned long long total() const { return pushed; }
+	unsigned long long dropped() const { return pushed - size(); }
+	// The values still held, oldest first.
+	const T &operator[](size_t index) const { return items[(next + N - size() + index) % N]; }
+	const T &front() const { return (*this)[0]; }
+	const T &back() const { return items[(next + N - 1) % N]; }
+	void clear() { next = 0; pushed = 0; }
+private:
+	T items[N];
+	size_t next;
+	unsigned long long pushed;
+};
+
+// PredicateTable and KeyedTable hold many results for one mocked function in a single Call, which
+// Dispatch(table) registers. A call that no entry matches falls through to the other registrations,
+// as if a Match() returned false. Dispatch() keeps a reference to the table, so it must outlive the
+// calls; entries may still be added after it.
+//
+// PredicateTable tries its predicates last added first, like the equivalent cascade of
+// Match().Return() registrations, but calls each of them directly instead of going through a Call
+// and a Match() functor per predicate. All predicates have the same type Pred, typically a
+// function pointer.
+template <typename Y, typename Pred>
+class PredicateTable
+{
+public:
+	PredicateTable() : hit(0) {}
+	PredicateTable &Add(Pred predicate, const Y &result) { entries.push_back(std::make_pair(predicate, result)); return *this; }
+	size_t size() const { return entries.size(); }
+	template <typename A>
+	bool operator()(A &a)
+	{
+		for (size_t i = entries.size(); i-- > 0; )
+			if (entries[i].first(a))
+				return found(i);
+		return false;
+	}
+	template <typename A, typename B>
+	bool operator()(A &a, B &b)
+	{
+		for (size_t i = entries.size(); i-- > 0; )
+			if (entries[i].first(a, b))
+				return found(i);
+		return false;
+	}
+	template <typename A, typename B, typename C>
+	bool operator()(A &a, B &b, C &c)
+	{
+		for (size_t i = entries.size(); i-- > 0; )
+			if (entries[i].first(a, b, c))
+				return found(i);
+		return false;
+	}
+	template <typename A, typename B, typename C, typename D>
+	bool operator()(A &a, B &b, C &c, D &d)
+	{
+		for (size_t i = entries.size(); i-- > 0; )
+			if (entries[i].first(a, b, c, d))
+				return found(i);
+		return false;
+	}
+	template <typename A, typename B, typename C, typename D, typename E>
+	bool operator()(A &a, B &b, C &c, D &d, E &e)
+	{
+		for (size_t i = entries.size(); i-- > 0; )
+			if (entries[i].first(a, b, c, d, e))
+				return found(i);
+		return false;
+	}
+	template <typename A, typename B, typename C, typename D, typename E, typename F>
+	bool operator()(A &a, B &b, C &c, D &d, E &e, F &f)
+	{
+		for (size_t i = entries.size(); i-- > 0; )
+			if (entries[i].first(a, b, c, d, e, f))
+				return found(i);
+		return false;
+	}
+	template <typename A, typename B, typename C, typename D, typename E, typename F, typename G>
+	bool operator()(A &a, B &b, C &c, D &d, E &e, F &f, G &g)
+	{
+		for (size_t i = entries.size(); i-- > 0; )
+			if (entries[i].first(a, b, c, d, e, f, g))
+				return found(i);
+		return false;
+	}
+	template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H>
+	bool operator()(A &a, B &b, C &c, D &d, E &e, F &f, G &g, H &h)
+	{
+		for (size_t i = entries.size(); i-- > 0; )
+			if (entries[i].first(a, b, c, d, e, f, g, h))
+				return found(i);
+		return false;
+	}
+	template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I>
+	bool operator()(A &a, B &b, C &c, D &d, E &e, F &f, G &g, H &h, I &i)
+	{
+		for (size_t i = entries.size(); i-- > 0; )
+			if (entries[i].first(a, b, c, d, e, f, g, h, i))
+				return found(i);
+		return false;
+	}
+	template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J>
+	bool operator()(A &a, B &b, C &c, D &d, E &e, F &f, G &g, H &h, I &i, J &j)
+	{
+		for (size_t i = entries.size(); i-- > 0; )
+			if (entries[i].first(a, b, c, d, e, f, g, h, i, j))
+				return found(i);
+		return false;
+	}
+	template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K>
+	bool operator()(A &a, B &b, C &c, D &d, E &e, F &f, G &g, H &h, I &i, J &j, K &k)
+	{
+		for (size_t i = entries.size(); i-- > 0; )
+			if (entries[i].first(a, b, c, d, e, f, g, h, i, j, k))
+				return found(i);
+		return false;
+	}
+	template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L>
+	bool operator()(A &a, B &b, C &c, D &d, E &e, F &f, G &g, H &h, I &i, J &j, K &k, L &l)
+	{
+		for (size_t i = entries.size(); i-- > 0; )
+			if (entries[i].first(a, b, c, d, e, f, g, h, i, j, k, l))
+				return found(i);
+		return false;
+	}
+	template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename M>
+	bool operator()(A &a, B &b, C &c, D &d, E &e, F &f, G &g, H &h, I &i, J &j, K &k, L &l, M &m)
+	{
+		for (size_t i = entries.size(); i-- > 0; )
+			if (entries[i].first(a, b, c, d, e, f, g, h, i, j, k, l, m))
+				return found(i);
+		return false;
+	}
+	template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename M, typename N>
+	bool operator()(A &a, B &b, C &c, D &d, E &e, F &f, G &g, H &h, I &i, J &j, K &k, L &l, M &m, N &n)
+	{
+		for (size_t i = entries.size(); i-- > 0; )
+			if (entries[i].first(a, b, c, d, e, f, g, h, i, j, k, l, m, n))
+				return found(i);
+		return false;
+	}
+	template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename M, typename N, typename O>
+	bool operator()(A &a, B &b, C &c, D &d, E &e, F &f, G &g, H &h, I &i, J &j, K &k, L &l, M &m, N &n, O &o)
+	{
+		for (size_t i = entries.size(); i-- > 0; )
+			if (entries[i].first(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o))
+				return found(i);
+		return false;
+	}
+	template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename M, typename N, typename O, typename P>
+	bool operator()(A &a, B &b, C &c, D &d, E &e, F &f, G &g, H &h, I &i, J &j, K &k, L &l, M &m, N &n, O &o, P &p)
+	{
+		for (size_t i = entries.size(); i-- > 0; )
+			if (entries[i].first(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p))
+				return found(i);
+		return false;
+	}
+	const Y &result() const { return entries[hit].second; }
+private:
+	bool found(size_t index)
+	{
+		hit = index;
+		return true;
+	}
+	std::vector<std::pair<Pred, Y> > entries;
+	size_t hit;
+};
+
+// KeyedTable passes the arguments to extract, and looks the key it returns up in a std::map, so
+// that finding the result does not depend on the number of entries. Adding a key again replaces
+// its result.
+template <typename Key, typename Y, typename Extract>
+class KeyedTable
+{
+public:
+	KeyedTable(Extract extractor) : extract(extractor), hit(entries.end()) {}
+	KeyedTable &Add(const Key &key, const Y &result)
+	{
+		std::pair<typename std::map<Key, Y>::iterator, bool> entry = entries.insert(std::make_pair(key, result));
+		if (!entry.second)
+			entry.first->second = result;
+		return *this;
+	}
+	size_t size() const { return entries.size(); }
+	template <typename A>
+	bool operator()(A &a)
+	{
+		return find(extract(a));
+	}
+	template <typename A, typename B>
+	bool operator()(A &a, B &b)
+	{
+		return find(extract(a, b));
+	}
+	template <typename A, typename B, typename C>
+	bool operator()(A &a, B &b, C &c)
+	{
+		return find(extract(a, b, c));
+	}
+	template <typename A, typename B, typename C, typename D>
+	bool operator()(A &a, B &b, C &c, D &d)
+	{
+		return find(extract(a, b, c, d));
+	}
+	template <typename A, typename B, typename C, typename D, typename E>
+	bool operator()(A &a, B &b, C &c, D &d, E &e)
+	{
+		return find(extract(a, b, c, d, e));
+	}
+	template <typename A, typename B, typename C, typename D, typename E, typename F>
+	bool operator()(A &a, B &b, C &c, D &d, E &e, F &f)
+	{
+		return find(extract(a, b, c, d, e, f));
+	}
+	template <typename A, typename B, typename C, typename D, typename E, typename F, typename G>
+	bool operator()(A &a, B &b, C &c, D &d, E &e, F &f, G &g)
+	{
+		return find(extract(a, b, c, d, e, f, g));
+	}
+	template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H>
+	bool operator()(A &a, B &b, C &c, D &d, E &e, F &f, G &g, H &h)
+	{
+		return find(extract(a, b, c, d, e, f, g, h));
+	}
+	template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I>
+	bool operator()(A &a, B &b, C &c, D &d, E &e, F &f, G &g, H &h, I &i)
+	{
+		return find(extract(a, b, c, d, e, f, g, h, i));
+	}
+	template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J>
+	bool operator()(A &a, B &b, C &c, D &d, E &e, F &f, G &g, H &h, I &i, J &j)
+	{
+		return find(extract(a, b, c, d, e, f, g, h, i, j));
+	}
+	template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K>
+	bool operator()(A &a, B &b, C &c, D &d, E &e, F &f, G &g, H &h, I &i, J &j, K &k)
+	{
+		return find(extract(a, b, c, d, e, f, g, h, i, j, k));
+	}
+	template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L>
+	bool operator()(A &a, B &b, C &c, D &d, E &e, F &f, G &g, H &h, I &i, J &j, K &k, L &l)
+	{
+		return find(extract(a, b, c, d, e, f, g, h, i, j, k, l));
+	}
+	template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename M>
+	bool operator()(A &a, B &b, C &c, D &d, E &e, F &f, G &g, H &h, I &i, J &j, K &k, L &l, M &m)
+	{
+		return find(extract(a, b, c, d, e, f, g, h, i, j, k, l, m));
+	}
+	template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename M, typename N>
+	bool operator()(A &a, B &b, C &c, D &d, E &e, F &f, G &g, H &h, I &i, J &j, K &k, L &l, M &m, N &n)
+	{
+		return find(extract(a, b, c, d, e, f, g, h, i, j, k, l, m, n));
+	}
+	template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename M, typename N, typename O>
+	bool operator()(A &a, B &b, C &c, D &d, E &e, F &f, G &g, H &h, I &i, J &j, K &k, L &l, M &m, N &n, O &o)
+	{
+		return find(extract(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o));
+	}
+	template <typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename M, typename N, typename O, typename P>
+	bool operator()(A &a, B &b, C &c, D &d, E &e, F &f, G &g, H &h, I &i, J &j, K &k, L &l, M &m, N &n, O &o, P &p)
+	{
+		return find(extract(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p));
+	}
+	const Y &result() const { return hit->second; }
+private:
+	bool find(const Key &key)
+	{
+		hit = entries.find(key);
+		return hit != entries.end();
+	}
+	Extract extract;
+	std::map<Key, Y> entries;
+	typename std::map<Key, Y>::const_iterator hit;
+};
+
+// The Match() and Do() functors that Dispatch() stores: a pointer to the table, which they call
+// through.
+template <typename T, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H,
+		  typename I, typename J, typename K, typename L, typename M, typename N, typename O, typename P>
+struct TableMatch {
+	static bool invoke(void *table, const base_tuple &tupl)
+	{
+		return DoWrapper<T,bool,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P>::invoke(*static_cast<T **>(table), tupl);
+	}
+};
+
+template <typename T, typename Y>
+struct TableResult {
+	static Y invoke(void *table, const base_tuple &)
+	{
+		return (*static_cast<T **>(table))->result();
+	}
+};
+
+class ReturnValueHolder : public MockAllocated {
+public:
+	virtual ~ReturnValueHolder() {}
+	// The bytes of the object, for MockRepository::memoryUsage().
+	virtual size_t objectSize() const = 0;
+};
+
+template <class T>
+class ReturnValueWrapper : public ReturnValueHolder {
+public:
+   virtual T value() = 0;
+};
+
+#if __cplusplus > 199711L
+// Return() copies the stored value out for every call. A value that cannot be copied, such as a
+// std::unique_ptr, is moved out instead, and Return() limits its Call to one call like ReturnOnce().
+template <typename T, bool copy = std::is_reference<typename no_cref<T>::type>::value || std::is_copy_constructible<typename no_cref<T>::type>::value>
+struct stored_value
+{
+	static const bool copies = true;
+	static T get(typename no_cref<T>::type &rv) { return rv; }
+};
+
+template <typename T>
+struct stored_value<T, false>
+{
+	static const bool copies = false;
+	static T get(typename no_cref<T>::type &rv) { return std::move(rv); }
+};
+#define HM_FORWARD(T, value) std::forward<T>(value)
+#else
+#define HM_FORWARD(T, value) (value)
+#endif
+
+template <class T>
+class ReturnValueWrapperCopy : public ReturnValueWrapper<T> {
+public:
+	size_t objectSize() const { return sizeof(*this); }
+	typename no_cref<T>::type rv;
+	ReturnValueWrapperCopy(T retValue) : rv(HM_FORWARD(T, retValue)) {}
+#if __cplusplus > 199711L
+   virtual T value() { return stored_value<T>::get(rv); };
+#else
+   virtual T value() { return rv; };
+#endif
+};
+
+#if __cplusplus > 199711L
+// ReturnMove() moves the value out, so it suits a Call that is made once; any later call gets the
+// moved-from value. ReturnOnce() also limits the Call to one call, so that a second one is reported;
+// an ExpectCalls() registration that wants more calls than that is rejected.
+template <class T>
+class ReturnValueWrapperMove : public ReturnValueWrapper<T> {
+public:
+	size_t objectSize() const { return sizeof(*this); }
+	typename no_cref<T>::type rv;
+	ReturnValueWrapperMove(T retValue) : rv(std::forward<T>(retValue)) {}
+   virtual T value() { return std::move(rv); };
+};
+#endif
+
+// ReturnSequence() and ReturnCycle() keep all their values in one Call and return the next one on
+// each call. ReturnSequence() returns each value once and limits the Call to that many calls, so a
+// further call is reported; ReturnCycle() wraps around at the end. Both need at least one value.
+template <class T>
+class ReturnValueWrapperSequence : public ReturnValueWrapper<T> {
+public:
+	size_t objectSize() const { return sizeof(*this); }
+	std::vector<typename no_cref<T>::type, MockStlAllocator<typename no_cref<T>::type> > values;
+	size_t next;
+	template <typename It>
+	ReturnValueWrapperSequence(It begin, It end) : values(begin, end), next(0) {}
+	size_t size() const { return values.size(); }
+   virtual T value() {
+		if (next == values.size())
+			next = 0;
+		return values[next++];
+   };
+};
+
+// ReturnGenerator(g) returns g(0) for the first call, g(1) for the second and so on.
+template <class T, typename G>
+class ReturnValueWrapperGenerator : public ReturnValueWrapper<T> {
+public:
+	size_t objectSize() const { return sizeof(*this); }
+	G generator;
+	size_t calls;
+	ReturnValueWrapperGenerator(G gen) : generator(gen), calls(0) {}
+   virtual T value() { return generator(calls++); };
+};
+
+template <class T>
+class ReturnValueWrapperRef : public ReturnValueWrapper<T> {
+public:
+	size_t objectSize() const { return sizeof(*this); }
+	T rv;
+	ReturnValueWrapperRef(T retValue) : rv(retValue) {}
+   virtual T value() { return rv; };
+};
+
+#ifdef HM_DISPATCH_STATS
+// Counters for the work done while dispatching mocked calls.
+struct DispatchStats {
+	unsigned long long calls;           // mocked calls dispatched
+	unsigned long long candidates;      // registrations inspected to find a matching one
+	unsigned long long argMatches;      // argument comparisons (matchesArgs) done
+	unsigned long long matchFunctors;   // Match() functors run
+	unsigned long long exceptions;      // exceptions raised by the repository while dispatching
+	unsigned long long nanoseconds;     // time spent dispatching, including Do() functors but not
+	                                    // the mocked calls they make, which count on their own
+	DispatchStats()
+		: calls(0), candidates(0), argMatches(0), matchFunctors(0), exceptions(0), nanoseconds(0)
+	{
+	}
+	DispatchStats &operator+=(const DispatchStats &other)
+	{
+		calls += other.calls;
+		candidates += other.candidates;
+		argMatches += other.argMatches;
+		matchFunctors += other.matchFunctors;
+		exceptions += other.exceptions;
+		nanoseconds += other.nanoseconds;
+		return *this;
+	}
+};
+
+HM_INLINE std::ostream &operator<<(std::ostream &os, const DispatchStats &stats);
+#endif
+
+//Call wrapping
+class Call : public MockAllocated {
+public:
+	virtual bool matchesArgs(const base_tuple &tuple) = 0;
+	// Compares With() values that could be packed with one memcmp, and anything else with matchesArgs().
+	// The arguments of a call are only packed when the first such Call compares them.
+	bool argumentsMatch(const base_tuple &tuple)
+	{
+		if (packedArgs && !matchFunctor.isSet())
+		{
+			if (!tuple.packed)
+				argumentKeys->packer(tuple);
+			return packed_equal(packedArgs, tuple.packed, packedSize);
+		}
+		return matchesArgs(tuple);
+	}
+	virtual void assignArgs(base_tuple &tuple) = 0;
+	// Dispatch reads these for every candidate Call, so they come first and share a cache line
+	// with the start of matchFunctor, which argumentsMatch() checks.
+	base_mock *mock;
+	std::pair<int, int> funcIndex;
+	const unsigned char *packedArgs;
+	RegistrationType expectation;
+	unsigned called;
+	unsigned short packedSize;
+	bool satisfied;
+	// Whether the Call is one of the expectations, which VerifyAll requires to be satisfied.
+	bool required;
+	FunctorHolder matchFunctor;
+	// The rest is only needed once the Call is chosen, or to report on it.
+	FunctorHolder functor;
+	FunctorHolder capture;
+	bool assignsArgs;
+	ReturnValueHolder *retVal;
+#ifndef HM_NO_EXCEPTIONS
+	ExceptionHolder *eHolder;
+#endif
+	const ArgumentKeys *argumentKeys;
+	// The repository the Call is registered with.
+	MockRepository *repo;
+	CallList previousCalls;
+	// The Calls registered before and after this one on the same mock.
+	Call *previousOnMock;
+	Call *nextOnMock;
+	int lineno;
+	const char *funcName;
+	const char *fileName;
+#ifdef HM_DISPATCH_STATS
+	DispatchStats stats;
+#endif
+#ifdef HM_CALL_TRACE
+	unsigned id;
+#endif
+protected:
+	// Lets a Call that has count results be made no more than count times. An expectation then
+	// waits for all of them. ExpectCalls() with another count than one, or OnCalls() with a higher
+	// minimum, asks for calls that cannot all get a result, so that is rejected.
+	void limitCalls(size_t count)
+	{
+		bool fixed = expectation.minimum == expectation.maximum && expectation.maximum > 1;
+		if ((fixed && expectation.maximum != count) || expectation.minimum > count)
+			RAISEEXCEPTION(CallCountConflictException(funcName, expectation.minimum, count));
+		expectation.maximum = (unsigned)count;
+		if (expectation.minimum)
+			expectation.minimum = (unsigned)count;
+	}
+	// Return() can hand out a value that cannot be copied only once, so the Call is limited to that.
+	template <typename Y>
+	void limitUncopyable()
+	{
+#if __cplusplus > 199711L
+		if (!stored_value<Y>::copies)
+			limitCalls(1);
+#endif
+	}
+	// Takes the keys of the With() values, and tells the repository about any Fingerprint in them.
+	void setArgumentKeys(const ArgumentKeys &keys);
+	bool invokeMatchFunctor(const base_tuple &tupl)
+	{
+#ifdef HM_DISPATCH_STATS
+		++stats.matchFunctors;
+#endif
+		return matchFunctor.invoke<bool>(tupl);
+	}
+	Call(RegistrationType expect, base_mock *baseMock, const std::pair<int, int> &index, int X, const char *func, const char *file)
+		: mock(baseMock),
+		funcIndex(index),
+		packedArgs(0),
+		expectation(expect),
+		called( 0 ),
+		packedSize(0),
+		satisfied(false),
+		required(false),
+		assignsArgs(false),
+		retVal(0),
+#ifndef HM_NO_EXCEPTIONS
+		eHolder(0),
+#endif
+		argumentKeys(0),
+		repo(0),
+		previousOnMock(0),
+		nextOnMock(0),
+		lineno(X),
+		funcName(func),
+		fileName(file)
+#ifdef HM_CALL_TRACE
+		, id(0)
+#endif
+	{
+	}
+public:
+	virtual const base_tuple *getArgs() const = 0;
+	// The bytes of the object, for MockRepository::memoryUsage().
+	virtual size_t objectSize() const = 0;
+	virtual ~Call()
+	{
+#ifndef HM_NO_EXCEPTIONS
+		delete eHolder;
+#endif
+		delete retVal;
+	}
+};
+
+HM_INLINE std::ostream &operator<<(std::ostream &os, const Call &call);
+
+template <typename Y,
+		  typename A = NullType, typename B = NullType, typename C = NullType, typename D = NullType,
+		  typename E = NullType, typename F = NullType, typename G = NullType, typename H = NullType,
+		  typename I = NullType, typename J = NullType, typename K = NullType, typename L = NullType,
+		  typename M = NullType, typename N = NullType, typename O = NullType, typename P = NullType>
+class TCall : public Call {
+private:
+	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> *args;
+public:
+		const base_tuple *getArgs() const { return args; }
+	size_t objectSize() const { return sizeof(*this); }
+	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
+	~TCall() { delete args; }
+	bool matchesArgs(const base_tuple &tupl) {
+		return (!args && !matchFunctor.isSet()) ||
+			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &>(tupl))) ||
+			(matchFunctor.isSet() && invokeMatchFunctor(tupl));
+	}
+	void assignArgs(base_tuple &tupl) {
+		if(args) {
+			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &>(tupl));
+			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &>(tupl));
+		}
+	}
+	template <typename CA, typename CB, typename CC, typename CD,
+			  typename CE, typename CF, typename CG, typename CH,
+			  typename CI, typename CJ, typename CK, typename CL,
+			  typename CM, typename CN, typename CO, typename CP>
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g, const CH & h, const CI & i, const CJ & j, const CK & k, const CL & l, const CM & m, const CN & n, const CO & o, const CP & p) {
+		args = new copy_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P,
+								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,const CH &,const CI &,const CJ &,const CK &,const CL &,const CM &,const CN &,const CO &,const CP &>(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p);
+		assignsArgs = args->assigning;
+		setArgumentKeys(args->keys);
+		return *this;
+	}
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &After(Call &call) {
+		previousCalls.push_back(&call);
+		return *this;
+	}
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &Do(T function) { functor.set<DoWrapper<T,Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> >(function); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &Match(T function) { matchFunctor.set<DoWrapper<T,bool,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> >(function); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &Dispatch(T &table) { matchFunctor.set<TableMatch<T,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> >(&table); functor.set<TableResult<T,Y> >(&table); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &Capture(T &container) { capture.set<DoWrapper<Capturer<T>,void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> >(Capturer<T>(container)); return *this; }
+	Call &Return(Y obj) { retVal = new ReturnValueWrapperCopy<Y>(HM_FORWARD(Y, obj)); limitUncopyable<Y>(); return *this; }
+	Call &ReturnByRef(Y obj) { retVal = new ReturnValueWrapperRef<Y>(obj); return *this; }
+#if __cplusplus > 199711L
+	Call &ReturnMove(Y obj) { retVal = new ReturnValueWrapperMove<Y>(std::forward<Y>(obj)); return *this; }
+	Call &ReturnOnce(Y obj) { limitCalls(1); return ReturnMove(std::forward<Y>(obj)); }
+#endif
+	template <typename It>
+	Call &ReturnSequence(It begin, It end) { if (begin == end) RAISEEXCEPTION(EmptySequenceException(funcName)); ReturnValueWrapperSequence<Y> *values = new ReturnValueWrapperSequence<Y>(begin, end); retVal = values; limitCalls(values->size()); return *this; }
+	template <typename It>
+	Call &ReturnCycle(It begin, It end) { if (begin == end) RAISEEXCEPTION(EmptyCycleException(funcName)); retVal = new ReturnValueWrapperSequence<Y>(begin, end); return *this; }
+	template <typename T>
+	Call &ReturnGenerator(T generator) { retVal = new ReturnValueWrapperGenerator<Y, T>(generator); return *this; }
+#ifndef HM_NO_EXCEPTIONS
+	template <typename Ex>
+	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
+#endif
+};
+template <typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I, typename J, typename K, typename L,
+		  typename M, typename N, typename O, typename P>
+class TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> : public Call {
+private:
+	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> *args;
+public:
+		const base_tuple *getArgs() const { return args; }
+	size_t objectSize() const { return sizeof(*this); }
+	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
+	~TCall() { delete args; }
+	bool matchesArgs(const base_tuple &tupl) {
+		return (!args && !matchFunctor.isSet()) ||
+			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &>(tupl))) ||
+			(matchFunctor.isSet() && invokeMatchFunctor(tupl));
+	}
+	void assignArgs(base_tuple &tupl) {
+		if(args) {
+			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &>(tupl));
+			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &>(tupl));
+		}
+	}
+	template <typename CA, typename CB, typename CC, typename CD,
+			  typename CE, typename CF, typename CG, typename CH,
+			  typename CI, typename CJ, typename CK, typename CL,
+			  typename CM, typename CN, typename CO, typename CP>
+	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g, const CH & h, const CI & i, const CJ & j, const CK & k, const CL & l, const CM & m, const CN & n, const CO & o, const CP & p) {
+		args = new copy_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P,
+								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,const CH &,const CI &,const CJ &,const CK &,const CL &,const CM &,const CN &,const CO &,const CP &>(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p);
+		assignsArgs = args->assigning;
+		setArgumentKeys(args->keys);
+		return *this;
+	}
+	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &After(Call &call) {
+		previousCalls.push_back(&call);
+		return *this;
+	}
+	template <typename T>
+	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &Do(T function) { functor.set<DoWrapper<T,void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> >(function); return *this; }
+	template <typename T>
+	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &Match(T function) { matchFunctor.set<DoWrapper<T,bool,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> >(function); return *this; }
+	template <typename T>
+	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &Capture(T &container) { capture.set<DoWrapper<Capturer<T>,void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> >(Capturer<T>(container)); return *this; }
+#ifndef HM_NO_EXCEPTIONS
+	template <typename Ex>
+	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
+#endif
+};
+
+template <typename Y,
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I, typename J, typename K, typename L,
+		  typename M, typename N, typename O>
+class TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> : public Call {
+private:
+	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> *args;
+public:
+		const base_tuple *getArgs() const { return args; }
+	size_t objectSize() const { return sizeof(*this); }
+	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
+	~TCall() { delete args; }
+	bool matchesArgs(const base_tuple &tupl) {
+		return (!args && !matchFunctor.isSet()) ||
+			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &>(tupl))) ||
+			(matchFunctor.isSet() && invokeMatchFunctor(tupl));
+	}
+	void assignArgs(base_tuple &tupl) {
+		if(args) {
+			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &>(tupl));
+			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &>(tupl));
+		}
+	}
+	template <typename CA, typename CB, typename CC, typename CD,
+			  typename CE, typename CF, typename CG, typename CH,
+			  typename CI, typename CJ, typename CK, typename CL,
+			  typename CM, typename CN, typename CO>
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g, const CH & h, const CI & i, const CJ & j, const CK & k, const CL & l, const CM & m, const CN & n, const CO & o) {
+		args = new copy_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType,
+								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,const CH &,const CI &,const CJ &,const CK &,const CL &,const CM &,const CN &,const CO &,NullType>(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o);
+		assignsArgs = args->assigning;
+		setArgumentKeys(args->keys);
+		return *this;
+	}
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &After(Call &call) {
+		previousCalls.push_back(&call);
+		return *this;
+	}
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &Do(T function) { functor.set<DoWrapper<T,Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &Match(T function) { matchFunctor.set<DoWrapper<T,bool,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &Dispatch(T &table) { matchFunctor.set<TableMatch<T,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> >(&table); functor.set<TableResult<T,Y> >(&table); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &Capture(T &container) { capture.set<DoWrapper<Capturer<T>,void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> >(Capturer<T>(container)); return *this; }
+	Call &Return(Y obj) { retVal = new ReturnValueWrapperCopy<Y>(HM_FORWARD(Y, obj)); limitUncopyable<Y>(); return *this; }
+	Call &ReturnByRef(Y obj) { retVal = new ReturnValueWrapperRef<Y>(obj); return *this; }
+#if __cplusplus > 199711L
+	Call &ReturnMove(Y obj) { retVal = new ReturnValueWrapperMove<Y>(std::forward<Y>(obj)); return *this; }
+	Call &ReturnOnce(Y obj) { limitCalls(1); return ReturnMove(std::forward<Y>(obj)); }
+#endif
+	template <typename It>
+	Call &ReturnSequence(It begin, It end) { if (begin == end) RAISEEXCEPTION(EmptySequenceException(funcName)); ReturnValueWrapperSequence<Y> *values = new ReturnValueWrapperSequence<Y>(begin, end); retVal = values; limitCalls(values->size()); return *this; }
+	template <typename It>
+	Call &ReturnCycle(It begin, It end) { if (begin == end) RAISEEXCEPTION(EmptyCycleException(funcName)); retVal = new ReturnValueWrapperSequence<Y>(begin, end); return *this; }
+	template <typename T>
+	Call &ReturnGenerator(T generator) { retVal = new ReturnValueWrapperGenerator<Y, T>(generator); return *this; }
+#ifndef HM_NO_EXCEPTIONS
+	template <typename Ex>
+	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
+#endif
+};
+template <typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I, typename J, typename K, typename L,
+		  typename M, typename N, typename O>
+class TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> : public Call {
+private:
+	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> *args;
+public:
+		const base_tuple *getArgs() const { return args; }
+	size_t objectSize() const { return sizeof(*this); }
+	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
+	~TCall() { delete args; }
+	bool matchesArgs(const base_tuple &tupl) {
+		return (!args && !matchFunctor.isSet()) ||
+			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &>(tupl))) ||
+			(matchFunctor.isSet() && invokeMatchFunctor(tupl));
+	}
+	void assignArgs(base_tuple &tupl) {
+		if(args) {
+			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &>(tupl));
+			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &>(tupl));
+		}
+	}
+	template <typename CA, typename CB, typename CC, typename CD,
+			  typename CE, typename CF, typename CG, typename CH,
+			  typename CI, typename CJ, typename CK, typename CL,
+			  typename CM, typename CN, typename CO>
+	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g, const CH & h, const CI & i, const CJ & j, const CK & k, const CL & l, const CM & m, const CN & n, const CO & o) {
+		args = new copy_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType,
+								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,const CH &,const CI &,const CJ &,const CK &,const CL &,const CM &,const CN &,const CO &,NullType>(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o);
+		assignsArgs = args->assigning;
+		setArgumentKeys(args->keys);
+		return *this;
+	}
+	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &After(Call &call) {
+		previousCalls.push_back(&call);
+		return *this;
+	}
+	template <typename T>
+	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &Do(T function) { functor.set<DoWrapper<T,void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &Match(T function) { matchFunctor.set<DoWrapper<T,bool,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> &Capture(T &container) { capture.set<DoWrapper<Capturer<T>,void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,NullType> >(Capturer<T>(container)); return *this; }
+#ifndef HM_NO_EXCEPTIONS
+	template <typename Ex>
+	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
+#endif
+};
+
+template <typename Y,
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I, typename J, typename K, typename L,
+		  typename M, typename N>
+class TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> : public Call {
+private:
+	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> *args;
+public:
+		const base_tuple *getArgs() const { return args; }
+	size_t objectSize() const { return sizeof(*this); }
+	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
+	~TCall() { delete args; }
+	bool matchesArgs(const base_tuple &tupl) {
+		return (!args && !matchFunctor.isSet()) ||
+			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &>(tupl))) ||
+			(matchFunctor.isSet() && invokeMatchFunctor(tupl));
+	}
+	void assignArgs(base_tuple &tupl) {
+		if(args) {
+			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &>(tupl));
+			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &>(tupl));
+		}
+	}
+	template <typename CA, typename CB, typename CC, typename CD,
+			  typename CE, typename CF, typename CG, typename CH,
+			  typename CI, typename CJ, typename CK, typename CL,
+			  typename CM, typename CN>
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g, const CH & h, const CI & i, const CJ & j, const CK & k, const CL & l, const CM & m, const CN & n) {
+		args = new copy_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType,
+								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,const CH &,const CI &,const CJ &,const CK &,const CL &,const CM &,const CN &,NullType,NullType>(a,b,c,d,e,f,g,h,i,j,k,l,m,n);
+		assignsArgs = args->assigning;
+		setArgumentKeys(args->keys);
+		return *this;
+	}
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &After(Call &call) {
+		previousCalls.push_back(&call);
+		return *this;
+	}
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &Do(T function) { functor.set<DoWrapper<T,Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &Match(T function) { matchFunctor.set<DoWrapper<T,bool,A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &Dispatch(T &table) { matchFunctor.set<TableMatch<T,A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> >(&table); functor.set<TableResult<T,Y> >(&table); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &Capture(T &container) { capture.set<DoWrapper<Capturer<T>,void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> >(Capturer<T>(container)); return *this; }
+	Call &Return(Y obj) { retVal = new ReturnValueWrapperCopy<Y>(HM_FORWARD(Y, obj)); limitUncopyable<Y>(); return *this; }
+	Call &ReturnByRef(Y obj) { retVal = new ReturnValueWrapperRef<Y>(obj); return *this; }
+#if __cplusplus > 199711L
+	Call &ReturnMove(Y obj) { retVal = new ReturnValueWrapperMove<Y>(std::forward<Y>(obj)); return *this; }
+	Call &ReturnOnce(Y obj) { limitCalls(1); return ReturnMove(std::forward<Y>(obj)); }
+#endif
+	template <typename It>
+	Call &ReturnSequence(It begin, It end) { if (begin == end) RAISEEXCEPTION(EmptySequenceException(funcName)); ReturnValueWrapperSequence<Y> *values = new ReturnValueWrapperSequence<Y>(begin, end); retVal = values; limitCalls(values->size()); return *this; }
+	template <typename It>
+	Call &ReturnCycle(It begin, It end) { if (begin == end) RAISEEXCEPTION(EmptyCycleException(funcName)); retVal = new ReturnValueWrapperSequence<Y>(begin, end); return *this; }
+	template <typename T>
+	Call &ReturnGenerator(T generator) { retVal = new ReturnValueWrapperGenerator<Y, T>(generator); return *this; }
+#ifndef HM_NO_EXCEPTIONS
+	template <typename Ex>
+	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
+#endif
+};
+template <typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I, typename J, typename K, typename L,
+		  typename M, typename N>
+class TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> : public Call {
+private:
+	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> *args;
+public:
+		const base_tuple *getArgs() const { return args; }
+	size_t objectSize() const { return sizeof(*this); }
+	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
+	~TCall() { delete args; }
+	bool matchesArgs(const base_tuple &tupl) {
+		return (!args && !matchFunctor.isSet()) ||
+			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &>(tupl))) ||
+			(matchFunctor.isSet() && invokeMatchFunctor(tupl));
+	}
+	void assignArgs(base_tuple &tupl) {
+		if(args) {
+			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &>(tupl));
+			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &>(tupl));
+		}
+	}
+	template <typename CA, typename CB, typename CC, typename CD,
+			  typename CE, typename CF, typename CG, typename CH,
+			  typename CI, typename CJ, typename CK, typename CL,
+			  typename CM, typename CN>
+	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g, const CH & h, const CI & i, const CJ & j, const CK & k, const CL & l, const CM & m, const CN & n) {
+		args = new copy_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType,
+								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,const CH &,const CI &,const CJ &,const CK &,const CL &,const CM &,const CN &,NullType,NullType>(a,b,c,d,e,f,g,h,i,j,k,l,m,n);
+		assignsArgs = args->assigning;
+		setArgumentKeys(args->keys);
+		return *this;
+	}
+	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &After(Call &call) {
+		previousCalls.push_back(&call);
+		return *this;
+	}
+	template <typename T>
+	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &Do(T function) { functor.set<DoWrapper<T,void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &Match(T function) { matchFunctor.set<DoWrapper<T,bool,A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> &Capture(T &container) { capture.set<DoWrapper<Capturer<T>,void,A,B,C,D,E,F,G,H,I,J,K,L,M,N,NullType,NullType> >(Capturer<T>(container)); return *this; }
+#ifndef HM_NO_EXCEPTIONS
+	template <typename Ex>
+	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
+#endif
+};
+
+template <typename Y,
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I, typename J, typename K, typename L,
+		  typename M>
+class TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> : public Call {
+private:
+	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> *args;
+public:
+		const base_tuple *getArgs() const { return args; }
+	size_t objectSize() const { return sizeof(*this); }
+	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
+	~TCall() { delete args; }
+	bool matchesArgs(const base_tuple &tupl) {
+		return (!args && !matchFunctor.isSet()) ||
+			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &>(tupl))) ||
+			(matchFunctor.isSet() && invokeMatchFunctor(tupl));
+	}
+	void assignArgs(base_tuple &tupl) {
+		if(args) {
+			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &>(tupl));
+			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &>(tupl));
+		}
+	}
+	template <typename CA, typename CB, typename CC, typename CD,
+			  typename CE, typename CF, typename CG, typename CH,
+			  typename CI, typename CJ, typename CK, typename CL,
+			  typename CM>
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g, const CH & h, const CI & i, const CJ & j, const CK & k, const CL & l, const CM & m) {
+		args = new copy_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType,
+								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,const CH &,const CI &,const CJ &,const CK &,const CL &,const CM &,NullType,NullType,NullType>(a,b,c,d,e,f,g,h,i,j,k,l,m);
+		assignsArgs = args->assigning;
+		setArgumentKeys(args->keys);
+		return *this;
+	}
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &After(Call &call) {
+		previousCalls.push_back(&call);
+		return *this;
+	}
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &Do(T function) { functor.set<DoWrapper<T,Y,A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &Match(T function) { matchFunctor.set<DoWrapper<T,bool,A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &Dispatch(T &table) { matchFunctor.set<TableMatch<T,A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> >(&table); functor.set<TableResult<T,Y> >(&table); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &Capture(T &container) { capture.set<DoWrapper<Capturer<T>,void,A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> >(Capturer<T>(container)); return *this; }
+	Call &Return(Y obj) { retVal = new ReturnValueWrapperCopy<Y>(HM_FORWARD(Y, obj)); limitUncopyable<Y>(); return *this; }
+	Call &ReturnByRef(Y obj) { retVal = new ReturnValueWrapperRef<Y>(obj); return *this; }
+#if __cplusplus > 199711L
+	Call &ReturnMove(Y obj) { retVal = new ReturnValueWrapperMove<Y>(std::forward<Y>(obj)); return *this; }
+	Call &ReturnOnce(Y obj) { limitCalls(1); return ReturnMove(std::forward<Y>(obj)); }
+#endif
+	template <typename It>
+	Call &ReturnSequence(It begin, It end) { if (begin == end) RAISEEXCEPTION(EmptySequenceException(funcName)); ReturnValueWrapperSequence<Y> *values = new ReturnValueWrapperSequence<Y>(begin, end); retVal = values; limitCalls(values->size()); return *this; }
+	template <typename It>
+	Call &ReturnCycle(It begin, It end) { if (begin == end) RAISEEXCEPTION(EmptyCycleException(funcName)); retVal = new ReturnValueWrapperSequence<Y>(begin, end); return *this; }
+	template <typename T>
+	Call &ReturnGenerator(T generator) { retVal = new ReturnValueWrapperGenerator<Y, T>(generator); return *this; }
+#ifndef HM_NO_EXCEPTIONS
+	template <typename Ex>
+	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
+#endif
+};
+template <typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I, typename J, typename K, typename L,
+		  typename M>
+class TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> : public Call {
+private:
+	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> *args;
+public:
+		const base_tuple *getArgs() const { return args; }
+	size_t objectSize() const { return sizeof(*this); }
+	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
+	~TCall() { delete args; }
+	bool matchesArgs(const base_tuple &tupl) {
+		return (!args && !matchFunctor.isSet()) ||
+			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &>(tupl))) ||
+			(matchFunctor.isSet() && invokeMatchFunctor(tupl));
+	}
+	void assignArgs(base_tuple &tupl) {
+		if(args) {
+			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &>(tupl));
+			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &>(tupl));
+		}
+	}
+	template <typename CA, typename CB, typename CC, typename CD,
+			  typename CE, typename CF, typename CG, typename CH,
+			  typename CI, typename CJ, typename CK, typename CL,
+			  typename CM>
+	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g, const CH & h, const CI & i, const CJ & j, const CK & k, const CL & l, const CM & m) {
+		args = new copy_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType,
+								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,const CH &,const CI &,const CJ &,const CK &,const CL &,const CM &,NullType,NullType,NullType>(a,b,c,d,e,f,g,h,i,j,k,l,m);
+		assignsArgs = args->assigning;
+		setArgumentKeys(args->keys);
+		return *this;
+	}
+	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &After(Call &call) {
+		previousCalls.push_back(&call);
+		return *this;
+	}
+	template <typename T>
+	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &Do(T function) { functor.set<DoWrapper<T,void,A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &Match(T function) { matchFunctor.set<DoWrapper<T,bool,A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> &Capture(T &container) { capture.set<DoWrapper<Capturer<T>,void,A,B,C,D,E,F,G,H,I,J,K,L,M,NullType,NullType,NullType> >(Capturer<T>(container)); return *this; }
+#ifndef HM_NO_EXCEPTIONS
+	template <typename Ex>
+	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
+#endif
+};
+
+template <typename Y,
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I, typename J, typename K, typename L>
+class TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> : public Call {
+private:
+	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> *args;
+public:
+		const base_tuple *getArgs() const { return args; }
+	size_t objectSize() const { return sizeof(*this); }
+	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
+	~TCall() { delete args; }
+	bool matchesArgs(const base_tuple &tupl) {
+		return (!args && !matchFunctor.isSet()) ||
+			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &>(tupl))) ||
+			(matchFunctor.isSet() && invokeMatchFunctor(tupl));
+	}
+	void assignArgs(base_tuple &tupl) {
+		if(args) {
+			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &>(tupl));
+			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &>(tupl));
+		}
+	}
+	template <typename CA, typename CB, typename CC, typename CD,
+			  typename CE, typename CF, typename CG, typename CH,
+			  typename CI, typename CJ, typename CK, typename CL>
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g, const CH & h, const CI & i, const CJ & j, const CK & k, const CL & l) {
+		args = new copy_tuple<A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType,
+								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,const CH &,const CI &,const CJ &,const CK &,const CL &,NullType,NullType,NullType,NullType>(a,b,c,d,e,f,g,h,i,j,k,l);
+		assignsArgs = args->assigning;
+		setArgumentKeys(args->keys);
+		return *this;
+	}
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &After(Call &call) {
+		previousCalls.push_back(&call);
+		return *this;
+	}
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &Do(T function) { functor.set<DoWrapper<T,Y,A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor.set<DoWrapper<T,bool,A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &Dispatch(T &table) { matchFunctor.set<TableMatch<T,A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> >(&table); functor.set<TableResult<T,Y> >(&table); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &Capture(T &container) { capture.set<DoWrapper<Capturer<T>,void,A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> >(Capturer<T>(container)); return *this; }
+	Call &Return(Y obj) { retVal = new ReturnValueWrapperCopy<Y>(HM_FORWARD(Y, obj)); limitUncopyable<Y>(); return *this; }
+	Call &ReturnByRef(Y obj) { retVal = new ReturnValueWrapperRef<Y>(obj); return *this; }
+#if __cplusplus > 199711L
+	Call &ReturnMove(Y obj) { retVal = new ReturnValueWrapperMove<Y>(std::forward<Y>(obj)); return *this; }
+	Call &ReturnOnce(Y obj) { limitCalls(1); return ReturnMove(std::forward<Y>(obj)); }
+#endif
+	template <typename It>
+	Call &ReturnSequence(It begin, It end) { if (begin == end) RAISEEXCEPTION(EmptySequenceException(funcName)); ReturnValueWrapperSequence<Y> *values = new ReturnValueWrapperSequence<Y>(begin, end); retVal = values; limitCalls(values->size()); return *this; }
+	template <typename It>
+	Call &ReturnCycle(It begin, It end) { if (begin == end) RAISEEXCEPTION(EmptyCycleException(funcName)); retVal = new ReturnValueWrapperSequence<Y>(begin, end); return *this; }
+	template <typename T>
+	Call &ReturnGenerator(T generator) { retVal = new ReturnValueWrapperGenerator<Y, T>(generator); return *this; }
+#ifndef HM_NO_EXCEPTIONS
+	template <typename Ex>
+	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
+#endif
+};
+template <typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I, typename J, typename K, typename L>
+class TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> : public Call {
+private:
+	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> *args;
+public:
+		const base_tuple *getArgs() const { return args; }
+	size_t objectSize() const { return sizeof(*this); }
+	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
+	~TCall() { delete args; }
+	bool matchesArgs(const base_tuple &tupl) {
+		return (!args && !matchFunctor.isSet()) ||
+			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &>(tupl))) ||
+			(matchFunctor.isSet() && invokeMatchFunctor(tupl));
+	}
+	void assignArgs(base_tuple &tupl) {
+		if(args) {
+			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &>(tupl));
+			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &>(tupl));
+		}
+	}
+	template <typename CA, typename CB, typename CC, typename CD,
+			  typename CE, typename CF, typename CG, typename CH,
+			  typename CI, typename CJ, typename CK, typename CL>
+	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g, const CH & h, const CI & i, const CJ & j, const CK & k, const CL & l) {
+		args = new copy_tuple<A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType,
+								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,const CH &,const CI &,const CJ &,const CK &,const CL &,NullType,NullType,NullType,NullType>(a,b,c,d,e,f,g,h,i,j,k,l);
+		assignsArgs = args->assigning;
+		setArgumentKeys(args->keys);
+		return *this;
+	}
+	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &After(Call &call) {
+		previousCalls.push_back(&call);
+		return *this;
+	}
+	template <typename T>
+	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &Do(T function) { functor.set<DoWrapper<T,void,A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor.set<DoWrapper<T,bool,A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<void,A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> &Capture(T &container) { capture.set<DoWrapper<Capturer<T>,void,A,B,C,D,E,F,G,H,I,J,K,L,NullType,NullType,NullType,NullType> >(Capturer<T>(container)); return *this; }
+#ifndef HM_NO_EXCEPTIONS
+	template <typename Ex>
+	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
+#endif
+};
+
+template <typename Y,
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I, typename J, typename K>
+class TCall<Y,A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> : public Call {
+private:
+	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> *args;
+public:
+		const base_tuple *getArgs() const { return args; }
+	size_t objectSize() const { return sizeof(*this); }
+	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
+	~TCall() { delete args; }
+	bool matchesArgs(const base_tuple &tupl) {
+		return (!args && !matchFunctor.isSet()) ||
+			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
+			(matchFunctor.isSet() && invokeMatchFunctor(tupl));
+	}
+	void assignArgs(base_tuple &tupl) {
+		if(args) {
+			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+		}
+	}
+	template <typename CA, typename CB, typename CC, typename CD,
+			  typename CE, typename CF, typename CG, typename CH,
+			  typename CI, typename CJ, typename CK>
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g, const CH & h, const CI & i, const CJ & j, const CK & k) {
+		args = new copy_tuple<A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType,
+								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,const CH &,const CI &,const CJ &,const CK &,NullType,NullType,NullType,NullType,NullType>(a,b,c,d,e,f,g,h,i,j,k);
+		assignsArgs = args->assigning;
+		setArgumentKeys(args->keys);
+		return *this;
+	}
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
+		previousCalls.push_back(&call);
+		return *this;
+	}
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor.set<DoWrapper<T,Y,A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor.set<DoWrapper<T,bool,A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &Dispatch(T &table) { matchFunctor.set<TableMatch<T,A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> >(&table); functor.set<TableResult<T,Y> >(&table); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &Capture(T &container) { capture.set<DoWrapper<Capturer<T>,void,A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> >(Capturer<T>(container)); return *this; }
+	Call &Return(Y obj) { retVal = new ReturnValueWrapperCopy<Y>(HM_FORWARD(Y, obj)); limitUncopyable<Y>(); return *this; }
+	Call &ReturnByRef(Y obj) { retVal = new ReturnValueWrapperRef<Y>(obj); return *this; }
+#if __cplusplus > 199711L
+	Call &ReturnMove(Y obj) { retVal = new ReturnValueWrapperMove<Y>(std::forward<Y>(obj)); return *this; }
+	Call &ReturnOnce(Y obj) { limitCalls(1); return ReturnMove(std::forward<Y>(obj)); }
+#endif
+	template <typename It>
+	Call &ReturnSequence(It begin, It end) { if (begin == end) RAISEEXCEPTION(EmptySequenceException(funcName)); ReturnValueWrapperSequence<Y> *values = new ReturnValueWrapperSequence<Y>(begin, end); retVal = values; limitCalls(values->size()); return *this; }
+	template <typename It>
+	Call &ReturnCycle(It begin, It end) { if (begin == end) RAISEEXCEPTION(EmptyCycleException(funcName)); retVal = new ReturnValueWrapperSequence<Y>(begin, end); return *this; }
+	template <typename T>
+	Call &ReturnGenerator(T generator) { retVal = new ReturnValueWrapperGenerator<Y, T>(generator); return *this; }
+#ifndef HM_NO_EXCEPTIONS
+	template <typename Ex>
+	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
+#endif
+};
+template <typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I, typename J, typename K>
+class TCall<void,A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> : public Call {
+private:
+	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> *args;
+public:
+		const base_tuple *getArgs() const { return args; }
+	size_t objectSize() const { return sizeof(*this); }
+	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
+	~TCall() { delete args; }
+	bool matchesArgs(const base_tuple &tupl) {
+		return (!args && !matchFunctor.isSet()) ||
+			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
+			(matchFunctor.isSet() && invokeMatchFunctor(tupl));
+	}
+	void assignArgs(base_tuple &tupl) {
+		if(args) {
+			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+		}
+	}
+	template <typename CA, typename CB, typename CC, typename CD,
+			  typename CE, typename CF, typename CG, typename CH,
+			  typename CI, typename CJ, typename CK>
+	TCall<void,A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g, const CH & h, const CI & i, const CJ & j, const CK & k) {
+		args = new copy_tuple<A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType,
+								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,const CH &,const CI &,const CJ &,const CK &,NullType,NullType,NullType,NullType,NullType>(a,b,c,d,e,f,g,h,i,j,k);
+		assignsArgs = args->assigning;
+		setArgumentKeys(args->keys);
+		return *this;
+	}
+	TCall<void,A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
+		previousCalls.push_back(&call);
+		return *this;
+	}
+	template <typename T>
+	TCall<void,A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor.set<DoWrapper<T,void,A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<void,A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor.set<DoWrapper<T,bool,A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<void,A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> &Capture(T &container) { capture.set<DoWrapper<Capturer<T>,void,A,B,C,D,E,F,G,H,I,J,K,NullType,NullType,NullType,NullType,NullType> >(Capturer<T>(container)); return *this; }
+#ifndef HM_NO_EXCEPTIONS
+	template <typename Ex>
+	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
+#endif
+};
+
+template <typename Y,
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I, typename J>
+class TCall<Y,A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
+private:
+	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> *args;
+public:
+		const base_tuple *getArgs() const { return args; }
+	size_t objectSize() const { return sizeof(*this); }
+	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
+	~TCall() { delete args; }
+	bool matchesArgs(const base_tuple &tupl) {
+		return (!args && !matchFunctor.isSet()) ||
+			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
+			(matchFunctor.isSet() && invokeMatchFunctor(tupl));
+	}
+	void assignArgs(base_tuple &tupl) {
+		if(args) {
+			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+		}
+	}
+	template <typename CA, typename CB, typename CC, typename CD,
+			  typename CE, typename CF, typename CG, typename CH,
+			  typename CI, typename CJ>
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g, const CH & h, const CI & i, const CJ & j) {
+		args = new copy_tuple<A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType,
+								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,const CH &,const CI &,const CJ &,NullType,NullType,NullType,NullType,NullType,NullType>(a,b,c,d,e,f,g,h,i,j);
+		assignsArgs = args->assigning;
+		setArgumentKeys(args->keys);
+		return *this;
+	}
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
+		previousCalls.push_back(&call);
+		return *this;
+	}
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor.set<DoWrapper<T,Y,A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor.set<DoWrapper<T,bool,A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &Dispatch(T &table) { matchFunctor.set<TableMatch<T,A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> >(&table); functor.set<TableResult<T,Y> >(&table); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &Capture(T &container) { capture.set<DoWrapper<Capturer<T>,void,A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> >(Capturer<T>(container)); return *this; }
+	Call &Return(Y obj) { retVal = new ReturnValueWrapperCopy<Y>(HM_FORWARD(Y, obj)); limitUncopyable<Y>(); return *this; }
+	Call &ReturnByRef(Y obj) { retVal = new ReturnValueWrapperRef<Y>(obj); return *this; }
+#if __cplusplus > 199711L
+	Call &ReturnMove(Y obj) { retVal = new ReturnValueWrapperMove<Y>(std::forward<Y>(obj)); return *this; }
+	Call &ReturnOnce(Y obj) { limitCalls(1); return ReturnMove(std::forward<Y>(obj)); }
+#endif
+	template <typename It>
+	Call &ReturnSequence(It begin, It end) { if (begin == end) RAISEEXCEPTION(EmptySequenceException(funcName)); ReturnValueWrapperSequence<Y> *values = new ReturnValueWrapperSequence<Y>(begin, end); retVal = values; limitCalls(values->size()); return *this; }
+	template <typename It>
+	Call &ReturnCycle(It begin, It end) { if (begin == end) RAISEEXCEPTION(EmptyCycleException(funcName)); retVal = new ReturnValueWrapperSequence<Y>(begin, end); return *this; }
+	template <typename T>
+	Call &ReturnGenerator(T generator) { retVal = new ReturnValueWrapperGenerator<Y, T>(generator); return *this; }
+#ifndef HM_NO_EXCEPTIONS
+	template <typename Ex>
+	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
+#endif
+};
+template <typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I, typename J>
+class TCall<void,A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
+private:
+	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> *args;
+public:
+		const base_tuple *getArgs() const { return args; }
+	size_t objectSize() const { return sizeof(*this); }
+	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
+	~TCall() { delete args; }
+	bool matchesArgs(const base_tuple &tupl) {
+		return (!args && !matchFunctor.isSet()) ||
+			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
+			(matchFunctor.isSet() && invokeMatchFunctor(tupl));
+	}
+	void assignArgs(base_tuple &tupl) {
+		if(args) {
+			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+		}
+	}
+	template <typename CA, typename CB, typename CC, typename CD,
+			  typename CE, typename CF, typename CG, typename CH,
+			  typename CI, typename CJ>
+	TCall<void,A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g, const CH & h, const CI & i, const CJ & j) {
+		args = new copy_tuple<A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType,
+								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,const CH &,const CI &,const CJ &,NullType,NullType,NullType,NullType,NullType,NullType>(a,b,c,d,e,f,g,h,i,j);
+		assignsArgs = args->assigning;
+		setArgumentKeys(args->keys);
+		return *this;
+	}
+	TCall<void,A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
+		previousCalls.push_back(&call);
+		return *this;
+	}
+	template <typename T>
+	TCall<void,A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor.set<DoWrapper<T,void,A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<void,A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor.set<DoWrapper<T,bool,A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<void,A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> &Capture(T &container) { capture.set<DoWrapper<Capturer<T>,void,A,B,C,D,E,F,G,H,I,J,NullType,NullType,NullType,NullType,NullType,NullType> >(Capturer<T>(container)); return *this; }
+#ifndef HM_NO_EXCEPTIONS
+	template <typename Ex>
+	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
+#endif
+};
+
+template <typename Y,
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I>
+class TCall<Y,A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
+private:
+	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
+public:
+		const base_tuple *getArgs() const { return args; }
+	size_t objectSize() const { return sizeof(*this); }
+	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
+	~TCall() { delete args; }
+	bool matchesArgs(const base_tuple &tupl) {
+		return (!args && !matchFunctor.isSet()) ||
+			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
+			(matchFunctor.isSet() && invokeMatchFunctor(tupl));
+	}
+	void assignArgs(base_tuple &tupl) {
+		if(args) {
+			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+		}
+	}
+	template <typename CA, typename CB, typename CC, typename CD,
+			  typename CE, typename CF, typename CG, typename CH,
+			  typename CI>
+	TCall<Y,A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g, const CH & h, const CI & i) {
+		args = new copy_tuple<A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
+								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,const CH &,const CI &,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(a,b,c,d,e,f,g,h,i);
+		assignsArgs = args->assigning;
+		setArgumentKeys(args->keys);
+		return *this;
+	}
+	TCall<Y,A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
+		previousCalls.push_back(&call);
+		return *this;
+	}
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor.set<DoWrapper<T,Y,A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor.set<DoWrapper<T,bool,A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Dispatch(T &table) { matchFunctor.set<TableMatch<T,A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(&table); functor.set<TableResult<T,Y> >(&table); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Capture(T &container) { capture.set<DoWrapper<Capturer<T>,void,A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(Capturer<T>(container)); return *this; }
+	Call &Return(Y obj) { retVal = new ReturnValueWrapperCopy<Y>(HM_FORWARD(Y, obj)); limitUncopyable<Y>(); return *this; }
+	Call &ReturnByRef(Y obj) { retVal = new ReturnValueWrapperRef<Y>(obj); return *this; }
+#if __cplusplus > 199711L
+	Call &ReturnMove(Y obj) { retVal = new ReturnValueWrapperMove<Y>(std::forward<Y>(obj)); return *this; }
+	Call &ReturnOnce(Y obj) { limitCalls(1); return ReturnMove(std::forward<Y>(obj)); }
+#endif
+	template <typename It>
+	Call &ReturnSequence(It begin, It end) { if (begin == end) RAISEEXCEPTION(EmptySequenceException(funcName)); ReturnValueWrapperSequence<Y> *values = new ReturnValueWrapperSequence<Y>(begin, end); retVal = values; limitCalls(values->size()); return *this; }
+	template <typename It>
+	Call &ReturnCycle(It begin, It end) { if (begin == end) RAISEEXCEPTION(EmptyCycleException(funcName)); retVal = new ReturnValueWrapperSequence<Y>(begin, end); return *this; }
+	template <typename T>
+	Call &ReturnGenerator(T generator) { retVal = new ReturnValueWrapperGenerator<Y, T>(generator); return *this; }
+#ifndef HM_NO_EXCEPTIONS
+	template <typename Ex>
+	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
+#endif
+};
+template <typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I>
+class TCall<void,A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
+private:
+	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
+public:
+		const base_tuple *getArgs() const { return args; }
+	size_t objectSize() const { return sizeof(*this); }
+	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
+	~TCall() { delete args; }
+	bool matchesArgs(const base_tuple &tupl) {
+		return (!args && !matchFunctor.isSet()) ||
+			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
+			(matchFunctor.isSet() && invokeMatchFunctor(tupl));
+	}
+	void assignArgs(base_tuple &tupl) {
+		if(args) {
+			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+		}
+	}
+	template <typename CA, typename CB, typename CC, typename CD,
+			  typename CE, typename CF, typename CG, typename CH,
+			  typename CI>
+	TCall<void,A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g, const CH & h, const CI & i) {
+		args = new copy_tuple<A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
+								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,const CH &,const CI &,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(a,b,c,d,e,f,g,h,i);
+		assignsArgs = args->assigning;
+		setArgumentKeys(args->keys);
+		return *this;
+	}
+	TCall<void,A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
+		previousCalls.push_back(&call);
+		return *this;
+	}
+	template <typename T>
+	TCall<void,A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor.set<DoWrapper<T,void,A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<void,A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor.set<DoWrapper<T,bool,A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<void,A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Capture(T &container) { capture.set<DoWrapper<Capturer<T>,void,A,B,C,D,E,F,G,H,I,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(Capturer<T>(container)); return *this; }
+#ifndef HM_NO_EXCEPTIONS
+	template <typename Ex>
+	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
+#endif
+};
+
+template <typename Y,
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H>
+class TCall<Y,A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
+private:
+	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
+public:
+		const base_tuple *getArgs() const { return args; }
+	size_t objectSize() const { return sizeof(*this); }
+	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
+	~TCall() { delete args; }
+	bool matchesArgs(const base_tuple &tupl) {
+		return (!args && !matchFunctor.isSet()) ||
+			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
+			(matchFunctor.isSet() && invokeMatchFunctor(tupl));
+	}
+	void assignArgs(base_tuple &tupl) {
+		if(args) {
+			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+		}
+	}
+	template <typename CA, typename CB, typename CC, typename CD,
+			  typename CE, typename CF, typename CG, typename CH>
+	TCall<Y,A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g, const CH & h) {
+		args = new copy_tuple<A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
+								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,const CH &,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(a,b,c,d,e,f,g,h);
+		assignsArgs = args->assigning;
+		setArgumentKeys(args->keys);
+		return *this;
+	}
+	TCall<Y,A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
+		previousCalls.push_back(&call);
+		return *this;
+	}
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor.set<DoWrapper<T,Y,A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor.set<DoWrapper<T,bool,A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Dispatch(T &table) { matchFunctor.set<TableMatch<T,A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(&table); functor.set<TableResult<T,Y> >(&table); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Capture(T &container) { capture.set<DoWrapper<Capturer<T>,void,A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(Capturer<T>(container)); return *this; }
+	Call &Return(Y obj) { retVal = new ReturnValueWrapperCopy<Y>(HM_FORWARD(Y, obj)); limitUncopyable<Y>(); return *this; }
+	Call &ReturnByRef(Y obj) { retVal = new ReturnValueWrapperRef<Y>(obj); return *this; }
+#if __cplusplus > 199711L
+	Call &ReturnMove(Y obj) { retVal = new ReturnValueWrapperMove<Y>(std::forward<Y>(obj)); return *this; }
+	Call &ReturnOnce(Y obj) { limitCalls(1); return ReturnMove(std::forward<Y>(obj)); }
+#endif
+	template <typename It>
+	Call &ReturnSequence(It begin, It end) { if (begin == end) RAISEEXCEPTION(EmptySequenceException(funcName)); ReturnValueWrapperSequence<Y> *values = new ReturnValueWrapperSequence<Y>(begin, end); retVal = values; limitCalls(values->size()); return *this; }
+	template <typename It>
+	Call &ReturnCycle(It begin, It end) { if (begin == end) RAISEEXCEPTION(EmptyCycleException(funcName)); retVal = new ReturnValueWrapperSequence<Y>(begin, end); return *this; }
+	template <typename T>
+	Call &ReturnGenerator(T generator) { retVal = new ReturnValueWrapperGenerator<Y, T>(generator); return *this; }
+#ifndef HM_NO_EXCEPTIONS
+	template <typename Ex>
+	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
+#endif
+};
+template <typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H>
+class TCall<void,A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
+private:
+	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
+public:
+		const base_tuple *getArgs() const { return args; }
+	size_t objectSize() const { return sizeof(*this); }
+	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
+	~TCall() { delete args; }
+	bool matchesArgs(const base_tuple &tupl) {
+		return (!args && !matchFunctor.isSet()) ||
+			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
+			(matchFunctor.isSet() && invokeMatchFunctor(tupl));
+	}
+	void assignArgs(base_tuple &tupl) {
+		if(args) {
+			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+		}
+	}
+	template <typename CA, typename CB, typename CC, typename CD,
+			  typename CE, typename CF, typename CG, typename CH>
+	TCall<void,A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g, const CH & h) {
+		args = new copy_tuple<A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
+								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,const CH &,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(a,b,c,d,e,f,g,h);
+		assignsArgs = args->assigning;
+		setArgumentKeys(args->keys);
+		return *this;
+	}
+	TCall<void,A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
+		previousCalls.push_back(&call);
+		return *this;
+	}
+	template <typename T>
+	TCall<void,A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor.set<DoWrapper<T,void,A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<void,A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor.set<DoWrapper<T,bool,A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<void,A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Capture(T &container) { capture.set<DoWrapper<Capturer<T>,void,A,B,C,D,E,F,G,H,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(Capturer<T>(container)); return *this; }
+#ifndef HM_NO_EXCEPTIONS
+	template <typename Ex>
+	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
+#endif
+};
+
+template <typename Y,
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G>
+class TCall<Y,A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
+private:
+	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
+public:
+		const base_tuple *getArgs() const { return args; }
+	size_t objectSize() const { return sizeof(*this); }
+	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
+	~TCall() { delete args; }
+	bool matchesArgs(const base_tuple &tupl) {
+		return (!args && !matchFunctor.isSet()) ||
+			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
+			(matchFunctor.isSet() && invokeMatchFunctor(tupl));
+	}
+	void assignArgs(base_tuple &tupl) {
+		if(args) {
+			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+		}
+	}
+	template <typename CA, typename CB, typename CC, typename CD,
+			  typename CE, typename CF, typename CG>
+	TCall<Y,A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g) {
+		args = new copy_tuple<A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
+								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(a,b,c,d,e,f,g);
+		assignsArgs = args->assigning;
+		setArgumentKeys(args->keys);
+		return *this;
+	}
+	TCall<Y,A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
+		previousCalls.push_back(&call);
+		return *this;
+	}
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor.set<DoWrapper<T,Y,A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor.set<DoWrapper<T,bool,A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Dispatch(T &table) { matchFunctor.set<TableMatch<T,A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(&table); functor.set<TableResult<T,Y> >(&table); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Capture(T &container) { capture.set<DoWrapper<Capturer<T>,void,A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(Capturer<T>(container)); return *this; }
+	Call &Return(Y obj) { retVal = new ReturnValueWrapperCopy<Y>(HM_FORWARD(Y, obj)); limitUncopyable<Y>(); return *this; }
+	Call &ReturnByRef(Y obj) { retVal = new ReturnValueWrapperRef<Y>(obj); return *this; }
+#if __cplusplus > 199711L
+	Call &ReturnMove(Y obj) { retVal = new ReturnValueWrapperMove<Y>(std::forward<Y>(obj)); return *this; }
+	Call &ReturnOnce(Y obj) { limitCalls(1); return ReturnMove(std::forward<Y>(obj)); }
+#endif
+	template <typename It>
+	Call &ReturnSequence(It begin, It end) { if (begin == end) RAISEEXCEPTION(EmptySequenceException(funcName)); ReturnValueWrapperSequence<Y> *values = new ReturnValueWrapperSequence<Y>(begin, end); retVal = values; limitCalls(values->size()); return *this; }
+	template <typename It>
+	Call &ReturnCycle(It begin, It end) { if (begin == end) RAISEEXCEPTION(EmptyCycleException(funcName)); retVal = new ReturnValueWrapperSequence<Y>(begin, end); return *this; }
+	template <typename T>
+	Call &ReturnGenerator(T generator) { retVal = new ReturnValueWrapperGenerator<Y, T>(generator); return *this; }
+#ifndef HM_NO_EXCEPTIONS
+	template <typename Ex>
+	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
+#endif
+};
+template <typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G>
+class TCall<void,A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
+private:
+	ref_comparable_assignable_tuple<A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
+public:
+		const base_tuple *getArgs() const { return args; }
+	size_t objectSize() const { return sizeof(*this); }
+	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
+	~TCall() { delete args; }
+	bool matchesArgs(const base_tuple &tupl) {
+		return (!args && !matchFunctor.isSet()) ||
+			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
+			(matchFunctor.isSet() && invokeMatchFunctor(tupl));
+	}
+	void assignArgs(base_tuple &tupl) {
+		if(args) {
+			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+		}
+	}
+	template <typename CA, typename CB, typename CC, typename CD,
+			  typename CE, typename CF, typename CG>
+	TCall<void,A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f, const CG & g) {
+		args = new copy_tuple<A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
+								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,const CG &,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(a,b,c,d,e,f,g);
+		assignsArgs = args->assigning;
+		setArgumentKeys(args->keys);
+		return *this;
+	}
+	TCall<void,A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
+		previousCalls.push_back(&call);
+		return *this;
+	}
+	template <typename T>
+	TCall<void,A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor.set<DoWrapper<T,void,A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<void,A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor.set<DoWrapper<T,bool,A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<void,A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Capture(T &container) { capture.set<DoWrapper<Capturer<T>,void,A,B,C,D,E,F,G,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(Capturer<T>(container)); return *this; }
+#ifndef HM_NO_EXCEPTIONS
+	template <typename Ex>
+	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
+#endif
+};
+
+template <typename Y,
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F>
+class TCall<Y,A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
+private:
+	ref_comparable_assignable_tuple<A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
+public:
+		const base_tuple *getArgs() const { return args; }
+	size_t objectSize() const { return sizeof(*this); }
+	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
+	~TCall() { delete args; }
+	bool matchesArgs(const base_tuple &tupl) {
+		return (!args && !matchFunctor.isSet()) ||
+			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
+			(matchFunctor.isSet() && invokeMatchFunctor(tupl));
+	}
+	void assignArgs(base_tuple &tupl) {
+		if(args) {
+			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+		}
+	}
+	template <typename CA, typename CB, typename CC, typename CD,
+			  typename CE, typename CF>
+	TCall<Y,A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f) {
+		args = new copy_tuple<A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
+								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(a,b,c,d,e,f);
+		assignsArgs = args->assigning;
+		setArgumentKeys(args->keys);
+		return *this;
+	}
+	TCall<Y,A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
+		previousCalls.push_back(&call);
+		return *this;
+	}
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor.set<DoWrapper<T,Y,A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor.set<DoWrapper<T,bool,A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Dispatch(T &table) { matchFunctor.set<TableMatch<T,A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(&table); functor.set<TableResult<T,Y> >(&table); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Capture(T &container) { capture.set<DoWrapper<Capturer<T>,void,A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(Capturer<T>(container)); return *this; }
+	Call &Return(Y obj) { retVal = new ReturnValueWrapperCopy<Y>(HM_FORWARD(Y, obj)); limitUncopyable<Y>(); return *this; }
+	Call &ReturnByRef(Y obj) { retVal = new ReturnValueWrapperRef<Y>(obj); return *this; }
+#if __cplusplus > 199711L
+	Call &ReturnMove(Y obj) { retVal = new ReturnValueWrapperMove<Y>(std::forward<Y>(obj)); return *this; }
+	Call &ReturnOnce(Y obj) { limitCalls(1); return ReturnMove(std::forward<Y>(obj)); }
+#endif
+	template <typename It>
+	Call &ReturnSequence(It begin, It end) { if (begin == end) RAISEEXCEPTION(EmptySequenceException(funcName)); ReturnValueWrapperSequence<Y> *values = new ReturnValueWrapperSequence<Y>(begin, end); retVal = values; limitCalls(values->size()); return *this; }
+	template <typename It>
+	Call &ReturnCycle(It begin, It end) { if (begin == end) RAISEEXCEPTION(EmptyCycleException(funcName)); retVal = new ReturnValueWrapperSequence<Y>(begin, end); return *this; }
+	template <typename T>
+	Call &ReturnGenerator(T generator) { retVal = new ReturnValueWrapperGenerator<Y, T>(generator); return *this; }
+#ifndef HM_NO_EXCEPTIONS
+	template <typename Ex>
+	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
+#endif
+};
+template <typename A, typename B, typename C, typename D,
+		  typename E, typename F>
+class TCall<void,A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
+private:
+	ref_comparable_assignable_tuple<A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
+public:
+		const base_tuple *getArgs() const { return args; }
+	size_t objectSize() const { return sizeof(*this); }
+	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
+	~TCall() { delete args; }
+	bool matchesArgs(const base_tuple &tupl) {
+		return (!args && !matchFunctor.isSet()) ||
+			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
+			(matchFunctor.isSet() && invokeMatchFunctor(tupl));
+	}
+	void assignArgs(base_tuple &tupl) {
+		if(args) {
+			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+		}
+	}
+	template <typename CA, typename CB, typename CC, typename CD,
+			  typename CE, typename CF>
+	TCall<void,A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e, const CF & f) {
+		args = new copy_tuple<A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
+								const CA &,const CB &,const CC &,const CD &,const CE &,const CF &,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(a,b,c,d,e,f);
+		assignsArgs = args->assigning;
+		setArgumentKeys(args->keys);
+		return *this;
+	}
+	TCall<void,A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
+		previousCalls.push_back(&call);
+		return *this;
+	}
+	template <typename T>
+	TCall<void,A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor.set<DoWrapper<T,void,A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<void,A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor.set<DoWrapper<T,bool,A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<void,A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Capture(T &container) { capture.set<DoWrapper<Capturer<T>,void,A,B,C,D,E,F,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(Capturer<T>(container)); return *this; }
+#ifndef HM_NO_EXCEPTIONS
+	template <typename Ex>
+	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
+#endif
+};
+
+template <typename Y,
+		  typename A, typename B, typename C, typename D,
+		  typename E>
+class TCall<Y,A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
+private:
+	ref_comparable_assignable_tuple<A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
+public:
+		const base_tuple *getArgs() const { return args; }
+	size_t objectSize() const { return sizeof(*this); }
+	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
+	~TCall() { delete args; }
+	bool matchesArgs(const base_tuple &tupl) {
+		return (!args && !matchFunctor.isSet()) ||
+			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
+			(matchFunctor.isSet() && invokeMatchFunctor(tupl));
+	}
+	void assignArgs(base_tuple &tupl) {
+		if(args) {
+			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+		}
+	}
+	template <typename CA, typename CB, typename CC, typename CD,
+			  typename CE>
+	TCall<Y,A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e) {
+		args = new copy_tuple<A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
+								const CA &,const CB &,const CC &,const CD &,const CE &,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(a,b,c,d,e);
+		assignsArgs = args->assigning;
+		setArgumentKeys(args->keys);
+		return *this;
+	}
+	TCall<Y,A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
+		previousCalls.push_back(&call);
+		return *this;
+	}
+	template <typename T>
+	TCall<Y,A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor.set<DoWrapper<T,Y,A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor.set<DoWrapper<T,bool,A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Dispatch(T &table) { matchFunctor.set<TableMatch<T,A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(&table); functor.set<TableResult<T,Y> >(&table); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Capture(T &container) { capture.set<DoWrapper<Capturer<T>,void,A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(Capturer<T>(container)); return *this; }
+	Call &Return(Y obj) { retVal = new ReturnValueWrapperCopy<Y>(HM_FORWARD(Y, obj)); limitUncopyable<Y>(); return *this; }
+	Call &ReturnByRef(Y obj) { retVal = new ReturnValueWrapperRef<Y>(obj); return *this; }
+#if __cplusplus > 199711L
+	Call &ReturnMove(Y obj) { retVal = new ReturnValueWrapperMove<Y>(std::forward<Y>(obj)); return *this; }
+	Call &ReturnOnce(Y obj) { limitCalls(1); return ReturnMove(std::forward<Y>(obj)); }
+#endif
+	template <typename It>
+	Call &ReturnSequence(It begin, It end) { if (begin == end) RAISEEXCEPTION(EmptySequenceException(funcName)); ReturnValueWrapperSequence<Y> *values = new ReturnValueWrapperSequence<Y>(begin, end); retVal = values; limitCalls(values->size()); return *this; }
+	template <typename It>
+	Call &ReturnCycle(It begin, It end) { if (begin == end) RAISEEXCEPTION(EmptyCycleException(funcName)); retVal = new ReturnValueWrapperSequence<Y>(begin, end); return *this; }
+	template <typename T>
+	Call &ReturnGenerator(T generator) { retVal = new ReturnValueWrapperGenerator<Y, T>(generator); return *this; }
+#ifndef HM_NO_EXCEPTIONS
+	template <typename Ex>
+	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
+#endif
+};
+template <typename A, typename B, typename C, typename D,
+		  typename E>
+class TCall<void,A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
+private:
+	ref_comparable_assignable_tuple<A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
+public:
+		const base_tuple *getArgs() const { return args; }
+	size_t objectSize() const { return sizeof(*this); }
+	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
+	~TCall() { delete args; }
+	bool matchesArgs(const base_tuple &tupl) {
+		return (!args && !matchFunctor.isSet()) ||
+			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
+			(matchFunctor.isSet() && invokeMatchFunctor(tupl));
+	}
+	void assignArgs(base_tuple &tupl) {
+		if(args) {
+			args->assign_to(static_cast<ref_tuple<A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+			args->assign_from(static_cast<ref_tuple<A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+		}
+	}
+	template <typename CA, typename CB, typename CC, typename CD,
+			  typename CE>
+	TCall<void,A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d, const CE & e) {
+		args = new copy_tuple<A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
+								const CA &,const CB &,const CC &,const CD &,const CE &,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(a,b,c,d,e);
+		assignsArgs = args->assigning;
+		setArgumentKeys(args->keys);
+		return *this;
+	}
+	TCall<void,A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
+		previousCalls.push_back(&call);
+		return *this;
+	}
+	template <typename T>
+	TCall<void,A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor.set<DoWrapper<T,void,A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<void,A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor.set<DoWrapper<T,bool,A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<void,A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Capture(T &container) { capture.set<DoWrapper<Capturer<T>,void,A,B,C,D,E,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(Capturer<T>(container)); return *this; }
+#ifndef HM_NO_EXCEPTIONS
+	template <typename Ex>
+	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
+#endif
+};
+
+template <typename Y,
+		  typename A, typename B, typename C, typename D>
+class TCall<Y,A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
+private:
+	ref_comparable_assignable_tuple<A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
+public:
+		const base_tuple *getArgs() const { return args; }
+	size_t objectSize() const { return sizeof(*this); }
+	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
+	~TCall() { delete args; }
+	bool matchesArgs(const base_tuple &tupl) {
+		return (!args && !matchFunctor.isSet()) ||
+			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
+			(matchFunctor.isSet() && invokeMatchFunctor(tupl));
+	}
+	void assignArgs(base_tuple &tupl) {
+		if(args) {
+			args->assign_to(static_cast<ref_tuple<A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+			args->assign_from(static_cast<ref_tuple<A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+		}
+	}
+	template <typename CA, typename CB, typename CC, typename CD>
+	TCall<Y,A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d) {
+		args = new copy_tuple<A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
+								const CA &,const CB &,const CC &,const CD &,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(a,b,c,d);
+		assignsArgs = args->assigning;
+		setArgumentKeys(args->keys);
+		return *this;
+	}
+	TCall<Y,A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
+		previousCalls.push_back(&call);
+		return *this;
+	}
+	template <typename T>
+	TCall<Y,A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor.set<DoWrapper<T,Y,A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor.set<DoWrapper<T,bool,A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Dispatch(T &table) { matchFunctor.set<TableMatch<T,A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(&table); functor.set<TableResult<T,Y> >(&table); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Capture(T &container) { capture.set<DoWrapper<Capturer<T>,void,A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(Capturer<T>(container)); return *this; }
+	Call &Return(Y obj) { retVal = new ReturnValueWrapperCopy<Y>(HM_FORWARD(Y, obj)); limitUncopyable<Y>(); return *this; }
+	Call &ReturnByRef(Y obj) { retVal = new ReturnValueWrapperRef<Y>(obj); return *this; }
+#if __cplusplus > 199711L
+	Call &ReturnMove(Y obj) { retVal = new ReturnValueWrapperMove<Y>(std::forward<Y>(obj)); return *this; }
+	Call &ReturnOnce(Y obj) { limitCalls(1); return ReturnMove(std::forward<Y>(obj)); }
+#endif
+	template <typename It>
+	Call &ReturnSequence(It begin, It end) { if (begin == end) RAISEEXCEPTION(EmptySequenceException(funcName)); ReturnValueWrapperSequence<Y> *values = new ReturnValueWrapperSequence<Y>(begin, end); retVal = values; limitCalls(values->size()); return *this; }
+	template <typename It>
+	Call &ReturnCycle(It begin, It end) { if (begin == end) RAISEEXCEPTION(EmptyCycleException(funcName)); retVal = new ReturnValueWrapperSequence<Y>(begin, end); return *this; }
+	template <typename T>
+	Call &ReturnGenerator(T generator) { retVal = new ReturnValueWrapperGenerator<Y, T>(generator); return *this; }
+#ifndef HM_NO_EXCEPTIONS
+	template <typename Ex>
+	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
+#endif
+};
+template <typename A, typename B, typename C, typename D>
+class TCall<void,A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
+private:
+	ref_comparable_assignable_tuple<A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
+public:
+		const base_tuple *getArgs() const { return args; }
+	size_t objectSize() const { return sizeof(*this); }
+	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
+	~TCall() { delete args; }
+	bool matchesArgs(const base_tuple &tupl) {
+		return (!args && !matchFunctor.isSet()) ||
+			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
+			(matchFunctor.isSet() && invokeMatchFunctor(tupl));
+	}
+	void assignArgs(base_tuple &tupl) {
+		if(args) {
+			args->assign_to(static_cast<ref_tuple<A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+			args->assign_from(static_cast<ref_tuple<A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+		}
+	}
+	template <typename CA, typename CB, typename CC, typename CD>
+	TCall<void,A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c, const CD & d) {
+		args = new copy_tuple<A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
+								const CA &,const CB &,const CC &,const CD &,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(a,b,c,d);
+		assignsArgs = args->assigning;
+		setArgumentKeys(args->keys);
+		return *this;
+	}
+	TCall<void,A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
+		previousCalls.push_back(&call);
+		return *this;
+	}
+	template <typename T>
+	TCall<void,A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor.set<DoWrapper<T,void,A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<void,A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor.set<DoWrapper<T,bool,A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<void,A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Capture(T &container) { capture.set<DoWrapper<Capturer<T>,void,A,B,C,D,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(Capturer<T>(container)); return *this; }
+#ifndef HM_NO_EXCEPTIONS
+	template <typename Ex>
+	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
+#endif
+};
+
+template <typename Y,
+		  typename A, typename B, typename C>
+class TCall<Y,A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
+private:
+	ref_comparable_assignable_tuple<A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
+public:
+		const base_tuple *getArgs() const { return args; }
+	size_t objectSize() const { return sizeof(*this); }
+	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
+	~TCall() { delete args; }
+	bool matchesArgs(const base_tuple &tupl) {
+		return (!args && !matchFunctor.isSet()) ||
+			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
+			(matchFunctor.isSet() && invokeMatchFunctor(tupl));
+	}
+	void assignArgs(base_tuple &tupl) {
+		if(args) {
+			args->assign_to(static_cast<ref_tuple<A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+			args->assign_from(static_cast<ref_tuple<A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+		}
+	}
+	template <typename CA, typename CB, typename CC>
+	TCall<Y,A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c) {
+		args = new copy_tuple<A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
+								const CA &,const CB &,const CC &,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(a,b,c);
+		assignsArgs = args->assigning;
+		setArgumentKeys(args->keys);
+		return *this;
+	}
+	TCall<Y,A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
+		previousCalls.push_back(&call);
+		return *this;
+	}
+	template <typename T>
+	TCall<Y,A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor.set<DoWrapper<T,Y,A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor.set<DoWrapper<T,bool,A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Dispatch(T &table) { matchFunctor.set<TableMatch<T,A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(&table); functor.set<TableResult<T,Y> >(&table); return *this; }
+	template <typename T>
+	TCall<Y,A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Capture(T &container) { capture.set<DoWrapper<Capturer<T>,void,A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(Capturer<T>(container)); return *this; }
+	Call &Return(Y obj) { retVal = new ReturnValueWrapperCopy<Y>(HM_FORWARD(Y, obj)); limitUncopyable<Y>(); return *this; }
+	Call &ReturnByRef(Y obj) { retVal = new ReturnValueWrapperRef<Y>(obj); return *this; }
+#if __cplusplus > 199711L
+	Call &ReturnMove(Y obj) { retVal = new ReturnValueWrapperMove<Y>(std::forward<Y>(obj)); return *this; }
+	Call &ReturnOnce(Y obj) { limitCalls(1); return ReturnMove(std::forward<Y>(obj)); }
+#endif
+	template <typename It>
+	Call &ReturnSequence(It begin, It end) { if (begin == end) RAISEEXCEPTION(EmptySequenceException(funcName)); ReturnValueWrapperSequence<Y> *values = new ReturnValueWrapperSequence<Y>(begin, end); retVal = values; limitCalls(values->size()); return *this; }
+	template <typename It>
+	Call &ReturnCycle(It begin, It end) { if (begin == end) RAISEEXCEPTION(EmptyCycleException(funcName)); retVal = new ReturnValueWrapperSequence<Y>(begin, end); return *this; }
+	template <typename T>
+	Call &ReturnGenerator(T generator) { retVal = new ReturnValueWrapperGenerator<Y, T>(generator); return *this; }
+#ifndef HM_NO_EXCEPTIONS
+	template <typename Ex>
+	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
+#endif
+};
+template <typename A, typename B, typename C>
+class TCall<void,A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
+private:
+	ref_comparable_assignable_tuple<A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
+public:
+		const base_tuple *getArgs() const { return args; }
+	size_t objectSize() const { return sizeof(*this); }
+	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
+	~TCall() { delete args; }
+	bool matchesArgs(const base_tuple &tupl) {
+		return (!args && !matchFunctor.isSet()) ||
+			(args && (*args == reinterpret_cast<const ref_tuple<A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
+			(matchFunctor.isSet() && invokeMatchFunctor(tupl));
+	}
+	void assignArgs(base_tuple &tupl) {
+		if(args) {
+			args->assign_to(static_cast<ref_tuple<A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+			args->assign_from(static_cast<ref_tuple<A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+		}
+	}
+	template <typename CA, typename CB, typename CC>
+	TCall<void,A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b, const CC & c) {
+		args = new copy_tuple<A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
+								const CA &,const CB &,const CC &,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(a,b,c);
+		assignsArgs = args->assigning;
+		setArgumentKeys(args->keys);
+		return *this;
+	}
+	TCall<void,A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
+		previousCalls.push_back(&call);
+		return *this;
+	}
+	template <typename T>
+	TCall<void,A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor.set<DoWrapper<T,void,A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<void,A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor.set<DoWrapper<T,bool,A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<void,A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Capture(T &container) { capture.set<DoWrapper<Capturer<T>,void,A,B,C,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(Capturer<T>(container)); return *this; }
+#ifndef HM_NO_EXCEPTIONS
+	template <typename Ex>
+	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
+#endif
+};
+
+template <typename Y,
+		  typename A, typename B>
+class TCall<Y,A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
+private:
+	ref_comparable_assignable_tuple<A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
+public:
+		const base_tuple *getArgs() const { return args; }
+	size_t objectSize() const { return sizeof(*this); }
+	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
+	~TCall() { delete args; }
+	bool matchesArgs(const base_tuple &tupl) {
+		return (!args && !matchFunctor.isSet()) ||
+			(args && (*args == reinterpret_cast<const ref_tuple<A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
+			(matchFunctor.isSet() && invokeMatchFunctor(tupl));
+	}
+	void assignArgs(base_tuple &tupl) {
+		if(args) {
+			args->assign_to(static_cast<ref_tuple<A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+			args->assign_from(static_cast<ref_tuple<A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+		}
+	}
+	template <typename CA, typename CB>
+	TCall<Y,A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b) {
+		args = new copy_tuple<A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
+								const CA &,const CB &,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(a,b);
+		assignsArgs = args->assigning;
+		setArgumentKeys(args->keys);
+		return *this;
+	}
+	TCall<Y,A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
+		previousCalls.push_back(&call);
+		return *this;
+	}
+	template <typename T>
+	TCall<Y,A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor.set<DoWrapper<T,Y,A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<Y,A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor.set<DoWrapper<T,bool,A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<Y,A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Dispatch(T &table) { matchFunctor.set<TableMatch<T,A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(&table); functor.set<TableResult<T,Y> >(&table); return *this; }
+	template <typename T>
+	TCall<Y,A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Capture(T &container) { capture.set<DoWrapper<Capturer<T>,void,A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(Capturer<T>(container)); return *this; }
+	Call &Return(Y obj) { retVal = new ReturnValueWrapperCopy<Y>(HM_FORWARD(Y, obj)); limitUncopyable<Y>(); return *this; }
+	Call &ReturnByRef(Y obj) { retVal = new ReturnValueWrapperRef<Y>(obj); return *this; }
+#if __cplusplus > 199711L
+	Call &ReturnMove(Y obj) { retVal = new ReturnValueWrapperMove<Y>(std::forward<Y>(obj)); return *this; }
+	Call &ReturnOnce(Y obj) { limitCalls(1); return ReturnMove(std::forward<Y>(obj)); }
+#endif
+	template <typename It>
+	Call &ReturnSequence(It begin, It end) { if (begin == end) RAISEEXCEPTION(EmptySequenceException(funcName)); ReturnValueWrapperSequence<Y> *values = new ReturnValueWrapperSequence<Y>(begin, end); retVal = values; limitCalls(values->size()); return *this; }
+	template <typename It>
+	Call &ReturnCycle(It begin, It end) { if (begin == end) RAISEEXCEPTION(EmptyCycleException(funcName)); retVal = new ReturnValueWrapperSequence<Y>(begin, end); return *this; }
+	template <typename T>
+	Call &ReturnGenerator(T generator) { retVal = new ReturnValueWrapperGenerator<Y, T>(generator); return *this; }
+#ifndef HM_NO_EXCEPTIONS
+	template <typename Ex>
+	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
+#endif
+};
+template <typename A, typename B>
+class TCall<void,A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
+private:
+	ref_comparable_assignable_tuple<A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
+public:
+		const base_tuple *getArgs() const { return args; }
+	size_t objectSize() const { return sizeof(*this); }
+	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
+	~TCall() { delete args; }
+	bool matchesArgs(const base_tuple &tupl) {
+		return (!args && !matchFunctor.isSet()) ||
+			(args && (*args == reinterpret_cast<const ref_tuple<A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
+			(matchFunctor.isSet() && invokeMatchFunctor(tupl));
+	}
+	void assignArgs(base_tuple &tupl) {
+		if(args) {
+			args->assign_to(static_cast<ref_tuple<A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+			args->assign_from(static_cast<ref_tuple<A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+		}
+	}
+	template <typename CA, typename CB>
+	TCall<void,A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a, const CB & b) {
+		args = new copy_tuple<A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
+								const CA &,const CB &,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(a,b);
+		assignsArgs = args->assigning;
+		setArgumentKeys(args->keys);
+		return *this;
+	}
+	TCall<void,A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
+		previousCalls.push_back(&call);
+		return *this;
+	}
+	template <typename T>
+	TCall<void,A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor.set<DoWrapper<T,void,A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<void,A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor.set<DoWrapper<T,bool,A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<void,A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Capture(T &container) { capture.set<DoWrapper<Capturer<T>,void,A,B,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(Capturer<T>(container)); return *this; }
+#ifndef HM_NO_EXCEPTIONS
+	template <typename Ex>
+	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
+#endif
+};
+
+template <typename Y,
+		  typename A>
+class TCall<Y,A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
+private:
+	ref_comparable_assignable_tuple<A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
+public:
+		const base_tuple *getArgs() const { return args; }
+	size_t objectSize() const { return sizeof(*this); }
+	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
+	~TCall() { delete args; }
+	bool matchesArgs(const base_tuple &tupl) {
+		return (!args && !matchFunctor.isSet()) ||
+			(args && (*args == reinterpret_cast<const ref_tuple<A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
+			(matchFunctor.isSet() && invokeMatchFunctor(tupl));
+	}
+	void assignArgs(base_tuple &tupl) {
+		if(args) {
+			args->assign_to(static_cast<ref_tuple<A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+			args->assign_from(static_cast<ref_tuple<A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
+		}
+	}
+	template <typename CA>
+	TCall<Y,A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA & a) {
+		args = new copy_tuple<A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
+								const CA &,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(a);
+		assignsArgs = args->assigning;
+		setArgumentKeys(args->keys);
+		return *this;
+	}
+	TCall<Y,A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
+		previousCalls.push_back(&call);
+		return *this;
+	}
+	template <typename T>
+	TCall<Y,A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor.set<DoWrapper<T,Y,A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<Y,A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor.set<DoWrapper<T,bool,A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<Y,A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Dispatch(T &table) { matchFunctor.set<TableMatch<T,A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(&table); functor.set<TableResult<T,Y> >(&table); return *this; }
+	template <typename T>
+	TCall<Y,A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Capture(T &container) { capture.set<DoWrapper<Capturer<T>,void,A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(Capturer<T>(container)); return *this; }
+	Call &Return(Y obj) { retVal = new ReturnValueWrapperCopy<Y>(HM_FORWARD(Y, obj)); limitUncopyable<Y>(); return *this; }
+	Call &ReturnByRef(Y obj) { retVal = new ReturnValueWrapperRef<Y>(obj); return *this; }
+#if __cplusplus > 199711L
+	Call &ReturnMove(Y obj) { retVal = new ReturnValueWrapperMove<Y>(std::forward<Y>(obj)); return *this; }
+	Call &ReturnOnce(Y obj) { limitCalls(1); return ReturnMove(std::forward<Y>(obj)); }
+#endif
+	template <typename It>
+	Call &ReturnSequence(It begin, It end) { if (begin == end) RAISEEXCEPTION(EmptySequenceException(funcName)); ReturnValueWrapperSequence<Y> *values = new ReturnValueWrapperSequence<Y>(begin, end); retVal = values; limitCalls(values->size()); return *this; }
+	template <typename It>
+	Call &ReturnCycle(It begin, It end) { if (begin == end) RAISEEXCEPTION(EmptyCycleException(funcName)); retVal = new ReturnValueWrapperSequence<Y>(begin, end); return *this; }
+	template <typename T>
+	Call &ReturnGenerator(T generator) { retVal = new ReturnValueWrapperGenerator<Y, T>(generator); return *this; }
+#ifndef HM_NO_EXCEPTIONS
+	template <typename Ex>
+	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
+#endif
+};
+template <typename A>
+class TCall<void,A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> : public Call {
+private:
+	ref_comparable_assignable_tuple<A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
+public:
+		const base_tuple *getArgs() const { return args; }
+	size_t objectSize() const { return sizeof(*this); }
+	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file), args(0) {}
+	~TCall() { delete args; }
+	bool matchesArgs(const base_tuple &tupl) {
+		return (!args && !matchFunctor.isSet()) ||
+			(args && (*args == reinterpret_cast<const ref_tuple<A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl))) ||
+			(matchFunctor.isSet() && invokeMatchFunctor(tupl));
+	}
+	void assignArgs(base_tuple &tupl) {
+		if(args) {
 			args->assign_to(static_cast<ref_tuple<A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
 			args->assign_from(static_cast<ref_tuple<A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &>(tupl));
 		}
@@ -3164,7 +7674,9 @@ public:
 	template <typename CA>
 	TCall<void,A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &With(const CA &a) {
 		args = new copy_tuple<A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
-								const CA &,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(a,NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType());
+								const CA &,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(a);
+		assignsArgs = args->assigning;
+		setArgumentKeys(args->keys);
 		return *this;
 	}
 	TCall<void,A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &After(Call &call) {
@@ -3172,9 +7684,11 @@ public:
 		return *this;
 	}
 	template <typename T>
-	TCall<void,A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor = new DoWrapper<T,void,A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
+	TCall<void,A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor.set<DoWrapper<T,void,A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
 	template <typename T>
-	TCall<void,A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor = new DoWrapper<T,bool,A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
+	TCall<void,A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Match(T function) { matchFunctor.set<DoWrapper<T,bool,A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	template <typename T>
+	TCall<void,A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Capture(T &container) { capture.set<DoWrapper<Capturer<T>,void,A,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(Capturer<T>(container)); return *this; }
 #ifndef HM_NO_EXCEPTIONS
 	template <typename Ex>
 	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
@@ -3187,10 +7701,11 @@ private:
 	ref_comparable_assignable_tuple<NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
 public:
 		const base_tuple *getArgs() const { return args; }
+	size_t objectSize() const { return sizeof(*this); }
 	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file) {
 		args = new copy_tuple<NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
 								NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>
-								(NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType());
+								();
 	}
 	~TCall() { delete args; }
 	bool matchesArgs(const base_tuple &) { return true; }
@@ -3200,9 +7715,19 @@ public:
 		return *this;
 	}
 	template <typename T>
-	TCall<Y,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor = new DoWrapper<T,Y,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
-	Call &Return(Y obj) { retVal = new ReturnValueWrapperCopy<Y>(obj); return *this; }
+	TCall<Y,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor.set<DoWrapper<T,Y,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
+	Call &Return(Y obj) { retVal = new ReturnValueWrapperCopy<Y>(HM_FORWARD(Y, obj)); limitUncopyable<Y>(); return *this; }
 	Call &ReturnByRef(Y obj) { retVal = new ReturnValueWrapperRef<Y>(obj); return *this; }
+#if __cplusplus > 199711L
+	Call &ReturnMove(Y obj) { retVal = new ReturnValueWrapperMove<Y>(std::forward<Y>(obj)); return *this; }
+	Call &ReturnOnce(Y obj) { limitCalls(1); return ReturnMove(std::forward<Y>(obj)); }
+#endif
+	template <typename It>
+	Call &ReturnSequence(It begin, It end) { if (begin == end) RAISEEXCEPTION(EmptySequenceException(funcName)); ReturnValueWrapperSequence<Y> *values = new ReturnValueWrapperSequence<Y>(begin, end); retVal = values; limitCalls(values->size()); return *this; }
+	template <typename It>
+	Call &ReturnCycle(It begin, It end) { if (begin == end) RAISEEXCEPTION(EmptyCycleException(funcName)); retVal = new ReturnValueWrapperSequence<Y>(begin, end); return *this; }
+	template <typename T>
+	Call &ReturnGenerator(T generator) { retVal = new ReturnValueWrapperGenerator<Y, T>(generator); return *this; }
 #ifndef HM_NO_EXCEPTIONS
 	template <typename Ex>
 	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
@@ -3214,10 +7739,11 @@ private:
 	ref_comparable_assignable_tuple<NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> *args;
 public:
 		const base_tuple *getArgs() const { return args; }
+	size_t objectSize() const { return sizeof(*this); }
 	TCall(RegistrationType expect, base_mock *baseMock, std::pair<int, int> index, int X, const char *func, const char *file) : Call(expect, baseMock, index, X, func ,file) {
 		args = new copy_tuple<NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,
 							NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>
-							(NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType(),NullType());
+							();
 	}
 	~TCall() { delete args; }
 	bool matchesArgs(const base_tuple &) { return true; }
@@ -3227,74 +7753,364 @@ public:
 		return *this;
 	}
 	template <typename T>
-	TCall<void,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor = new DoWrapper<T,void,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType>(function); return *this; }
+	TCall<void,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> &Do(T function) { functor.set<DoWrapper<T,void,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType,NullType> >(function); return *this; }
 #ifndef HM_NO_EXCEPTIONS
 	template <typename Ex>
 	Call &Throw(Ex exception) { eHolder = new ExceptionWrapper<Ex>(exception); return *this; }
 #endif
 };
 
-inline
-bool satisfied( std::list<Call *> const& previousCalls )
+HM_INLINE
+bool satisfied( CallList const& previousCalls );
+
+#if __cplusplus > 199711L
+// Record and replay. RecordCall(obj, func, real, recording) forwards the calls on a mocked function to
+// a real object and appends what it returns to a CallRecording file. ReplayCall(obj, func, replay)
+// serves those results back in the same order from a CallReplay, without the real object. A replayed function bypasses the expectations entirely: each call only checks that the
+// next entry in the file is for that function and returns its value, so replaying a long recording
+// is as cheap as replaying a short one. Each function replays from the CallReplay it was registered
+// with, and a function that is replayed on a mock cannot also have expectations on that mock.
+//
+// The file holds "HMREPLY1" followed by entries of int32 baseOffset, int32 funcIndex, uint32 length
+// and the result, in native byte order. Results are stored through replay_value<T>, which handles
+// trivially copyable types and std::string; specialize it for other return types.
+//
+// A CallReplay reads the whole file into memory. Define HM_REPLAY_MMAP to map it instead on POSIX
+// systems, which saves the copy for very large recordings but pulls the POSIX headers in.
+template <typename T>
+struct replay_value
 {
-   for (std::list<Call *>::const_iterator callsBefore = previousCalls.begin();
-	  callsBefore != previousCalls.end(); ++callsBefore)
-   {
-	  if (!(*callsBefore)->satisfied)
-	  {
-		 return false;
-	  }
-   }
-   return true;
-}
+	static_assert(std::is_trivially_copyable<T>::value, "Specialize HippoMocks::replay_value to record this return type");
+	static void write(std::string &out, const T &value)
+	{
+		out.append(reinterpret_cast<const char *>(&value), sizeof(T));
+	}
+	static T read(const char *data, size_t)
+	{
+		T value;
+		memcpy(&value, data, sizeof(T));
+		return value;
+	}
+};
 
+template <typename T>
+struct replay_value<T &>
+{
+	static_assert(sizeof(T) == 0, "References cannot be recorded; return a value instead");
+};
 
-class MockRepository {
+template <>
+struct replay_value<std::string>
+{
+	static void write(std::string &out, const std::string &value) { out += value; }
+	static std::string read(const char *data, size_t length) { return std::string(data, length); }
+};
+
+template <>
+struct replay_value<void>
+{
+	static void read(const char *, size_t) {}
+};
+
+class CallRecording
+{
+public:
+	CallRecording(const char *fileName);
+	~CallRecording();
+	void append(std::pair<int, int> funcIndex, const std::string &value);
 private:
-	friend inline std::ostream &operator<<(std::ostream &os, const MockRepository &repo);
-	std::list<base_mock *> mocks;
-	std::map<void (*)(), int> staticFuncMap;
-#ifdef _HIPPOMOCKS__ENABLE_CFUNC_MOCKING_SUPPORT
-	std::list<Replace *> staticReplaces;
-#endif
+	CallRecording(const CallRecording &);
+	CallRecording &operator=(const CallRecording &);
+	FILE *file;
+};
 
-	std::list<Call *> neverCalls;
-	std::list<Call *> expectations;
-	std::list<Call *> optionals;
+class CallReplay
+{
 public:
-	bool autoExpect;
+	CallReplay(const char *fileName);
+	~CallReplay();
+	// Takes the next entry if it is one for funcIndex.
+	bool next(std::pair<int, int> funcIndex, const char *&value, size_t &length)
+	{
+		int entryIndex[2];
+		unsigned int entryLength;
+		if ((size_t)(end - cursor) < sizeof(entryIndex) + sizeof(entryLength))
+			return false;
+		memcpy(entryIndex, cursor, sizeof(entryIndex));
+		memcpy(&entryLength, cursor + sizeof(entryIndex), sizeof(entryLength));
+		const char *entry = cursor + sizeof(entryIndex) + sizeof(entryLength);
+		if (entryIndex[0] != funcIndex.first || entryIndex[1] != funcIndex.second ||
+			(size_t)(end - entry) < entryLength)
+			return false;
+		value = entry;
+		length = entryLength;
+		cursor = entry + entryLength;
+		return true;
+	}
+	// True when every recorded call has been replayed.
+	bool Finished() const { return cursor == end; }
 private:
+	CallReplay(const CallReplay &);
+	CallReplay &operator=(const CallReplay &);
+	void release();
+	const char *data;
+	const char *cursor;
+	const char *end;
+	size_t size;
+};
 
-	void addAutoExpectTo( Call* call )
+template <typename Y, typename R, typename Z, typename... Args>
+class RecordingForwarder
+{
+public:
+	RecordingForwarder(R *real, Y (Z::*func)(Args...), CallRecording &recording, std::pair<int, int> funcIndex)
+		: real(real), func(func), recording(&recording), funcIndex(funcIndex)
 	{
-		 if (autoExpect && expectations.size() > 0)
-		 {
-			call->previousCalls.push_back(expectations.back());
-		 }
 	}
+	Y operator()(Args... args)
+	{
+		Y result = (real->*func)(std::forward<Args>(args)...);
+		std::string value;
+		replay_value<Y>::write(value, result);
+		recording->append(funcIndex, value);
+		return result;
+	}
+private:
+	R *real;
+	Y (Z::*func)(Args...);
+	CallRecording *recording;
+	std::pair<int, int> funcIndex;
+};
 
+template <typename R, typename Z, typename... Args>
+class RecordingForwarder<void, R, Z, Args...>
+{
+public:
+	RecordingForwarder(R *real, void (Z::*func)(Args...), CallRecording &recording, std::pair<int, int> funcIndex)
+		: real(real), func(func), recording(&recording), funcIndex(funcIndex)
+	{
+	}
+	void operator()(Args... args)
+	{
+		(real->*func)(std::forward<Args>(args)...);
+		recording->append(funcIndex, std::string());
+	}
+private:
+	R *real;
+	void (Z::*func)(Args...);
+	CallRecording *recording;
+	std::pair<int, int> funcIndex;
+};
 
-	void addCall( Call* call, RegistrationType expect )
+// FakeCall(obj, func) is for using a mock as a stand-in in throughput tests of other code. The call
+// goes straight from the vtable to the fake, which returns its Return() value or calls its Do()
+// functor. There is no argument matching, no counting and no ordering, so nothing about these
+// calls can be verified; the function only does what it is told. A fake replaces whatever else was
+// registered for that function on that mock, and belongs to the mock until it is reset.
+template <typename Y, typename... Args>
+class TFake : public VirtualDestructable
+{
+	static_assert(!std::is_reference<Y>::value, "Fakes return by value; use OnCall for functions returning references");
+public:
+	size_t objectSize() const { return sizeof(*this); }
+	TFake() : result() {}
+	TFake &Return(Y value) { result = value; return *this; }
+	template <typename T>
+	TFake &Do(T function) { functor = function; return *this; }
+	Y invoke(Args... args)
 	{
-	   if( expect == Never ) {
-		  addAutoExpectTo( call );
-		  neverCalls.push_back(call);
-		}
-		else if( expect.minimum == expect.maximum )
+		if (functor)
+			return functor(std::forward<Args>(args)...);
+		return result;
+	}
+private:
+	Y result;
+	std::function<Y(Args...)> functor;
+};
+
+template <typename... Args>
+class TFake<void, Args...> : public VirtualDestructable
+{
+public:
+	size_t objectSize() const { return sizeof(*this); }
+	template <typename T>
+	TFake &Do(T function) { functor = function; return *this; }
+	void invoke(Args... args)
+	{
+		if (functor)
+			functor(std::forward<Args>(args)...);
+	}
+private:
+	std::function<void(Args...)> functor;
+};
+#endif
+
+
+class MockRepository {
+private:
+	friend std::ostream &operator<<(std::ostream &os, const MockRepository &repo);
+#ifdef HM_MEMORY_RESOURCE
+	// Comes first, as the members after it give their memory back to it when they are destroyed.
+	MemoryResourceAllocator resourceAllocator;
+#endif
+
+	typedef std::vector<base_mock *, MockStlAllocator<base_mock *> > MockList;
+	MockList mocks;
+	typedef void (*StaticFunc)();
+	std::map<StaticFunc, int, std::less<StaticFunc>, MockStlAllocator<std::pair<const StaticFunc, int> > > staticFuncMap;
+#ifdef _HIPPOMOCKS__ENABLE_CFUNC_MOCKING_SUPPORT
+	typedef std::vector<Replace *, MockStlAllocator<Replace *> > ReplaceList;
+	ReplaceList staticReplaces;
+#endif
+
+	CallList neverCalls;
+	CallList expectations;
+	CallList optionals;
+public:
+	bool autoExpect;
+	bool indexArguments;
+	size_t nearestCandidates;
+	bool poolMocks;
+private:
+	// The optionals of one mocked function for indexArguments, in registration order: those that
+	// can be looked up by the hash of their With() arguments, and the rest, which are scanned.
+	// Each is numbered with its place in optionals, so that the last registered match still wins.
+	typedef std::pair<size_t, Call *> IndexedCall;
+	typedef std::vector<IndexedCall, MockStlAllocator<IndexedCall> > IndexedCalls;
+#if __cplusplus > 199711L
+	typedef std::unordered_map<size_t, IndexedCalls, std::hash<size_t>, std::equal_to<size_t>,
+	                           MockStlAllocator<std::pair<const size_t, IndexedCalls> > > KeyedCalls;
+#else
+	typedef std::map<size_t, IndexedCalls, std::less<size_t>, MockStlAllocator<std::pair<const size_t, IndexedCalls> > > KeyedCalls;
+#endif
+	struct ArgumentIndex {
+		ArgumentIndex() : hasher(0) {}
+		KeyedCalls keyed;
+		IndexedCalls wildcards;
+		size_t (*hasher)(const base_tuple &);
+	};
+	typedef std::pair<base_mock *, std::pair<int, int> > IndexedFunction;
+	typedef std::map<IndexedFunction, ArgumentIndex, std::less<IndexedFunction>,
+	                 MockStlAllocator<std::pair<const IndexedFunction, ArgumentIndex> > > ArgumentIndexes;
+	// Calls are indexed on the first dispatch after they are registered, once With() has been
+	// applied to them.
+	ArgumentIndexes argumentIndex;
+	size_t optionalCount;
+	size_t indexedCount;
+	// The number of Calls with a Fingerprint in their With() values, and their hashes.
+	size_t fingerprintCalls;
+	FingerprintCache fingerprintCache;
+	friend class Call;
+	void updateArgumentIndex();
+	Call *findOptional(base_mock *mock, std::pair<int, int> funcno, const base_tuple &tuple);
+
+	// A registration ranked by how near it is to a call that matched none; see nearestCandidates.
+	struct Candidate {
+		unsigned distance;  // 0 on the called function, 1 elsewhere on the same mock, 2 elsewhere
+		unsigned matching;  // arguments equal to the call's, or all of them without With()
+		size_t order;
+		const Call *call;
+		bool operator<(const Candidate &other) const
 		{
-		   addAutoExpectTo( call );
-		   expectations.push_back(call);
+			if (distance != other.distance)
+				return distance < other.distance;
+			if (matching != other.matching)
+				return matching > other.matching;
+			return order < other.order;
 		}
-		else
-		{
-		   optionals.push_back(call);
-	   }
-	}
+	};
+	friend class ExpectationException;
+	void printNearest(std::ostream &os, base_mock *mock, std::pair<int, int> funcno, const base_tuple *actual) const;
+
+	void addAutoExpectTo( Call* call );
+	void addCall( Call* call, RegistrationType expect );
+	// The number of expectations that are not satisfied yet, in total and for each mock, so that
+	// VerifyAll and VerifyPartial only look through the expectations when one of them is missing.
+	size_t unsatisfied;
+	typedef std::map<base_mock *, size_t, std::less<base_mock *>, MockStlAllocator<std::pair<base_mock * const, size_t> > > UnsatisfiedCounts;
+	UnsatisfiedCounts unsatisfiedByMock;
+	void setSatisfied( Call *call, bool satisfied );
 
 #ifndef HM_NO_EXCEPTIONS
 	ExceptionHolder *latentException;
 #endif
+#ifdef HM_MOCK_ALLOCATOR
+	// Where the repository allocates from, or null for the heap.
+	MockAllocator *allocator;
+#endif
+#ifdef HM_DISPATCH_HOOKS
+	// Tracks one dispatch for the statistics and the call trace, and adds its counters to the
+	// repository, the mock and the Call that handled it when it ends. Dispatches may nest through
+	// Do() functors; the time of a nested dispatch is taken off the one around it. The end may run
+	// while an exception unwinds, so the mock's counters are looked up at the start, and calls that
+	// match nothing are traced before the exception is raised.
+	class DispatchScope {
+	public:
+		DispatchScope(MockRepository *repo, base_mock *mock, std::pair<int, int> funcno, const base_tuple &tuple);
+		~DispatchScope();
+		void setCall(Call *call);
+		MockRepository *repo;
+		base_mock *mock;
+		std::pair<int, int> funcno;
+		const base_tuple &tuple;
+		Call *call;
+		DispatchScope *outer;
+		unsigned long long start;
+#ifdef HM_DISPATCH_STATS
+		DispatchStats stats;
+		DispatchStats *mockStats;
+		unsigned long long nestedNanoseconds;
+#endif
+#ifdef HM_CALL_TRACE
+		unsigned long long sequence;
+		bool traced;
+#endif
+	private:
+		DispatchScope(const DispatchScope &);
+		DispatchScope &operator=(const DispatchScope &);
+	};
+	friend class DispatchScope;
+	DispatchScope *currentDispatch;
+#endif
+#ifdef HM_DISPATCH_STATS
+	DispatchStats totalStats;
+	typedef std::map<const base_mock *, DispatchStats, std::less<const base_mock *>,
+	                 MockStlAllocator<std::pair<const base_mock * const, DispatchStats> > > MockStats;
+	MockStats mockStats;
+	void noteException(Call *call);
+#endif
+#ifdef HM_CALL_TRACE
+	CallTraceWriter *trace;
+	unsigned long long traceStart;
+	unsigned long long traceSequence;
+	typedef std::map<const base_mock *, unsigned, std::less<const base_mock *>,
+	                 MockStlAllocator<std::pair<const base_mock * const, unsigned> > > MockIds;
+	MockIds mockIds;
+	unsigned lastCallId;
+	void traceDispatch(DispatchScope &scope);
+#endif
 public:
+#ifdef HM_DISPATCH_STATS
+	const DispatchStats &Statistics() const { return totalStats; }
+	template <typename T>
+	DispatchStats Statistics(T *mck) const
+	{
+		MockStats::const_iterator it = mockStats.find(reinterpret_cast<const base_mock *>(mck));
+		return it == mockStats.end() ? DispatchStats() : it->second;
+	}
+	static const DispatchStats &Statistics(const Call &call) { return call.stats; }
+	void DumpStatistics(std::ostream &os) const;
+	void ResetStatistics();
+#endif
+#ifdef HM_CALL_TRACE
+	bool StartTrace(const char *fileName);
+	void StopTrace();
+#endif
+	// The memory held for the mocks and registrations of this repository, in total and per mock
+	// type. Registrations on C functions are listed as "C functions".
+	MemoryUsage memoryUsage() const;
+	std::map<std::string, MemoryUsage> memoryUsageByType() const;
+	void DumpMemoryUsage(std::ostream &os) const;
 #ifndef HM_NO_EXCEPTIONS
 	void SetLatentException(ExceptionHolder *holder)
 	{
@@ -3321,6 +8137,12 @@ public:
 #define OnCallDestructor(obj) RegisterExpectDestructor<__COUNTER__>(obj, HM_NS Any, __FILE__, __LINE__)
 #define ExpectCallDestructor(obj) RegisterExpectDestructor<__COUNTER__>(obj, HM_NS Once, __FILE__, __LINE__)
 #define NeverCallDestructor(obj) RegisterExpectDestructor<__COUNTER__>(obj, HM_NS Never, __FILE__, __LINE__)
+#if __cplusplus > 199711L
+#define RecordCall(obj, func, real, recording) RegisterRecord_<__COUNTER__>(obj, &func, real, recording, #func, __FILE__, __LINE__)
+#define ReplayCall(obj, func, replay) RegisterReplay_<__COUNTER__>(obj, &func, replay, #func)
+#define StubCall(obj, func) RegisterStub_<__COUNTER__>(obj, &func)
+#define FakeCall(obj, func) RegisterFake_<__COUNTER__>(obj, &func)
+#endif
 #else
 #ifdef _HIPPOMOCKS__ENABLE_CFUNC_MOCKING_SUPPORT
 #define OnCallFunc(func) RegisterExpect_<__LINE__>(&func, HM_NS Any, #func, __FILE__, __LINE__)
@@ -3341,6 +8163,12 @@ public:
 #define OnCallDestructor(obj) RegisterExpectDestructor<__LINE__>(obj, HM_NS Any, __FILE__, __LINE__)
 #define ExpectCallDestructor(obj) RegisterExpectDestructor<__LINE__>(obj, HM_NS Once, __FILE__, __LINE__)
 #define NeverCallDestructor(obj) RegisterExpectDestructor<__LINE__>(obj, HM_NS Never, __FILE__, __LINE__)
+#if __cplusplus > 199711L
+#define RecordCall(obj, func, real, recording) RegisterRecord_<__LINE__>(obj, &func, real, recording, #func, __FILE__, __LINE__)
+#define ReplayCall(obj, func, replay) RegisterReplay_<__LINE__>(obj, &func, replay, #func)
+#define StubCall(obj, func) RegisterStub_<__LINE__>(obj, &func)
+#define FakeCall(obj, func) RegisterFake_<__LINE__>(obj, &func)
+#endif
 #endif
 	template <typename A, class B, typename C>
 	void Member(A *mck, C B::*member)
@@ -3353,6 +8181,25 @@ public:
   template <int X, typename Z2>
 	TCall<void> &RegisterExpectDestructor(Z2 *mck, RegistrationType expect, const char *fileName, unsigned long lineNo);
 
+#if __cplusplus > 199711L
+	template <int X, typename Z2, typename Y, typename Z, typename R, typename... Args>
+	TCall<Y,Args...> &RegisterRecord_(Z2 *mck, Y (Z::*func)(Args...), R *real, CallRecording &recording, const char *functionName, const char *fileName, unsigned long lineNo);
+	template <int X, typename Z2, typename Y, typename Z, typename R, typename... Args>
+	TCall<Y,Args...> &RegisterRecord_(Z2 *mck, Y (Z::*func)(Args...) const, R *real, CallRecording &recording, const char *functionName, const char *fileName, unsigned long lineNo) { return RegisterRecord_<X>(mck, (Y(Z::*)(Args...))(func), real, recording, functionName, fileName, lineNo); }
+	template <int X, typename Z2, typename Y, typename Z, typename... Args>
+	void RegisterReplay_(Z2 *mck, Y (Z::*func)(Args...), CallReplay &replay, const char *functionName);
+	template <int X, typename Z2, typename Y, typename Z, typename... Args>
+	void RegisterReplay_(Z2 *mck, Y (Z::*func)(Args...) const, CallReplay &replay, const char *functionName) { RegisterReplay_<X>(mck, (Y(Z::*)(Args...))(func), replay, functionName); }
+	template <int X, typename Z2, typename Y, typename Z, typename... Args>
+	void RegisterStub_(Z2 *mck, Y (Z::*func)(Args...));
+	template <int X, typename Z2, typename Y, typename Z, typename... Args>
+	void RegisterStub_(Z2 *mck, Y (Z::*func)(Args...) const) { RegisterStub_<X>(mck, (Y(Z::*)(Args...))(func)); }
+	template <int X, typename Z2, typename Y, typename Z, typename... Args>
+	TFake<Y,Args...> &RegisterFake_(Z2 *mck, Y (Z::*func)(Args...));
+	template <int X, typename Z2, typename Y, typename Z, typename... Args>
+	TFake<Y,Args...> &RegisterFake_(Z2 *mck, Y (Z::*func)(Args...) const) { return RegisterFake_<X>(mck, (Y(Z::*)(Args...))(func)); }
+#endif
+
 #ifdef _HIPPOMOCKS__ENABLE_CFUNC_MOCKING_SUPPORT
 	template <int X, typename Y>
 	TCall<Y> &RegisterExpect_(Y (*func)(), RegistrationType expect, const char *functionName, const char *fileName, unsigned long lineNo);
@@ -4110,69 +8957,37 @@ public:
 	template <typename Z>
 	void BasicRegisterExpect(mock<Z> *zMock, int baseOffset, int funcIndex, void (base_mock::*func)(), int X);
 #ifdef _HIPPOMOCKS__ENABLE_CFUNC_MOCKING_SUPPORT
-  int BasicStaticRegisterExpect(void (*func)(), void (*fp)(), int X)
-  {
-	if (staticFuncMap.find(func) == staticFuncMap.end())
-	{
-	  staticFuncMap[func] = X;
-	  staticReplaces.push_front(new Replace(func, fp));
-	}
-	return staticFuncMap[func];
-  }
+  int BasicStaticRegisterExpect(void (*func)(), void (*fp)(), int X);
 #endif
 
-  void doCall( Call* call, const base_tuple &tuple )
-  {
-	  ++call->called;
-
-	  call->satisfied = call->called >= call->expectation.minimum;
-
-	  call->assignArgs(const_cast<base_tuple &>(tuple));
-	  #ifndef HM_NO_EXCEPTIONS
-	  if (call->eHolder)
-		 call->eHolder->rethrow();
-	  #endif
-  }
-
-  void doVoidFunctor( Call* call, const base_tuple &tuple )
-  {
-	  if (call->functor != NULL)
-		 (*(TupleInvocable<void> *)(call->functor))(tuple);
-  }
+  void doCall( Call* call, const base_tuple &tuple );
+  void doVoidFunctor( Call* call, const base_tuple &tuple );
 
   template<typename Z>
   Z doReturnFunctor( Call* call, const base_tuple &tuple )
   {
-	  if (call->functor != NULL)
+	  if (call->functor.isSet())
 	  {
 			if(call->retVal == NULL)
 			{
-			   return (*(TupleInvocable<Z> *)(call->functor))(tuple);
+			   return call->functor.invoke<Z>(tuple);
 			}
 			else
 			{
-			   (*(TupleInvocable<Z> *)(call->functor))(tuple);
+			   call->functor.invoke<Z>(tuple);
 			}
 	  }
 
 	  if (call->retVal)
 			return ((ReturnValueWrapper<Z> *)call->retVal)->value();
 
+#ifdef HM_DISPATCH_STATS
+	  noteException(call);
+#endif
 	  RAISEEXCEPTION(NoResultSetUpException(this, call->getArgs(), call->funcName));
   }
 
-  void doVoidCall( Call* call, const base_tuple &tuple, bool const makeLatent )
-  {
-	 if( call->called < call->expectation.maximum )
-	 {
-		 doCall( call, tuple );
-		 doVoidFunctor( call, tuple );
-	 }
-	 else
-	 {
-		 doThrow( call, makeLatent );
-	 }
-  }
+  void doVoidCall( Call* call, const base_tuple &tuple, bool const makeLatent );
 
   template<typename Z>
   Z doReturnCall( Call* call, const base_tuple &tuple )
@@ -4182,238 +8997,156 @@ public:
 		 doCall( call, tuple );
 		 return doReturnFunctor<Z>( call, tuple );
 	 }
-	  RAISEEXCEPTION(ExpectationException(this, call->getArgs(), call->funcName));
-  }
-
-
-  void doThrow( Call * call, bool const makeLatent )
-  {
-	  call->satisfied = true;
-
-	  if (makeLatent)
-	  {
-	  #ifndef HM_NO_EXCEPTIONS
-		 if (latentException)
-			return;
-	  #endif
-		 RAISELATENTEXCEPTION(ExpectationException(this, call->getArgs(), call->funcName));
-	  }
-	  else
-	  {
-		 RAISEEXCEPTION(ExpectationException(this, call->getArgs(), call->funcName));
-	  }
-  }
-
-  const char *funcName( base_mock *mock, std::pair<int, int> funcno )
-  {
-	  const char *name = NULL;
-	  for (std::list<Call *>::iterator i = expectations.begin(); i != expectations.end() && !name; ++i)
-	  {
-		 Call *call = *i;
-		 if (call->mock == mock &&
-			   call->funcIndex == funcno)
-		 name = call->funcName;
-	  }
-	  for (std::list<Call *>::iterator i = optionals.begin(); i != optionals.end() && !name; ++i)
-	  {
-		 Call *call = *i;
-		 if (call->mock == mock &&
-			   call->funcIndex == funcno)
-		 name = call->funcName;
-	  }
-	  for (std::list<Call *>::iterator i = neverCalls.begin(); i != neverCalls.end() && !name; ++i)
-	  {
-		 Call *call = *i;
-		 if (call->mock == mock &&
-			   call->funcIndex == funcno)
-			   name = call->funcName;
-	  }
-	  return name;
+#ifdef HM_DISPATCH_STATS
+	  noteException(call);
+#endif
+	  RAISEEXCEPTION(ExpectationException(this, call->getArgs(), call->funcName, call->mock, call->funcIndex, &tuple));
   }
 
-  bool
-  matches( Call *call, base_mock *mock, std::pair<int, int> funcno, const base_tuple &tuple )
-  {
-   return call->mock == mock &&
-		  call->funcIndex == funcno &&
-		  call->matchesArgs(tuple) &&
-		  satisfied( call->previousCalls );
-
- }
-
-   bool
-   isUnsatisfied( Call *call, base_mock *mock, std::pair<int, int> funcno, const base_tuple &tuple )
-   {
-	  return ! call->satisfied && matches( call, mock, funcno, tuple );
-   }
+  void doThrow( Call * call, bool const makeLatent );
+  const char *funcName( base_mock *mock, std::pair<int, int> funcno );
+  bool matches( Call *call, base_mock *mock, std::pair<int, int> funcno, const base_tuple &tuple );
+  bool isUnsatisfied( Call *call, base_mock *mock, std::pair<int, int> funcno, const base_tuple &tuple );
 
 	template <typename Z>
 	Z DoExpectation(base_mock *mock, std::pair<int, int> funcno, const base_tuple &tuple);
 
-	void DoVoidExpectation(base_mock *mock, std::pair<int, int> funcno, const base_tuple &tuple, bool makeLatent = false)
-	{
-		for (std::list<Call *>::reverse_iterator i = neverCalls.rbegin(); i != neverCalls.rend(); ++i)
-		{
-			Call *call = *i;
-			if ( matches( call, mock, funcno, tuple ) )
-			{
-			   doThrow( call, makeLatent );
-			   return;
-			}
-		}
-	   for (std::list<Call *>::reverse_iterator i = expectations.rbegin(); i != expectations.rend(); ++i)
-		{
-			Call *call = *i;
-			if ( isUnsatisfied( call, mock, funcno, tuple ) )
-			{
-				doVoidCall( call, tuple, makeLatent );
-				return;
-			}
-		}
-		for (std::list<Call *>::reverse_iterator i = optionals.rbegin(); i != optionals.rend(); ++i)
-		{
-			Call *call = *i;
-			if ( matches( call, mock, funcno, tuple ) )
-			{
-			   doVoidCall( call, tuple, makeLatent );
-			   return;
-			}
-		}
-
-		if (makeLatent)
-		{
-#ifndef HM_NO_EXCEPTIONS
-			if (latentException)
-				return;
-#endif
-			RAISELATENTEXCEPTION(ExpectationException(this, &tuple, funcName(mock, funcno)));
-		}
-		else
-		{
-			RAISEEXCEPTION(ExpectationException(this, &tuple, funcName(mock, funcno)));
-		}
-	}
+	void DoVoidExpectation(base_mock *mock, std::pair<int, int> funcno, const base_tuple &tuple, bool makeLatent = false);
+	// Dispatches the destructor of mock like DoVoidExpectation, looking only at the Calls on mock.
+	void DoDestructorExpectation(base_mock *mock, std::pair<int, int> funcno);
+#ifdef HM_MOCK_ALLOCATOR
+	// Everything the repository allocates comes from allocator if one is given. Each repository
+	// installs its allocator for the thread whenever it registers, creates a mock or dispatches a
+	// call, so a Call should be set up before another repository on the thread is used.
+	explicit MockRepository(MockAllocator *allocator = 0)
+#else
 	MockRepository()
+#endif
 		: autoExpect(DEFAULT_AUTOEXPECT)
+		, indexArguments(DEFAULT_INDEXARGUMENTS)
+		, nearestCandidates(DEFAULT_NEARESTCANDIDATES)
+		, poolMocks(DEFAULT_POOLMOCKS)
+		, optionalCount(0)
+		, indexedCount(0)
+		, fingerprintCalls(0)
+		, unsatisfied(0)
 #ifndef HM_NO_EXCEPTIONS
 		, latentException(0)
+#endif
+#ifdef HM_MOCK_ALLOCATOR
+		, allocator(allocator)
+#endif
+#ifdef HM_DISPATCH_HOOKS
+		, currentDispatch(0)
+#endif
+#ifdef HM_CALL_TRACE
+		, trace(0)
+		, traceStart(0)
+		, traceSequence(0)
+		, lastCallId(0)
 #endif
 	{
 		MockRepoInstanceHolder<0>::instance = this;
+		useAllocator();
 	}
+#ifdef HM_MEMORY_RESOURCE
+	// Takes the resource by reference, so that MockRepository(0) still means the heap.
+	explicit MockRepository(std::pmr::memory_resource &resource)
+		: MockRepository(&resourceAllocator)
+	{
+		resourceAllocator = MemoryResourceAllocator(&resource);
+	}
+#endif
 	~MockRepository()
   // If we're on a recent enough compiler that's not VS2012 (as it doesn't have noexcept)
 #if __cplusplus > 199711L || (defined(_MSC_VER) && _MSC_VER > 1700)
 noexcept(false)
 #endif
-	{
-		MockRepoInstanceHolder<0>::instance = 0;
-#ifndef HM_NO_EXCEPTIONS
-		if (!HM_UNCAUGHT_EXCEPTION())
-		{
-			try
-			{
-#endif
-				VerifyAll();
-#ifndef HM_NO_EXCEPTIONS
-			}
-			catch(...)
-			{
-				delete latentException;
-				reset();
-				for (std::list<base_mock *>::iterator i = mocks.begin(); i != mocks.end(); i++)
-				{
-					(*i)->destroy();
-				}
-#ifdef _HIPPOMOCKS__ENABLE_CFUNC_MOCKING_SUPPORT
-				for (std::list<Replace *>::iterator i = staticReplaces.begin(); i != staticReplaces.end(); i++)
-				{
-					delete *i;
-				}
-#endif
-				throw;
-			}
-		}
-		if (latentException)
-		{
-			try
-			{
-				latentException->rethrow();
-			}
-			catch(BASE_EXCEPTION & e)
-			{
-				printf("Latent exception masked!\nException:\n%s\n", e.what());
-			}
-			delete latentException;
-		}
+	;
+	void reset();
+	void VerifyAll();
+	void VerifyPartial(base_mock *obj);
+	template <typename base>
+	base *Mock();
+#ifdef _HIPPOMOCKS__ENABLE_STUB_SUPPORT
+	template <typename base>
+	base *Stub();
 #endif
-		reset();
-		for (std::list<base_mock *>::iterator i = mocks.begin(); i != mocks.end(); i++)
-		{
-			(*i)->destroy();
-		}
-#ifdef _HIPPOMOCKS__ENABLE_CFUNC_MOCKING_SUPPORT
-		for (std::list<Replace *>::iterator i = staticReplaces.begin(); i != staticReplaces.end(); i++)
-		{
-			delete *i;
-		}
+	// Like Mock(), but builds the mock and its function table in storage, which must outlive the
+	// repository.
+	template <typename base>
+	base *MockAt(MockStorage<base> &storage);
+private:
+	template <typename base>
+	base *addMock(mock<base> *m);
+	// Whether HM_MEMORY_REPORT_ENV is set; looked up only the first time.
+	static bool memoryReportRequested();
+	// Makes the repository's allocator the one that everything allocated on this thread comes from.
+	void useAllocator()
+	{
+#ifdef HM_MOCK_ALLOCATOR
+		MockAllocatorHolder<0>::current = allocator;
 #endif
 	}
-	void reset()
+};
+
+#if __cplusplus > 199711L
+template <typename Z, typename Y>
+class replayFuncs : public mock<Z> {
+private:
+	replayFuncs();
+public:
+	template <int X, typename... Args>
+	Y replayed(Args... args)
 	{
-	   for (std::list<Call *>::iterator i = expectations.begin(); i != expectations.end(); i++)
-		{
-			delete *i;
-		}
-		expectations.clear();
-		for (std::list<Call *>::iterator i = neverCalls.begin(); i != neverCalls.end(); i++)
-		{
-			delete *i;
-		}
-		neverCalls.clear();
-		for (std::list<Call *>::iterator i = optionals.begin(); i != optionals.end(); i++)
-		{
-			delete *i;
-		}
-		optionals.clear();
-		for (std::list<base_mock *>::iterator i = mocks.begin(); i != mocks.end(); i++)
+		mock<Z> *realMock = mock<Z>::getRealThis();
+		if (realMock->isZombie)
+			RAISEEXCEPTION(ZombieMockException(realMock->repo));
+		std::pair<int, int> funcIndex = realMock->translateX(X);
+		typename mock<Z>::ReplaySlot &slot = realMock->replays[funcIndex];
+		const char *value;
+		size_t length;
+		if (!slot.replay->next(funcIndex, value, length))
 		{
-			(*i)->reset();
+			ref_tuple<Args...> tuple(args...);
+			RAISEEXCEPTION(ExpectationException(realMock->repo, &tuple, slot.funcName, realMock, funcIndex, &tuple));
 		}
+		return replay_value<Y>::read(value, length);
 	}
+};
 
-	void VerifyAll()
+// The fakes for a vtable live in an array hung off the table itself, indexed like it. Like the
+// expectation thunks, a fake finds its function through the funcMap of its own mock, as X is only
+// a line number or counter and can be the same for FakeCalls in other files.
+template <typename Z, typename Y>
+class fakeFuncs : public mock<Z> {
+private:
+	fakeFuncs();
+public:
+	template <int X, typename... Args>
+	Y faked(Args... args)
 	{
-#ifndef HM_NO_EXCEPTIONS
-		if (latentException)
-			latentException->rethrow();
-#endif
-
-		for (std::list<Call *>::iterator i = expectations.begin(); i != expectations.end(); i++)
-		{
-			if (!(*i)->satisfied) {
-				RAISEEXCEPTION(CallMissingException(this));
-			}
-		}
+		VirtualDestructable **fakes = (*(VirtualDestructable ****)this)[VIRT_FUNC_LIMIT+2];
+		int funcIndex = mock<Z>::getRealThis()->translateX(X).second;
+		return static_cast<TFake<Y, Args...> *>(fakes[funcIndex])->invoke(std::forward<Args>(args)...);
 	}
-	void VerifyPartial(base_mock *obj)
-	{
-#ifndef HM_NO_EXCEPTIONS
-		if (latentException)
-			return;
-#endif
-		for (std::list<Call *>::iterator i = expectations.begin(); i != expectations.end(); i++)
-		{
-			if ((*i)->mock == (base_mock *)obj &&
-				!(*i)->satisfied )
-			{
-				RAISELATENTEXCEPTION(CallMissingException(this));
-			}
-		}
+};
+
+// StubCall(obj, func) makes a function return a value-initialized result without registering a
+// Call, so it costs nothing on other calls. Unlike the shared thunk of Stub<T>() this knows the
+// signature, so it works for any return type that can be value-initialized.
+template <typename Z, typename Y>
+class stubFuncs : public mock<Z> {
+private:
+	stubFuncs();
+public:
+	template <typename... Args>
+	Y stubbed(Args...)
+	{
+		return Y();
 	}
-	template <typename base>
-	base *Mock();
 };
+#endif
 
 // mock function providers
 template <typename Z, typename Y>
@@ -5098,1259 +9831,2346 @@ public:
 		MockRepoInstanceHolder<0>::instance->DoVoidExpectation(NULL, std::pair<int, int>(0, X), ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P>(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p));
 	}
 
-#ifdef _MSC_VER
-	template <int X>
-	void __stdcall stdcallexpectation0()
-	{
-		MockRepository *repo = mock<Z>::repo;
-		repo->DoVoidExpectation(this, mock<Z>::translateX(X), ref_tuple<>());
-	}
-	template <int X, typename A>
-	void __stdcall stdcallexpectation1(A a)
-	{
-		MockRepository *repo = mock<Z>::repo;
-		repo->DoVoidExpectation(this, mock<Z>::translateX(X), ref_tuple<A>(a));
-	}
-	template <int X, typename A, typename B>
-	void __stdcall stdcallexpectation2(A a, B b)
-	{
-		MockRepository *repo = mock<Z>::repo;
-		repo->DoVoidExpectation(this, mock<Z>::translateX(X), ref_tuple<A,B>(a,b));
-	}
-	template <int X, typename A, typename B, typename C>
-	void __stdcall stdcallexpectation3(A a, B b, C c)
-	{
-		MockRepository *repo = mock<Z>::repo;
-		repo->DoVoidExpectation(this, mock<Z>::translateX(X), ref_tuple<A,B,C>(a,b,c));
-	}
-	template <int X, typename A, typename B, typename C, typename D>
-	void __stdcall stdcallexpectation4(A a, B b, C c, D d)
-	{
-		MockRepository *repo = mock<Z>::repo;
-		repo->DoVoidExpectation(this, mock<Z>::translateX(X), ref_tuple<A,B,C,D>(a,b,c,d));
-	}
-	template <int X, typename A, typename B, typename C, typename D, typename E>
-	void __stdcall stdcallexpectation5(A a, B b, C c, D d, E e)
-	{
-		MockRepository *repo = mock<Z>::repo;
-		repo->DoVoidExpectation(this, mock<Z>::translateX(X), ref_tuple<A,B,C,D,E>(a,b,c,d,e));
-	}
-	template <int X, typename A, typename B, typename C, typename D, typename E, typename F>
-	void __stdcall stdcallexpectation6(A a, B b, C c, D d, E e, F f)
-	{
-		MockRepository *repo = mock<Z>::repo;
-		repo->DoVoidExpectation(this, mock<Z>::translateX(X), ref_tuple<A,B,C,D,E,F>(a,b,c,d,e,f));
-	}
-	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G>
-	void __stdcall stdcallexpectation7(A a, B b, C c, D d, E e, F f, G g)
-	{
-		MockRepository *repo = mock<Z>::repo;
-		repo->DoVoidExpectation(this, mock<Z>::translateX(X), ref_tuple<A,B,C,D,E,F,G>(a,b,c,d,e,f,g));
-	}
-	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H>
-	void __stdcall stdcallexpectation8(A a, B b, C c, D d, E e, F f, G g, H h)
-	{
-		MockRepository *repo = mock<Z>::repo;
-		repo->DoVoidExpectation(this, mock<Z>::translateX(X), ref_tuple<A,B,C,D,E,F,G,H>(a,b,c,d,e,f,g,h));
-	}
-	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I>
-	void __stdcall stdcallexpectation9(A a, B b, C c, D d, E e, F f, G g, H h, I i)
-	{
-		MockRepository *repo = mock<Z>::repo;
-		repo->DoVoidExpectation(this, mock<Z>::translateX(X), ref_tuple<A,B,C,D,E,F,G,H,I>(a,b,c,d,e,f,g,h,i));
-	}
-	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J>
-	void __stdcall stdcallexpectation10(A a, B b, C c, D d, E e, F f, G g, H h, I i, J j)
-	{
-		MockRepository *repo = mock<Z>::repo;
-		repo->DoVoidExpectation(this, mock<Z>::translateX(X), ref_tuple<A,B,C,D,E,F,G,H,I,J>(a,b,c,d,e,f,g,h,i,j));
-	}
-	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K>
-	void __stdcall stdcallexpectation11(A a, B b, C c, D d, E e, F f, G g, H h, I i, J j, K k)
-	{
-		MockRepository *repo = mock<Z>::repo;
-		repo->DoVoidExpectation(this, mock<Z>::translateX(X), ref_tuple<A,B,C,D,E,F,G,H,I,J,K>(a,b,c,d,e,f,g,h,i,j,k));
-	}
-	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L>
-	void __stdcall stdcallexpectation12(A a, B b, C c, D d, E e, F f, G g, H h, I i, J j, K k, L l)
-	{
-		MockRepository *repo = mock<Z>::repo;
-		repo->DoVoidExpectation(this, mock<Z>::translateX(X), ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L>(a,b,c,d,e,f,g,h,i,j,k,l));
-	}
-	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename M>
-	void __stdcall stdcallexpectation13(A a, B b, C c, D d, E e, F f, G g, H h, I i, J j, K k, L l, M m)
-	{
-		MockRepository *repo = mock<Z>::repo;
-		repo->DoVoidExpectation(this, mock<Z>::translateX(X), ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M>(a,b,c,d,e,f,g,h,i,j,k,l,m));
-	}
-	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename M, typename N>
-	void __stdcall stdcallexpectation14(A a, B b, C c, D d, E e, F f, G g, H h, I i, J j, K k, L l, M m, N n)
-	{
-		MockRepository *repo = mock<Z>::repo;
-		repo->DoVoidExpectation(this, mock<Z>::translateX(X), ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N>(a,b,c,d,e,f,g,h,i,j,k,l,m,n));
-	}
-	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename M, typename N, typename O>
-	void __stdcall stdcallexpectation15(A a, B b, C c, D d, E e, F f, G g, H h, I i, J j, K k, L l, M m, N n, O o)
-	{
-		MockRepository *repo = mock<Z>::repo;
-		repo->DoVoidExpectation(this, mock<Z>::translateX(X), ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O>(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o));
-	}
-	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename M, typename N, typename O, typename P>
-	void __stdcall stdcallexpectation16(A a, B b, C c, D d, E e, F f, G g, H h, I i, J j, K k, L l, M m, N n, O o, P p)
-	{
-		MockRepository *repo = mock<Z>::repo;
-		repo->DoVoidExpectation(this, mock<Z>::translateX(X), ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P>(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p));
-	}
-#if defined(_MSC_VER) && !defined(_WIN64)
-	template <int X>
-	static void __stdcall static_stdcallexpectation0()
-	{
-		return MockRepoInstanceHolder<0>::instance->DoVoidExpectation(NULL, std::pair<int, int>(0, X), ref_tuple<>());
-	}
-	template <int X, typename A>
-	static void __stdcall static_stdcallexpectation1(A a)
-	{
-		return MockRepoInstanceHolder<0>::instance->DoVoidExpectation(NULL, std::pair<int, int>(0, X), ref_tuple<A>(a));
-	}
-	template <int X, typename A, typename B>
-	static void __stdcall static_stdcallexpectation2(A a, B b)
-	{
-		return MockRepoInstanceHolder<0>::instance->DoVoidExpectation(NULL, std::pair<int, int>(0, X), ref_tuple<A,B>(a,b));
-	}
-	template <int X, typename A, typename B, typename C>
-	static void __stdcall static_stdcallexpectation3(A a, B b, C c)
-	{
-		return MockRepoInstanceHolder<0>::instance->DoVoidExpectation(NULL, std::pair<int, int>(0, X), ref_tuple<A,B,C>(a,b,c));
-	}
-	template <int X, typename A, typename B, typename C, typename D>
-	static void __stdcall static_stdcallexpectation4(A a, B b, C c, D d)
-	{
-		return MockRepoInstanceHolder<0>::instance->DoVoidExpectation(NULL, std::pair<int, int>(0, X), ref_tuple<A,B,C,D>(a,b,c,d));
-	}
-	template <int X, typename A, typename B, typename C, typename D, typename E>
-	static void __stdcall static_stdcallexpectation5(A a, B b, C c, D d, E e)
-	{
-		return MockRepoInstanceHolder<0>::instance->DoVoidExpectation(NULL, std::pair<int, int>(0, X), ref_tuple<A,B,C,D,E>(a,b,c,d,e));
-	}
-	template <int X, typename A, typename B, typename C, typename D, typename E, typename F>
-	static void __stdcall static_stdcallexpectation6(A a, B b, C c, D d, E e, F f)
-	{
-		return MockRepoInstanceHolder<0>::instance->DoVoidExpectation(NULL, std::pair<int, int>(0, X), ref_tuple<A,B,C,D,E,F>(a,b,c,d,e,f));
-	}
-	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G>
-	static void __stdcall static_stdcallexpectation7(A a, B b, C c, D d, E e, F f, G g)
-	{
-		return MockRepoInstanceHolder<0>::instance->DoVoidExpectation(NULL, std::pair<int, int>(0, X), ref_tuple<A,B,C,D,E,F,G>(a,b,c,d,e,f,g));
-	}
-	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H>
-	static void __stdcall static_stdcallexpectation8(A a, B b, C c, D d, E e, F f, G g, H h)
-	{
-		return MockRepoInstanceHolder<0>::instance->DoVoidExpectation(NULL, std::pair<int, int>(0, X), ref_tuple<A,B,C,D,E,F,G,H>(a,b,c,d,e,f,g,h));
-	}
-	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I>
-	static void __stdcall static_stdcallexpectation9(A a, B b, C c, D d, E e, F f, G g, H h, I i)
-	{
-		return MockRepoInstanceHolder<0>::instance->DoVoidExpectation(NULL, std::pair<int, int>(0, X), ref_tuple<A,B,C,D,E,F,G,H,I>(a,b,c,d,e,f,g,h,i));
-	}
-	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J>
-	static void __stdcall static_stdcallexpectation10(A a, B b, C c, D d, E e, F f, G g, H h, I i, J j)
-	{
-		return MockRepoInstanceHolder<0>::instance->DoVoidExpectation(NULL, std::pair<int, int>(0, X), ref_tuple<A,B,C,D,E,F,G,H,I,J>(a,b,c,d,e,f,g,h,i,j));
-	}
-	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K>
-	static void __stdcall static_stdcallexpectation11(A a, B b, C c, D d, E e, F f, G g, H h, I i, J j, K k)
-	{
-		return MockRepoInstanceHolder<0>::instance->DoVoidExpectation(NULL, std::pair<int, int>(0, X), ref_tuple<A,B,C,D,E,F,G,H,I,J,K>(a,b,c,d,e,f,g,h,i,j,k));
-	}
-	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L>
-	static void __stdcall static_stdcallexpectation12(A a, B b, C c, D d, E e, F f, G g, H h, I i, J j, K k, L l)
-	{
-		return MockRepoInstanceHolder<0>::instance->DoVoidExpectation(NULL, std::pair<int, int>(0, X), ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L>(a,b,c,d,e,f,g,h,i,j,k,l));
-	}
-	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename M>
-	static void __stdcall static_stdcallexpectation13(A a, B b, C c, D d, E e, F f, G g, H h, I i, J j, K k, L l, M m)
-	{
-		return MockRepoInstanceHolder<0>::instance->DoVoidExpectation(NULL, std::pair<int, int>(0, X), ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M>(a,b,c,d,e,f,g,h,i,j,k,l,m));
-	}
-	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename M, typename N>
-	static void __stdcall static_stdcallexpectation14(A a, B b, C c, D d, E e, F f, G g, H h, I i, J j, K k, L l, M m, N n)
-	{
-		return MockRepoInstanceHolder<0>::instance->DoVoidExpectation(NULL, std::pair<int, int>(0, X), ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N>(a,b,c,d,e,f,g,h,i,j,k,l,m,n));
-	}
-	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename M, typename N, typename O>
-	static void __stdcall static_stdcallexpectation15(A a, B b, C c, D d, E e, F f, G g, H h, I i, J j, K k, L l, M m, N n, O o)
-	{
-		return MockRepoInstanceHolder<0>::instance->DoVoidExpectation(NULL, std::pair<int, int>(0, X), ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O>(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o));
-	}
-	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename M, typename N, typename O, typename P>
-	static void __stdcall static_stdcallexpectation16(A a, B b, C c, D d, E e, F f, G g, H h, I i, J j, K k, L l, M m, N n, O o, P p)
-	{
-		return MockRepoInstanceHolder<0>::instance->DoVoidExpectation(NULL, std::pair<int, int>(0, X), ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P>(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p));
-	}
-#endif
+#ifdef _MSC_VER
+	template <int X>
+	void __stdcall stdcallexpectation0()
+	{
+		MockRepository *repo = mock<Z>::repo;
+		repo->DoVoidExpectation(this, mock<Z>::translateX(X), ref_tuple<>());
+	}
+	template <int X, typename A>
+	void __stdcall stdcallexpectation1(A a)
+	{
+		MockRepository *repo = mock<Z>::repo;
+		repo->DoVoidExpectation(this, mock<Z>::translateX(X), ref_tuple<A>(a));
+	}
+	template <int X, typename A, typename B>
+	void __stdcall stdcallexpectation2(A a, B b)
+	{
+		MockRepository *repo = mock<Z>::repo;
+		repo->DoVoidExpectation(this, mock<Z>::translateX(X), ref_tuple<A,B>(a,b));
+	}
+	template <int X, typename A, typename B, typename C>
+	void __stdcall stdcallexpectation3(A a, B b, C c)
+	{
+		MockRepository *repo = mock<Z>::repo;
+		repo->DoVoidExpectation(this, mock<Z>::translateX(X), ref_tuple<A,B,C>(a,b,c));
+	}
+	template <int X, typename A, typename B, typename C, typename D>
+	void __stdcall stdcallexpectation4(A a, B b, C c, D d)
+	{
+		MockRepository *repo = mock<Z>::repo;
+		repo->DoVoidExpectation(this, mock<Z>::translateX(X), ref_tuple<A,B,C,D>(a,b,c,d));
+	}
+	template <int X, typename A, typename B, typename C, typename D, typename E>
+	void __stdcall stdcallexpectation5(A a, B b, C c, D d, E e)
+	{
+		MockRepository *repo = mock<Z>::repo;
+		repo->DoVoidExpectation(this, mock<Z>::translateX(X), ref_tuple<A,B,C,D,E>(a,b,c,d,e));
+	}
+	template <int X, typename A, typename B, typename C, typename D, typename E, typename F>
+	void __stdcall stdcallexpectation6(A a, B b, C c, D d, E e, F f)
+	{
+		MockRepository *repo = mock<Z>::repo;
+		repo->DoVoidExpectation(this, mock<Z>::translateX(X), ref_tuple<A,B,C,D,E,F>(a,b,c,d,e,f));
+	}
+	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G>
+	void __stdcall stdcallexpectation7(A a, B b, C c, D d, E e, F f, G g)
+	{
+		MockRepository *repo = mock<Z>::repo;
+		repo->DoVoidExpectation(this, mock<Z>::translateX(X), ref_tuple<A,B,C,D,E,F,G>(a,b,c,d,e,f,g));
+	}
+	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H>
+	void __stdcall stdcallexpectation8(A a, B b, C c, D d, E e, F f, G g, H h)
+	{
+		MockRepository *repo = mock<Z>::repo;
+		repo->DoVoidExpectation(this, mock<Z>::translateX(X), ref_tuple<A,B,C,D,E,F,G,H>(a,b,c,d,e,f,g,h));
+	}
+	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I>
+	void __stdcall stdcallexpectation9(A a, B b, C c, D d, E e, F f, G g, H h, I i)
+	{
+		MockRepository *repo = mock<Z>::repo;
+		repo->DoVoidExpectation(this, mock<Z>::translateX(X), ref_tuple<A,B,C,D,E,F,G,H,I>(a,b,c,d,e,f,g,h,i));
+	}
+	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J>
+	void __stdcall stdcallexpectation10(A a, B b, C c, D d, E e, F f, G g, H h, I i, J j)
+	{
+		MockRepository *repo = mock<Z>::repo;
+		repo->DoVoidExpectation(this, mock<Z>::translateX(X), ref_tuple<A,B,C,D,E,F,G,H,I,J>(a,b,c,d,e,f,g,h,i,j));
+	}
+	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K>
+	void __stdcall stdcallexpectation11(A a, B b, C c, D d, E e, F f, G g, H h, I i, J j, K k)
+	{
+		MockRepository *repo = mock<Z>::repo;
+		repo->DoVoidExpectation(this, mock<Z>::translateX(X), ref_tuple<A,B,C,D,E,F,G,H,I,J,K>(a,b,c,d,e,f,g,h,i,j,k));
+	}
+	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L>
+	void __stdcall stdcallexpectation12(A a, B b, C c, D d, E e, F f, G g, H h, I i, J j, K k, L l)
+	{
+		MockRepository *repo = mock<Z>::repo;
+		repo->DoVoidExpectation(this, mock<Z>::translateX(X), ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L>(a,b,c,d,e,f,g,h,i,j,k,l));
+	}
+	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename M>
+	void __stdcall stdcallexpectation13(A a, B b, C c, D d, E e, F f, G g, H h, I i, J j, K k, L l, M m)
+	{
+		MockRepository *repo = mock<Z>::repo;
+		repo->DoVoidExpectation(this, mock<Z>::translateX(X), ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M>(a,b,c,d,e,f,g,h,i,j,k,l,m));
+	}
+	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename M, typename N>
+	void __stdcall stdcallexpectation14(A a, B b, C c, D d, E e, F f, G g, H h, I i, J j, K k, L l, M m, N n)
+	{
+		MockRepository *repo = mock<Z>::repo;
+		repo->DoVoidExpectation(this, mock<Z>::translateX(X), ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N>(a,b,c,d,e,f,g,h,i,j,k,l,m,n));
+	}
+	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename M, typename N, typename O>
+	void __stdcall stdcallexpectation15(A a, B b, C c, D d, E e, F f, G g, H h, I i, J j, K k, L l, M m, N n, O o)
+	{
+		MockRepository *repo = mock<Z>::repo;
+		repo->DoVoidExpectation(this, mock<Z>::translateX(X), ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O>(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o));
+	}
+	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename M, typename N, typename O, typename P>
+	void __stdcall stdcallexpectation16(A a, B b, C c, D d, E e, F f, G g, H h, I i, J j, K k, L l, M m, N n, O o, P p)
+	{
+		MockRepository *repo = mock<Z>::repo;
+		repo->DoVoidExpectation(this, mock<Z>::translateX(X), ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P>(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p));
+	}
+#if defined(_MSC_VER) && !defined(_WIN64)
+	template <int X>
+	static void __stdcall static_stdcallexpectation0()
+	{
+		return MockRepoInstanceHolder<0>::instance->DoVoidExpectation(NULL, std::pair<int, int>(0, X), ref_tuple<>());
+	}
+	template <int X, typename A>
+	static void __stdcall static_stdcallexpectation1(A a)
+	{
+		return MockRepoInstanceHolder<0>::instance->DoVoidExpectation(NULL, std::pair<int, int>(0, X), ref_tuple<A>(a));
+	}
+	template <int X, typename A, typename B>
+	static void __stdcall static_stdcallexpectation2(A a, B b)
+	{
+		return MockRepoInstanceHolder<0>::instance->DoVoidExpectation(NULL, std::pair<int, int>(0, X), ref_tuple<A,B>(a,b));
+	}
+	template <int X, typename A, typename B, typename C>
+	static void __stdcall static_stdcallexpectation3(A a, B b, C c)
+	{
+		return MockRepoInstanceHolder<0>::instance->DoVoidExpectation(NULL, std::pair<int, int>(0, X), ref_tuple<A,B,C>(a,b,c));
+	}
+	template <int X, typename A, typename B, typename C, typename D>
+	static void __stdcall static_stdcallexpectation4(A a, B b, C c, D d)
+	{
+		return MockRepoInstanceHolder<0>::instance->DoVoidExpectation(NULL, std::pair<int, int>(0, X), ref_tuple<A,B,C,D>(a,b,c,d));
+	}
+	template <int X, typename A, typename B, typename C, typename D, typename E>
+	static void __stdcall static_stdcallexpectation5(A a, B b, C c, D d, E e)
+	{
+		return MockRepoInstanceHolder<0>::instance->DoVoidExpectation(NULL, std::pair<int, int>(0, X), ref_tuple<A,B,C,D,E>(a,b,c,d,e));
+	}
+	template <int X, typename A, typename B, typename C, typename D, typename E, typename F>
+	static void __stdcall static_stdcallexpectation6(A a, B b, C c, D d, E e, F f)
+	{
+		return MockRepoInstanceHolder<0>::instance->DoVoidExpectation(NULL, std::pair<int, int>(0, X), ref_tuple<A,B,C,D,E,F>(a,b,c,d,e,f));
+	}
+	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G>
+	static void __stdcall static_stdcallexpectation7(A a, B b, C c, D d, E e, F f, G g)
+	{
+		return MockRepoInstanceHolder<0>::instance->DoVoidExpectation(NULL, std::pair<int, int>(0, X), ref_tuple<A,B,C,D,E,F,G>(a,b,c,d,e,f,g));
+	}
+	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H>
+	static void __stdcall static_stdcallexpectation8(A a, B b, C c, D d, E e, F f, G g, H h)
+	{
+		return MockRepoInstanceHolder<0>::instance->DoVoidExpectation(NULL, std::pair<int, int>(0, X), ref_tuple<A,B,C,D,E,F,G,H>(a,b,c,d,e,f,g,h));
+	}
+	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I>
+	static void __stdcall static_stdcallexpectation9(A a, B b, C c, D d, E e, F f, G g, H h, I i)
+	{
+		return MockRepoInstanceHolder<0>::instance->DoVoidExpectation(NULL, std::pair<int, int>(0, X), ref_tuple<A,B,C,D,E,F,G,H,I>(a,b,c,d,e,f,g,h,i));
+	}
+	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J>
+	static void __stdcall static_stdcallexpectation10(A a, B b, C c, D d, E e, F f, G g, H h, I i, J j)
+	{
+		return MockRepoInstanceHolder<0>::instance->DoVoidExpectation(NULL, std::pair<int, int>(0, X), ref_tuple<A,B,C,D,E,F,G,H,I,J>(a,b,c,d,e,f,g,h,i,j));
+	}
+	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K>
+	static void __stdcall static_stdcallexpectation11(A a, B b, C c, D d, E e, F f, G g, H h, I i, J j, K k)
+	{
+		return MockRepoInstanceHolder<0>::instance->DoVoidExpectation(NULL, std::pair<int, int>(0, X), ref_tuple<A,B,C,D,E,F,G,H,I,J,K>(a,b,c,d,e,f,g,h,i,j,k));
+	}
+	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L>
+	static void __stdcall static_stdcallexpectation12(A a, B b, C c, D d, E e, F f, G g, H h, I i, J j, K k, L l)
+	{
+		return MockRepoInstanceHolder<0>::instance->DoVoidExpectation(NULL, std::pair<int, int>(0, X), ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L>(a,b,c,d,e,f,g,h,i,j,k,l));
+	}
+	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename M>
+	static void __stdcall static_stdcallexpectation13(A a, B b, C c, D d, E e, F f, G g, H h, I i, J j, K k, L l, M m)
+	{
+		return MockRepoInstanceHolder<0>::instance->DoVoidExpectation(NULL, std::pair<int, int>(0, X), ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M>(a,b,c,d,e,f,g,h,i,j,k,l,m));
+	}
+	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename M, typename N>
+	static void __stdcall static_stdcallexpectation14(A a, B b, C c, D d, E e, F f, G g, H h, I i, J j, K k, L l, M m, N n)
+	{
+		return MockRepoInstanceHolder<0>::instance->DoVoidExpectation(NULL, std::pair<int, int>(0, X), ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N>(a,b,c,d,e,f,g,h,i,j,k,l,m,n));
+	}
+	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename M, typename N, typename O>
+	static void __stdcall static_stdcallexpectation15(A a, B b, C c, D d, E e, F f, G g, H h, I i, J j, K k, L l, M m, N n, O o)
+	{
+		return MockRepoInstanceHolder<0>::instance->DoVoidExpectation(NULL, std::pair<int, int>(0, X), ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O>(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o));
+	}
+	template <int X, typename A, typename B, typename C, typename D, typename E, typename F, typename G, typename H, typename I, typename J, typename K, typename L, typename M, typename N, typename O, typename P>
+	static void __stdcall static_stdcallexpectation16(A a, B b, C c, D d, E e, F f, G g, H h, I i, J j, K k, L l, M m, N n, O o, P p)
+	{
+		return MockRepoInstanceHolder<0>::instance->DoVoidExpectation(NULL, std::pair<int, int>(0, X), ref_tuple<A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P>(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p));
+	}
+#endif
+#endif
+};
+
+template <typename T>
+template <int X>
+void mock<T>::mockedDestructor(int)
+{
+	repo->DoDestructorExpectation(this, translateX(X));
+	repo->VerifyPartial(this);
+	isZombie = true;
+}
+
+template <typename Z>
+void MockRepository::BasicRegisterExpect(mock<Z> *zMock, int baseOffset, int funcIndex, void (base_mock::*func)(), int X)
+{
+	useAllocator();
+	if (funcIndex > VIRT_FUNC_LIMIT) RAISEEXCEPTION(NotImplementedException(this));
+	if ((unsigned int)baseOffset * sizeof(void*) + sizeof(void*)-1 > sizeof(Z)) RAISEEXCEPTION(NotImplementedException(this));
+	if (zMock->funcMap.find(std::make_pair(baseOffset, funcIndex)) == zMock->funcMap.end())
+	{
+		if (zMock->funcTables.find(baseOffset) == zMock->funcTables.end())
+		{
+			typedef void (*funcptr)();
+			funcptr *funcTable = static_cast<funcptr *>(MockAllocated::allocate(sizeof(funcptr) * (VIRT_FUNC_LIMIT+3)));
+			memcpy(funcTable, zMock->notimplementedfuncs, sizeof(funcptr) * VIRT_FUNC_LIMIT);
+			((void **)funcTable)[VIRT_FUNC_LIMIT] = zMock;
+			((void **)funcTable)[VIRT_FUNC_LIMIT+1] = 0;
+			((void **)funcTable)[VIRT_FUNC_LIMIT+2] = 0;
+			zMock->funcTables[baseOffset] = funcTable;
+			((void **)zMock)[baseOffset] = funcTable;
+		}
+		zMock->funcMap[std::make_pair(baseOffset, funcIndex)] = X+1;
+		zMock->funcTables[baseOffset][funcIndex] = getNonvirtualMemberFunctionAddress<void (*)()>(func);
+	}
+}
+
+template <int X, typename Z2>
+TCall<void> &MockRepository::RegisterExpectDestructor(Z2 *mck, RegistrationType expect, const char *fileName, unsigned long lineNo)
+{
+	func_index idx;
+	((Z2 *)&idx)->~Z2();
+	int funcIndex = idx.lci * FUNCTION_STRIDE + FUNCTION_BASE;
+	void (mock<Z2>::*member)(int);
+	member = &mock<Z2>::template mockedDestructor<X>;
+	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
+						0, funcIndex,
+						reinterpret_cast<void (base_mock::*)()>(member), X);
+#ifdef EXTRA_DESTRUCTOR
+	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
+						0, funcIndex+1,
+						reinterpret_cast<void (base_mock::*)()>(member), X);
+#endif
+	TCall<void> *call = new TCall<void>(Once, reinterpret_cast<base_mock *>(mck), std::pair<int, int>(0, funcIndex), lineNo, "destructor", fileName);
+	addCall( call, expect );
+	return *call;
+}
+
+#if __cplusplus > 199711L
+template <int X, typename Z2, typename Y, typename Z, typename R, typename... Args>
+TCall<Y,Args...> &MockRepository::RegisterRecord_(Z2 *mck, Y (Z::*func)(Args...), R *real, CallRecording &recording, const char *functionName, const char *fileName, unsigned long lineNo)
+{
+	std::pair<int, int> funcIndex = virtual_index((Y(Z2::*)(Args...))func);
+	return RegisterExpect_<X>(mck, func, Any, functionName, fileName, lineNo)
+		.Do(RecordingForwarder<Y, R, Z, Args...>(real, func, recording, funcIndex));
+}
+
+template <int X, typename Z2, typename Y, typename Z, typename... Args>
+void MockRepository::RegisterReplay_(Z2 *mck, Y (Z::*func)(Args...), CallReplay &replay, const char *functionName)
+{
+	std::pair<int, int> funcIndex = virtual_index((Y(Z2::*)(Args...))func);
+	Y (replayFuncs<Z2, Y>::*mfp)(Args...);
+	mfp = &replayFuncs<Z2, Y>::template replayed<X, Args...>;
+	mock<Z2> *zMock = reinterpret_cast<mock<Z2> *>(mck);
+	BasicRegisterExpect(zMock,
+						funcIndex.first, funcIndex.second,
+						reinterpret_cast<void (base_mock::*)()>(mfp), X);
+	typename mock<Z2>::ReplaySlot &slot = zMock->replays[funcIndex];
+	slot.replay = &replay;
+	slot.funcName = functionName;
+}
+
+template <int X, typename Z2, typename Y, typename Z, typename... Args>
+void MockRepository::RegisterStub_(Z2 *mck, Y (Z::*func)(Args...))
+{
+	std::pair<int, int> funcIndex = virtual_index((Y(Z2::*)(Args...))func);
+	Y (stubFuncs<Z2, Y>::*mfp)(Args...);
+	mfp = &stubFuncs<Z2, Y>::template stubbed<Args...>;
+	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
+						funcIndex.first, funcIndex.second,
+						reinterpret_cast<void (base_mock::*)()>(mfp), X);
+}
+
+template <int X, typename Z2, typename Y, typename Z, typename... Args>
+TFake<Y,Args...> &MockRepository::RegisterFake_(Z2 *mck, Y (Z::*func)(Args...))
+{
+	std::pair<int, int> funcIndex = virtual_index((Y(Z2::*)(Args...))func);
+	Y (fakeFuncs<Z2, Y>::*mfp)(Args...);
+	mfp = &fakeFuncs<Z2, Y>::template faked<X, Args...>;
+	mock<Z2> *zMock = reinterpret_cast<mock<Z2> *>(mck);
+	BasicRegisterExpect(zMock,
+						funcIndex.first, funcIndex.second,
+						reinterpret_cast<void (base_mock::*)()>(mfp), X);
+	// The fake takes over the function even if something else registered it first.
+	zMock->funcMap[funcIndex] = X+1;
+	void (**funcTable)() = zMock->funcTables[funcIndex.first];
+	funcTable[funcIndex.second] = getNonvirtualMemberFunctionAddress<void (*)()>(reinterpret_cast<void (base_mock::*)()>(mfp));
+	VirtualDestructable **&fakes = ((VirtualDestructable ***)funcTable)[VIRT_FUNC_LIMIT+2];
+	if (!fakes)
+	{
+		fakes = static_cast<VirtualDestructable **>(MockAllocated::allocate(sizeof(VirtualDestructable *) * VIRT_FUNC_LIMIT));
+		memset(fakes, 0, sizeof(VirtualDestructable *) * VIRT_FUNC_LIMIT);
+	}
+	TFake<Y,Args...> *fake = new TFake<Y,Args...>();
+	delete fakes[funcIndex.second];
+	fakes[funcIndex.second] = fake;
+	return *fake;
+}
+#endif
+
+#if defined(_MSC_VER) && !defined(_WIN64)
+// Support for COM, see declarations
+template <int X, typename Z2, typename Y, typename Z>
+TCall<Y> &MockRepository::RegisterExpect_(Z2 *mck, Y (__stdcall Z::*func)(), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+	std::pair<int, int> funcIndex = virtual_index((Y(__stdcall Z2::*)())func);
+	Y(__stdcall mockFuncs<Z2, Y>::*mfp)();
+	mfp = &mockFuncs<Z2, Y>::template stdcallexpectation0<X>;
+	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
+		funcIndex.first,
+		funcIndex.second,
+		reinterpret_cast<void (base_mock::*)()>(mfp), X);
+	TCall<Y> *call = new TCall<Y>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, funcName, fileName);
+
+	addCall( call, expect );
+	return *call;
+}
+template <int X, typename Z2, typename Y, typename Z, typename A>
+TCall<Y,A> &MockRepository::RegisterExpect_(Z2 *mck, Y (__stdcall Z::*func)(A), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+	std::pair<int, int> funcIndex = virtual_index((Y(__stdcall Z2::*)(A))func);
+	Y(__stdcall mockFuncs<Z2, Y>::*mfp)(A);
+	mfp = &mockFuncs<Z2, Y>::template stdcallexpectation1<X, A>;
+	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
+		funcIndex.first,
+		funcIndex.second,
+		reinterpret_cast<void (base_mock::*)()>(mfp), X);
+	TCall<Y, A> *call = new TCall<Y, A>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, funcName, fileName);
+	addCall( call, expect );
+	return *call;
+}
+template <int X, typename Z2, typename Y, typename Z,
+	typename A, typename B>
+TCall<Y,A,B> &MockRepository::RegisterExpect_(Z2 *mck, Y (__stdcall Z::*func)(A,B), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+		std::pair<int, int> funcIndex = virtual_index((Y(__stdcall Z2::*)(A, B))func);
+		Y(__stdcall mockFuncs<Z2, Y>::*mfp)(A, B);
+		mfp = &mockFuncs<Z2, Y>::template stdcallexpectation2<X, A, B>;
+		BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
+			funcIndex.first,
+			funcIndex.second,
+			reinterpret_cast<void (base_mock::*)()>(mfp), X);
+		TCall<Y, A, B> *call = new TCall<Y, A, B>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, funcName, fileName);
+	addCall( call, expect );
+		return *call;
+}
+template <int X, typename Z2, typename Y, typename Z,
+	typename A, typename B, typename C>
+TCall<Y,A,B,C> &MockRepository::RegisterExpect_(Z2 *mck, Y (__stdcall Z::*func)(A,B,C), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+		std::pair<int, int> funcIndex = virtual_index((Y(__stdcall Z2::*)(A, B, C))func);
+		Y(__stdcall mockFuncs<Z2, Y>::*mfp)(A, B, C);
+		mfp = &mockFuncs<Z2, Y>::template stdcallexpectation3<X, A, B, C>;
+		BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
+			funcIndex.first,
+			funcIndex.second,
+			reinterpret_cast<void (base_mock::*)()>(mfp), X);
+		TCall<Y, A, B, C> *call = new TCall<Y, A, B, C>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, funcName, fileName);
+	addCall( call, expect );
+		return *call;
+}
+template <int X, typename Z2, typename Y, typename Z,
+	typename A, typename B, typename C, typename D>
+TCall<Y,A,B,C,D> &MockRepository::RegisterExpect_(Z2 *mck, Y (__stdcall Z::*func)(A,B,C,D), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+		std::pair<int, int> funcIndex = virtual_index((Y(__stdcall Z2::*)(A, B, C, D))func);
+		Y(__stdcall mockFuncs<Z2, Y>::*mfp)(A, B, C, D);
+		mfp = &mockFuncs<Z2, Y>::template stdcallexpectation4<X, A, B, C, D>;
+		BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
+			funcIndex.first,
+			funcIndex.second,
+			reinterpret_cast<void (base_mock::*)()>(mfp), X);
+		TCall<Y, A, B, C, D> *call = new TCall<Y, A, B, C, D>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, funcName, fileName);
+	addCall( call, expect );
+		return *call;
+}
+template <int X, typename Z2, typename Y, typename Z,
+	typename A, typename B, typename C, typename D,
+	typename E>
+TCall<Y,A,B,C,D,E> &MockRepository::RegisterExpect_(Z2 *mck, Y (__stdcall Z::*func)(A,B,C,D,E), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+		std::pair<int, int> funcIndex = virtual_index((Y(__stdcall Z2::*)(A, B, C, D, E))func);
+		Y(__stdcall mockFuncs<Z2, Y>::*mfp)(A, B, C, D, E);
+		mfp = &mockFuncs<Z2, Y>::template stdcallexpectation5<X, A, B, C, D, E>;
+		BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
+			funcIndex.first,
+			funcIndex.second,
+			reinterpret_cast<void (base_mock::*)()>(mfp), X);
+		TCall<Y, A, B, C, D, E> *call = new TCall<Y, A, B, C, D, E>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, funcName, fileName);
+	addCall( call, expect );
+		return *call;
+}
+template <int X, typename Z2, typename Y, typename Z,
+	typename A, typename B, typename C, typename D,
+	typename E, typename F>
+TCall<Y,A,B,C,D,E,F> &MockRepository::RegisterExpect_(Z2 *mck, Y (__stdcall Z::*func)(A,B,C,D,E,F), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+		std::pair<int, int> funcIndex = virtual_index((Y(__stdcall Z2::*)(A, B, C, D, E, F))func);
+		Y(__stdcall mockFuncs<Z2, Y>::*mfp)(A, B, C, D, E, F);
+		mfp = &mockFuncs<Z2, Y>::template stdcallexpectation6<X, A, B, C, D, E, F>;
+		BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
+			funcIndex.first,
+			funcIndex.second,
+			reinterpret_cast<void (base_mock::*)()>(mfp), X);
+		TCall<Y, A, B, C, D, E, F> *call = new TCall<Y, A, B, C, D, E, F>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, funcName, fileName);
+	addCall( call, expect );
+		return *call;
+}
+template <int X, typename Z2, typename Y, typename Z,
+	typename A, typename B, typename C, typename D,
+	typename E, typename F, typename G>
+TCall<Y,A,B,C,D,E,F,G> &MockRepository::RegisterExpect_(Z2 *mck, Y (__stdcall Z::*func)(A,B,C,D,E,F,G), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+		std::pair<int, int> funcIndex = virtual_index((Y(__stdcall Z2::*)(A, B, C, D, E, F, G))func);
+		Y(__stdcall mockFuncs<Z2, Y>::*mfp)(A, B, C, D, E, F, G);
+		mfp = &mockFuncs<Z2, Y>::template stdcallexpectation7<X, A, B, C, D, E, F, G>;
+		BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
+			funcIndex.first,
+			funcIndex.second,
+			reinterpret_cast<void (base_mock::*)()>(mfp), X);
+		TCall<Y, A, B, C, D, E, F, G> *call = new TCall<Y, A, B, C, D, E, F, G>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, funcName, fileName);
+	addCall( call, expect );
+		return *call;
+}
+template <int X, typename Z2, typename Y, typename Z,
+	typename A, typename B, typename C, typename D,
+	typename E, typename F, typename G, typename H>
+TCall<Y,A,B,C,D,E,F,G,H> &MockRepository::RegisterExpect_(Z2 *mck, Y (__stdcall Z::*func)(A,B,C,D,E,F,G,H), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+		std::pair<int, int> funcIndex = virtual_index((Y(__stdcall Z2::*)(A, B, C, D, E, F, G, H))func);
+		Y(__stdcall mockFuncs<Z2, Y>::*mfp)(A, B, C, D, E, F, G, H);
+		mfp = &mockFuncs<Z2, Y>::template stdcallexpectation8<X, A, B, C, D, E, F, G, H>;
+		BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
+			funcIndex.first,
+			funcIndex.second,
+			reinterpret_cast<void (base_mock::*)()>(mfp), X);
+		TCall<Y, A, B, C, D, E, F, G, H> *call = new TCall<Y, A, B, C, D, E, F, G, H>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, funcName, fileName);
+	addCall( call, expect );
+		return *call;
+}
+template <int X, typename Z2, typename Y, typename Z,
+	typename A, typename B, typename C, typename D,
+	typename E, typename F, typename G, typename H,
+	typename I>
+TCall<Y,A,B,C,D,E,F,G,H,I> &MockRepository::RegisterExpect_(Z2 *mck, Y (__stdcall Z::*func)(A,B,C,D,E,F,G,H,I), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+		std::pair<int, int> funcIndex = virtual_index((Y(__stdcall Z2::*)(A, B, C, D, E, F, G, H, I))func);
+		Y(__stdcall mockFuncs<Z2, Y>::*mfp)(A, B, C, D, E, F, G, H, I);
+		mfp = &mockFuncs<Z2, Y>::template stdcallexpectation9<X, A, B, C, D, E, F, G, H, I>;
+		BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
+			funcIndex.first,
+			funcIndex.second,
+			reinterpret_cast<void (base_mock::*)()>(mfp), X);
+		TCall<Y, A, B, C, D, E, F, G, H, I> *call = new TCall<Y, A, B, C, D, E, F, G, H, I>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, funcName, fileName);
+	addCall( call, expect );
+		return *call;
+}
+template <int X, typename Z2, typename Y, typename Z,
+	typename A, typename B, typename C, typename D,
+	typename E, typename F, typename G, typename H,
+	typename I, typename J>
+TCall<Y,A,B,C,D,E,F,G,H,I,J> &MockRepository::RegisterExpect_(Z2 *mck, Y (__stdcall Z::*func)(A,B,C,D,E,F,G,H,I,J), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+		std::pair<int, int> funcIndex = virtual_index((Y(__stdcall Z2::*)(A, B, C, D, E, F, G, H, I, J))func);
+		Y(__stdcall mockFuncs<Z2, Y>::*mfp)(A, B, C, D, E, F, G, H, I, J);
+		mfp = &mockFuncs<Z2, Y>::template stdcallexpectation10<X, A, B, C, D, E, F, G, H, I, J>;
+		BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
+			funcIndex.first,
+			funcIndex.second,
+			reinterpret_cast<void (base_mock::*)()>(mfp), X);
+		TCall<Y, A, B, C, D, E, F, G, H, I, J> *call = new TCall<Y, A, B, C, D, E, F, G, H, I, J>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, funcName, fileName);
+	addCall( call, expect );
+		return *call;
+}
+template <int X, typename Z2, typename Y, typename Z,
+	typename A, typename B, typename C, typename D,
+	typename E, typename F, typename G, typename H,
+	typename I, typename J, typename K>
+TCall<Y,A,B,C,D,E,F,G,H,I,J,K> &MockRepository::RegisterExpect_(Z2 *mck, Y (__stdcall Z::*func)(A,B,C,D,E,F,G,H,I,J,K), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+		std::pair<int, int> funcIndex = virtual_index((Y(__stdcall Z2::*)(A, B, C, D, E, F, G, H, I, J, K))func);
+		Y(__stdcall mockFuncs<Z2, Y>::*mfp)(A, B, C, D, E, F, G, H, I, J, K);
+		mfp = &mockFuncs<Z2, Y>::template stdcallexpectation11<X, A, B, C, D, E, F, G, H, I, J, K>;
+		BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
+			funcIndex.first,
+			funcIndex.second,
+			reinterpret_cast<void (base_mock::*)()>(mfp), X);
+		TCall<Y, A, B, C, D, E, F, G, H, I, J, K> *call = new TCall<Y, A, B, C, D, E, F, G, H, I, J, K>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, funcName, fileName);
+	addCall( call, expect );
+		return *call;
+}
+template <int X, typename Z2, typename Y, typename Z,
+	typename A, typename B, typename C, typename D,
+	typename E, typename F, typename G, typename H,
+	typename I, typename J, typename K, typename L>
+TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L> &MockRepository::RegisterExpect_(Z2 *mck, Y (__stdcall Z::*func)(A,B,C,D,E,F,G,H,I,J,K,L), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+		std::pair<int, int> funcIndex = virtual_index((Y(__stdcall Z2::*)(A, B, C, D, E, F, G, H, I, J, K, L))func);
+		Y(__stdcall mockFuncs<Z2, Y>::*mfp)(A, B, C, D, E, F, G, H, I, J, K, L);
+		mfp = &mockFuncs<Z2, Y>::template stdcallexpectation12<X, A, B, C, D, E, F, G, H, I, J, K, L>;
+		BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
+			funcIndex.first,
+			funcIndex.second,
+			reinterpret_cast<void (base_mock::*)()>(mfp), X);
+		TCall<Y, A, B, C, D, E, F, G, H, I, J, K, L> *call = new TCall<Y, A, B, C, D, E, F, G, H, I, J, K, L>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, funcName, fileName);
+	addCall( call, expect );
+		return *call;
+}
+template <int X, typename Z2, typename Y, typename Z,
+	typename A, typename B, typename C, typename D,
+	typename E, typename F, typename G, typename H,
+	typename I, typename J, typename K, typename L,
+	typename M>
+TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M> &MockRepository::RegisterExpect_(Z2 *mck, Y (__stdcall Z::*func)(A,B,C,D,E,F,G,H,I,J,K,L,M), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+		std::pair<int, int> funcIndex = virtual_index((Y(__stdcall Z2::*)(A, B, C, D, E, F, G, H, I, J, K, L, M))func);
+		Y(__stdcall mockFuncs<Z2, Y>::*mfp)(A, B, C, D, E, F, G, H, I, J, K, L, M);
+		mfp = &mockFuncs<Z2, Y>::template stdcallexpectation13<X, A, B, C, D, E, F, G, H, I, J, K, L, M>;
+		BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
+			funcIndex.first,
+			funcIndex.second,
+			reinterpret_cast<void (base_mock::*)()>(mfp), X);
+		TCall<Y, A, B, C, D, E, F, G, H, I, J, K, L, M> *call = new TCall<Y, A, B, C, D, E, F, G, H, I, J, K, L, M>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, funcName, fileName);
+	addCall( call, expect );
+		return *call;
+}
+template <int X, typename Z2, typename Y, typename Z,
+	typename A, typename B, typename C, typename D,
+	typename E, typename F, typename G, typename H,
+	typename I, typename J, typename K, typename L,
+	typename M, typename N>
+TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N> &MockRepository::RegisterExpect_(Z2 *mck, Y (__stdcall Z::*func)(A,B,C,D,E,F,G,H,I,J,K,L,M,N), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+		std::pair<int, int> funcIndex = virtual_index((Y(__stdcall Z2::*)(A, B, C, D, E, F, G, H, I, J, K, L, M, N))func);
+		Y(__stdcall mockFuncs<Z2, Y>::*mfp)(A, B, C, D, E, F, G, H, I, J, K, L, M, N);
+		mfp = &mockFuncs<Z2, Y>::template stdcallexpectation14<X, A, B, C, D, E, F, G, H, I, J, K, L, M, N>;
+		BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
+			funcIndex.first,
+			funcIndex.second,
+			reinterpret_cast<void (base_mock::*)()>(mfp), X);
+		TCall<Y, A, B, C, D, E, F, G, H, I, J, K, L, M, N> *call = new TCall<Y, A, B, C, D, E, F, G, H, I, J, K, L, M, N>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, funcName, fileName);
+	addCall( call, expect );
+		return *call;
+}
+template <int X, typename Z2, typename Y, typename Z,
+	typename A, typename B, typename C, typename D,
+	typename E, typename F, typename G, typename H,
+	typename I, typename J, typename K, typename L,
+	typename M, typename N, typename O>
+TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O> &MockRepository::RegisterExpect_(Z2 *mck, Y (__stdcall Z::*func)(A,B,C,D,E,F,G,H,I,J,K,L,M,N,O), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+		std::pair<int, int> funcIndex = virtual_index((Y(__stdcall Z2::*)(A, B, C, D, E, F, G, H, I, J, K, L, M, N, O))func);
+		Y(__stdcall mockFuncs<Z2, Y>::*mfp)(A, B, C, D, E, F, G, H, I, J, K, L, M, N, O);
+		mfp = &mockFuncs<Z2, Y>::template stdcallexpectation15<X, A, B, C, D, E, F, G, H, I, J, K, L, M, N, O>;
+		BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
+			funcIndex.first,
+			funcIndex.second,
+			reinterpret_cast<void (base_mock::*)()>(mfp), X);
+		TCall<Y, A, B, C, D, E, F, G, H, I, J, K, L, M, N, O> *call = new TCall<Y, A, B, C, D, E, F, G, H, I, J, K, L, M, N, O>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, funcName, fileName);
+	addCall( call, expect );
+		return *call;
+}
+
+template <int X, typename Z2, typename Y, typename Z,
+	typename A, typename B, typename C, typename D,
+	typename E, typename F, typename G, typename H,
+	typename I, typename J, typename K, typename L,
+	typename M, typename N, typename O, typename P>
+TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &MockRepository::RegisterExpect_(Z2 *mck, Y (__stdcall Z::*func)(A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+		std::pair<int, int> funcIndex = virtual_index((Y(__stdcall Z2::*)(A, B, C, D, E, F, G, H, I, J, K, L, M, N, O, P))func);
+		Y(__stdcall mockFuncs<Z2, Y>::*mfp)(A, B, C, D, E, F, G, H, I, J, K, L, M, N, O, P);
+		mfp = &mockFuncs<Z2, Y>::template stdcallexpectation16<X, A, B, C, D, E, F, G, H, I, J, K, L, M, N, O, P>;
+		BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
+			funcIndex.first,
+			funcIndex.second,
+			reinterpret_cast<void (base_mock::*)()>(mfp), X);
+		TCall<Y, A, B, C, D, E, F, G, H, I, J, K, L, M, N, O, P> *call = new TCall<Y, A, B, C, D, E, F, G, H, I, J, K, L, M, N, O, P>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, funcName, fileName);
+	addCall( call, expect );
+		return *call;
+}
 #endif
-};
 
-template <typename T>
-template <int X>
-void mock<T>::mockedDestructor(int)
+#ifdef _HIPPOMOCKS__ENABLE_CFUNC_MOCKING_SUPPORT
+template <int X, typename Y>
+TCall<Y> &MockRepository::RegisterExpect_(Y (*func)(), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+  Y (*fp)();
+  fp = &mockFuncs<char, Y>::template static_expectation0<X>;
+  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
+  TCall<Y> *call = new TCall<Y>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
+  addCall( call, expect );
+  return *call;
+}
+template <int X, typename Y, typename A>
+TCall<Y,A> &MockRepository::RegisterExpect_(Y (*func)(A), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+  Y (*fp)(A);
+  fp = &mockFuncs<char, Y>::template static_expectation1<X,A>;
+  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
+  TCall<Y,A> *call = new TCall<Y,A>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
+  addCall( call, expect );
+  return *call;
+}
+template <int X, typename Y,
+		  typename A, typename B>
+TCall<Y,A,B> &MockRepository::RegisterExpect_(Y (*func)(A,B), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+  Y (*fp)(A,B);
+  fp = &mockFuncs<char, Y>::template static_expectation2<X,A,B>;
+  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
+  TCall<Y,A,B> *call = new TCall<Y,A,B>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
+  addCall( call, expect );
+  return *call;
+}
+template <int X, typename Y,
+		  typename A, typename B, typename C>
+TCall<Y,A,B,C> &MockRepository::RegisterExpect_(Y (*func)(A,B,C), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+  Y (*fp)(A,B,C);
+  fp = &mockFuncs<char, Y>::template static_expectation3<X,A,B,C>;
+  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
+  TCall<Y,A,B,C> *call = new TCall<Y,A,B,C>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
+  addCall( call, expect );
+  return *call;
+}
+template <int X, typename Y,
+		  typename A, typename B, typename C, typename D>
+TCall<Y,A,B,C,D> &MockRepository::RegisterExpect_(Y (*func)(A,B,C,D), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+  Y (*fp)(A,B,C,D);
+  fp = &mockFuncs<char, Y>::template static_expectation4<X,A,B,C,D>;
+  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
+  TCall<Y,A,B,C,D> *call = new TCall<Y,A,B,C,D>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
+  addCall( call, expect );
+  return *call;
+}
+template <int X, typename Y,
+		  typename A, typename B, typename C, typename D,
+		  typename E>
+TCall<Y,A,B,C,D,E> &MockRepository::RegisterExpect_(Y (*func)(A,B,C,D,E), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+  Y (*fp)(A,B,C,D,E);
+  fp = &mockFuncs<char, Y>::template static_expectation5<X,A,B,C,D,E>;
+  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
+  TCall<Y,A,B,C,D,E> *call = new TCall<Y,A,B,C,D,E>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
+  addCall( call, expect );
+  return *call;
+}
+template <int X, typename Y,
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F>
+TCall<Y,A,B,C,D,E,F> &MockRepository::RegisterExpect_(Y (*func)(A,B,C,D,E,F), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+  Y (*fp)(A,B,C,D,E,F);
+  fp = &mockFuncs<char, Y>::template static_expectation6<X,A,B,C,D,E,F>;
+  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
+  TCall<Y,A,B,C,D,E,F> *call = new TCall<Y,A,B,C,D,E,F>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
+  addCall( call, expect );
+  return *call;
+}
+template <int X, typename Y,
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G>
+TCall<Y,A,B,C,D,E,F,G> &MockRepository::RegisterExpect_(Y (*func)(A,B,C,D,E,F,G), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+  Y (*fp)(A,B,C,D,E,F,G);
+  fp = &mockFuncs<char, Y>::template static_expectation7<X,A,B,C,D,E,F,G>;
+  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
+  TCall<Y,A,B,C,D,E,F,G> *call = new TCall<Y,A,B,C,D,E,F,G>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
+   addCall( call, expect );
+  return *call;
+}
+template <int X, typename Y,
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H>
+TCall<Y,A,B,C,D,E,F,G,H> &MockRepository::RegisterExpect_(Y (*func)(A,B,C,D,E,F,G,H), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+  Y (*fp)(A,B,C,D,E,F,G,H);
+  fp = &mockFuncs<char, Y>::template static_expectation8<X,A,B,C,D,E,F,G,H>;
+  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
+  TCall<Y,A,B,C,D,E,F,G,H> *call = new TCall<Y,A,B,C,D,E,F,G,H>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
+  addCall( call, expect );
+  return *call;
+}
+template <int X, typename Y,
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I>
+TCall<Y,A,B,C,D,E,F,G,H,I> &MockRepository::RegisterExpect_(Y (*func)(A,B,C,D,E,F,G,H,I), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+  Y (*fp)(A,B,C,D,E,F,G,H,I);
+  fp = &mockFuncs<char, Y>::template static_expectation9<X,A,B,C,D,E,F,G,H,I>;
+  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
+  TCall<Y,A,B,C,D,E,F,G,H,I> *call = new TCall<Y,A,B,C,D,E,F,G,H,I>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
+  addCall( call, expect );
+  return *call;
+}
+template <int X, typename Y,
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I, typename J>
+TCall<Y,A,B,C,D,E,F,G,H,I,J> &MockRepository::RegisterExpect_(Y (*func)(A,B,C,D,E,F,G,H,I,J), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+  Y (*fp)(A,B,C,D,E,F,G,H,I,J);
+  fp = &mockFuncs<char, Y>::template static_expectation10<X,A,B,C,D,E,F,G,H,I,J>;
+  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
+  TCall<Y,A,B,C,D,E,F,G,H,I,J> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
+  addCall( call, expect );
+  return *call;
+}
+template <int X, typename Y,
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I, typename J, typename K>
+TCall<Y,A,B,C,D,E,F,G,H,I,J,K> &MockRepository::RegisterExpect_(Y (*func)(A,B,C,D,E,F,G,H,I,J,K), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+  Y (*fp)(A,B,C,D,E,F,G,H,I,J,K);
+  fp = &mockFuncs<char, Y>::template static_expectation11<X,A,B,C,D,E,F,G,H,I,J,K>;
+  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
+  TCall<Y,A,B,C,D,E,F,G,H,I,J,K> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J,K>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
+  addCall( call, expect );
+  return *call;
+}
+template <int X, typename Y,
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I, typename J, typename K, typename L>
+TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L> &MockRepository::RegisterExpect_(Y (*func)(A,B,C,D,E,F,G,H,I,J,K,L), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+  Y (*fp)(A,B,C,D,E,F,G,H,I,J,K,L);
+  fp = &mockFuncs<char, Y>::template static_expectation12<X,A,B,C,D,E,F,G,H,I,J,K,L>;
+  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
+  TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
+  addCall( call, expect );
+  return *call;
+}
+template <int X, typename Y,
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I, typename J, typename K, typename L,
+		  typename M>
+TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M> &MockRepository::RegisterExpect_(Y (*func)(A,B,C,D,E,F,G,H,I,J,K,L,M), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+  Y (*fp)(A,B,C,D,E,F,G,H,I,J,K,L,M);
+  fp = &mockFuncs<char, Y>::template static_expectation13<X,A,B,C,D,E,F,G,H,I,J,K,L,M>;
+  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
+  TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
+  addCall( call, expect );
+  return *call;
+}
+template <int X, typename Y,
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I, typename J, typename K, typename L,
+		  typename M, typename N>
+TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N> &MockRepository::RegisterExpect_(Y (*func)(A,B,C,D,E,F,G,H,I,J,K,L,M,N), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+  Y (*fp)(A,B,C,D,E,F,G,H,I,J,K,L,M,N);
+  fp = &mockFuncs<char, Y>::template static_expectation14<X,A,B,C,D,E,F,G,H,I,J,K,L,M,N>;
+  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
+  TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
+  addCall( call, expect );
+  return *call;
+}
+template <int X, typename Y,
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I, typename J, typename K, typename L,
+		  typename M, typename N, typename O>
+TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O> &MockRepository::RegisterExpect_(Y (*func)(A,B,C,D,E,F,G,H,I,J,K,L,M,N,O), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+  Y (*fp)(A,B,C,D,E,F,G,H,I,J,K,L,M,N,O);
+  fp = &mockFuncs<char, Y>::template static_expectation15<X,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O>;
+  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
+  TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
+  addCall( call, expect );
+  return *call;
+}
+
+template <int X, typename Y,
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I, typename J, typename K, typename L,
+		  typename M, typename N, typename O, typename P>
+TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &MockRepository::RegisterExpect_(Y (*func)(A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+  Y (*fp)(A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P);
+  fp = &mockFuncs<char, Y>::template static_expectation16<X,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P>;
+  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
+  TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
+  addCall( call, expect );
+  return *call;
+}
+
+#if defined(_MSC_VER) && !defined(_WIN64)
+template <int X, typename Y>
+TCall<Y> &MockRepository::RegisterExpect_(Y (__stdcall *func)(), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+  Y (__stdcall *fp)();
+  fp = &mockFuncs<char, Y>::template static_stdcallexpectation0<X>;
+  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
+  TCall<Y> *call = new TCall<Y>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
+  addCall( call, expect );
+  return *call;
+}
+template <int X, typename Y, typename A>
+TCall<Y,A> &MockRepository::RegisterExpect_(Y (__stdcall *func)(A), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+  Y (__stdcall *fp)(A);
+  fp = &mockFuncs<char, Y>::template static_stdcallexpectation1<X,A>;
+  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
+  TCall<Y,A> *call = new TCall<Y,A>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
+  addCall( call, expect );
+  return *call;
+}
+template <int X, typename Y,
+		  typename A, typename B>
+TCall<Y,A,B> &MockRepository::RegisterExpect_(Y (__stdcall *func)(A,B), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+  Y (__stdcall *fp)(A,B);
+  fp = &mockFuncs<char, Y>::template static_stdcallexpectation2<X,A,B>;
+  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
+  TCall<Y,A,B> *call = new TCall<Y,A,B>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
+  addCall( call, expect );
+  return *call;
+}
+template <int X, typename Y,
+		  typename A, typename B, typename C>
+TCall<Y,A,B,C> &MockRepository::RegisterExpect_(Y (__stdcall *func)(A,B,C), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+  Y (__stdcall *fp)(A,B,C);
+  fp = &mockFuncs<char, Y>::template static_stdcallexpectation3<X,A,B,C>;
+  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
+  TCall<Y,A,B,C> *call = new TCall<Y,A,B,C>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
+  addCall( call, expect );
+  return *call;
+}
+template <int X, typename Y,
+		  typename A, typename B, typename C, typename D>
+TCall<Y,A,B,C,D> &MockRepository::RegisterExpect_(Y (__stdcall *func)(A,B,C,D), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+  Y (__stdcall *fp)(A,B,C,D);
+  fp = &mockFuncs<char, Y>::template static_stdcallexpectation4<X,A,B,C,D>;
+  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
+  TCall<Y,A,B,C,D> *call = new TCall<Y,A,B,C,D>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
+  addCall( call, expect );
+  return *call;
+}
+template <int X, typename Y,
+		  typename A, typename B, typename C, typename D,
+		  typename E>
+TCall<Y,A,B,C,D,E> &MockRepository::RegisterExpect_(Y (__stdcall *func)(A,B,C,D,E), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+  Y (__stdcall *fp)(A,B,C,D,E);
+  fp = &mockFuncs<char, Y>::template static_stdcallexpectation5<X,A,B,C,D,E>;
+  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
+  TCall<Y,A,B,C,D,E> *call = new TCall<Y,A,B,C,D,E>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
+  addCall( call, expect );
+  return *call;
+}
+template <int X, typename Y,
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F>
+TCall<Y,A,B,C,D,E,F> &MockRepository::RegisterExpect_(Y (__stdcall *func)(A,B,C,D,E,F), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+  Y (__stdcall *fp)(A,B,C,D,E,F);
+  fp = &mockFuncs<char, Y>::template static_stdcallexpectation6<X,A,B,C,D,E,F>;
+  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
+  TCall<Y,A,B,C,D,E,F> *call = new TCall<Y,A,B,C,D,E,F>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
+  addCall( call, expect );
+  return *call;
+}
+template <int X, typename Y,
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G>
+TCall<Y,A,B,C,D,E,F,G> &MockRepository::RegisterExpect_(Y (__stdcall *func)(A,B,C,D,E,F,G), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
 {
-	repo->DoVoidExpectation(this, translateX(X), ref_tuple<>(), true);
-	repo->VerifyPartial(this);
-	isZombie = true;
+  Y (__stdcall *fp)(A,B,C,D,E,F,G);
+  fp = &mockFuncs<char, Y>::template static_stdcallexpectation7<X,A,B,C,D,E,F,G>;
+  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
+  TCall<Y,A,B,C,D,E,F,G> *call = new TCall<Y,A,B,C,D,E,F,G>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
+   addCall( call, expect );
+  return *call;
 }
-
-template <typename Z>
-void MockRepository::BasicRegisterExpect(mock<Z> *zMock, int baseOffset, int funcIndex, void (base_mock::*func)(), int X)
+template <int X, typename Y,
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H>
+TCall<Y,A,B,C,D,E,F,G,H> &MockRepository::RegisterExpect_(Y (__stdcall *func)(A,B,C,D,E,F,G,H), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
 {
-	if (funcIndex > VIRT_FUNC_LIMIT) RAISEEXCEPTION(NotImplementedException(this));
-	if ((unsigned int)baseOffset * sizeof(void*) + sizeof(void*)-1 > sizeof(Z)) RAISEEXCEPTION(NotImplementedException(this));
-	if (zMock->funcMap.find(std::make_pair(baseOffset, funcIndex)) == zMock->funcMap.end())
-	{
-		if (zMock->funcTables.find(baseOffset) == zMock->funcTables.end())
-		{
-			typedef void (*funcptr)();
-			funcptr *funcTable = new funcptr[VIRT_FUNC_LIMIT+1];
-			memcpy(funcTable, zMock->notimplementedfuncs, sizeof(funcptr) * VIRT_FUNC_LIMIT);
-			((void **)funcTable)[VIRT_FUNC_LIMIT] = zMock;
-			zMock->funcTables[baseOffset] = funcTable;
-			((void **)zMock)[baseOffset] = funcTable;
-		}
-		zMock->funcMap[std::make_pair(baseOffset, funcIndex)] = X+1;
-		zMock->funcTables[baseOffset][funcIndex] = getNonvirtualMemberFunctionAddress<void (*)()>(func);
-	}
+  Y (__stdcall *fp)(A,B,C,D,E,F,G,H);
+  fp = &mockFuncs<char, Y>::template static_stdcallexpectation8<X,A,B,C,D,E,F,G,H>;
+  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
+  TCall<Y,A,B,C,D,E,F,G,H> *call = new TCall<Y,A,B,C,D,E,F,G,H>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
+  addCall( call, expect );
+  return *call;
+}
+template <int X, typename Y,
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I>
+TCall<Y,A,B,C,D,E,F,G,H,I> &MockRepository::RegisterExpect_(Y (__stdcall *func)(A,B,C,D,E,F,G,H,I), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+  Y (__stdcall *fp)(A,B,C,D,E,F,G,H,I);
+  fp = &mockFuncs<char, Y>::template static_stdcallexpectation9<X,A,B,C,D,E,F,G,H,I>;
+  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
+  TCall<Y,A,B,C,D,E,F,G,H,I> *call = new TCall<Y,A,B,C,D,E,F,G,H,I>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
+  addCall( call, expect );
+  return *call;
+}
+template <int X, typename Y,
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I, typename J>
+TCall<Y,A,B,C,D,E,F,G,H,I,J> &MockRepository::RegisterExpect_(Y (__stdcall *func)(A,B,C,D,E,F,G,H,I,J), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+  Y (__stdcall *fp)(A,B,C,D,E,F,G,H,I,J);
+  fp = &mockFuncs<char, Y>::template static_stdcallexpectation10<X,A,B,C,D,E,F,G,H,I,J>;
+  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
+  TCall<Y,A,B,C,D,E,F,G,H,I,J> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
+  addCall( call, expect );
+  return *call;
+}
+template <int X, typename Y,
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I, typename J, typename K>
+TCall<Y,A,B,C,D,E,F,G,H,I,J,K> &MockRepository::RegisterExpect_(Y (__stdcall *func)(A,B,C,D,E,F,G,H,I,J,K), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+  Y (__stdcall *fp)(A,B,C,D,E,F,G,H,I,J,K);
+  fp = &mockFuncs<char, Y>::template static_stdcallexpectation11<X,A,B,C,D,E,F,G,H,I,J,K>;
+  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
+  TCall<Y,A,B,C,D,E,F,G,H,I,J,K> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J,K>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
+  addCall( call, expect );
+  return *call;
+}
+template <int X, typename Y,
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I, typename J, typename K, typename L>
+TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L> &MockRepository::RegisterExpect_(Y (__stdcall *func)(A,B,C,D,E,F,G,H,I,J,K,L), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+  Y (__stdcall *fp)(A,B,C,D,E,F,G,H,I,J,K,L);
+  fp = &mockFuncs<char, Y>::template static_stdcallexpectation12<X,A,B,C,D,E,F,G,H,I,J,K,L>;
+  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
+  TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
+  addCall( call, expect );
+  return *call;
+}
+template <int X, typename Y,
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I, typename J, typename K, typename L,
+		  typename M>
+TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M> &MockRepository::RegisterExpect_(Y (__stdcall *func)(A,B,C,D,E,F,G,H,I,J,K,L,M), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+  Y (__stdcall *fp)(A,B,C,D,E,F,G,H,I,J,K,L,M);
+  fp = &mockFuncs<char, Y>::template static_stdcallexpectation13<X,A,B,C,D,E,F,G,H,I,J,K,L,M>;
+  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
+  TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
+  addCall( call, expect );
+  return *call;
+}
+template <int X, typename Y,
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I, typename J, typename K, typename L,
+		  typename M, typename N>
+TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N> &MockRepository::RegisterExpect_(Y (__stdcall *func)(A,B,C,D,E,F,G,H,I,J,K,L,M,N), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+  Y (__stdcall *fp)(A,B,C,D,E,F,G,H,I,J,K,L,M,N);
+  fp = &mockFuncs<char, Y>::template static_stdcallexpectation14<X,A,B,C,D,E,F,G,H,I,J,K,L,M,N>;
+  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
+  TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
+  addCall( call, expect );
+  return *call;
+}
+template <int X, typename Y,
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I, typename J, typename K, typename L,
+		  typename M, typename N, typename O>
+TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O> &MockRepository::RegisterExpect_(Y (__stdcall *func)(A,B,C,D,E,F,G,H,I,J,K,L,M,N,O), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+{
+  Y (__stdcall *fp)(A,B,C,D,E,F,G,H,I,J,K,L,M,N,O);
+  fp = &mockFuncs<char, Y>::template static_stdcallexpectation15<X,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O>;
+  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
+  TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
+  addCall( call, expect );
+  return *call;
 }
 
-template <int X, typename Z2>
-TCall<void> &MockRepository::RegisterExpectDestructor(Z2 *mck, RegistrationType expect, const char *fileName, unsigned long lineNo)
+template <int X, typename Y,
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I, typename J, typename K, typename L,
+		  typename M, typename N, typename O, typename P>
+TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &MockRepository::RegisterExpect_(Y (__stdcall *func)(A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
 {
-	func_index idx;
-	((Z2 *)&idx)->~Z2();
-	int funcIndex = idx.lci * FUNCTION_STRIDE + FUNCTION_BASE;
-	void (mock<Z2>::*member)(int);
-	member = &mock<Z2>::template mockedDestructor<X>;
-	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
-						0, funcIndex,
-						reinterpret_cast<void (base_mock::*)()>(member), X);
-#ifdef EXTRA_DESTRUCTOR
-	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
-						0, funcIndex+1,
-						reinterpret_cast<void (base_mock::*)()>(member), X);
-#endif
-	TCall<void> *call = new TCall<void>(Once, reinterpret_cast<base_mock *>(mck), std::pair<int, int>(0, funcIndex), lineNo, "destructor", fileName);
-	addCall( call, expect );
-	return *call;
+  Y (__stdcall *fp)(A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P);
+  fp = &mockFuncs<char, Y>::template static_stdcallexpectation16<X,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P>;
+  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
+  TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
+  addCall( call, expect );
+  return *call;
 }
+#endif
+#endif
 
-#if defined(_MSC_VER) && !defined(_WIN64)
-// Support for COM, see declarations
 template <int X, typename Z2, typename Y, typename Z>
-TCall<Y> &MockRepository::RegisterExpect_(Z2 *mck, Y (__stdcall Z::*func)(), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+TCall<Y> &MockRepository::RegisterExpect_(Z2 *mck, Y (Z::*func)(), RegistrationType expect, const char *functionName, const char *fileName, unsigned long lineNo)
 {
-	std::pair<int, int> funcIndex = virtual_index((Y(__stdcall Z2::*)())func);
-	Y(__stdcall mockFuncs<Z2, Y>::*mfp)();
-	mfp = &mockFuncs<Z2, Y>::template stdcallexpectation0<X>;
+	std::pair<int, int> funcIndex = virtual_index((Y (Z2::*)())func);
+	Y (mockFuncs<Z2, Y>::*mfp)();
+	mfp = &mockFuncs<Z2, Y>::template expectation0<X>;
 	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
-		funcIndex.first,
-		funcIndex.second,
-		reinterpret_cast<void (base_mock::*)()>(mfp), X);
-	TCall<Y> *call = new TCall<Y>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, funcName, fileName);
+						funcIndex.first, funcIndex.second,
+						reinterpret_cast<void (base_mock::*)()>(mfp),X);
+	TCall<Y> *call = new TCall<Y>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, functionName ,fileName);
 
 	addCall( call, expect );
 	return *call;
 }
 template <int X, typename Z2, typename Y, typename Z, typename A>
-TCall<Y,A> &MockRepository::RegisterExpect_(Z2 *mck, Y (__stdcall Z::*func)(A), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+TCall<Y,A> &MockRepository::RegisterExpect_(Z2 *mck, Y (Z::*func)(A), RegistrationType expect, const char *functionName, const char *fileName, unsigned long lineNo)
 {
-	std::pair<int, int> funcIndex = virtual_index((Y(__stdcall Z2::*)(A))func);
-	Y(__stdcall mockFuncs<Z2, Y>::*mfp)(A);
-	mfp = &mockFuncs<Z2, Y>::template stdcallexpectation1<X, A>;
+	std::pair<int, int> funcIndex = virtual_index((Y(Z2::*)(A))func);
+	Y (mockFuncs<Z2, Y>::*mfp)(A);
+	mfp = &mockFuncs<Z2, Y>::template expectation1<X,A>;
 	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
-		funcIndex.first,
-		funcIndex.second,
-		reinterpret_cast<void (base_mock::*)()>(mfp), X);
-	TCall<Y, A> *call = new TCall<Y, A>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, funcName, fileName);
+						funcIndex.first, funcIndex.second,
+						reinterpret_cast<void (base_mock::*)()>(mfp),X);
+	TCall<Y,A> *call = new TCall<Y,A>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, functionName ,fileName);
 	addCall( call, expect );
 	return *call;
 }
 template <int X, typename Z2, typename Y, typename Z,
-	typename A, typename B>
-TCall<Y,A,B> &MockRepository::RegisterExpect_(Z2 *mck, Y (__stdcall Z::*func)(A,B), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
-{
-		std::pair<int, int> funcIndex = virtual_index((Y(__stdcall Z2::*)(A, B))func);
-		Y(__stdcall mockFuncs<Z2, Y>::*mfp)(A, B);
-		mfp = &mockFuncs<Z2, Y>::template stdcallexpectation2<X, A, B>;
-		BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
-			funcIndex.first,
-			funcIndex.second,
-			reinterpret_cast<void (base_mock::*)()>(mfp), X);
-		TCall<Y, A, B> *call = new TCall<Y, A, B>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, funcName, fileName);
-	addCall( call, expect );
-		return *call;
-}
-template <int X, typename Z2, typename Y, typename Z,
-	typename A, typename B, typename C>
-TCall<Y,A,B,C> &MockRepository::RegisterExpect_(Z2 *mck, Y (__stdcall Z::*func)(A,B,C), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+		  typename A, typename B>
+TCall<Y,A,B> &MockRepository::RegisterExpect_(Z2 *mck, Y (Z::*func)(A,B), RegistrationType expect, const char *functionName, const char *fileName, unsigned long lineNo)
 {
-		std::pair<int, int> funcIndex = virtual_index((Y(__stdcall Z2::*)(A, B, C))func);
-		Y(__stdcall mockFuncs<Z2, Y>::*mfp)(A, B, C);
-		mfp = &mockFuncs<Z2, Y>::template stdcallexpectation3<X, A, B, C>;
-		BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
-			funcIndex.first,
-			funcIndex.second,
-			reinterpret_cast<void (base_mock::*)()>(mfp), X);
-		TCall<Y, A, B, C> *call = new TCall<Y, A, B, C>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, funcName, fileName);
+	std::pair<int, int> funcIndex = virtual_index((Y(Z2::*)(A,B))func);
+	Y (mockFuncs<Z2, Y>::*mfp)(A,B);
+	mfp = &mockFuncs<Z2, Y>::template expectation2<X,A,B>;
+	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
+						funcIndex.first, funcIndex.second,
+						reinterpret_cast<void (base_mock::*)()>(mfp),X);
+	TCall<Y,A,B> *call = new TCall<Y,A,B>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, functionName ,fileName);
 	addCall( call, expect );
-		return *call;
+	return *call;
 }
 template <int X, typename Z2, typename Y, typename Z,
-	typename A, typename B, typename C, typename D>
-TCall<Y,A,B,C,D> &MockRepository::RegisterExpect_(Z2 *mck, Y (__stdcall Z::*func)(A,B,C,D), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+		  typename A, typename B, typename C>
+TCall<Y,A,B,C> &MockRepository::RegisterExpect_(Z2 *mck, Y (Z::*func)(A,B,C), RegistrationType expect, const char *functionName, const char *fileName, unsigned long lineNo)
 {
-		std::pair<int, int> funcIndex = virtual_index((Y(__stdcall Z2::*)(A, B, C, D))func);
-		Y(__stdcall mockFuncs<Z2, Y>::*mfp)(A, B, C, D);
-		mfp = &mockFuncs<Z2, Y>::template stdcallexpectation4<X, A, B, C, D>;
-		BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
-			funcIndex.first,
-			funcIndex.second,
-			reinterpret_cast<void (base_mock::*)()>(mfp), X);
-		TCall<Y, A, B, C, D> *call = new TCall<Y, A, B, C, D>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, funcName, fileName);
+	std::pair<int, int> funcIndex = virtual_index((Y(Z2::*)(A,B,C))func);
+	Y (mockFuncs<Z2, Y>::*mfp)(A,B,C);
+	mfp = &mockFuncs<Z2, Y>::template expectation3<X,A,B,C>;
+	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
+						funcIndex.first, funcIndex.second,
+						reinterpret_cast<void (base_mock::*)()>(mfp),X);
+	TCall<Y,A,B,C> *call = new TCall<Y,A,B,C>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, functionName ,fileName);
 	addCall( call, expect );
-		return *call;
+	return *call;
 }
 template <int X, typename Z2, typename Y, typename Z,
-	typename A, typename B, typename C, typename D,
-	typename E>
-TCall<Y,A,B,C,D,E> &MockRepository::RegisterExpect_(Z2 *mck, Y (__stdcall Z::*func)(A,B,C,D,E), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+		  typename A, typename B, typename C, typename D>
+TCall<Y,A,B,C,D> &MockRepository::RegisterExpect_(Z2 *mck, Y (Z::*func)(A,B,C,D), RegistrationType expect, const char *functionName, const char *fileName, unsigned long lineNo)
 {
-		std::pair<int, int> funcIndex = virtual_index((Y(__stdcall Z2::*)(A, B, C, D, E))func);
-		Y(__stdcall mockFuncs<Z2, Y>::*mfp)(A, B, C, D, E);
-		mfp = &mockFuncs<Z2, Y>::template stdcallexpectation5<X, A, B, C, D, E>;
-		BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
-			funcIndex.first,
-			funcIndex.second,
-			reinterpret_cast<void (base_mock::*)()>(mfp), X);
-		TCall<Y, A, B, C, D, E> *call = new TCall<Y, A, B, C, D, E>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, funcName, fileName);
+	std::pair<int, int> funcIndex = virtual_index((Y(Z2::*)(A,B,C,D))func);
+	Y (mockFuncs<Z2, Y>::*mfp)(A,B,C,D);
+	mfp = &mockFuncs<Z2, Y>::template expectation4<X,A,B,C,D>;
+	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
+						funcIndex.first, funcIndex.second,
+						reinterpret_cast<void (base_mock::*)()>(mfp),X);
+	TCall<Y,A,B,C,D> *call = new TCall<Y,A,B,C,D>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, functionName ,fileName);
 	addCall( call, expect );
-		return *call;
+	return *call;
 }
 template <int X, typename Z2, typename Y, typename Z,
-	typename A, typename B, typename C, typename D,
-	typename E, typename F>
-TCall<Y,A,B,C,D,E,F> &MockRepository::RegisterExpect_(Z2 *mck, Y (__stdcall Z::*func)(A,B,C,D,E,F), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+		  typename A, typename B, typename C, typename D,
+		  typename E>
+TCall<Y,A,B,C,D,E> &MockRepository::RegisterExpect_(Z2 *mck, Y (Z::*func)(A,B,C,D,E), RegistrationType expect, const char *functionName, const char *fileName, unsigned long lineNo)
 {
-		std::pair<int, int> funcIndex = virtual_index((Y(__stdcall Z2::*)(A, B, C, D, E, F))func);
-		Y(__stdcall mockFuncs<Z2, Y>::*mfp)(A, B, C, D, E, F);
-		mfp = &mockFuncs<Z2, Y>::template stdcallexpectation6<X, A, B, C, D, E, F>;
-		BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
-			funcIndex.first,
-			funcIndex.second,
-			reinterpret_cast<void (base_mock::*)()>(mfp), X);
-		TCall<Y, A, B, C, D, E, F> *call = new TCall<Y, A, B, C, D, E, F>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, funcName, fileName);
+	std::pair<int, int> funcIndex = virtual_index((Y(Z2::*)(A,B,C,D,E))func);
+	Y (mockFuncs<Z2, Y>::*mfp)(A,B,C,D,E);
+	mfp = &mockFuncs<Z2, Y>::template expectation5<X,A,B,C,D,E>;
+	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
+						funcIndex.first, funcIndex.second,
+						reinterpret_cast<void (base_mock::*)()>(mfp),X);
+	TCall<Y,A,B,C,D,E> *call = new TCall<Y,A,B,C,D,E>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, functionName ,fileName);
 	addCall( call, expect );
-		return *call;
+	return *call;
 }
 template <int X, typename Z2, typename Y, typename Z,
-	typename A, typename B, typename C, typename D,
-	typename E, typename F, typename G>
-TCall<Y,A,B,C,D,E,F,G> &MockRepository::RegisterExpect_(Z2 *mck, Y (__stdcall Z::*func)(A,B,C,D,E,F,G), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F>
+TCall<Y,A,B,C,D,E,F> &MockRepository::RegisterExpect_(Z2 *mck, Y (Z::*func)(A,B,C,D,E,F), RegistrationType expect, const char *functionName, const char *fileName, unsigned long lineNo)
 {
-		std::pair<int, int> funcIndex = virtual_index((Y(__stdcall Z2::*)(A, B, C, D, E, F, G))func);
-		Y(__stdcall mockFuncs<Z2, Y>::*mfp)(A, B, C, D, E, F, G);
-		mfp = &mockFuncs<Z2, Y>::template stdcallexpectation7<X, A, B, C, D, E, F, G>;
-		BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
-			funcIndex.first,
-			funcIndex.second,
-			reinterpret_cast<void (base_mock::*)()>(mfp), X);
-		TCall<Y, A, B, C, D, E, F, G> *call = new TCall<Y, A, B, C, D, E, F, G>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, funcName, fileName);
+	std::pair<int, int> funcIndex = virtual_index((Y(Z2::*)(A,B,C,D,E,F))func);
+	Y (mockFuncs<Z2, Y>::*mfp)(A,B,C,D,E,F);
+	mfp = &mockFuncs<Z2, Y>::template expectation6<X,A,B,C,D,E,F>;
+	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
+						funcIndex.first, funcIndex.second,
+						reinterpret_cast<void (base_mock::*)()>(mfp),X);
+	TCall<Y,A,B,C,D,E,F> *call = new TCall<Y,A,B,C,D,E,F>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, functionName ,fileName);
 	addCall( call, expect );
-		return *call;
+	return *call;
 }
 template <int X, typename Z2, typename Y, typename Z,
-	typename A, typename B, typename C, typename D,
-	typename E, typename F, typename G, typename H>
-TCall<Y,A,B,C,D,E,F,G,H> &MockRepository::RegisterExpect_(Z2 *mck, Y (__stdcall Z::*func)(A,B,C,D,E,F,G,H), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G>
+TCall<Y,A,B,C,D,E,F,G> &MockRepository::RegisterExpect_(Z2 *mck, Y (Z::*func)(A,B,C,D,E,F,G), RegistrationType expect, const char *functionName, const char *fileName, unsigned long lineNo)
 {
-		std::pair<int, int> funcIndex = virtual_index((Y(__stdcall Z2::*)(A, B, C, D, E, F, G, H))func);
-		Y(__stdcall mockFuncs<Z2, Y>::*mfp)(A, B, C, D, E, F, G, H);
-		mfp = &mockFuncs<Z2, Y>::template stdcallexpectation8<X, A, B, C, D, E, F, G, H>;
-		BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
-			funcIndex.first,
-			funcIndex.second,
-			reinterpret_cast<void (base_mock::*)()>(mfp), X);
-		TCall<Y, A, B, C, D, E, F, G, H> *call = new TCall<Y, A, B, C, D, E, F, G, H>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, funcName, fileName);
+	std::pair<int, int> funcIndex = virtual_index((Y(Z2::*)(A,B,C,D,E,F,G))func);
+	Y (mockFuncs<Z2, Y>::*mfp)(A,B,C,D,E,F,G);
+	mfp = &mockFuncs<Z2, Y>::template expectation7<X,A,B,C,D,E,F,G>;
+	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
+						funcIndex.first, funcIndex.second,
+						reinterpret_cast<void (base_mock::*)()>(mfp),X);
+	TCall<Y,A,B,C,D,E,F,G> *call = new TCall<Y,A,B,C,D,E,F,G>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, functionName ,fileName);
 	addCall( call, expect );
-		return *call;
+	return *call;
 }
 template <int X, typename Z2, typename Y, typename Z,
-	typename A, typename B, typename C, typename D,
-	typename E, typename F, typename G, typename H,
-	typename I>
-TCall<Y,A,B,C,D,E,F,G,H,I> &MockRepository::RegisterExpect_(Z2 *mck, Y (__stdcall Z::*func)(A,B,C,D,E,F,G,H,I), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H>
+TCall<Y,A,B,C,D,E,F,G,H> &MockRepository::RegisterExpect_(Z2 *mck, Y (Z::*func)(A,B,C,D,E,F,G,H), RegistrationType expect, const char *functionName, const char *fileName, unsigned long lineNo)
 {
-		std::pair<int, int> funcIndex = virtual_index((Y(__stdcall Z2::*)(A, B, C, D, E, F, G, H, I))func);
-		Y(__stdcall mockFuncs<Z2, Y>::*mfp)(A, B, C, D, E, F, G, H, I);
-		mfp = &mockFuncs<Z2, Y>::template stdcallexpectation9<X, A, B, C, D, E, F, G, H, I>;
-		BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
-			funcIndex.first,
-			funcIndex.second,
-			reinterpret_cast<void (base_mock::*)()>(mfp), X);
-		TCall<Y, A, B, C, D, E, F, G, H, I> *call = new TCall<Y, A, B, C, D, E, F, G, H, I>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, funcName, fileName);
+	std::pair<int, int> funcIndex = virtual_index((Y(Z2::*)(A,B,C,D,E,F,G,H))func);
+	Y (mockFuncs<Z2, Y>::*mfp)(A,B,C,D,E,F,G,H);
+	mfp = &mockFuncs<Z2, Y>::template expectation8<X,A,B,C,D,E,F,G,H>;
+	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
+						funcIndex.first, funcIndex.second,
+						reinterpret_cast<void (base_mock::*)()>(mfp),X);
+	TCall<Y,A,B,C,D,E,F,G,H> *call = new TCall<Y,A,B,C,D,E,F,G,H>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, functionName ,fileName);
 	addCall( call, expect );
-		return *call;
+	return *call;
 }
 template <int X, typename Z2, typename Y, typename Z,
-	typename A, typename B, typename C, typename D,
-	typename E, typename F, typename G, typename H,
-	typename I, typename J>
-TCall<Y,A,B,C,D,E,F,G,H,I,J> &MockRepository::RegisterExpect_(Z2 *mck, Y (__stdcall Z::*func)(A,B,C,D,E,F,G,H,I,J), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I>
+TCall<Y,A,B,C,D,E,F,G,H,I> &MockRepository::RegisterExpect_(Z2 *mck, Y (Z::*func)(A,B,C,D,E,F,G,H,I), RegistrationType expect, const char *functionName, const char *fileName, unsigned long lineNo)
 {
-		std::pair<int, int> funcIndex = virtual_index((Y(__stdcall Z2::*)(A, B, C, D, E, F, G, H, I, J))func);
-		Y(__stdcall mockFuncs<Z2, Y>::*mfp)(A, B, C, D, E, F, G, H, I, J);
-		mfp = &mockFuncs<Z2, Y>::template stdcallexpectation10<X, A, B, C, D, E, F, G, H, I, J>;
-		BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
-			funcIndex.first,
-			funcIndex.second,
-			reinterpret_cast<void (base_mock::*)()>(mfp), X);
-		TCall<Y, A, B, C, D, E, F, G, H, I, J> *call = new TCall<Y, A, B, C, D, E, F, G, H, I, J>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, funcName, fileName);
+	std::pair<int, int> funcIndex = virtual_index((Y(Z2::*)(A,B,C,D,E,F,G,H,I))func);
+	Y (mockFuncs<Z2, Y>::*mfp)(A,B,C,D,E,F,G,H,I);
+	mfp = &mockFuncs<Z2, Y>::template expectation9<X,A,B,C,D,E,F,G,H,I>;
+	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
+						funcIndex.first, funcIndex.second,
+						reinterpret_cast<void (base_mock::*)()>(mfp),X);
+	TCall<Y,A,B,C,D,E,F,G,H,I> *call = new TCall<Y,A,B,C,D,E,F,G,H,I>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, functionName ,fileName);
 	addCall( call, expect );
-		return *call;
+	return *call;
 }
 template <int X, typename Z2, typename Y, typename Z,
-	typename A, typename B, typename C, typename D,
-	typename E, typename F, typename G, typename H,
-	typename I, typename J, typename K>
-TCall<Y,A,B,C,D,E,F,G,H,I,J,K> &MockRepository::RegisterExpect_(Z2 *mck, Y (__stdcall Z::*func)(A,B,C,D,E,F,G,H,I,J,K), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I, typename J>
+TCall<Y,A,B,C,D,E,F,G,H,I,J> &MockRepository::RegisterExpect_(Z2 *mck, Y (Z::*func)(A,B,C,D,E,F,G,H,I,J), RegistrationType expect, const char *functionName, const char *fileName, unsigned long lineNo)
 {
-		std::pair<int, int> funcIndex = virtual_index((Y(__stdcall Z2::*)(A, B, C, D, E, F, G, H, I, J, K))func);
-		Y(__stdcall mockFuncs<Z2, Y>::*mfp)(A, B, C, D, E, F, G, H, I, J, K);
-		mfp = &mockFuncs<Z2, Y>::template stdcallexpectation11<X, A, B, C, D, E, F, G, H, I, J, K>;
-		BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
-			funcIndex.first,
-			funcIndex.second,
-			reinterpret_cast<void (base_mock::*)()>(mfp), X);
-		TCall<Y, A, B, C, D, E, F, G, H, I, J, K> *call = new TCall<Y, A, B, C, D, E, F, G, H, I, J, K>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, funcName, fileName);
+	std::pair<int, int> funcIndex = virtual_index((Y(Z2::*)(A,B,C,D,E,F,G,H,I,J))func);
+	Y (mockFuncs<Z2, Y>::*mfp)(A,B,C,D,E,F,G,H,I,J);
+	mfp = &mockFuncs<Z2, Y>::template expectation10<X,A,B,C,D,E,F,G,H,I,J>;
+	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
+						funcIndex.first, funcIndex.second,
+						reinterpret_cast<void (base_mock::*)()>(mfp),X);
+	TCall<Y,A,B,C,D,E,F,G,H,I,J> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, functionName ,fileName);
 	addCall( call, expect );
-		return *call;
+	return *call;
 }
 template <int X, typename Z2, typename Y, typename Z,
-	typename A, typename B, typename C, typename D,
-	typename E, typename F, typename G, typename H,
-	typename I, typename J, typename K, typename L>
-TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L> &MockRepository::RegisterExpect_(Z2 *mck, Y (__stdcall Z::*func)(A,B,C,D,E,F,G,H,I,J,K,L), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I, typename J, typename K>
+TCall<Y,A,B,C,D,E,F,G,H,I,J,K> &MockRepository::RegisterExpect_(Z2 *mck, Y (Z::*func)(A,B,C,D,E,F,G,H,I,J,K), RegistrationType expect, const char *functionName, const char *fileName, unsigned long lineNo)
 {
-		std::pair<int, int> funcIndex = virtual_index((Y(__stdcall Z2::*)(A, B, C, D, E, F, G, H, I, J, K, L))func);
-		Y(__stdcall mockFuncs<Z2, Y>::*mfp)(A, B, C, D, E, F, G, H, I, J, K, L);
-		mfp = &mockFuncs<Z2, Y>::template stdcallexpectation12<X, A, B, C, D, E, F, G, H, I, J, K, L>;
-		BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
-			funcIndex.first,
-			funcIndex.second,
-			reinterpret_cast<void (base_mock::*)()>(mfp), X);
-		TCall<Y, A, B, C, D, E, F, G, H, I, J, K, L> *call = new TCall<Y, A, B, C, D, E, F, G, H, I, J, K, L>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, funcName, fileName);
+	std::pair<int, int> funcIndex = virtual_index((Y(Z2::*)(A,B,C,D,E,F,G,H,I,J,K))func);
+	Y (mockFuncs<Z2, Y>::*mfp)(A,B,C,D,E,F,G,H,I,J,K);
+	mfp = &mockFuncs<Z2, Y>::template expectation11<X,A,B,C,D,E,F,G,H,I,J,K>;
+	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
+						funcIndex.first, funcIndex.second,
+						reinterpret_cast<void (base_mock::*)()>(mfp),X);
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J,K>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, functionName ,fileName);
 	addCall( call, expect );
-		return *call;
+	return *call;
 }
 template <int X, typename Z2, typename Y, typename Z,
-	typename A, typename B, typename C, typename D,
-	typename E, typename F, typename G, typename H,
-	typename I, typename J, typename K, typename L,
-	typename M>
-TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M> &MockRepository::RegisterExpect_(Z2 *mck, Y (__stdcall Z::*func)(A,B,C,D,E,F,G,H,I,J,K,L,M), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I, typename J, typename K, typename L>
+TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L> &MockRepository::RegisterExpect_(Z2 *mck, Y (Z::*func)(A,B,C,D,E,F,G,H,I,J,K,L), RegistrationType expect, const char *functionName, const char *fileName, unsigned long lineNo)
 {
-		std::pair<int, int> funcIndex = virtual_index((Y(__stdcall Z2::*)(A, B, C, D, E, F, G, H, I, J, K, L, M))func);
-		Y(__stdcall mockFuncs<Z2, Y>::*mfp)(A, B, C, D, E, F, G, H, I, J, K, L, M);
-		mfp = &mockFuncs<Z2, Y>::template stdcallexpectation13<X, A, B, C, D, E, F, G, H, I, J, K, L, M>;
-		BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
-			funcIndex.first,
-			funcIndex.second,
-			reinterpret_cast<void (base_mock::*)()>(mfp), X);
-		TCall<Y, A, B, C, D, E, F, G, H, I, J, K, L, M> *call = new TCall<Y, A, B, C, D, E, F, G, H, I, J, K, L, M>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, funcName, fileName);
+	std::pair<int, int> funcIndex = virtual_index((Y(Z2::*)(A,B,C,D,E,F,G,H,I,J,K,L))func);
+	Y (mockFuncs<Z2, Y>::*mfp)(A,B,C,D,E,F,G,H,I,J,K,L);
+	mfp = &mockFuncs<Z2, Y>::template expectation12<X,A,B,C,D,E,F,G,H,I,J,K,L>;
+	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
+						funcIndex.first, funcIndex.second,
+						reinterpret_cast<void (base_mock::*)()>(mfp),X);
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, functionName ,fileName);
 	addCall( call, expect );
-		return *call;
+	return *call;
 }
 template <int X, typename Z2, typename Y, typename Z,
-	typename A, typename B, typename C, typename D,
-	typename E, typename F, typename G, typename H,
-	typename I, typename J, typename K, typename L,
-	typename M, typename N>
-TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N> &MockRepository::RegisterExpect_(Z2 *mck, Y (__stdcall Z::*func)(A,B,C,D,E,F,G,H,I,J,K,L,M,N), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I, typename J, typename K, typename L,
+		  typename M>
+TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M> &MockRepository::RegisterExpect_(Z2 *mck, Y (Z::*func)(A,B,C,D,E,F,G,H,I,J,K,L,M), RegistrationType expect, const char *functionName, const char *fileName, unsigned long lineNo)
 {
-		std::pair<int, int> funcIndex = virtual_index((Y(__stdcall Z2::*)(A, B, C, D, E, F, G, H, I, J, K, L, M, N))func);
-		Y(__stdcall mockFuncs<Z2, Y>::*mfp)(A, B, C, D, E, F, G, H, I, J, K, L, M, N);
-		mfp = &mockFuncs<Z2, Y>::template stdcallexpectation14<X, A, B, C, D, E, F, G, H, I, J, K, L, M, N>;
-		BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
-			funcIndex.first,
-			funcIndex.second,
-			reinterpret_cast<void (base_mock::*)()>(mfp), X);
-		TCall<Y, A, B, C, D, E, F, G, H, I, J, K, L, M, N> *call = new TCall<Y, A, B, C, D, E, F, G, H, I, J, K, L, M, N>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, funcName, fileName);
+	std::pair<int, int> funcIndex = virtual_index((Y(Z2::*)(A,B,C,D,E,F,G,H,I,J,K,L,M))func);
+	Y (mockFuncs<Z2, Y>::*mfp)(A,B,C,D,E,F,G,H,I,J,K,L,M);
+	mfp = &mockFuncs<Z2, Y>::template expectation13<X,A,B,C,D,E,F,G,H,I,J,K,L,M>;
+	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
+						funcIndex.first, funcIndex.second,
+						reinterpret_cast<void (base_mock::*)()>(mfp),X);
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, functionName ,fileName);
+	addCall( call, expect );
+	return *call;
+}
+template <int X, typename Z2, typename Y, typename Z,
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I, typename J, typename K, typename L,
+		  typename M, typename N>
+TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N> &MockRepository::RegisterExpect_(Z2 *mck, Y (Z::*func)(A,B,C,D,E,F,G,H,I,J,K,L,M,N), RegistrationType expect, const char *functionName, const char *fileName, unsigned long lineNo)
+{
+	std::pair<int, int> funcIndex = virtual_index((Y(Z2::*)(A,B,C,D,E,F,G,H,I,J,K,L,M,N))func);
+	Y (mockFuncs<Z2, Y>::*mfp)(A,B,C,D,E,F,G,H,I,J,K,L,M,N);
+	mfp = &mockFuncs<Z2, Y>::template expectation14<X,A,B,C,D,E,F,G,H,I,J,K,L,M,N>;
+	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
+						funcIndex.first, funcIndex.second,
+						reinterpret_cast<void (base_mock::*)()>(mfp),X);
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, functionName ,fileName);
 	addCall( call, expect );
-		return *call;
+	return *call;
 }
 template <int X, typename Z2, typename Y, typename Z,
-	typename A, typename B, typename C, typename D,
-	typename E, typename F, typename G, typename H,
-	typename I, typename J, typename K, typename L,
-	typename M, typename N, typename O>
-TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O> &MockRepository::RegisterExpect_(Z2 *mck, Y (__stdcall Z::*func)(A,B,C,D,E,F,G,H,I,J,K,L,M,N,O), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I, typename J, typename K, typename L,
+		  typename M, typename N, typename O>
+TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O> &MockRepository::RegisterExpect_(Z2 *mck, Y (Z::*func)(A,B,C,D,E,F,G,H,I,J,K,L,M,N,O), RegistrationType expect, const char *functionName, const char *fileName, unsigned long lineNo)
 {
-		std::pair<int, int> funcIndex = virtual_index((Y(__stdcall Z2::*)(A, B, C, D, E, F, G, H, I, J, K, L, M, N, O))func);
-		Y(__stdcall mockFuncs<Z2, Y>::*mfp)(A, B, C, D, E, F, G, H, I, J, K, L, M, N, O);
-		mfp = &mockFuncs<Z2, Y>::template stdcallexpectation15<X, A, B, C, D, E, F, G, H, I, J, K, L, M, N, O>;
-		BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
-			funcIndex.first,
-			funcIndex.second,
-			reinterpret_cast<void (base_mock::*)()>(mfp), X);
-		TCall<Y, A, B, C, D, E, F, G, H, I, J, K, L, M, N, O> *call = new TCall<Y, A, B, C, D, E, F, G, H, I, J, K, L, M, N, O>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, funcName, fileName);
+	std::pair<int, int> funcIndex = virtual_index((Y(Z2::*)(A,B,C,D,E,F,G,H,I,J,K,L,M,N,O))func);
+	Y (mockFuncs<Z2, Y>::*mfp)(A,B,C,D,E,F,G,H,I,J,K,L,M,N,O);
+	mfp = &mockFuncs<Z2, Y>::template expectation15<X,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O>;
+	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
+						funcIndex.first, funcIndex.second,
+						reinterpret_cast<void (base_mock::*)()>(mfp),X);
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, functionName ,fileName);
 	addCall( call, expect );
-		return *call;
+	return *call;
 }
 
 template <int X, typename Z2, typename Y, typename Z,
-	typename A, typename B, typename C, typename D,
-	typename E, typename F, typename G, typename H,
-	typename I, typename J, typename K, typename L,
-	typename M, typename N, typename O, typename P>
-TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &MockRepository::RegisterExpect_(Z2 *mck, Y (__stdcall Z::*func)(A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+		  typename A, typename B, typename C, typename D,
+		  typename E, typename F, typename G, typename H,
+		  typename I, typename J, typename K, typename L,
+		  typename M, typename N, typename O, typename P>
+TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &MockRepository::RegisterExpect_(Z2 *mck, Y (Z::*func)(A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P), RegistrationType expect, const char *functionName, const char *fileName, unsigned long lineNo)
 {
-		std::pair<int, int> funcIndex = virtual_index((Y(__stdcall Z2::*)(A, B, C, D, E, F, G, H, I, J, K, L, M, N, O, P))func);
-		Y(__stdcall mockFuncs<Z2, Y>::*mfp)(A, B, C, D, E, F, G, H, I, J, K, L, M, N, O, P);
-		mfp = &mockFuncs<Z2, Y>::template stdcallexpectation16<X, A, B, C, D, E, F, G, H, I, J, K, L, M, N, O, P>;
-		BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
-			funcIndex.first,
-			funcIndex.second,
-			reinterpret_cast<void (base_mock::*)()>(mfp), X);
-		TCall<Y, A, B, C, D, E, F, G, H, I, J, K, L, M, N, O, P> *call = new TCall<Y, A, B, C, D, E, F, G, H, I, J, K, L, M, N, O, P>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, funcName, fileName);
+	std::pair<int, int> funcIndex = virtual_index((Y(Z2::*)(A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P))func);
+	Y (mockFuncs<Z2, Y>::*mfp)(A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P);
+	mfp = &mockFuncs<Z2, Y>::template expectation16<X,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P>;
+	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
+						funcIndex.first, funcIndex.second,
+						reinterpret_cast<void (base_mock::*)()>(mfp),X);
+	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, functionName ,fileName);
 	addCall( call, expect );
-		return *call;
+	return *call;
 }
-#endif
 
-#ifdef _HIPPOMOCKS__ENABLE_CFUNC_MOCKING_SUPPORT
-template <int X, typename Y>
-TCall<Y> &MockRepository::RegisterExpect_(Y (*func)(), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+template <typename Z>
+Z MockRepository::DoExpectation(base_mock *mock, std::pair<int, int> funcno, const base_tuple &tuple)
 {
-  Y (*fp)();
-  fp = &mockFuncs<char, Y>::template static_expectation0<X>;
-  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
-  TCall<Y> *call = new TCall<Y>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
-  addCall( call, expect );
-  return *call;
+	useAllocator();
+#ifdef HM_DISPATCH_HOOKS
+	DispatchScope scope(this, mock, funcno, tuple);
+#endif
+	if (fingerprintCalls)
+		fingerprintCache.begin();
+	for (CallList::reverse_iterator i = neverCalls.rbegin(); i != neverCalls.rend(); ++i)
+	{
+		Call *call = *i;
+		if ( matches( call, mock, funcno, tuple ) )
+		{
+			if (!call->satisfied)
+				setSatisfied( call, true );
+#ifdef HM_DISPATCH_HOOKS
+			scope.setCall(call);
+#endif
+#ifdef HM_DISPATCH_STATS
+			noteException(call);
+#endif
+			RAISEEXCEPTION(ExpectationException(this, call->getArgs(), call->funcName, mock, funcno, &tuple));
+		}
+	}
+   for (CallList::reverse_iterator i = expectations.rbegin(); i != expectations.rend(); ++i)
+	{
+		Call *call = *i;
+		if( isUnsatisfied( call, mock, funcno, tuple ) )
+		{
+			return doReturnCall<Z>( call, tuple );
+		}
+	}
+	if (Call *call = findOptional( mock, funcno, tuple ))
+	{
+		return doReturnCall<Z>( call, tuple );
+	}
+#ifdef HM_DISPATCH_HOOKS
+	scope.setCall(NULL);
+#endif
+#ifdef HM_DISPATCH_STATS
+	noteException(NULL);
+#endif
+	RAISEEXCEPTION(ExpectationException(this, &tuple, funcName(mock,funcno), mock, funcno, &tuple));
 }
-template <int X, typename Y, typename A>
-TCall<Y,A> &MockRepository::RegisterExpect_(Y (*func)(A), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
-{
-  Y (*fp)(A);
-  fp = &mockFuncs<char, Y>::template static_expectation1<X,A>;
-  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
-  TCall<Y,A> *call = new TCall<Y,A>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
-  addCall( call, expect );
-  return *call;
+template <typename base>
+base *MockRepository::Mock() {
+	useAllocator();
+	return addMock(poolMocks ? MockPool<base>::borrow(this, false) : new mock<base>(this, false));
 }
-template <int X, typename Y,
-		  typename A, typename B>
-TCall<Y,A,B> &MockRepository::RegisterExpect_(Y (*func)(A,B), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
-{
-  Y (*fp)(A,B);
-  fp = &mockFuncs<char, Y>::template static_expectation2<X,A,B>;
-  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
-  TCall<Y,A,B> *call = new TCall<Y,A,B>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
-  addCall( call, expect );
-  return *call;
+#ifdef _HIPPOMOCKS__ENABLE_STUB_SUPPORT
+template <typename base>
+base *MockRepository::Stub() {
+	useAllocator();
+	return addMock(poolMocks ? MockPool<base>::borrow(this, true) : new mock<base>(this, true));
 }
-template <int X, typename Y,
-		  typename A, typename B, typename C>
-TCall<Y,A,B,C> &MockRepository::RegisterExpect_(Y (*func)(A,B,C), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
-{
-  Y (*fp)(A,B,C);
-  fp = &mockFuncs<char, Y>::template static_expectation3<X,A,B,C>;
-  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
-  TCall<Y,A,B,C> *call = new TCall<Y,A,B,C>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
-  addCall( call, expect );
-  return *call;
+#endif
+template <typename base>
+base *MockRepository::MockAt(MockStorage<base> &storage) {
+	useAllocator();
+	void (**table)() = reinterpret_cast<void (**)()>(storage.bytes + sizeof(mock<base>));
+	return addMock(new (storage.bytes) mock<base>(this, false, table));
 }
-template <int X, typename Y,
-		  typename A, typename B, typename C, typename D>
-TCall<Y,A,B,C,D> &MockRepository::RegisterExpect_(Y (*func)(A,B,C,D), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
-{
-  Y (*fp)(A,B,C,D);
-  fp = &mockFuncs<char, Y>::template static_expectation4<X,A,B,C,D>;
-  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
-  TCall<Y,A,B,C,D> *call = new TCall<Y,A,B,C,D>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
-  addCall( call, expect );
-  return *call;
+template <typename base>
+base *MockRepository::addMock(mock<base> *m) {
+		mocks.push_back(m);
+#ifdef HM_CALL_TRACE
+	unsigned id = (unsigned)mockIds.size() + 1;
+	mockIds[m] = id;
+#endif
+	return reinterpret_cast<base *>(m);
 }
-template <int X, typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E>
-TCall<Y,A,B,C,D,E> &MockRepository::RegisterExpect_(Y (*func)(A,B,C,D,E), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+#if !defined(HM_COMPILED) || defined(HM_IMPLEMENTATION)
+// Non-template implementation. In header-only mode (the default) this is emitted inline in every
+// translation unit; with HM_COMPILED it is only compiled into the unit that defines HM_IMPLEMENTATION.
+
+HM_INLINE ExpectationException::ExpectationException(MockRepository *repo, const base_tuple *tuple, const char *funcName,
+                                                     base_mock *mock, std::pair<int, int> funcno, const base_tuple *actual)
 {
-  Y (*fp)(A,B,C,D,E);
-  fp = &mockFuncs<char, Y>::template static_expectation5<X,A,B,C,D,E>;
-  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
-  TCall<Y,A,B,C,D,E> *call = new TCall<Y,A,B,C,D,E>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
-  addCall( call, expect );
-  return *call;
+	std::stringstream text;
+	text << "Function ";
+	text << funcName;
+	if (tuple)
+		tuple->printTo(text);
+	else
+		text << "(...)";
+	text << " called with mismatching expectation!" << std::endl;
+	if (repo->nearestCandidates)
+		repo->printNearest(text, mock, funcno, actual);
+	else
+		text << *repo;
+	txt = text.str();
 }
-template <int X, typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F>
-TCall<Y,A,B,C,D,E,F> &MockRepository::RegisterExpect_(Y (*func)(A,B,C,D,E,F), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+
+HM_INLINE NotImplementedException::NotImplementedException(MockRepository *repo)
 {
-  Y (*fp)(A,B,C,D,E,F);
-  fp = &mockFuncs<char, Y>::template static_expectation6<X,A,B,C,D,E,F>;
-  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
-  TCall<Y,A,B,C,D,E,F> *call = new TCall<Y,A,B,C,D,E,F>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
-  addCall( call, expect );
-  return *call;
+	std::stringstream text;
+	text << "Function called without expectation!" << std::endl;
+	text << *repo;
+
+#ifdef LINUX_TARGET
+	void* stacktrace[256];
+	size_t size = backtrace( stacktrace, sizeof(stacktrace) );
+	if( size > 0 )
+	{
+		text << "Stackdump:" << std::endl;
+		char **symbols = backtrace_symbols( stacktrace, size );
+		for( size_t i = 0; i < size; i = i + 1 )
+		{
+			text << symbols[i] << std::endl;
+		}
+		free( symbols );
+	}
+#endif
+
+	txt = text.str();
 }
-template <int X, typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G>
-TCall<Y,A,B,C,D,E,F,G> &MockRepository::RegisterExpect_(Y (*func)(A,B,C,D,E,F,G), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+
+HM_INLINE CallMissingException::CallMissingException(MockRepository *repo)
 {
-  Y (*fp)(A,B,C,D,E,F,G);
-  fp = &mockFuncs<char, Y>::template static_expectation7<X,A,B,C,D,E,F,G>;
-  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
-  TCall<Y,A,B,C,D,E,F,G> *call = new TCall<Y,A,B,C,D,E,F,G>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
-   addCall( call, expect );
-  return *call;
+	std::stringstream text;
+	text << "Function with expectation not called!" << std::endl;
+	text << *repo;
+	txt = text.str();
 }
-template <int X, typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H>
-TCall<Y,A,B,C,D,E,F,G,H> &MockRepository::RegisterExpect_(Y (*func)(A,B,C,D,E,F,G,H), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+
+HM_INLINE ZombieMockException::ZombieMockException(MockRepository *repo)
 {
-  Y (*fp)(A,B,C,D,E,F,G,H);
-  fp = &mockFuncs<char, Y>::template static_expectation8<X,A,B,C,D,E,F,G,H>;
-  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
-  TCall<Y,A,B,C,D,E,F,G,H> *call = new TCall<Y,A,B,C,D,E,F,G,H>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
-  addCall( call, expect );
-  return *call;
+	std::stringstream text;
+	text << "Function called on mock that has already been destroyed!" << std::endl;
+	text << *repo;
+
+#ifdef LINUX_TARGET
+	void* stacktrace[256];
+	size_t size = backtrace( stacktrace, sizeof(stacktrace) );
+	if( size > 0 )
+	{
+		text << "Stackdump:" << std::endl;
+		char **symbols = backtrace_symbols( stacktrace, size );
+		for( size_t i = 0; i < size; i = i + 1 )
+		{
+			text << symbols[i] << std::endl;
+		}
+		free( symbols );
+	}
+#endif
+
+	txt = text.str();
 }
-template <int X, typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I>
-TCall<Y,A,B,C,D,E,F,G,H,I> &MockRepository::RegisterExpect_(Y (*func)(A,B,C,D,E,F,G,H,I), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+
+HM_INLINE NoResultSetUpException::NoResultSetUpException(MockRepository *repo, const base_tuple *tuple, const char *funcName)
 {
-  Y (*fp)(A,B,C,D,E,F,G,H,I);
-  fp = &mockFuncs<char, Y>::template static_expectation9<X,A,B,C,D,E,F,G,H,I>;
-  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
-  TCall<Y,A,B,C,D,E,F,G,H,I> *call = new TCall<Y,A,B,C,D,E,F,G,H,I>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
-  addCall( call, expect );
-  return *call;
+	std::stringstream text;
+	text << "No result set up on call to ";
+	text << funcName;
+	if (tuple)
+		tuple->printTo(text);
+	else
+		text << "(...)";
+	text << std::endl;
+	text << *repo;
+
+#ifdef LINUX_TARGET
+	void* stacktrace[256];
+	size_t size = backtrace( stacktrace, sizeof(stacktrace) );
+	if( size > 0 )
+	{
+		text << "Stackdump:" << std::endl;
+		char **symbols = backtrace_symbols( stacktrace, size );
+		for( size_t i = 0; i < size; i = i + 1 )
+		{
+			text << symbols[i] << std::endl;
+		}
+		free( symbols );
+	}
+#endif
+
+	txt = text.str();
 }
-template <int X, typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J>
-TCall<Y,A,B,C,D,E,F,G,H,I,J> &MockRepository::RegisterExpect_(Y (*func)(A,B,C,D,E,F,G,H,I,J), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+
+HM_INLINE RecordingFileException::RecordingFileException(const char *fileName)
 {
-  Y (*fp)(A,B,C,D,E,F,G,H,I,J);
-  fp = &mockFuncs<char, Y>::template static_expectation10<X,A,B,C,D,E,F,G,H,I,J>;
-  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
-  TCall<Y,A,B,C,D,E,F,G,H,I,J> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
-  addCall( call, expect );
-  return *call;
+	std::stringstream text;
+	text << "Cannot use " << fileName << " as a call recording" << std::endl;
+	txt = text.str();
 }
-template <int X, typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J, typename K>
-TCall<Y,A,B,C,D,E,F,G,H,I,J,K> &MockRepository::RegisterExpect_(Y (*func)(A,B,C,D,E,F,G,H,I,J,K), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+
+HM_INLINE EmptyCycleException::EmptyCycleException(const char *funcName)
+{
+	std::stringstream text;
+	text << "ReturnCycle() on " << funcName << " was given no values" << std::endl;
+	txt = text.str();
+}
+
+HM_INLINE EmptySequenceException::EmptySequenceException(const char *funcName)
 {
-  Y (*fp)(A,B,C,D,E,F,G,H,I,J,K);
-  fp = &mockFuncs<char, Y>::template static_expectation11<X,A,B,C,D,E,F,G,H,I,J,K>;
-  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
-  TCall<Y,A,B,C,D,E,F,G,H,I,J,K> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J,K>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
-  addCall( call, expect );
-  return *call;
+	std::stringstream text;
+	text << "ReturnSequence() on " << funcName << " was given no values" << std::endl;
+	txt = text.str();
 }
-template <int X, typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J, typename K, typename L>
-TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L> &MockRepository::RegisterExpect_(Y (*func)(A,B,C,D,E,F,G,H,I,J,K,L), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+
+HM_INLINE CallCountConflictException::CallCountConflictException(const char *funcName, unsigned expected, size_t results)
 {
-  Y (*fp)(A,B,C,D,E,F,G,H,I,J,K,L);
-  fp = &mockFuncs<char, Y>::template static_expectation12<X,A,B,C,D,E,F,G,H,I,J,K,L>;
-  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
-  TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
-  addCall( call, expect );
-  return *call;
+	std::stringstream text;
+	text << funcName << " is expected " << expected << " times but has results for " << results << " calls" << std::endl;
+	txt = text.str();
 }
-template <int X, typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J, typename K, typename L,
-		  typename M>
-TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M> &MockRepository::RegisterExpect_(Y (*func)(A,B,C,D,E,F,G,H,I,J,K,L,M), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+
+#if __cplusplus > 199711L
+HM_INLINE CallRecording::CallRecording(const char *fileName)
+	: file(fopen(fileName, "wb"))
 {
-  Y (*fp)(A,B,C,D,E,F,G,H,I,J,K,L,M);
-  fp = &mockFuncs<char, Y>::template static_expectation13<X,A,B,C,D,E,F,G,H,I,J,K,L,M>;
-  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
-  TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
-  addCall( call, expect );
-  return *call;
+	if (!file)
+		RAISEEXCEPTION(RecordingFileException(fileName));
+	fwrite("HMREPLY1", 1, 8, file);
 }
-template <int X, typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J, typename K, typename L,
-		  typename M, typename N>
-TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N> &MockRepository::RegisterExpect_(Y (*func)(A,B,C,D,E,F,G,H,I,J,K,L,M,N), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+
+HM_INLINE CallRecording::~CallRecording()
 {
-  Y (*fp)(A,B,C,D,E,F,G,H,I,J,K,L,M,N);
-  fp = &mockFuncs<char, Y>::template static_expectation14<X,A,B,C,D,E,F,G,H,I,J,K,L,M,N>;
-  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
-  TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
-  addCall( call, expect );
-  return *call;
+	fclose(file);
 }
-template <int X, typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J, typename K, typename L,
-		  typename M, typename N, typename O>
-TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O> &MockRepository::RegisterExpect_(Y (*func)(A,B,C,D,E,F,G,H,I,J,K,L,M,N,O), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+
+HM_INLINE void CallRecording::append(std::pair<int, int> funcIndex, const std::string &value)
 {
-  Y (*fp)(A,B,C,D,E,F,G,H,I,J,K,L,M,N,O);
-  fp = &mockFuncs<char, Y>::template static_expectation15<X,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O>;
-  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
-  TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
-  addCall( call, expect );
-  return *call;
+	int entryIndex[2] = { funcIndex.first, funcIndex.second };
+	unsigned int entryLength = (unsigned int)value.size();
+	fwrite(entryIndex, sizeof(entryIndex), 1, file);
+	fwrite(&entryLength, sizeof(entryLength), 1, file);
+	fwrite(value.data(), 1, value.size(), file);
 }
 
-template <int X, typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J, typename K, typename L,
-		  typename M, typename N, typename O, typename P>
-TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &MockRepository::RegisterExpect_(Y (*func)(A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+HM_INLINE CallReplay::CallReplay(const char *fileName)
+	: data(0)
+	, cursor(0)
+	, end(0)
+	, size(0)
 {
-  Y (*fp)(A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P);
-  fp = &mockFuncs<char, Y>::template static_expectation16<X,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P>;
-  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
-  TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
-  addCall( call, expect );
-  return *call;
+#if !defined(HM_REPLAY_MMAP) || defined(_WIN32)
+	FILE *file = fopen(fileName, "rb");
+	if (file)
+	{
+		fseek(file, 0, SEEK_END);
+		size = (size_t)ftell(file);
+		fseek(file, 0, SEEK_SET);
+		char *buffer = new char[size + 1];
+		size = fread(buffer, 1, size, file);
+		fclose(file);
+		data = buffer;
+	}
+#else
+	int fd = open(fileName, O_RDONLY);
+	struct stat info;
+	if (fd >= 0 && fstat(fd, &info) == 0 && info.st_size > 0)
+	{
+		void *mapping = mmap(0, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (mapping != MAP_FAILED)
+		{
+			data = (const char *)mapping;
+			size = (size_t)info.st_size;
+		}
+	}
+	if (fd >= 0)
+		close(fd);
+#endif
+	if (!data || size < 8 || memcmp(data, "HMREPLY1", 8) != 0)
+	{
+		release();
+		RAISEEXCEPTION(RecordingFileException(fileName));
+	}
+	cursor = data + 8;
+	end = data + size;
 }
 
-#if defined(_MSC_VER) && !defined(_WIN64)
-template <int X, typename Y>
-TCall<Y> &MockRepository::RegisterExpect_(Y (__stdcall *func)(), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+HM_INLINE CallReplay::~CallReplay()
 {
-  Y (__stdcall *fp)();
-  fp = &mockFuncs<char, Y>::template static_stdcallexpectation0<X>;
-  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
-  TCall<Y> *call = new TCall<Y>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
-  addCall( call, expect );
-  return *call;
+	release();
 }
-template <int X, typename Y, typename A>
-TCall<Y,A> &MockRepository::RegisterExpect_(Y (__stdcall *func)(A), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+
+HM_INLINE void CallReplay::release()
 {
-  Y (__stdcall *fp)(A);
-  fp = &mockFuncs<char, Y>::template static_stdcallexpectation1<X,A>;
-  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
-  TCall<Y,A> *call = new TCall<Y,A>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
-  addCall( call, expect );
-  return *call;
+	if (!data)
+		return;
+#if !defined(HM_REPLAY_MMAP) || defined(_WIN32)
+	delete [] data;
+#else
+	munmap((void *)data, size);
+#endif
+	data = 0;
 }
-template <int X, typename Y,
-		  typename A, typename B>
-TCall<Y,A,B> &MockRepository::RegisterExpect_(Y (__stdcall *func)(A,B), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+#endif
+
+HM_INLINE
+bool satisfied( CallList const& previousCalls )
 {
-  Y (__stdcall *fp)(A,B);
-  fp = &mockFuncs<char, Y>::template static_stdcallexpectation2<X,A,B>;
-  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
-  TCall<Y,A,B> *call = new TCall<Y,A,B>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
-  addCall( call, expect );
-  return *call;
+	for (CallList::const_iterator callsBefore = previousCalls.begin();
+		callsBefore != previousCalls.end(); ++callsBefore)
+	{
+		if (!(*callsBefore)->satisfied)
+		{
+			return false;
+		}
+	}
+	return true;
 }
-template <int X, typename Y,
-		  typename A, typename B, typename C>
-TCall<Y,A,B,C> &MockRepository::RegisterExpect_(Y (__stdcall *func)(A,B,C), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+
+HM_INLINE void MockRepository::addAutoExpectTo( Call* call )
 {
-  Y (__stdcall *fp)(A,B,C);
-  fp = &mockFuncs<char, Y>::template static_stdcallexpectation3<X,A,B,C>;
-  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
-  TCall<Y,A,B,C> *call = new TCall<Y,A,B,C>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
-  addCall( call, expect );
-  return *call;
+	if (autoExpect && expectations.size() > 0)
+	{
+		call->previousCalls.push_back(expectations.back());
+	}
 }
-template <int X, typename Y,
-		  typename A, typename B, typename C, typename D>
-TCall<Y,A,B,C,D> &MockRepository::RegisterExpect_(Y (__stdcall *func)(A,B,C,D), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+
+HM_INLINE void Call::setArgumentKeys(const ArgumentKeys &keys)
 {
-  Y (__stdcall *fp)(A,B,C,D);
-  fp = &mockFuncs<char, Y>::template static_stdcallexpectation4<X,A,B,C,D>;
-  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
-  TCall<Y,A,B,C,D> *call = new TCall<Y,A,B,C,D>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
-  addCall( call, expect );
-  return *call;
+	argumentKeys = &keys;
+	packedArgs = keys.packed;
+	packedSize = (unsigned short)keys.packedSize;
+	if (keys.fingerprints && repo)
+		++repo->fingerprintCalls;
 }
-template <int X, typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E>
-TCall<Y,A,B,C,D,E> &MockRepository::RegisterExpect_(Y (__stdcall *func)(A,B,C,D,E), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+
+HM_INLINE void MockRepository::addCall( Call* call, RegistrationType expect )
 {
-  Y (__stdcall *fp)(A,B,C,D,E);
-  fp = &mockFuncs<char, Y>::template static_stdcallexpectation5<X,A,B,C,D,E>;
-  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
-  TCall<Y,A,B,C,D,E> *call = new TCall<Y,A,B,C,D,E>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
-  addCall( call, expect );
-  return *call;
+	call->repo = this;
+#ifdef HM_CALL_TRACE
+	call->id = ++lastCallId;
+#endif
+	if (call->mock)
+	{
+		MockCalls *calls = call->mock->registeredCalls();
+		call->previousOnMock = calls->last;
+		if (calls->last)
+			calls->last->nextOnMock = call;
+		else
+			calls->first = call;
+		calls->last = call;
+	}
+	if( expect == Never ) {
+		addAutoExpectTo( call );
+		neverCalls.push_back(call);
+	}
+	else if( expect.minimum == expect.maximum )
+	{
+		addAutoExpectTo( call );
+		expectations.push_back(call);
+		call->required = true;
+		if (!call->satisfied)
+		{
+			++unsatisfied;
+			++unsatisfiedByMock[call->mock];
+		}
+	}
+	else
+	{
+		optionals.push_back(call);
+		++optionalCount;
+	}
 }
-template <int X, typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F>
-TCall<Y,A,B,C,D,E,F> &MockRepository::RegisterExpect_(Y (__stdcall *func)(A,B,C,D,E,F), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+
+#ifdef _HIPPOMOCKS__ENABLE_CFUNC_MOCKING_SUPPORT
+HM_INLINE int MockRepository::BasicStaticRegisterExpect(void (*func)(), void (*fp)(), int X)
 {
-  Y (__stdcall *fp)(A,B,C,D,E,F);
-  fp = &mockFuncs<char, Y>::template static_stdcallexpectation6<X,A,B,C,D,E,F>;
-  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
-  TCall<Y,A,B,C,D,E,F> *call = new TCall<Y,A,B,C,D,E,F>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
-  addCall( call, expect );
-  return *call;
+	useAllocator();
+	if (staticFuncMap.find(func) == staticFuncMap.end())
+	{
+		staticFuncMap[func] = X;
+		staticReplaces.push_back(new Replace(func, fp));
+	}
+	return staticFuncMap[func];
 }
-template <int X, typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G>
-TCall<Y,A,B,C,D,E,F,G> &MockRepository::RegisterExpect_(Y (__stdcall *func)(A,B,C,D,E,F,G), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+#endif
+
+HM_INLINE void MockRepository::setSatisfied( Call *call, bool satisfied )
 {
-  Y (__stdcall *fp)(A,B,C,D,E,F,G);
-  fp = &mockFuncs<char, Y>::template static_stdcallexpectation7<X,A,B,C,D,E,F,G>;
-  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
-  TCall<Y,A,B,C,D,E,F,G> *call = new TCall<Y,A,B,C,D,E,F,G>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
-   addCall( call, expect );
-  return *call;
+	call->satisfied = satisfied;
+	if (!call->required)
+		return;
+	if (satisfied)
+	{
+		--unsatisfied;
+		UnsatisfiedCounts::iterator count = unsatisfiedByMock.find(call->mock);
+		if (--count->second == 0)
+			unsatisfiedByMock.erase(count);
+	}
+	else
+	{
+		++unsatisfied;
+		++unsatisfiedByMock[call->mock];
+	}
 }
-template <int X, typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H>
-TCall<Y,A,B,C,D,E,F,G,H> &MockRepository::RegisterExpect_(Y (__stdcall *func)(A,B,C,D,E,F,G,H), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+
+HM_INLINE void MockRepository::doCall( Call* call, const base_tuple &tuple )
 {
-  Y (__stdcall *fp)(A,B,C,D,E,F,G,H);
-  fp = &mockFuncs<char, Y>::template static_stdcallexpectation8<X,A,B,C,D,E,F,G,H>;
-  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
-  TCall<Y,A,B,C,D,E,F,G,H> *call = new TCall<Y,A,B,C,D,E,F,G,H>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
-  addCall( call, expect );
-  return *call;
+#ifdef HM_DISPATCH_HOOKS
+	if (currentDispatch)
+		currentDispatch->setCall(call);
+#endif
+	++call->called;
+
+	if (call->satisfied != (call->called >= call->expectation.minimum))
+		setSatisfied( call, !call->satisfied );
+
+	if (call->capture.isSet())
+		call->capture.invoke<void>(tuple);
+	if (call->assignsArgs)
+		call->assignArgs(const_cast<base_tuple &>(tuple));
+#ifndef HM_NO_EXCEPTIONS
+	if (call->eHolder)
+	{
+#ifdef HM_DISPATCH_STATS
+		noteException(call);
+#endif
+		call->eHolder->rethrow();
+	}
+#endif
 }
-template <int X, typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I>
-TCall<Y,A,B,C,D,E,F,G,H,I> &MockRepository::RegisterExpect_(Y (__stdcall *func)(A,B,C,D,E,F,G,H,I), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+
+HM_INLINE void MockRepository::doVoidFunctor( Call* call, const base_tuple &tuple )
 {
-  Y (__stdcall *fp)(A,B,C,D,E,F,G,H,I);
-  fp = &mockFuncs<char, Y>::template static_stdcallexpectation9<X,A,B,C,D,E,F,G,H,I>;
-  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
-  TCall<Y,A,B,C,D,E,F,G,H,I> *call = new TCall<Y,A,B,C,D,E,F,G,H,I>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
-  addCall( call, expect );
-  return *call;
+	if (call->functor.isSet())
+		call->functor.invoke<void>(tuple);
 }
-template <int X, typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J>
-TCall<Y,A,B,C,D,E,F,G,H,I,J> &MockRepository::RegisterExpect_(Y (__stdcall *func)(A,B,C,D,E,F,G,H,I,J), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+
+HM_INLINE void MockRepository::doVoidCall( Call* call, const base_tuple &tuple, bool const makeLatent )
 {
-  Y (__stdcall *fp)(A,B,C,D,E,F,G,H,I,J);
-  fp = &mockFuncs<char, Y>::template static_stdcallexpectation10<X,A,B,C,D,E,F,G,H,I,J>;
-  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
-  TCall<Y,A,B,C,D,E,F,G,H,I,J> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
-  addCall( call, expect );
-  return *call;
+	if( call->called < call->expectation.maximum )
+	{
+		doCall( call, tuple );
+		doVoidFunctor( call, tuple );
+	}
+	else
+	{
+		doThrow( call, makeLatent );
+	}
+}
+
+HM_INLINE void MockRepository::doThrow( Call * call, bool const makeLatent )
+{
+	if (!call->satisfied)
+		setSatisfied( call, true );
+#ifdef HM_DISPATCH_HOOKS
+	if (currentDispatch)
+		currentDispatch->setCall(call);
+#endif
+#ifdef HM_DISPATCH_STATS
+	noteException(call);
+#endif
+
+	if (makeLatent)
+	{
+#ifndef HM_NO_EXCEPTIONS
+		if (latentException)
+			return;
+#endif
+		RAISELATENTEXCEPTION(ExpectationException(this, call->getArgs(), call->funcName, call->mock, call->funcIndex));
+	}
+	else
+	{
+		RAISEEXCEPTION(ExpectationException(this, call->getArgs(), call->funcName, call->mock, call->funcIndex));
+	}
 }
-template <int X, typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J, typename K>
-TCall<Y,A,B,C,D,E,F,G,H,I,J,K> &MockRepository::RegisterExpect_(Y (__stdcall *func)(A,B,C,D,E,F,G,H,I,J,K), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+
+HM_INLINE const char *MockRepository::funcName( base_mock *mock, std::pair<int, int> funcno )
 {
-  Y (__stdcall *fp)(A,B,C,D,E,F,G,H,I,J,K);
-  fp = &mockFuncs<char, Y>::template static_stdcallexpectation11<X,A,B,C,D,E,F,G,H,I,J,K>;
-  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
-  TCall<Y,A,B,C,D,E,F,G,H,I,J,K> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J,K>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
-  addCall( call, expect );
-  return *call;
+	if (mock)
+	{
+		// Prefer the name given to an expectation, then to an optional Call, as the lists below.
+		const char *names[3] = { NULL, NULL, NULL };
+		for (Call *call = mock->registeredCalls()->first; call; call = call->nextOnMock)
+		{
+			size_t kind = call->required ? 0 : call->expectation == Never ? 2 : 1;
+			if (call->funcIndex == funcno && !names[kind])
+				names[kind] = call->funcName;
+		}
+		return names[0] ? names[0] : names[1] ? names[1] : names[2];
+	}
+	const char *name = NULL;
+	for (CallList::iterator i = expectations.begin(); i != expectations.end() && !name; ++i)
+	{
+		Call *call = *i;
+		if (call->mock == mock &&
+			call->funcIndex == funcno)
+			name = call->funcName;
+	}
+	for (CallList::iterator i = optionals.begin(); i != optionals.end() && !name; ++i)
+	{
+		Call *call = *i;
+		if (call->mock == mock &&
+			call->funcIndex == funcno)
+			name = call->funcName;
+	}
+	for (CallList::iterator i = neverCalls.begin(); i != neverCalls.end() && !name; ++i)
+	{
+		Call *call = *i;
+		if (call->mock == mock &&
+			call->funcIndex == funcno)
+			name = call->funcName;
+	}
+	return name;
 }
-template <int X, typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J, typename K, typename L>
-TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L> &MockRepository::RegisterExpect_(Y (__stdcall *func)(A,B,C,D,E,F,G,H,I,J,K,L), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+
+HM_INLINE bool MockRepository::matches( Call *call, base_mock *mock, std::pair<int, int> funcno, const base_tuple &tuple )
 {
-  Y (__stdcall *fp)(A,B,C,D,E,F,G,H,I,J,K,L);
-  fp = &mockFuncs<char, Y>::template static_stdcallexpectation12<X,A,B,C,D,E,F,G,H,I,J,K,L>;
-  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
-  TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
-  addCall( call, expect );
-  return *call;
+#ifdef HM_DISPATCH_STATS
+	++call->stats.candidates;
+	if (currentDispatch)
+		++currentDispatch->stats.candidates;
+	if (call->mock != mock ||
+		call->funcIndex != funcno)
+		return false;
+	unsigned long long matchFunctors = call->stats.matchFunctors;
+	++call->stats.argMatches;
+	bool argsMatch = call->argumentsMatch(tuple);
+	if (currentDispatch)
+	{
+		++currentDispatch->stats.argMatches;
+		currentDispatch->stats.matchFunctors += call->stats.matchFunctors - matchFunctors;
+	}
+	return argsMatch &&
+		satisfied( call->previousCalls );
+#else
+	return call->mock == mock &&
+		call->funcIndex == funcno &&
+		call->argumentsMatch(tuple) &&
+		satisfied( call->previousCalls );
+#endif
 }
-template <int X, typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J, typename K, typename L,
-		  typename M>
-TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M> &MockRepository::RegisterExpect_(Y (__stdcall *func)(A,B,C,D,E,F,G,H,I,J,K,L,M), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+
+HM_INLINE void MockRepository::DoDestructorExpectation(base_mock *mock, std::pair<int, int> funcno)
 {
-  Y (__stdcall *fp)(A,B,C,D,E,F,G,H,I,J,K,L,M);
-  fp = &mockFuncs<char, Y>::template static_stdcallexpectation13<X,A,B,C,D,E,F,G,H,I,J,K,L,M>;
-  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
-  TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
-  addCall( call, expect );
-  return *call;
+	useAllocator();
+	ref_tuple<> tuple;
+#ifdef HM_DISPATCH_HOOKS
+	DispatchScope scope(this, mock, funcno, tuple);
+#endif
+	MockCalls *calls = mock->registeredCalls();
+	for (Call *call = calls->last; call; call = call->previousOnMock)
+	{
+		if ( call->expectation == Never && matches( call, mock, funcno, tuple ) )
+		{
+			doThrow( call, true );
+			return;
+		}
+	}
+	for (Call *call = calls->last; call; call = call->previousOnMock)
+	{
+		if ( call->required && isUnsatisfied( call, mock, funcno, tuple ) )
+		{
+			doVoidCall( call, tuple, true );
+			return;
+		}
+	}
+	for (Call *call = calls->last; call; call = call->previousOnMock)
+	{
+		if ( !call->required && !(call->expectation == Never) && matches( call, mock, funcno, tuple ) )
+		{
+			doVoidCall( call, tuple, true );
+			return;
+		}
+	}
+
+#ifdef HM_DISPATCH_HOOKS
+	scope.setCall(NULL);
+#endif
+#ifdef HM_DISPATCH_STATS
+	noteException(NULL);
+#endif
+#ifndef HM_NO_EXCEPTIONS
+	if (latentException)
+		return;
+#endif
+	RAISELATENTEXCEPTION(ExpectationException(this, &tuple, funcName(mock, funcno), mock, funcno, &tuple));
 }
-template <int X, typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J, typename K, typename L,
-		  typename M, typename N>
-TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N> &MockRepository::RegisterExpect_(Y (__stdcall *func)(A,B,C,D,E,F,G,H,I,J,K,L,M,N), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+
+HM_INLINE bool MockRepository::isUnsatisfied( Call *call, base_mock *mock, std::pair<int, int> funcno, const base_tuple &tuple )
 {
-  Y (__stdcall *fp)(A,B,C,D,E,F,G,H,I,J,K,L,M,N);
-  fp = &mockFuncs<char, Y>::template static_stdcallexpectation14<X,A,B,C,D,E,F,G,H,I,J,K,L,M,N>;
-  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
-  TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
-  addCall( call, expect );
-  return *call;
+	return ! call->satisfied && matches( call, mock, funcno, tuple );
 }
-template <int X, typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J, typename K, typename L,
-		  typename M, typename N, typename O>
-TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O> &MockRepository::RegisterExpect_(Y (__stdcall *func)(A,B,C,D,E,F,G,H,I,J,K,L,M,N,O), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+
+HM_INLINE void MockRepository::DoVoidExpectation(base_mock *mock, std::pair<int, int> funcno, const base_tuple &tuple, bool makeLatent)
 {
-  Y (__stdcall *fp)(A,B,C,D,E,F,G,H,I,J,K,L,M,N,O);
-  fp = &mockFuncs<char, Y>::template static_stdcallexpectation15<X,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O>;
-  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
-  TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
-  addCall( call, expect );
-  return *call;
+	useAllocator();
+#ifdef HM_DISPATCH_HOOKS
+	DispatchScope scope(this, mock, funcno, tuple);
+#endif
+	if (fingerprintCalls)
+		fingerprintCache.begin();
+	for (CallList::reverse_iterator i = neverCalls.rbegin(); i != neverCalls.rend(); ++i)
+	{
+		Call *call = *i;
+		if ( matches( call, mock, funcno, tuple ) )
+		{
+			doThrow( call, makeLatent );
+			return;
+		}
+	}
+	for (CallList::reverse_iterator i = expectations.rbegin(); i != expectations.rend(); ++i)
+	{
+		Call *call = *i;
+		if ( isUnsatisfied( call, mock, funcno, tuple ) )
+		{
+			doVoidCall( call, tuple, makeLatent );
+			return;
+		}
+	}
+	if (Call *call = findOptional( mock, funcno, tuple ))
+	{
+		doVoidCall( call, tuple, makeLatent );
+		return;
+	}
+
+#ifdef HM_DISPATCH_HOOKS
+	scope.setCall(NULL);
+#endif
+#ifdef HM_DISPATCH_STATS
+	noteException(NULL);
+#endif
+	if (makeLatent)
+	{
+#ifndef HM_NO_EXCEPTIONS
+		if (latentException)
+			return;
+#endif
+		RAISELATENTEXCEPTION(ExpectationException(this, &tuple, funcName(mock, funcno), mock, funcno, &tuple));
+	}
+	else
+	{
+		RAISEEXCEPTION(ExpectationException(this, &tuple, funcName(mock, funcno), mock, funcno, &tuple));
+	}
 }
 
-template <int X, typename Y,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J, typename K, typename L,
-		  typename M, typename N, typename O, typename P>
-TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &MockRepository::RegisterExpect_(Y (__stdcall *func)(A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P), RegistrationType expect, const char *funcName, const char *fileName, unsigned long lineNo)
+HM_INLINE bool MockRepository::memoryReportRequested()
 {
-  Y (__stdcall *fp)(A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P);
-  fp = &mockFuncs<char, Y>::template static_stdcallexpectation16<X,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P>;
-  int index = BasicStaticRegisterExpect(reinterpret_cast<void (*)()>(func), reinterpret_cast<void (*)()>(fp),X);
-  TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P>(expect, NULL, std::pair<int, int>(0, index), lineNo, funcName ,fileName);
-  addCall( call, expect );
-  return *call;
+	static const bool requested = getenv(HM_MEMORY_REPORT_ENV) != 0;
+	return requested;
 }
+
+HM_INLINE MockRepository::~MockRepository()
+#if __cplusplus > 199711L || (defined(_MSC_VER) && _MSC_VER > 1700)
+noexcept(false)
+#endif
+{
+	MockRepoInstanceHolder<0>::instance = 0;
+	useAllocator();
+	if (FingerprintCache::Current<0>::cache == &fingerprintCache)
+		FingerprintCache::Current<0>::cache = 0;
+	if (memoryReportRequested())
+		DumpMemoryUsage(std::cerr);
+#ifdef HM_CALL_TRACE
+	StopTrace();
+#endif
+#ifndef HM_NO_EXCEPTIONS
+	if (!HM_UNCAUGHT_EXCEPTION())
+	{
+		try
+		{
+#endif
+			VerifyAll();
+#ifndef HM_NO_EXCEPTIONS
+		}
+		catch(...)
+		{
+			delete latentException;
+			reset();
+			for (MockList::iterator i = mocks.begin(); i != mocks.end(); i++)
+			{
+				(*i)->destroy();
+			}
+#ifdef _HIPPOMOCKS__ENABLE_CFUNC_MOCKING_SUPPORT
+			for (ReplaceList::reverse_iterator i = staticReplaces.rbegin(); i != staticReplaces.rend(); ++i)
+			{
+				delete *i;
+			}
+#endif
+#ifdef HM_MOCK_ALLOCATOR
+			MockAllocatorHolder<0>::current = 0;
+#endif
+			throw;
+		}
+	}
+	if (latentException)
+	{
+		try
+		{
+			latentException->rethrow();
+		}
+		catch(BASE_EXCEPTION & e)
+		{
+			printf("Latent exception masked!\nException:\n%s\n", e.what());
+		}
+		delete latentException;
+	}
+#endif
+	reset();
+	for (MockList::iterator i = mocks.begin(); i != mocks.end(); i++)
+	{
+		(*i)->destroy();
+	}
+#ifdef _HIPPOMOCKS__ENABLE_CFUNC_MOCKING_SUPPORT
+	for (ReplaceList::reverse_iterator i = staticReplaces.rbegin(); i != staticReplaces.rend(); ++i)
+	{
+		delete *i;
+	}
 #endif
+#ifdef HM_MOCK_ALLOCATOR
+	MockAllocatorHolder<0>::current = 0;
 #endif
+}
 
-template <int X, typename Z2, typename Y, typename Z>
-TCall<Y> &MockRepository::RegisterExpect_(Z2 *mck, Y (Z::*func)(), RegistrationType expect, const char *functionName, const char *fileName, unsigned long lineNo)
+HM_INLINE MemoryUsage MockRepository::memoryUsage() const
 {
-	std::pair<int, int> funcIndex = virtual_index((Y (Z2::*)())func);
-	Y (mockFuncs<Z2, Y>::*mfp)();
-	mfp = &mockFuncs<Z2, Y>::template expectation0<X>;
-	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
-						funcIndex.first, funcIndex.second,
-						reinterpret_cast<void (base_mock::*)()>(mfp),X);
-	TCall<Y> *call = new TCall<Y>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, functionName ,fileName);
-
-	addCall( call, expect );
-	return *call;
+	MemoryUsage total;
+	std::map<std::string, MemoryUsage> byType = memoryUsageByType();
+	for (std::map<std::string, MemoryUsage>::iterator i = byType.begin(); i != byType.end(); ++i)
+		total += i->second;
+	return total;
 }
-template <int X, typename Z2, typename Y, typename Z, typename A>
-TCall<Y,A> &MockRepository::RegisterExpect_(Z2 *mck, Y (Z::*func)(A), RegistrationType expect, const char *functionName, const char *fileName, unsigned long lineNo)
+
+HM_INLINE std::map<std::string, MemoryUsage> MockRepository::memoryUsageByType() const
 {
-	std::pair<int, int> funcIndex = virtual_index((Y(Z2::*)(A))func);
-	Y (mockFuncs<Z2, Y>::*mfp)(A);
-	mfp = &mockFuncs<Z2, Y>::template expectation1<X,A>;
-	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
-						funcIndex.first, funcIndex.second,
-						reinterpret_cast<void (base_mock::*)()>(mfp),X);
-	TCall<Y,A> *call = new TCall<Y,A>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, functionName ,fileName);
-	addCall( call, expect );
-	return *call;
+	std::map<std::string, MemoryUsage> byType;
+	std::map<const base_mock *, MemoryUsage *> byMock;
+	for (MockList::const_iterator i = mocks.begin(); i != mocks.end(); ++i)
+	{
+		MemoryUsage &usage = byType[(*i)->typeName()];
+		(*i)->memoryUsage(usage);
+		byMock[*i] = &usage;
+	}
+	const CallList *lists[] = { &expectations, &neverCalls, &optionals };
+	for (size_t l = 0; l < sizeof(lists) / sizeof(lists[0]); l++)
+	{
+		for (CallList::const_iterator i = lists[l]->begin(); i != lists[l]->end(); ++i)
+		{
+			const Call *call = *i;
+			std::map<const base_mock *, MemoryUsage *>::iterator owner = byMock.find(call->mock);
+			MemoryUsage &usage = owner != byMock.end() ? *owner->second : byType["C functions"];
+			usage.calls += call->objectSize();
+			usage.tuples += call->getArgs() ? call->getArgs()->objectSize() : 0;
+			usage.functors += call->matchFunctor.allocatedSize() + call->functor.allocatedSize() + call->capture.allocatedSize();
+			usage.returnValues += call->retVal ? call->retVal->objectSize() : 0;
+#ifndef HM_NO_EXCEPTIONS
+			usage.returnValues += call->eHolder ? call->eHolder->objectSize() : 0;
+#endif
+		}
+	}
+	return byType;
 }
-template <int X, typename Z2, typename Y, typename Z,
-		  typename A, typename B>
-TCall<Y,A,B> &MockRepository::RegisterExpect_(Z2 *mck, Y (Z::*func)(A,B), RegistrationType expect, const char *functionName, const char *fileName, unsigned long lineNo)
+
+HM_INLINE void MockRepository::DumpMemoryUsage(std::ostream &os) const
 {
-	std::pair<int, int> funcIndex = virtual_index((Y(Z2::*)(A,B))func);
-	Y (mockFuncs<Z2, Y>::*mfp)(A,B);
-	mfp = &mockFuncs<Z2, Y>::template expectation2<X,A,B>;
-	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
-						funcIndex.first, funcIndex.second,
-						reinterpret_cast<void (base_mock::*)()>(mfp),X);
-	TCall<Y,A,B> *call = new TCall<Y,A,B>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, functionName ,fileName);
-	addCall( call, expect );
-	return *call;
+	std::map<std::string, MemoryUsage> byType = memoryUsageByType();
+	MemoryUsage total;
+	for (std::map<std::string, MemoryUsage>::iterator i = byType.begin(); i != byType.end(); ++i)
+		total += i->second;
+	os << "Mock memory usage: " << total << std::endl;
+	for (std::map<std::string, MemoryUsage>::iterator i = byType.begin(); i != byType.end(); ++i)
+		os << "  " << i->first << ": " << i->second << std::endl;
 }
-template <int X, typename Z2, typename Y, typename Z,
-		  typename A, typename B, typename C>
-TCall<Y,A,B,C> &MockRepository::RegisterExpect_(Z2 *mck, Y (Z::*func)(A,B,C), RegistrationType expect, const char *functionName, const char *fileName, unsigned long lineNo)
+
+HM_INLINE std::ostream &operator<<(std::ostream &os, const MemoryUsage &usage)
 {
-	std::pair<int, int> funcIndex = virtual_index((Y(Z2::*)(A,B,C))func);
-	Y (mockFuncs<Z2, Y>::*mfp)(A,B,C);
-	mfp = &mockFuncs<Z2, Y>::template expectation3<X,A,B,C>;
-	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
-						funcIndex.first, funcIndex.second,
-						reinterpret_cast<void (base_mock::*)()>(mfp),X);
-	TCall<Y,A,B,C> *call = new TCall<Y,A,B,C>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, functionName ,fileName);
-	addCall( call, expect );
-	return *call;
+	os << usage.total() << " bytes ("
+	   << usage.functionTables << " function tables, "
+	   << usage.notImplementedTables << " notimplementedfuncs, "
+	   << usage.calls << " calls, "
+	   << usage.tuples << " arguments, "
+	   << usage.functors << " functors, "
+	   << usage.returnValues << " return values)";
+	return os;
 }
-template <int X, typename Z2, typename Y, typename Z,
-		  typename A, typename B, typename C, typename D>
-TCall<Y,A,B,C,D> &MockRepository::RegisterExpect_(Z2 *mck, Y (Z::*func)(A,B,C,D), RegistrationType expect, const char *functionName, const char *fileName, unsigned long lineNo)
+
+HM_INLINE void MockRepository::reset()
 {
-	std::pair<int, int> funcIndex = virtual_index((Y(Z2::*)(A,B,C,D))func);
-	Y (mockFuncs<Z2, Y>::*mfp)(A,B,C,D);
-	mfp = &mockFuncs<Z2, Y>::template expectation4<X,A,B,C,D>;
-	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
-						funcIndex.first, funcIndex.second,
-						reinterpret_cast<void (base_mock::*)()>(mfp),X);
-	TCall<Y,A,B,C,D> *call = new TCall<Y,A,B,C,D>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, functionName ,fileName);
-	addCall( call, expect );
-	return *call;
+	useAllocator();
+	for (CallList::iterator i = expectations.begin(); i != expectations.end(); i++)
+	{
+		delete *i;
+	}
+	expectations.clear();
+	for (CallList::iterator i = neverCalls.begin(); i != neverCalls.end(); i++)
+	{
+		delete *i;
+	}
+	neverCalls.clear();
+	for (CallList::iterator i = optionals.begin(); i != optionals.end(); i++)
+	{
+		delete *i;
+	}
+	optionals.clear();
+	unsatisfied = 0;
+	unsatisfiedByMock.clear();
+	argumentIndex.clear();
+	optionalCount = 0;
+	indexedCount = 0;
+	fingerprintCalls = 0;
+	for (MockList::iterator i = mocks.begin(); i != mocks.end(); i++)
+	{
+		(*i)->reset();
+	}
 }
-template <int X, typename Z2, typename Y, typename Z,
-		  typename A, typename B, typename C, typename D,
-		  typename E>
-TCall<Y,A,B,C,D,E> &MockRepository::RegisterExpect_(Z2 *mck, Y (Z::*func)(A,B,C,D,E), RegistrationType expect, const char *functionName, const char *fileName, unsigned long lineNo)
+
+HM_INLINE void MockRepository::updateArgumentIndex()
 {
-	std::pair<int, int> funcIndex = virtual_index((Y(Z2::*)(A,B,C,D,E))func);
-	Y (mockFuncs<Z2, Y>::*mfp)(A,B,C,D,E);
-	mfp = &mockFuncs<Z2, Y>::template expectation5<X,A,B,C,D,E>;
-	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
-						funcIndex.first, funcIndex.second,
-						reinterpret_cast<void (base_mock::*)()>(mfp),X);
-	TCall<Y,A,B,C,D,E> *call = new TCall<Y,A,B,C,D,E>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, functionName ,fileName);
-	addCall( call, expect );
-	return *call;
+	for (CallList::iterator i = optionals.end() - (optionalCount - indexedCount); i != optionals.end(); ++i)
+	{
+		Call *call = *i;
+		ArgumentIndex &index = argumentIndex[std::make_pair(call->mock, call->funcIndex)];
+		if (call->argumentKeys && call->argumentKeys->hasher && !call->matchFunctor.isSet())
+		{
+			index.hasher = call->argumentKeys->hasher;
+			index.keyed[call->argumentKeys->hash].push_back(IndexedCall(indexedCount++, call));
+		}
+		else
+		{
+			index.wildcards.push_back(IndexedCall(indexedCount++, call));
+		}
+	}
 }
-template <int X, typename Z2, typename Y, typename Z,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F>
-TCall<Y,A,B,C,D,E,F> &MockRepository::RegisterExpect_(Z2 *mck, Y (Z::*func)(A,B,C,D,E,F), RegistrationType expect, const char *functionName, const char *fileName, unsigned long lineNo)
+
+HM_INLINE Call *MockRepository::findOptional(base_mock *mock, std::pair<int, int> funcno, const base_tuple &tuple)
 {
-	std::pair<int, int> funcIndex = virtual_index((Y(Z2::*)(A,B,C,D,E,F))func);
-	Y (mockFuncs<Z2, Y>::*mfp)(A,B,C,D,E,F);
-	mfp = &mockFuncs<Z2, Y>::template expectation6<X,A,B,C,D,E,F>;
-	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
-						funcIndex.first, funcIndex.second,
-						reinterpret_cast<void (base_mock::*)()>(mfp),X);
-	TCall<Y,A,B,C,D,E,F> *call = new TCall<Y,A,B,C,D,E,F>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, functionName ,fileName);
-	addCall( call, expect );
-	return *call;
+	if (!indexArguments)
+	{
+		for (CallList::reverse_iterator i = optionals.rbegin(); i != optionals.rend(); ++i)
+		{
+			if ( matches( *i, mock, funcno, tuple ) )
+				return *i;
+		}
+		return 0;
+	}
+	if (indexedCount != optionalCount)
+		updateArgumentIndex();
+	ArgumentIndexes::iterator slot = argumentIndex.find(std::make_pair(mock, funcno));
+	if (slot == argumentIndex.end())
+		return 0;
+	ArgumentIndex &index = slot->second;
+	const IndexedCall *keyed = 0;
+	if (index.hasher)
+	{
+		KeyedCalls::iterator bucket = index.keyed.find(index.hasher(tuple));
+		if (bucket != index.keyed.end())
+		{
+			for (IndexedCalls::reverse_iterator i = bucket->second.rbegin(); i != bucket->second.rend() && !keyed; ++i)
+			{
+				if ( matches( i->second, mock, funcno, tuple ) )
+					keyed = &*i;
+			}
+		}
+	}
+	for (IndexedCalls::reverse_iterator i = index.wildcards.rbegin(); i != index.wildcards.rend(); ++i)
+	{
+		if (keyed && i->first < keyed->first)
+			break;
+		if ( matches( i->second, mock, funcno, tuple ) )
+			return i->second;
+	}
+	return keyed ? keyed->second : 0;
 }
-template <int X, typename Z2, typename Y, typename Z,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G>
-TCall<Y,A,B,C,D,E,F,G> &MockRepository::RegisterExpect_(Z2 *mck, Y (Z::*func)(A,B,C,D,E,F,G), RegistrationType expect, const char *functionName, const char *fileName, unsigned long lineNo)
+
+HM_INLINE void MockRepository::VerifyAll()
 {
-	std::pair<int, int> funcIndex = virtual_index((Y(Z2::*)(A,B,C,D,E,F,G))func);
-	Y (mockFuncs<Z2, Y>::*mfp)(A,B,C,D,E,F,G);
-	mfp = &mockFuncs<Z2, Y>::template expectation7<X,A,B,C,D,E,F,G>;
-	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
-						funcIndex.first, funcIndex.second,
-						reinterpret_cast<void (base_mock::*)()>(mfp),X);
-	TCall<Y,A,B,C,D,E,F,G> *call = new TCall<Y,A,B,C,D,E,F,G>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, functionName ,fileName);
-	addCall( call, expect );
-	return *call;
+#ifndef HM_NO_EXCEPTIONS
+	if (latentException)
+		latentException->rethrow();
+#endif
+
+	if (!unsatisfied)
+		return;
+	for (CallList::iterator i = expectations.begin(); i != expectations.end(); i++)
+	{
+		if (!(*i)->satisfied) {
+			RAISEEXCEPTION(CallMissingException(this));
+		}
+	}
 }
-template <int X, typename Z2, typename Y, typename Z,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H>
-TCall<Y,A,B,C,D,E,F,G,H> &MockRepository::RegisterExpect_(Z2 *mck, Y (Z::*func)(A,B,C,D,E,F,G,H), RegistrationType expect, const char *functionName, const char *fileName, unsigned long lineNo)
+
+HM_INLINE void MockRepository::VerifyPartial(base_mock *obj)
 {
-	std::pair<int, int> funcIndex = virtual_index((Y(Z2::*)(A,B,C,D,E,F,G,H))func);
-	Y (mockFuncs<Z2, Y>::*mfp)(A,B,C,D,E,F,G,H);
-	mfp = &mockFuncs<Z2, Y>::template expectation8<X,A,B,C,D,E,F,G,H>;
-	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
-						funcIndex.first, funcIndex.second,
-						reinterpret_cast<void (base_mock::*)()>(mfp),X);
-	TCall<Y,A,B,C,D,E,F,G,H> *call = new TCall<Y,A,B,C,D,E,F,G,H>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, functionName ,fileName);
-	addCall( call, expect );
-	return *call;
+#ifndef HM_NO_EXCEPTIONS
+	if (latentException)
+		return;
+#endif
+	if (unsatisfiedByMock.find(obj) == unsatisfiedByMock.end())
+		return;
+	for (Call *call = obj->registeredCalls()->first; call; call = call->nextOnMock)
+	{
+		if (call->required &&
+			!call->satisfied )
+		{
+			RAISELATENTEXCEPTION(CallMissingException(this));
+		}
+	}
 }
-template <int X, typename Z2, typename Y, typename Z,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I>
-TCall<Y,A,B,C,D,E,F,G,H,I> &MockRepository::RegisterExpect_(Z2 *mck, Y (Z::*func)(A,B,C,D,E,F,G,H,I), RegistrationType expect, const char *functionName, const char *fileName, unsigned long lineNo)
+
+#ifdef HM_DISPATCH_HOOKS
+HM_INLINE MockRepository::DispatchScope::DispatchScope(MockRepository *repo, base_mock *mock, std::pair<int, int> funcno, const base_tuple &tuple)
+	: repo(repo)
+	, mock(mock)
+	, funcno(funcno)
+	, tuple(tuple)
+	, call(0)
+	, outer(repo->currentDispatch)
+	, start(MonotonicNanoseconds())
+#ifdef HM_CALL_TRACE
+	, sequence(++repo->traceSequence)
+	, traced(false)
+#endif
 {
-	std::pair<int, int> funcIndex = virtual_index((Y(Z2::*)(A,B,C,D,E,F,G,H,I))func);
-	Y (mockFuncs<Z2, Y>::*mfp)(A,B,C,D,E,F,G,H,I);
-	mfp = &mockFuncs<Z2, Y>::template expectation9<X,A,B,C,D,E,F,G,H,I>;
-	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
-						funcIndex.first, funcIndex.second,
-						reinterpret_cast<void (base_mock::*)()>(mfp),X);
-	TCall<Y,A,B,C,D,E,F,G,H,I> *call = new TCall<Y,A,B,C,D,E,F,G,H,I>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, functionName ,fileName);
-	addCall( call, expect );
-	return *call;
+#ifdef HM_DISPATCH_STATS
+	stats.calls = 1;
+	mockStats = &repo->mockStats[mock];
+	nestedNanoseconds = 0;
+#endif
+	repo->currentDispatch = this;
 }
-template <int X, typename Z2, typename Y, typename Z,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J>
-TCall<Y,A,B,C,D,E,F,G,H,I,J> &MockRepository::RegisterExpect_(Z2 *mck, Y (Z::*func)(A,B,C,D,E,F,G,H,I,J), RegistrationType expect, const char *functionName, const char *fileName, unsigned long lineNo)
+
+HM_INLINE void MockRepository::DispatchScope::setCall(Call *matched)
 {
-	std::pair<int, int> funcIndex = virtual_index((Y(Z2::*)(A,B,C,D,E,F,G,H,I,J))func);
-	Y (mockFuncs<Z2, Y>::*mfp)(A,B,C,D,E,F,G,H,I,J);
-	mfp = &mockFuncs<Z2, Y>::template expectation10<X,A,B,C,D,E,F,G,H,I,J>;
-	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
-						funcIndex.first, funcIndex.second,
-						reinterpret_cast<void (base_mock::*)()>(mfp),X);
-	TCall<Y,A,B,C,D,E,F,G,H,I,J> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, functionName ,fileName);
-	addCall( call, expect );
-	return *call;
+	call = matched;
+#ifdef HM_CALL_TRACE
+	// Trace before Out() parameters are assigned and before any Do() functor dispatches more calls.
+	repo->traceDispatch(*this);
+#endif
 }
-template <int X, typename Z2, typename Y, typename Z,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J, typename K>
-TCall<Y,A,B,C,D,E,F,G,H,I,J,K> &MockRepository::RegisterExpect_(Z2 *mck, Y (Z::*func)(A,B,C,D,E,F,G,H,I,J,K), RegistrationType expect, const char *functionName, const char *fileName, unsigned long lineNo)
+
+HM_INLINE MockRepository::DispatchScope::~DispatchScope()
 {
-	std::pair<int, int> funcIndex = virtual_index((Y(Z2::*)(A,B,C,D,E,F,G,H,I,J,K))func);
-	Y (mockFuncs<Z2, Y>::*mfp)(A,B,C,D,E,F,G,H,I,J,K);
-	mfp = &mockFuncs<Z2, Y>::template expectation11<X,A,B,C,D,E,F,G,H,I,J,K>;
-	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
-						funcIndex.first, funcIndex.second,
-						reinterpret_cast<void (base_mock::*)()>(mfp),X);
-	TCall<Y,A,B,C,D,E,F,G,H,I,J,K> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J,K>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, functionName ,fileName);
-	addCall( call, expect );
-	return *call;
+	repo->currentDispatch = outer;
+#ifdef HM_CALL_TRACE
+	repo->traceDispatch(*this);
+#endif
+#ifdef HM_DISPATCH_STATS
+	unsigned long long elapsed = MonotonicNanoseconds() - start;
+	stats.nanoseconds = elapsed - nestedNanoseconds;
+	if (outer)
+		outer->nestedNanoseconds += elapsed;
+	repo->totalStats += stats;
+	*mockStats += stats;
+	if (call)
+	{
+		++call->stats.calls;
+		call->stats.nanoseconds += stats.nanoseconds;
+	}
+#endif
 }
-template <int X, typename Z2, typename Y, typename Z,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J, typename K, typename L>
-TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L> &MockRepository::RegisterExpect_(Z2 *mck, Y (Z::*func)(A,B,C,D,E,F,G,H,I,J,K,L), RegistrationType expect, const char *functionName, const char *fileName, unsigned long lineNo)
+#endif
+
+#ifdef HM_CALL_TRACE
+HM_INLINE bool MockRepository::StartTrace(const char *fileName)
 {
-	std::pair<int, int> funcIndex = virtual_index((Y(Z2::*)(A,B,C,D,E,F,G,H,I,J,K,L))func);
-	Y (mockFuncs<Z2, Y>::*mfp)(A,B,C,D,E,F,G,H,I,J,K,L);
-	mfp = &mockFuncs<Z2, Y>::template expectation12<X,A,B,C,D,E,F,G,H,I,J,K,L>;
-	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
-						funcIndex.first, funcIndex.second,
-						reinterpret_cast<void (base_mock::*)()>(mfp),X);
-	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, functionName ,fileName);
-	addCall( call, expect );
-	return *call;
+	StopTrace();
+	FILE *file = fopen(fileName, "wb");
+	if (!file)
+		return false;
+	trace = new CallTraceWriter(file);
+	traceStart = MonotonicNanoseconds();
+	traceSequence = 0;
+	return true;
 }
-template <int X, typename Z2, typename Y, typename Z,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J, typename K, typename L,
-		  typename M>
-TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M> &MockRepository::RegisterExpect_(Z2 *mck, Y (Z::*func)(A,B,C,D,E,F,G,H,I,J,K,L,M), RegistrationType expect, const char *functionName, const char *fileName, unsigned long lineNo)
+
+HM_INLINE void MockRepository::StopTrace()
 {
-	std::pair<int, int> funcIndex = virtual_index((Y(Z2::*)(A,B,C,D,E,F,G,H,I,J,K,L,M))func);
-	Y (mockFuncs<Z2, Y>::*mfp)(A,B,C,D,E,F,G,H,I,J,K,L,M);
-	mfp = &mockFuncs<Z2, Y>::template expectation13<X,A,B,C,D,E,F,G,H,I,J,K,L,M>;
-	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
-						funcIndex.first, funcIndex.second,
-						reinterpret_cast<void (base_mock::*)()>(mfp),X);
-	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, functionName ,fileName);
-	addCall( call, expect );
-	return *call;
+	delete trace;
+	trace = 0;
 }
-template <int X, typename Z2, typename Y, typename Z,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J, typename K, typename L,
-		  typename M, typename N>
-TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N> &MockRepository::RegisterExpect_(Z2 *mck, Y (Z::*func)(A,B,C,D,E,F,G,H,I,J,K,L,M,N), RegistrationType expect, const char *functionName, const char *fileName, unsigned long lineNo)
+
+HM_INLINE void MockRepository::traceDispatch(DispatchScope &scope)
 {
-	std::pair<int, int> funcIndex = virtual_index((Y(Z2::*)(A,B,C,D,E,F,G,H,I,J,K,L,M,N))func);
-	Y (mockFuncs<Z2, Y>::*mfp)(A,B,C,D,E,F,G,H,I,J,K,L,M,N);
-	mfp = &mockFuncs<Z2, Y>::template expectation14<X,A,B,C,D,E,F,G,H,I,J,K,L,M,N>;
-	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
-						funcIndex.first, funcIndex.second,
-						reinterpret_cast<void (base_mock::*)()>(mfp),X);
-	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, functionName ,fileName);
-	addCall( call, expect );
-	return *call;
+	if (!trace || scope.traced)
+		return;
+	scope.traced = true;
+	MockIds::const_iterator mockId = mockIds.find(scope.mock);
+	trace->put(scope.sequence);
+	trace->put(scope.start - traceStart);
+	trace->put(mockId == mockIds.end() ? 0U : mockId->second);
+	trace->put(scope.funcno.first);
+	trace->put(scope.funcno.second);
+	trace->put(scope.call ? scope.call->id : 0U);
+	scope.tuple.traceTo(*trace);
 }
-template <int X, typename Z2, typename Y, typename Z,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J, typename K, typename L,
-		  typename M, typename N, typename O>
-TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O> &MockRepository::RegisterExpect_(Z2 *mck, Y (Z::*func)(A,B,C,D,E,F,G,H,I,J,K,L,M,N,O), RegistrationType expect, const char *functionName, const char *fileName, unsigned long lineNo)
+#endif
+
+#ifdef HM_DISPATCH_STATS
+HM_INLINE void MockRepository::noteException(Call *call)
 {
-	std::pair<int, int> funcIndex = virtual_index((Y(Z2::*)(A,B,C,D,E,F,G,H,I,J,K,L,M,N,O))func);
-	Y (mockFuncs<Z2, Y>::*mfp)(A,B,C,D,E,F,G,H,I,J,K,L,M,N,O);
-	mfp = &mockFuncs<Z2, Y>::template expectation15<X,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O>;
-	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
-						funcIndex.first, funcIndex.second,
-						reinterpret_cast<void (base_mock::*)()>(mfp),X);
-	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, functionName ,fileName);
-	addCall( call, expect );
-	return *call;
+	if (call)
+		++call->stats.exceptions;
+	if (currentDispatch)
+		++currentDispatch->stats.exceptions;
+	else
+		++totalStats.exceptions;
 }
 
-template <int X, typename Z2, typename Y, typename Z,
-		  typename A, typename B, typename C, typename D,
-		  typename E, typename F, typename G, typename H,
-		  typename I, typename J, typename K, typename L,
-		  typename M, typename N, typename O, typename P>
-TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> &MockRepository::RegisterExpect_(Z2 *mck, Y (Z::*func)(A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P), RegistrationType expect, const char *functionName, const char *fileName, unsigned long lineNo)
+HM_INLINE void MockRepository::ResetStatistics()
 {
-	std::pair<int, int> funcIndex = virtual_index((Y(Z2::*)(A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P))func);
-	Y (mockFuncs<Z2, Y>::*mfp)(A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P);
-	mfp = &mockFuncs<Z2, Y>::template expectation16<X,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P>;
-	BasicRegisterExpect(reinterpret_cast<mock<Z2> *>(mck),
-						funcIndex.first, funcIndex.second,
-						reinterpret_cast<void (base_mock::*)()>(mfp),X);
-	TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P> *call = new TCall<Y,A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P>(expect, reinterpret_cast<base_mock *>(mck), funcIndex, lineNo, functionName ,fileName);
-	addCall( call, expect );
-	return *call;
+	totalStats = DispatchStats();
+	// Reset in place: a dispatch in progress still points at its mock's entry.
+	for (MockStats::iterator i = mockStats.begin(); i != mockStats.end(); ++i)
+		i->second = DispatchStats();
+	const CallList *lists[] = { &expectations, &neverCalls, &optionals };
+	for (size_t l = 0; l < sizeof(lists) / sizeof(lists[0]); l++)
+	{
+		for (CallList::const_iterator i = lists[l]->begin(); i != lists[l]->end(); ++i)
+			(*i)->stats = DispatchStats();
+	}
 }
 
-template <typename Z>
-Z MockRepository::DoExpectation(base_mock *mock, std::pair<int, int> funcno, const base_tuple &tuple)
+HM_INLINE void MockRepository::DumpStatistics(std::ostream &os) const
 {
-	for (std::list<Call *>::reverse_iterator i = neverCalls.rbegin(); i != neverCalls.rend(); ++i)
+	os << "Dispatch statistics: " << totalStats << std::endl;
+
+	std::multimap<unsigned long long, const base_mock *> byTime;
+	for (MockStats::const_iterator i = mockStats.begin(); i != mockStats.end(); ++i)
 	{
-		Call *call = *i;
-		if ( matches( call, mock, funcno, tuple ) )
-		{
-			call->satisfied = true;
-			RAISEEXCEPTION(ExpectationException(this, call->getArgs(), call->funcName));
-		}
+		if (i->second.calls)
+			byTime.insert(std::make_pair(i->second.nanoseconds, i->first));
 	}
-   for (std::list<Call *>::reverse_iterator i = expectations.rbegin(); i != expectations.rend(); ++i)
+	if (!byTime.empty())
 	{
-		Call *call = *i;
-		if( isUnsatisfied( call, mock, funcno, tuple ) )
+		os << "Per mock, slowest first:" << std::endl;
+		for (std::multimap<unsigned long long, const base_mock *>::reverse_iterator i = byTime.rbegin(); i != byTime.rend(); ++i)
 		{
-			return doReturnCall<Z>( call, tuple );
+			if (i->second)
+				os << "  mock at 0x" << i->second << ": ";
+			else
+				os << "  C functions: ";
+			os << mockStats.find(i->second)->second << std::endl;
 		}
 	}
-	for (std::list<Call *>::reverse_iterator i = optionals.rbegin(); i != optionals.rend(); ++i)
+
+	const CallList *lists[] = { &expectations, &neverCalls, &optionals };
+	bool first = true;
+	for (size_t l = 0; l < sizeof(lists) / sizeof(lists[0]); l++)
 	{
-		Call *call = *i;
-		if ( matches( call, mock, funcno, tuple ) )
+		for (CallList::const_iterator i = lists[l]->begin(); i != lists[l]->end(); ++i)
 		{
-		   return doReturnCall<Z>( call, tuple );
+			const Call &call = **i;
+			if (first)
+				os << "Per registration:" << std::endl;
+			first = false;
+			os << "  " << call.fileName << "(" << call.lineno << "): " << call.funcName << ": " << call.stats << std::endl;
 		}
 	}
-	RAISEEXCEPTION(ExpectationException(this, &tuple, funcName(mock,funcno)));
 }
-template <typename base>
-base *MockRepository::Mock() {
-	mock<base> *m = new mock<base>(this);
-		mocks.push_back(m);
-	return reinterpret_cast<base *>(m);
+
+HM_INLINE std::ostream &operator<<(std::ostream &os, const DispatchStats &stats)
+{
+	os << stats.calls << " calls, "
+	   << stats.candidates << " candidates inspected, "
+	   << stats.argMatches << " argument matches, "
+	   << stats.matchFunctors << " Match() functors run, "
+	   << stats.exceptions << " exceptions, "
+	   << stats.nanoseconds / 1000 << " us";
+	return os;
 }
-inline std::ostream &operator<<(std::ostream &os, const Call &call)
+#endif
+
+HM_INLINE std::ostream &operator<<(std::ostream &os, const Call &call)
 {
 	os << call.fileName << "(" << call.lineno << "): "; //format for Visual studio, enables doubleclick on output line
 	if (call.expectation == Once)
@@ -6378,12 +12198,45 @@ inline std::ostream &operator<<(std::ostream &os, const Call &call)
 	return os;
 }
 
-inline std::ostream &operator<<(std::ostream &os, const MockRepository &repo)
+HM_INLINE void MockRepository::printNearest(std::ostream &os, base_mock *mock, std::pair<int, int> funcno, const base_tuple *actual) const
+{
+	std::vector<Candidate> candidates;
+	const CallList *lists[] = { &expectations, &neverCalls, &optionals };
+	for (size_t l = 0; l < sizeof(lists) / sizeof(lists[0]); l++)
+	{
+		for (CallList::const_iterator i = lists[l]->begin(); i != lists[l]->end(); ++i)
+		{
+			Candidate candidate;
+			candidate.call = *i;
+			candidate.order = candidates.size();
+			candidate.distance = candidate.call->mock != mock ? 2 : candidate.call->funcIndex != funcno ? 1 : 0;
+			candidate.matching = 0;
+			if (candidate.distance == 0)
+			{
+				if (!candidate.call->getArgs())
+					candidate.matching = candidate.call->matchFunctor.isSet() ? 0 : ~0U;
+				else if (actual)
+					candidate.matching = const_cast<base_tuple *>(candidate.call->getArgs())->matchingArgs(*actual);
+			}
+			candidates.push_back(candidate);
+		}
+	}
+	size_t shown = std::min(candidates.size(), nearestCandidates);
+	std::partial_sort(candidates.begin(), candidates.begin() + shown, candidates.end());
+	if (shown)
+		os << "Nearest registrations:" << std::endl;
+	for (size_t i = 0; i < shown; i++)
+		os << *candidates[i].call;
+	if (shown < candidates.size())
+		os << "and " << candidates.size() - shown << " more; set nearestCandidates to 0 to list them all." << std::endl;
+}
+
+HM_INLINE std::ostream &operator<<(std::ostream &os, const MockRepository &repo)
 {
    if (repo.expectations.size())
 	{
 		os << "Expectations set:" << std::endl;
-		for (std::list<Call *>::const_iterator exp = repo.expectations.begin(); exp != repo.expectations.end(); ++exp)
+		for (CallList::const_iterator exp = repo.expectations.begin(); exp != repo.expectations.end(); ++exp)
 			os << **exp;
 		os << std::endl;
 	}
@@ -6391,7 +12244,7 @@ inline std::ostream &operator<<(std::ostream &os, const MockRepository &repo)
 	if (repo.neverCalls.size())
 	{
 		os << "Functions explicitly expected to not be called:" << std::endl;
-		for (std::list<Call *>::const_iterator exp = repo.neverCalls.begin(); exp != repo.neverCalls.end(); ++exp)
+		for (CallList::const_iterator exp = repo.neverCalls.begin(); exp != repo.neverCalls.end(); ++exp)
 			os << **exp;
 		os << std::endl;
 	}
@@ -6399,13 +12252,15 @@ inline std::ostream &operator<<(std::ostream &os, const MockRepository &repo)
 	if (repo.optionals.size())
 	{
 		os << "Optional results set up:" << std::endl;
-		for (std::list<Call *>::const_iterator exp = repo.optionals.begin(); exp != repo.optionals.end(); ++exp)
+		for (CallList::const_iterator exp = repo.optionals.begin(); exp != repo.optionals.end(); ++exp)
 			os << **exp;
 		os << std::endl;
 	}
 	return os;
 }
 
+#endif
+
 #ifdef _MSC_VER
 #pragma warning(pop)
 #endif
@@ -6418,6 +12273,19 @@ using HippoMocks::DONTCARE_NAME;
 using HippoMocks::Call;
 using HippoMocks::Out;
 using HippoMocks::In;
+using HippoMocks::CaptureRing;
+using HippoMocks::Fingerprint;
+using HippoMocks::PredicateTable;
+using HippoMocks::KeyedTable;
+#ifdef HM_MOCK_ALLOCATOR
+using HippoMocks::MockAllocator;
+using HippoMocks::MockBuffer;
+#endif
+using HippoMocks::MockStorage;
+#if __cplusplus > 199711L
+using HippoMocks::CallRecording;
+using HippoMocks::CallReplay;
+#endif
 #endif
 
 #undef DEBUGBREAK
@@ -6427,6 +12295,7 @@ using HippoMocks::In;
 #undef DONTCARE_NAME
 #undef VIRT_FUNC_LIMIT
 #undef EXTRA_DESTRUCTOR
+#undef HM_INLINE
 //#undef FUNCTION_BASE // needed for test
 #undef FUNCTION_STRIDE
 #undef CFUNC_MOCK_PLATFORMIS64BIT
@@ -0,0 +1,121 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <new>
+#include "Bench.h"
+
+static unsigned long long allocations = 0;
+
+void *operator new(size_t size) {
+	++allocations;
+	void *p = malloc(size ? size : 1);
+	if (!p) throw std::bad_alloc();
+	return p;
+}
+
+void *operator new[](size_t size) {
+	++allocations;
+	void *p = malloc(size ? size : 1);
+	if (!p) throw std::bad_alloc();
+	return p;
+}
+
+void operator delete(void *p) noexcept { free(p); }
+void operator delete[](void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+void operator delete[](void *p, size_t) noexcept { free(p); }
+
+unsigned long long AllocationCount() {
+	return allocations;
+}
+
+unsigned long Iterations(unsigned long requested) {
+	double scaled = requested * BenchRegistry::Instance().scale;
+	return scaled < 1 ? 1 : (unsigned long)scaled;
+}
+
+static double NowNs() {
+	return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+Measurement::Measurement(const std::string &name, unsigned long n, unsigned long iterations) {
+	result.name = name;
+	result.n = n;
+	result.iterations = iterations;
+	allocs = 0;
+	ns = 0;
+	resume();
+}
+
+void Measurement::pause() {
+	ns += NowNs() - startNs;
+	allocs += AllocationCount() - startAllocs;
+}
+
+void Measurement::resume() {
+	startAllocs = AllocationCount();
+	startNs = NowNs();
+}
+
+void Measurement::stop() {
+	pause();
+	result.nsPerOp = ns / result.iterations;
+	result.allocsPerOp = (double)allocs / result.iterations;
+	BenchRegistry::Instance().AddResult(result);
+	fprintf(stderr, "%-48s n=%-7lu %12.1f ns/op %10.2f allocs/op\n", result.name.c_str(), result.n, result.nsPerOp, result.allocsPerOp);
+}
+
+bool BenchRegistry::RunBenchmarks(const char *filter) {
+	bool failed = false;
+	for (std::vector<Benchmark *>::iterator it = benchmarks.begin(); it != benchmarks.end(); ++it) {
+		Benchmark *b = *it;
+		if (filter && !strstr(b->name.c_str(), filter))
+			continue;
+		try {
+			b->Run();
+		} catch (std::exception &e) {
+			fprintf(stderr, "Benchmark %s failed with exception: %s\n", b->name.c_str(), e.what());
+			failed = true;
+		}
+	}
+	return failed;
+}
+
+void BenchRegistry::WriteJson(FILE *out) {
+	fprintf(out, "[\n");
+	for (size_t i = 0; i < results.size(); ++i) {
+		const BenchResult &r = results[i];
+		fprintf(out, "  {\"name\": \"%s\", \"n\": %lu, \"iterations\": %lu, \"ns_per_op\": %.3f, \"allocs_per_op\": %.3f}%s\n",
+				r.name.c_str(), r.n, r.iterations, r.nsPerOp, r.allocsPerOp, i + 1 == results.size() ? "" : ",");
+	}
+	fprintf(out, "]\n");
+}
+
+// Usage: HippoMocksBench [--scale factor] [--out file.json] [filter]
+// Human-readable results go to stderr, the JSON report to stdout or the --out file. Exits with 1
+// if any benchmark failed, after reporting the others.
+int main(int argc, char **argv) {
+	const char *filter = NULL;
+	const char *outName = NULL;
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "--scale") == 0 && i + 1 < argc)
+			BenchRegistry::Instance().scale = atof(argv[++i]);
+		else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc)
+			outName = argv[++i];
+		else
+			filter = argv[i];
+	}
+	bool failed = BenchRegistry::Instance().RunBenchmarks(filter);
+	FILE *out = outName ? fopen(outName, "w") : stdout;
+	if (!out) {
+		fprintf(stderr, "Cannot open %s\n", outName);
+		return 1;
+	}
+	BenchRegistry::Instance().WriteJson(out);
+	if (out != stdout)
+		fclose(out);
+	return failed ? 1 : 0;
+}
+
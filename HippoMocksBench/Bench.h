@@ -0,0 +1,72 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+// Number of heap allocations made through operator new since program start.
+unsigned long long AllocationCount();
+
+// Scales the iteration count requested by a benchmark by the --scale command line option.
+unsigned long Iterations(unsigned long requested);
+
+struct BenchResult {
+	std::string name;
+	unsigned long n;
+	unsigned long iterations;
+	double nsPerOp;
+	double allocsPerOp;
+};
+
+class Benchmark;
+
+class BenchRegistry {
+	std::vector<Benchmark *> benchmarks;
+	std::vector<BenchResult> results;
+public:
+	double scale;
+	BenchRegistry() : scale(1.0) {}
+	static BenchRegistry &Instance() { static BenchRegistry registry; return registry; }
+	void AddBenchmark(Benchmark *benchmark) {
+		benchmarks.push_back(benchmark);
+	}
+	void AddResult(const BenchResult &result) {
+		results.push_back(result);
+	}
+	// Runs the benchmarks whose name contains filter, or all of them; true if any failed.
+	bool RunBenchmarks(const char *filter);
+	void WriteJson(FILE *out);
+};
+
+class Benchmark {
+public:
+	std::string name;
+	Benchmark(std::string name)
+	: name(name)
+	{
+	}
+	virtual void Run() = 0;
+};
+
+// Times a region of a benchmark, excluding the setup before and teardown after it.
+// Construct it right before the measured loop and call stop() right after it. Per-iteration
+// setup inside the loop can be left out of the measurement with pause() and resume().
+class Measurement {
+public:
+	Measurement(const std::string &name, unsigned long n, unsigned long iterations);
+	void pause();
+	void resume();
+	void stop();
+private:
+	BenchResult result;
+	unsigned long long startAllocs, allocs;
+	double startNs, ns;
+};
+
+#define BENCH(X) class Bench##X : public Benchmark { public: Bench##X() : Benchmark(#X) { BenchRegistry::Instance().AddBenchmark(this); } void Run(); };\
+static Bench##X _Bench##X;\
+void Bench##X::Run()
+
+#endif
+
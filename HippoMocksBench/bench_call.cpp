@@ -0,0 +1,292 @@
+#include "hippomocks.h"
+#include "Bench.h"
+#include <sstream>
+#include <vector>
+
+class IBench {
+public:
+	virtual ~IBench() {}
+	virtual int f0() = 0;
+	virtual int f1(int) = 0;
+	virtual int f4(int, int, int, int) = 0;
+	virtual int f16(int, int, int, int, int, int, int, int, int, int, int, int, int, int, int, int) = 0;
+};
+
+// The baseline for FakeCall: the same calls through a hand-written implementation.
+class RealBench : public IBench {
+public:
+	int f0() { return 1; }
+	int f1(int a) { return a; }
+	int f4(int a, int, int, int) { return a; }
+	int f16(int a, int, int, int, int, int, int, int, int, int, int, int, int, int, int, int) { return a; }
+};
+
+static volatile int sink;
+
+static bool match1(int a) { return a == 1; }
+static bool match4(int a, int, int, int d) { return a == 1 && d == 4; }
+static bool match16(int a, int, int, int, int, int, int, int, int, int, int, int, int, int, int, int p) { return a == 1 && p == 16; }
+
+static int do0() { return 1; }
+static int do1(int a) { return a; }
+static int do4(int a, int, int, int) { return a; }
+static int do16(int a, int, int, int, int, int, int, int, int, int, int, int, int, int, int, int) { return a; }
+
+enum Variant { ONCALL, EXPECTCALLS, WITH, MATCH, DO, FAKE, VIRTUAL };
+static const char *variantNames[] = { "OnCall", "ExpectCalls", "With", "Match", "Do", "FakeCall", "Virtual" };
+
+static void setup0(MockRepository &mocks, IBench *b, Variant v, unsigned long iters) {
+	switch (v) {
+	case ONCALL: mocks.OnCall(b, IBench::f0).Return(1); break;
+	case EXPECTCALLS: mocks.ExpectCalls(b, IBench::f0, iters).Return(1); break;
+	case DO: mocks.OnCall(b, IBench::f0).Do(do0); break;
+	case FAKE: mocks.FakeCall(b, IBench::f0).Return(1); break;
+	case WITH: case MATCH: // nothing to compare without arguments; not run
+	case VIRTUAL: break;
+	}
+}
+
+static void setup1(MockRepository &mocks, IBench *b, Variant v, unsigned long iters) {
+	switch (v) {
+	case ONCALL: mocks.OnCall(b, IBench::f1).Return(1); break;
+	case EXPECTCALLS: mocks.ExpectCalls(b, IBench::f1, iters).Return(1); break;
+	case WITH: mocks.OnCall(b, IBench::f1).With(1).Return(1); break;
+	case MATCH: mocks.OnCall(b, IBench::f1).Match(match1).Return(1); break;
+	case DO: mocks.OnCall(b, IBench::f1).Do(do1); break;
+	case FAKE: mocks.FakeCall(b, IBench::f1).Return(1); break;
+	case VIRTUAL: break;
+	}
+}
+
+static void setup4(MockRepository &mocks, IBench *b, Variant v, unsigned long iters) {
+	switch (v) {
+	case ONCALL: mocks.OnCall(b, IBench::f4).Return(1); break;
+	case EXPECTCALLS: mocks.ExpectCalls(b, IBench::f4, iters).Return(1); break;
+	case WITH: mocks.OnCall(b, IBench::f4).With(1, 2, 3, 4).Return(1); break;
+	case MATCH: mocks.OnCall(b, IBench::f4).Match(match4).Return(1); break;
+	case DO: mocks.OnCall(b, IBench::f4).Do(do4); break;
+	case FAKE: mocks.FakeCall(b, IBench::f4).Return(1); break;
+	case VIRTUAL: break;
+	}
+}
+
+static void setup16(MockRepository &mocks, IBench *b, Variant v, unsigned long iters) {
+	switch (v) {
+	case ONCALL: mocks.OnCall(b, IBench::f16).Return(1); break;
+	case EXPECTCALLS: mocks.ExpectCalls(b, IBench::f16, iters).Return(1); break;
+	case WITH: mocks.OnCall(b, IBench::f16).With(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16).Return(1); break;
+	case MATCH: mocks.OnCall(b, IBench::f16).Match(match16).Return(1); break;
+	case DO: mocks.OnCall(b, IBench::f16).Do(do16); break;
+	case FAKE: mocks.FakeCall(b, IBench::f16).Return(1); break;
+	case VIRTUAL: break;
+	}
+}
+
+static void callBench(int arity, Variant v) {
+	unsigned long iters = Iterations(1000000);
+	std::string name = std::string("call/") + variantNames[v] + "/" + (arity == 0 ? "0" : arity == 1 ? "1" : arity == 4 ? "4" : "16");
+	MockRepository mocks;
+	RealBench real;
+	IBench *b = v == VIRTUAL ? &real : mocks.Mock<IBench>();
+	int acc = 0;
+	switch (arity) {
+	case 0: {
+		setup0(mocks, b, v, iters);
+		Measurement m(name, arity, iters);
+		for (unsigned long i = 0; i < iters; i++) acc += b->f0();
+		m.stop();
+		break;
+	}
+	case 1: {
+		setup1(mocks, b, v, iters);
+		Measurement m(name, arity, iters);
+		for (unsigned long i = 0; i < iters; i++) acc += b->f1(1);
+		m.stop();
+		break;
+	}
+	case 4: {
+		setup4(mocks, b, v, iters);
+		Measurement m(name, arity, iters);
+		for (unsigned long i = 0; i < iters; i++) acc += b->f4(1, 2, 3, 4);
+		m.stop();
+		break;
+	}
+	default: {
+		setup16(mocks, b, v, iters);
+		Measurement m(name, arity, iters);
+		for (unsigned long i = 0; i < iters; i++) acc += b->f16(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16);
+		m.stop();
+		break;
+	}
+	}
+	sink = acc;
+}
+
+BENCH(mockedCallLatency)
+{
+	static const int arities[] = { 0, 1, 4, 16 };
+	for (int v = ONCALL; v <= VIRTUAL; v++)
+		for (int a = 0; a < 4; a++)
+			if (arities[a] != 0 || (v != WITH && v != MATCH))
+				callBench(arities[a], (Variant)v);
+}
+
+
+class IBuffer {
+public:
+	virtual ~IBuffer() {}
+	virtual std::vector<char> read() = 0;
+};
+
+enum ReturnVariant { RETURN_COPY, RETURN_MOVE_IN, RETURN_MOVE };
+static const char *returnVariantNames[] = { "Return", "ReturnMovedIn", "ReturnMove" };
+
+// One registration and one call per iteration, returning a 1MB buffer. Return() of an lvalue copies
+// it in and out, Return() of an rvalue only copies it out and ReturnMove() does not copy at all.
+BENCH(heavyReturn)
+{
+	unsigned long iters = Iterations(2000);
+	for (int v = RETURN_COPY; v <= RETURN_MOVE; v++) {
+		MockRepository mocks;
+		IBuffer *b = mocks.Mock<IBuffer>();
+		size_t total = 0;
+		Measurement m(std::string("return/") + returnVariantNames[v] + "/1MB", 1, iters);
+		for (unsigned long i = 0; i < iters; i++) {
+			m.pause();
+			std::vector<char> buffer(1 << 20, 'x');
+			m.resume();
+			switch (v) {
+			case RETURN_COPY: mocks.ExpectCall(b, IBuffer::read).Return(buffer); break;
+			case RETURN_MOVE_IN: mocks.ExpectCall(b, IBuffer::read).Return(std::move(buffer)); break;
+			case RETURN_MOVE: mocks.ExpectCall(b, IBuffer::read).ReturnMove(std::move(buffer)); break;
+			}
+			total += b->read().size();
+			m.pause();
+			mocks.reset();
+			m.resume();
+		}
+		m.stop();
+		sink = (int)total;
+	}
+}
+
+class IDb {
+public:
+	virtual ~IDb() {}
+	virtual int get(const std::string &key) = 0;
+};
+
+// A lookup table of 1000 OnCall().With(key) registrations, looked up in turn. Scanning compares the
+// key against the registrations one by one; with indexArguments each call is one hash probe.
+BENCH(lookupTable)
+{
+	static const int entries = 1000;
+	std::vector<std::string> keys;
+	for (int i = 0; i < entries; i++) {
+		std::stringstream key;
+		key << "key" << i;
+		keys.push_back(key.str());
+	}
+	unsigned long iters = Iterations(20000);
+	for (int indexed = 0; indexed < 2; indexed++) {
+		MockRepository mocks;
+		mocks.indexArguments = indexed != 0;
+		IDb *db = mocks.Mock<IDb>();
+		for (int i = 0; i < entries; i++)
+			mocks.OnCall(db, IDb::get).With(keys[i]).Return(i);
+		int acc = 0;
+		Measurement m(indexed ? "lookupTable/indexArguments/1000" : "lookupTable/scan/1000", 1, iters);
+		for (unsigned long i = 0; i < iters; i++)
+			acc += db->get(keys[i % entries]);
+		m.stop();
+		sink = acc;
+	}
+}
+
+template <int R>
+static bool hasRemainder(int a) { return a % 32 == R; }
+
+// 32 predicates on f1, each matching one remainder of the argument, as a cascade of Match()
+// registrations and as one PredicateTable.
+BENCH(predicateCascade)
+{
+	typedef bool (*Predicate)(int);
+	static const Predicate predicates[] = {
+		hasRemainder<0>, hasRemainder<1>, hasRemainder<2>, hasRemainder<3>, hasRemainder<4>, hasRemainder<5>, hasRemainder<6>, hasRemainder<7>,
+		hasRemainder<8>, hasRemainder<9>, hasRemainder<10>, hasRemainder<11>, hasRemainder<12>, hasRemainder<13>, hasRemainder<14>, hasRemainder<15>,
+		hasRemainder<16>, hasRemainder<17>, hasRemainder<18>, hasRemainder<19>, hasRemainder<20>, hasRemainder<21>, hasRemainder<22>, hasRemainder<23>,
+		hasRemainder<24>, hasRemainder<25>, hasRemainder<26>, hasRemainder<27>, hasRemainder<28>, hasRemainder<29>, hasRemainder<30>, hasRemainder<31>
+	};
+	unsigned long iters = Iterations(200000);
+	for (int table = 0; table < 2; table++) {
+		MockRepository mocks;
+		IBench *b = mocks.Mock<IBench>();
+		PredicateTable<int, Predicate> dispatch;
+		for (int i = 0; i < 32; i++) {
+			if (table)
+				dispatch.Add(predicates[i], i);
+			else
+				mocks.OnCall(b, IBench::f1).Match(predicates[i]).Return(i);
+		}
+		if (table)
+			mocks.OnCall(b, IBench::f1).Dispatch(dispatch);
+		int acc = 0;
+		Measurement m(table ? "predicates/PredicateTable/32" : "predicates/Match/32", 1, iters);
+		for (unsigned long i = 0; i < iters; i++)
+			acc += b->f1((int)i);
+		m.stop();
+		sink = acc;
+	}
+}
+
+// 1000 OnCall().With() registrations on f4, called with the arguments of the first one, so that
+// every call compares against all of them.
+BENCH(withScan)
+{
+	static const int entries = 1000;
+	unsigned long iters = Iterations(20000);
+	MockRepository mocks;
+	IBench *b = mocks.Mock<IBench>();
+	for (int i = 0; i < entries; i++)
+		mocks.OnCall(b, IBench::f4).With(i, 2, 3, 4).Return(i);
+	int acc = 0;
+	Measurement m("withScan/f4/1000", 4, iters);
+	for (unsigned long i = 0; i < iters; i++)
+		acc += b->f4(0, 2, 3, 4);
+	m.stop();
+	sink = acc;
+}
+
+class IWriter {
+public:
+	virtual ~IWriter() {}
+	virtual int write(const std::string &payload) = 0;
+};
+
+// 100 registrations for 64KB payloads that only differ in their last byte, matched by With() and
+// by Fingerprint(). Registrations by value copy every payload and compare nearly all of it; a
+// Fingerprint keeps 16 bytes and the call's payload is hashed once.
+BENCH(payloadScan)
+{
+	static const int entries = 100;
+	unsigned long iters = Iterations(2000);
+	for (int fingerprint = 0; fingerprint < 2; fingerprint++) {
+		MockRepository mocks;
+		IWriter *w = mocks.Mock<IWriter>();
+		std::string payload(1 << 16, 'x');
+		for (int i = 0; i < entries; i++) {
+			payload[payload.size() - 1] = (char)i;
+			if (fingerprint)
+				mocks.OnCall(w, IWriter::write).With(Fingerprint(payload)).Return(i);
+			else
+				mocks.OnCall(w, IWriter::write).With(payload).Return(i);
+		}
+		payload[payload.size() - 1] = 0;
+		int acc = 0;
+		Measurement m(fingerprint ? "payloadScan/Fingerprint/64KB" : "payloadScan/With/64KB", 1, iters);
+		for (unsigned long i = 0; i < iters; i++)
+			acc += w->write(payload);
+		m.stop();
+		sink = acc;
+	}
+}
@@ -0,0 +1,38 @@
+#include "hippomocks.h"
+#include "Bench.h"
+
+#ifdef _HIPPOMOCKS__ENABLE_CFUNC_MOCKING_SUPPORT
+
+// Kept out of line and long enough to be patched. Optimized builds must also not call a clone or
+// a constant-propagated copy of it, which the patch would not reach.
+#if defined(__clang__)
+__attribute__((noinline, optnone))
+#elif defined(__GNUC__)
+__attribute__((noinline, noipa))
+#endif
+int bench_cfunc(int a)
+{
+	int r = a;
+	for (int i = 0; i < a; i++)
+		r = r * 31 + i;
+	return r;
+}
+
+static volatile int sink;
+
+BENCH(expectCallFuncInstallTeardown)
+{
+	unsigned long iters = Iterations(20000);
+	int acc = 0;
+	Measurement m("cfunc/install_call_teardown", 1, iters);
+	for (unsigned long i = 0; i < iters; i++) {
+		MockRepository mocks;
+		mocks.ExpectCallFunc(bench_cfunc).Return(1);
+		acc += bench_cfunc(3);
+	}
+	m.stop();
+	sink = acc;
+}
+
+#endif
+
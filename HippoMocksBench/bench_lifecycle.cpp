@@ -0,0 +1,112 @@
+#include "hippomocks.h"
+#include "Bench.h"
+
+class ILifecycle {
+public:
+	virtual ~ILifecycle() {}
+	virtual int f(int) = 0;
+	virtual void g() = 0;
+};
+
+static volatile int sink;
+
+static const unsigned long registrationCounts[] = { 10, 100, 1000, 10000, 100000 };
+
+BENCH(mockCreateDestroy)
+{
+	unsigned long iters = Iterations(20000);
+	Measurement m("mock/create_destroy", 1, iters);
+	for (unsigned long i = 0; i < iters; i++) {
+		MockRepository mocks;
+		mocks.Mock<ILifecycle>();
+	}
+	m.stop();
+}
+
+BENCH(resetWithRegistrations)
+{
+	for (size_t c = 0; c < sizeof(registrationCounts) / sizeof(registrationCounts[0]); c++) {
+		unsigned long n = registrationCounts[c];
+		unsigned long iters = Iterations(1000000) / n;
+		if (!iters) iters = 1;
+		MockRepository mocks;
+		ILifecycle *l = mocks.Mock<ILifecycle>();
+		Measurement m("reset", n, iters);
+		for (unsigned long it = 0; it < iters; it++) {
+			m.pause();
+			for (unsigned long i = 0; i < n; i++)
+				mocks.OnCall(l, ILifecycle::f).With((int)i).Return(1);
+			m.resume();
+			mocks.reset();
+		}
+		m.stop();
+	}
+}
+
+BENCH(verifyAllWithRegistrations)
+{
+	for (size_t c = 0; c < sizeof(registrationCounts) / sizeof(registrationCounts[0]); c++) {
+		unsigned long n = registrationCounts[c];
+		unsigned long iters = Iterations(100000);
+		MockRepository mocks;
+		mocks.autoExpect = false;
+		ILifecycle *l = mocks.Mock<ILifecycle>();
+		for (unsigned long i = 0; i < n; i++)
+			mocks.ExpectCall(l, ILifecycle::g);
+		for (unsigned long i = 0; i < n; i++)
+			l->g();
+		Measurement m("VerifyAll", n, iters);
+		for (unsigned long it = 0; it < iters; it++)
+			mocks.VerifyAll();
+		m.stop();
+	}
+}
+
+
+BENCH(tenThousandRegistrations)
+{
+	const unsigned long n = 10000;
+	unsigned long iters = Iterations(50);
+	MockRepository mocks;
+	ILifecycle *l = mocks.Mock<ILifecycle>();
+	Measurement setup("setup/OnCall", n, iters);
+	for (unsigned long it = 0; it < iters; it++) {
+		for (unsigned long i = 0; i < n; i++)
+			mocks.OnCall(l, ILifecycle::f).With((int)i).Return(1);
+		setup.pause();
+		mocks.reset();
+		setup.resume();
+	}
+	setup.stop();
+
+	for (unsigned long i = 0; i < n; i++)
+		mocks.OnCall(l, ILifecycle::f).With((int)i).Return(1);
+	unsigned long calls = Iterations(2000);
+	int acc = 0;
+	Measurement m("call/oldest", n, calls);
+	for (unsigned long it = 0; it < calls; it++)
+		acc += l->f(0);
+	m.stop();
+	sink = acc;
+}
+
+#ifdef HM_MOCK_ALLOCATOR
+// A whole test on caller-provided memory: the mock, its function table and its registrations.
+BENCH(placedMockCycle)
+{
+	static char storage[16384];
+	unsigned long iters = Iterations(20000);
+	int acc = 0;
+	Measurement m("mock/placed_cycle", 1, iters);
+	for (unsigned long i = 0; i < iters; i++) {
+		MockBuffer buffer(storage, sizeof(storage));
+		MockStorage<ILifecycle> placed;
+		MockRepository mocks(&buffer);
+		ILifecycle *l = mocks.MockAt(placed);
+		mocks.ExpectCall(l, ILifecycle::f).With(1).Return(2);
+		acc += l->f(1);
+	}
+	m.stop();
+	sink = acc;
+}
+#endif
@@ -122,3 +122,28 @@ TEST (checkExpectationsAreInOrder)
 	CHECK(exceptionCaught);
 }
 
+
+TEST (checkVerifyAllSeesEachMissingCall)
+{
+	MockRepository mocks;
+	mocks.autoExpect = false;
+	IA *iamock = mocks.Mock<IA>();
+	IA *other = mocks.Mock<IA>();
+	mocks.ExpectCalls(iamock, IA::f, 2);
+	mocks.ExpectCall(other, IA::g);
+	mocks.ExpectCallDestructor(other);
+	iamock->f();
+	other->g();
+	delete other;
+	bool exceptionCaught = false;
+	try {
+		mocks.VerifyAll();
+	}
+	catch (HippoMocks::CallMissingException &) 
+	{
+		exceptionCaught = true;
+	}
+	CHECK(exceptionCaught);
+	iamock->f();
+	mocks.VerifyAll();
+}
@@ -0,0 +1,95 @@
+#include "hippomocks.h"
+#include "Framework.h"
+#include <string>
+
+class ITable {
+public:
+	virtual ~ITable() {}
+	virtual int get(const std::string &key) = 0;
+	virtual int at(int row, int column) = 0;
+	virtual void put(int key) = 0;
+};
+
+static bool inColumnNine(int, int column)
+{
+	return column == 9;
+}
+
+TEST (checkIndexedLookupFindsEveryKey)
+{
+	MockRepository mocks;
+	mocks.indexArguments = true;
+	ITable *iamock = mocks.Mock<ITable>();
+	for (int row = 0; row < 100; row++)
+		for (int column = 0; column < 100; column++)
+			mocks.OnCall(iamock, ITable::at).With(row, column).Return(row * 1000 + column);
+	int hits = 0;
+	for (int row = 0; row < 100; row++)
+		for (int column = 0; column < 100; column++)
+			hits += iamock->at(row, column) == row * 1000 + column;
+	EQUALS(10000, hits);
+	bool exceptionCaught = false;
+	try
+	{
+		iamock->at(100, 0);
+	}
+	catch (HippoMocks::ExpectationException &)
+	{
+		exceptionCaught = true;
+	}
+	CHECK(exceptionCaught);
+}
+
+TEST (checkIndexedStringKeysCompareByValue)
+{
+	MockRepository mocks;
+	mocks.indexArguments = true;
+	ITable *iamock = mocks.Mock<ITable>();
+	mocks.OnCall(iamock, ITable::get).With("one").Return(1);
+	mocks.OnCall(iamock, ITable::get).With(std::string("two")).Return(2);
+	EQUALS(1, iamock->get(std::string("one")));
+	EQUALS(2, iamock->get("two"));
+}
+
+TEST (checkLastRegistrationWinsOverIndex)
+{
+	MockRepository mocks;
+	mocks.indexArguments = true;
+	ITable *iamock = mocks.Mock<ITable>();
+	mocks.OnCall(iamock, ITable::at).With(1, 1).Return(1);
+	mocks.OnCall(iamock, ITable::at).With(1, _).Return(2);
+	mocks.OnCall(iamock, ITable::at).With(2, 2).Return(3);
+	EQUALS(2, iamock->at(1, 1));
+	EQUALS(3, iamock->at(2, 2));
+	EQUALS(2, iamock->at(1, 5));
+	mocks.OnCall(iamock, ITable::at).With(1, 1).Return(4);
+	mocks.OnCall(iamock, ITable::at).Match(inColumnNine).Return(5);
+	EQUALS(4, iamock->at(1, 1));
+	EQUALS(5, iamock->at(1, 9));
+	EQUALS(2, iamock->at(1, 5));
+}
+
+TEST (checkIndexedCallsKeepTheirLimits)
+{
+	MockRepository mocks;
+	mocks.indexArguments = true;
+	ITable *iamock = mocks.Mock<ITable>();
+	mocks.OnCall(iamock, ITable::put).With(3);
+	mocks.NeverCall(iamock, ITable::put).With(4);
+	mocks.ExpectCall(iamock, ITable::put).With(3);
+	iamock->put(3);
+	iamock->put(3);
+	bool exceptionCaught = false;
+	try
+	{
+		iamock->put(4);
+	}
+	catch (HippoMocks::ExpectationException &)
+	{
+		exceptionCaught = true;
+	}
+	CHECK(exceptionCaught);
+	mocks.reset();
+	mocks.OnCall(iamock, ITable::put).With(4);
+	iamock->put(4);
+}
@@ -0,0 +1,140 @@
+#include "hippomocks.h"
+#include "Framework.h"
+
+// Only built in the HippoMocksTestsInstrumented target, which defines HM_CALL_TRACE.
+#ifdef HM_CALL_TRACE
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+class ITrace {
+public:
+	virtual ~ITrace() {}
+	virtual int f(int a, const char *b) = 0;
+	virtual void g() = 0;
+};
+
+struct TraceRecord {
+	unsigned long long sequence, timestamp;
+	unsigned mockId;
+	int baseOffset, funcIndex;
+	unsigned callId;
+	std::vector<std::pair<unsigned char, std::string> > args;
+};
+
+template <typename T>
+static bool readValue(FILE *file, T &value)
+{
+	return fread(&value, sizeof(value), 1, file) == 1;
+}
+
+static std::vector<TraceRecord> readTrace(const char *fileName)
+{
+	std::vector<TraceRecord> records;
+	FILE *file = fopen(fileName, "rb");
+	char magic[8];
+	if (!file || fread(magic, 1, 8, file) != 8 || memcmp(magic, "HMTRACE1", 8) != 0)
+		throw BaseException("Bad trace file %s", fileName);
+	TraceRecord record;
+	while (readValue(file, record.sequence))
+	{
+		unsigned char argCount;
+		readValue(file, record.timestamp);
+		readValue(file, record.mockId);
+		readValue(file, record.baseOffset);
+		readValue(file, record.funcIndex);
+		readValue(file, record.callId);
+		readValue(file, argCount);
+		record.args.clear();
+		for (unsigned char i = 0; i < argCount; i++)
+		{
+			unsigned char kind;
+			unsigned length;
+			readValue(file, kind);
+			readValue(file, length);
+			std::string data(length, '\0');
+			if (length && fread(&data[0], 1, length, file) != length)
+				throw BaseException("Truncated trace file %s", fileName);
+			record.args.push_back(std::make_pair(kind, data));
+		}
+		records.push_back(record);
+	}
+	fclose(file);
+	return records;
+}
+
+TEST (checkCallTraceRecordsDispatchedCalls)
+{
+	const char *fileName = "hippomocks_test_trace.bin";
+	{
+		MockRepository mocks;
+		ITrace *first = mocks.Mock<ITrace>();
+		ITrace *second = mocks.Mock<ITrace>();
+		mocks.OnCall(first, ITrace::g);
+		mocks.OnCall(second, ITrace::f).Return(4);
+		CHECK(mocks.StartTrace(fileName));
+		first->g();
+		EQUALS(4, second->f(42, "hello"));
+		mocks.StopTrace();
+		second->f(1, "not traced");
+	}
+	std::vector<TraceRecord> records = readTrace(fileName);
+	remove(fileName);
+
+	EQUALS(2u, records.size());
+	EQUALS(1ULL, records[0].sequence);
+	EQUALS(2ULL, records[1].sequence);
+	CHECK(records[0].timestamp <= records[1].timestamp);
+	EQUALS(1u, records[0].mockId);
+	EQUALS(2u, records[1].mockId);
+	EQUALS(1u, records[0].callId);
+	EQUALS(2u, records[1].callId);
+	CHECK(records[0].funcIndex != records[1].funcIndex);
+	EQUALS(0u, records[0].args.size());
+	EQUALS(2u, records[1].args.size());
+	// An int is stored as its bytes under C++11 and printed otherwise; a string is always printed.
+	if (records[1].args[0].first == 0)
+	{
+		int value;
+		EQUALS(sizeof(int), records[1].args[0].second.size());
+		memcpy(&value, records[1].args[0].second.data(), sizeof(int));
+		EQUALS(42, value);
+	}
+	else
+	{
+		EQUALS("42", records[1].args[0].second);
+	}
+	EQUALS(1, (int)records[1].args[1].first);
+	EQUALS("hello", records[1].args[1].second);
+}
+
+TEST (checkCallTraceRecordsUnmatchedCalls)
+{
+	const char *fileName = "hippomocks_test_trace.bin";
+	{
+		MockRepository mocks;
+		ITrace *iamock = mocks.Mock<ITrace>();
+		mocks.NeverCall(iamock, ITrace::g);
+		CHECK(mocks.StartTrace(fileName));
+		bool exceptionCaught = false;
+		try
+		{
+			iamock->g();
+		}
+		catch (HippoMocks::ExpectationException &)
+		{
+			exceptionCaught = true;
+		}
+		CHECK(exceptionCaught);
+		mocks.reset();
+	}
+	std::vector<TraceRecord> records = readTrace(fileName);
+	remove(fileName);
+
+	EQUALS(1u, records.size());
+	EQUALS(1u, records[0].mockId);
+	EQUALS(1u, records[0].callId);
+}
+
+#endif
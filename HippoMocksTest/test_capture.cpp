@@ -0,0 +1,61 @@
+#include "hippomocks.h"
+#include "Framework.h"
+#include <string>
+#include <vector>
+
+class ICapture {
+public:
+	virtual ~ICapture() {}
+	virtual void event(int id) = 0;
+	virtual int send(int channel, const std::string &data) = 0;
+	virtual void update(const std::string &state) = 0;
+};
+
+struct Sent {
+	Sent() : channel(0) {}
+	Sent(int c, const std::string &d) : channel(c), data(d) {}
+	int channel;
+	std::string data;
+};
+
+TEST (checkCaptureRingKeepsLastValues)
+{
+	MockRepository mocks;
+	ICapture *iamock = mocks.Mock<ICapture>();
+	CaptureRing<int, 4> events;
+	mocks.OnCall(iamock, ICapture::event).Capture(events);
+	CHECK(events.empty());
+	for (int i = 1; i <= 6; i++)
+		iamock->event(i);
+	EQUALS(4u, events.size());
+	EQUALS(6ULL, events.total());
+	EQUALS(2ULL, events.dropped());
+	EQUALS(3, events.front());
+	EQUALS(4, events[1]);
+	EQUALS(6, events.back());
+}
+
+TEST (checkCaptureOfSeveralArgumentsKeepsReturnValue)
+{
+	MockRepository mocks;
+	ICapture *iamock = mocks.Mock<ICapture>();
+	std::vector<Sent> sent;
+	sent.reserve(2);
+	mocks.OnCall(iamock, ICapture::send).Capture(sent).Return(5);
+	EQUALS(5, iamock->send(1, "hello"));
+	EQUALS(5, iamock->send(2, "world"));
+	EQUALS(2u, sent.size());
+	EQUALS(2, sent[1].channel);
+	EQUALS("hello", sent[0].data);
+}
+
+TEST (checkCaptureByReference)
+{
+	MockRepository mocks;
+	ICapture *iamock = mocks.Mock<ICapture>();
+	CaptureRing<const std::string *, 2> states;
+	mocks.ExpectCall(iamock, ICapture::update).Capture(states);
+	std::string state = "ready";
+	iamock->update(state);
+	CHECK(states.back() == &state);
+}
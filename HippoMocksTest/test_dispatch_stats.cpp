@@ -0,0 +1,108 @@
+#include "hippomocks.h"
+#include "Framework.h"
+
+// Only built with counters in the HippoMocksTestsInstrumented target, which defines HM_DISPATCH_STATS.
+#ifdef HM_DISPATCH_STATS
+
+class IStats {
+public:
+	virtual ~IStats() {}
+	virtual int f(int a) = 0;
+	virtual void g() = 0;
+};
+
+static bool isOdd(int a) { return a % 2 == 1; }
+
+static void spin()
+{
+	unsigned long long start = HippoMocks::MonotonicNanoseconds();
+	while (HippoMocks::MonotonicNanoseconds() - start < 20000000ULL) {}
+}
+
+static IStats *inner;
+
+static int callInner(int)
+{
+	inner->g();
+	return 0;
+}
+
+TEST (checkDispatchStatsCountCallsAndCandidates)
+{
+	MockRepository mocks;
+	IStats *iamock = mocks.Mock<IStats>();
+	IStats *other = mocks.Mock<IStats>();
+	Call &even = mocks.OnCall(iamock, IStats::f).Return(2);
+	Call &odd = mocks.OnCall(iamock, IStats::f).Match(isOdd).Return(1);
+	mocks.OnCall(other, IStats::g);
+	EQUALS(1, iamock->f(1));
+	EQUALS(2, iamock->f(2));
+	other->g();
+
+	const HippoMocks::DispatchStats &total = mocks.Statistics();
+	EQUALS(3ULL, total.calls);
+	EQUALS(0ULL, total.exceptions);
+	// Registrations are searched latest first: f(1) skips g, f(2) skips g and the Match, g() is found at once.
+	EQUALS(6ULL, total.candidates);
+	EQUALS(4ULL, total.argMatches);
+	EQUALS(2ULL, total.matchFunctors);
+
+	EQUALS(2ULL, mocks.Statistics(iamock).calls);
+	EQUALS(5ULL, mocks.Statistics(iamock).candidates);
+	EQUALS(1ULL, mocks.Statistics(other).calls);
+	EQUALS(1ULL, MockRepository::Statistics(odd).calls);
+	EQUALS(2ULL, MockRepository::Statistics(odd).matchFunctors);
+	EQUALS(1ULL, MockRepository::Statistics(even).calls);
+}
+
+TEST (checkDispatchStatsCountExceptions)
+{
+	MockRepository mocks;
+	IStats *iamock = mocks.Mock<IStats>();
+	Call &never = mocks.NeverCall(iamock, IStats::g);
+	bool exceptionCaught = false;
+	try
+	{
+		iamock->g();
+	}
+	catch (HippoMocks::ExpectationException &)
+	{
+		exceptionCaught = true;
+	}
+	CHECK(exceptionCaught);
+	EQUALS(1ULL, mocks.Statistics().exceptions);
+	EQUALS(1ULL, mocks.Statistics(iamock).exceptions);
+	EQUALS(1ULL, MockRepository::Statistics(never).exceptions);
+	mocks.reset();
+}
+
+TEST (checkDispatchStatsTimeNestedCallsOnce)
+{
+	MockRepository mocks;
+	IStats *outer = mocks.Mock<IStats>();
+	inner = mocks.Mock<IStats>();
+	mocks.OnCall(outer, IStats::f).Do(callInner);
+	mocks.OnCall(inner, IStats::g).Do(spin);
+	outer->f(0);
+	// The inner call's time is not counted again for the outer call that made it.
+	CHECK(mocks.Statistics(inner).nanoseconds >= 20000000ULL);
+	CHECK(mocks.Statistics(outer).nanoseconds < mocks.Statistics(inner).nanoseconds);
+	EQUALS(mocks.Statistics().nanoseconds, mocks.Statistics(outer).nanoseconds + mocks.Statistics(inner).nanoseconds);
+}
+
+TEST (checkDispatchStatsDumpAndReset)
+{
+	MockRepository mocks;
+	IStats *iamock = mocks.Mock<IStats>();
+	mocks.OnCall(iamock, IStats::f).Return(3);
+	iamock->f(0);
+	std::stringstream text;
+	mocks.DumpStatistics(text);
+	CHECK(text.str().find("1 calls") != std::string::npos);
+	CHECK(text.str().find("IStats::f") != std::string::npos);
+	mocks.ResetStatistics();
+	EQUALS(0ULL, mocks.Statistics().calls);
+	EQUALS(0ULL, mocks.Statistics(iamock).calls);
+}
+
+#endif
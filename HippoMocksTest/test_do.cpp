@@ -102,3 +102,32 @@ TEST (checkFunctorObjectByvalCalled)
 }
 
 
+
+class largeFunctor {
+public:
+  largeFunctor(int &count, int &alive) : count(count), alive(alive) { alive++; }
+  largeFunctor(const largeFunctor &other) : count(other.count), alive(other.alive) { alive++; }
+  ~largeFunctor() { alive--; }
+  void operator()() { count++; }
+  int &count;
+  int &alive;
+  char padding[4 * HM_FUNCTOR_BUFFER_SIZE];
+private:
+  largeFunctor &operator=(const largeFunctor&); // Silence VS
+};
+
+TEST (checkFunctorsTooLargeToStoreInlineAreCalledAndReleased)
+{
+  int count = 0, alive = 0;
+  {
+    MockRepository mocks;
+    II *iamock = mocks.Mock<II>();
+    mocks.OnCall(iamock, II::f).Do(largeFunctor(count, alive));
+    mocks.OnCall(iamock, II::g).Do(functorByVal(count)).Do(largeFunctor(count, alive));
+    EQUALS(2, alive);
+    iamock->f();
+    iamock->g();
+    EQUALS(2, count);
+  }
+  EQUALS(0, alive);
+}
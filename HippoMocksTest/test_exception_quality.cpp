@@ -180,3 +180,55 @@ TEST(checkCallMissingExceptionToContainInfo)
 	CHECK(exceptionCaught);
 }
 
+
+TEST(checkExpectationExceptionListsNearestRegistrationsFirst)
+{
+	bool exceptionCaught = false;
+	MockRepository mocks;
+	IS *ismock = mocks.Mock<IS>();
+	mocks.OnCall(ismock, IS::f).Return(1);
+	for (int i = 0; i < 20; i++)
+		mocks.OnCall(ismock, IS::g).With(i, i).Return(i);
+
+	try
+	{
+		ismock->g(15, 99);
+	}
+	catch (HippoMocks::ExpectationException &ex)
+	{
+		const char *nearest = strstr(ex.what(), "Result set for IS::g(15,15)");
+		const char *other = strstr(ex.what(), "Result set for IS::g(0,0)");
+		CHECK(nearest != NULL);
+		CHECK(other != NULL);
+		CHECK(nearest < other);
+		CHECK(strstr(ex.what(), "Result set for IS::g(12,12)") == NULL);
+		CHECK(strstr(ex.what(), "Result set for IS::f()") == NULL);
+		CHECK(strstr(ex.what(), "and 11 more") != NULL);
+		exceptionCaught = true;
+	}
+	CHECK(exceptionCaught);
+}
+
+TEST(checkExpectationExceptionListsAllRegistrationsOnRequest)
+{
+	bool exceptionCaught = false;
+	MockRepository mocks;
+	mocks.nearestCandidates = 0;
+	IS *ismock = mocks.Mock<IS>();
+	mocks.OnCall(ismock, IS::f).Return(1);
+	for (int i = 0; i < 20; i++)
+		mocks.OnCall(ismock, IS::g).With(i, i).Return(i);
+
+	try
+	{
+		ismock->g(15, 99);
+	}
+	catch (HippoMocks::ExpectationException &ex)
+	{
+		CHECK(strstr(ex.what(), "Optional results set up:") != NULL);
+		CHECK(strstr(ex.what(), "Result set for IS::g(19,19)") != NULL);
+		CHECK(strstr(ex.what(), "Result set for IS::f()") != NULL);
+		exceptionCaught = true;
+	}
+	CHECK(exceptionCaught);
+}
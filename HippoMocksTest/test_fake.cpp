@@ -0,0 +1,75 @@
+#include "hippomocks.h"
+#include "Framework.h"
+
+#if __cplusplus > 199711L
+
+#include <string>
+
+class IFake {
+public:
+	virtual ~IFake() {}
+	virtual int add(int a, int b) = 0;
+	virtual std::string name() const = 0;
+	virtual void tick(int amount) = 0;
+};
+
+TEST (checkFakeCallReturnsValue)
+{
+	MockRepository mocks;
+	IFake *iamock = mocks.Mock<IFake>();
+	mocks.FakeCall(iamock, IFake::add).Return(7);
+	mocks.FakeCall(iamock, IFake::name).Return("fake");
+	for (int i = 0; i < 3; i++)
+		EQUALS(7, iamock->add(i, i));
+	EQUALS("fake", iamock->name());
+}
+
+TEST (checkFakeCallRunsDo)
+{
+	MockRepository mocks;
+	IFake *iamock = mocks.Mock<IFake>();
+	int total = 0;
+	mocks.FakeCall(iamock, IFake::add).Do([](int a, int b) { return a + b; });
+	mocks.FakeCall(iamock, IFake::tick).Do([&total](int amount) { total += amount; });
+	EQUALS(5, iamock->add(2, 3));
+	iamock->tick(4);
+	iamock->tick(6);
+	EQUALS(10, total);
+	// Nothing is counted, so nothing is left to verify.
+	mocks.VerifyAll();
+}
+
+TEST (checkFakeCallReplacesEarlierRegistration)
+{
+	MockRepository mocks;
+	IFake *iamock = mocks.Mock<IFake>();
+	mocks.OnCall(iamock, IFake::add).Return(1);
+	mocks.FakeCall(iamock, IFake::add).Return(2);
+	EQUALS(2, iamock->add(0, 0));
+	mocks.FakeCall(iamock, IFake::add).Return(3);
+	EQUALS(3, iamock->add(0, 0));
+	mocks.reset();
+	mocks.OnCall(iamock, IFake::add).Return(4);
+	EQUALS(4, iamock->add(0, 0));
+}
+
+class ITwoCounts {
+public:
+	virtual ~ITwoCounts() {}
+	virtual int first() = 0;
+	virtual int second() = 0;
+};
+
+TEST (checkFakeCallsWithTheSameLineDoNotShareASlot)
+{
+	// What FakeCall does on the same line of two different files.
+	MockRepository mocks;
+	ITwoCounts *a = mocks.Mock<ITwoCounts>();
+	ITwoCounts *b = mocks.Mock<ITwoCounts>();
+	mocks.RegisterFake_<5>(a, &ITwoCounts::first).Return(1);
+	mocks.RegisterFake_<5>(b, &ITwoCounts::second).Return(2);
+	EQUALS(1, a->first());
+	EQUALS(2, b->second());
+}
+
+#endif
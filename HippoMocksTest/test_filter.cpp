@@ -30,3 +30,47 @@ TEST (checkFilterIsApplied)
 	EQUALS(4, iamock->f(1, 1, 1));
 }
 
+
+TEST (checkPredicateTableMatchesLikeCascade)
+{
+	MockRepository mocks;
+	IAA *iamock = mocks.Mock<IAA>();
+	PredicateTable<int, bool (*)(int, int, int)> table;
+	table.Add(never, 3).Add(eod, 2).Add(oeo, 1).Add(allEven, 5);
+	mocks.OnCall(iamock, IAA::f).Return(4);
+	mocks.OnCall(iamock, IAA::f).Dispatch(table);
+	EQUALS(5, iamock->f(0, 0, 0));
+	EQUALS(4, iamock->f(0, 0, 1));
+	EQUALS(2, iamock->f(0, 1, 0));
+	EQUALS(2, iamock->f(0, 1, 1));
+	EQUALS(4, iamock->f(1, 0, 0));
+	EQUALS(1, iamock->f(1, 0, 1));
+	EQUALS(4, iamock->f(1, 1, 0));
+	EQUALS(4, iamock->f(1, 1, 1));
+}
+
+static int sum(int a, int b, int c) { return a + b + c; }
+
+TEST (checkKeyedTableLooksUpExtractedKey)
+{
+	MockRepository mocks;
+	IAA *iamock = mocks.Mock<IAA>();
+	KeyedTable<int, int, int (*)(int, int, int)> table(sum);
+	for (int i = 0; i < 100; i++)
+		table.Add(i, i * 2);
+	table.Add(3, 42);
+	mocks.ExpectCalls(iamock, IAA::f, 3).Dispatch(table);
+	EQUALS(20, iamock->f(1, 2, 7));
+	EQUALS(42, iamock->f(1, 1, 1));
+	bool exceptionCaught = false;
+	try
+	{
+		iamock->f(100, 0, 0);
+	}
+	catch (HippoMocks::ExpectationException &)
+	{
+		exceptionCaught = true;
+	}
+	CHECK(exceptionCaught);
+	EQUALS(198, iamock->f(99, 0, 0));
+}
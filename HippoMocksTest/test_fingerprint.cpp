@@ -0,0 +1,108 @@
+#include "hippomocks.h"
+#include "Framework.h"
+#include <string>
+#include <vector>
+
+class IStorage {
+public:
+	virtual ~IStorage() {}
+	virtual int write(const std::string &payload) = 0;
+	virtual int send(int channel, const std::vector<char> &payload) = 0;
+	virtual int log(const char *line) = 0;
+};
+
+TEST (checkFingerprintMatchesSamePayload)
+{
+	MockRepository mocks;
+	IStorage *iamock = mocks.Mock<IStorage>();
+	std::string payload(1 << 20, 'x');
+	mocks.OnCall(iamock, IStorage::write).With(Fingerprint(payload)).Return(1);
+	std::string other = payload;
+	other[12345] = 'y';
+	mocks.OnCall(iamock, IStorage::write).With(Fingerprint(other)).Return(2);
+	EQUALS(1, iamock->write(std::string(1 << 20, 'x')));
+	EQUALS(2, iamock->write(other));
+	bool exceptionCaught = false;
+	try
+	{
+		iamock->write(std::string((1 << 20) - 1, 'x'));
+	}
+	catch (HippoMocks::ExpectationException &)
+	{
+		exceptionCaught = true;
+	}
+	CHECK(exceptionCaught);
+}
+
+TEST (checkFingerprintOfVectorWithOtherArguments)
+{
+	MockRepository mocks;
+	IStorage *iamock = mocks.Mock<IStorage>();
+	std::vector<char> payload(4096, 'a');
+	mocks.ExpectCall(iamock, IStorage::send).With(3, Fingerprint(payload).Verified()).Return(4096);
+	mocks.OnCall(iamock, IStorage::send).With(_, Fingerprint(std::vector<char>())).Return(0);
+	EQUALS(0, iamock->send(1, std::vector<char>()));
+	EQUALS(4096, iamock->send(3, payload));
+}
+
+TEST (checkFingerprintOfCString)
+{
+	MockRepository mocks;
+	IStorage *iamock = mocks.Mock<IStorage>();
+	mocks.ExpectCall(iamock, IStorage::log).With(Fingerprint("started")).Return(1);
+	mocks.ExpectCall(iamock, IStorage::write).With(Fingerprint("stopped")).Return(2);
+	char line[] = "started";
+	EQUALS(1, iamock->log(line));
+	EQUALS(2, iamock->write("stopped"));
+}
+
+TEST (checkFingerprintIsPrinted)
+{
+	MockRepository mocks;
+	IStorage *iamock = mocks.Mock<IStorage>();
+	mocks.ExpectCall(iamock, IStorage::write).With(Fingerprint(std::string("abc"))).Return(1);
+	bool exceptionCaught = false;
+	try
+	{
+		iamock->write("abd");
+	}
+	catch (HippoMocks::ExpectationException &e)
+	{
+		exceptionCaught = true;
+		CHECK(std::string(e.what()).find("fingerprint(3 bytes, ") != std::string::npos);
+	}
+	CHECK(exceptionCaught);
+	mocks.reset();
+}
+
+TEST (checkFingerprintSeesChangedBuffer)
+{
+	MockRepository mocks;
+	IStorage *iamock = mocks.Mock<IStorage>();
+	std::string buffer(100, 'a');
+	mocks.OnCall(iamock, IStorage::write).With(Fingerprint(std::string(100, 'a'))).Return(1);
+	mocks.OnCall(iamock, IStorage::write).With(Fingerprint(std::string(100, 'b'))).Return(2);
+	EQUALS(1, iamock->write(buffer));
+	buffer.assign(100, 'b');
+	EQUALS(2, iamock->write(buffer));
+	buffer.assign(100, 'a');
+	EQUALS(1, iamock->write(buffer));
+}
+
+TEST (checkOnlyRepositoriesWithFingerprintsUseTheCache)
+{
+	MockRepository plain;
+	IStorage *plainMock = plain.Mock<IStorage>();
+	plain.OnCall(plainMock, IStorage::log).Return(1);
+	EQUALS(1, plainMock->log("started"));
+	CHECK(HippoMocks::FingerprintCache::Current<0>::cache == NULL);
+	{
+		MockRepository mocks;
+		IStorage *iamock = mocks.Mock<IStorage>();
+		mocks.OnCall(iamock, IStorage::log).With(Fingerprint("started")).Return(2);
+		EQUALS(2, iamock->log("started"));
+		CHECK(HippoMocks::FingerprintCache::Current<0>::cache != NULL);
+	}
+	CHECK(HippoMocks::FingerprintCache::Current<0>::cache == NULL);
+	EQUALS(1, plainMock->log("started"));
+}
@@ -0,0 +1,53 @@
+#include "hippomocks.h"
+#include "Framework.h"
+
+class IMeasured {
+public:
+	virtual ~IMeasured() {}
+	virtual int f(int a) = 0;
+};
+
+class IAlsoMeasured {
+public:
+	virtual ~IAlsoMeasured() {}
+	virtual void g() = 0;
+};
+
+TEST (checkMemoryUsageCountsRegistrations)
+{
+	MockRepository mocks;
+	EQUALS(0u, mocks.memoryUsage().total());
+	IMeasured *m = mocks.Mock<IMeasured>();
+	HippoMocks::MemoryUsage empty = mocks.memoryUsage();
+	CHECK(empty.notImplementedTables > 0);
+	CHECK(empty.functionTables > 0);
+	EQUALS(0u, empty.calls);
+
+	mocks.OnCall(m, IMeasured::f).With(1).Return(2);
+	HippoMocks::MemoryUsage registered = mocks.memoryUsage();
+	CHECK(registered.calls > 0);
+	CHECK(registered.tuples > 0);
+	CHECK(registered.returnValues > 0);
+	CHECK(registered.total() > empty.total());
+
+	mocks.reset();
+	EQUALS(empty.total(), mocks.memoryUsage().total());
+}
+
+TEST (checkMemoryUsageIsSplitPerMockType)
+{
+	MockRepository mocks;
+	IMeasured *first = mocks.Mock<IMeasured>();
+	IMeasured *second = mocks.Mock<IMeasured>();
+	IAlsoMeasured *other = mocks.Mock<IAlsoMeasured>();
+	mocks.OnCall(first, IMeasured::f).Return(1);
+	mocks.OnCall(second, IMeasured::f).Return(1);
+	mocks.OnCall(other, IAlsoMeasured::g);
+	std::map<std::string, HippoMocks::MemoryUsage> byType = mocks.memoryUsageByType();
+	EQUALS(2u, byType.size());
+	std::string firstName = byType.begin()->first, lastName = byType.rbegin()->first;
+	CHECK(lastName.find("IMeasured") != std::string::npos);
+	CHECK(firstName.find("IAlsoMeasured") != std::string::npos);
+	EQUALS(2 * byType[firstName].notImplementedTables, byType[lastName].notImplementedTables);
+	EQUALS(mocks.memoryUsage().total(), byType[firstName].total() + byType[lastName].total());
+}
@@ -0,0 +1,88 @@
+#include "hippomocks.h"
+#include "Framework.h"
+
+class IPooled {
+public:
+	virtual ~IPooled() {}
+	virtual int f() = 0;
+	virtual int g(int a) = 0;
+};
+
+TEST (checkReleasedMockIsReusedWithoutRegistrations)
+{
+	IPooled *first;
+	{
+		MockRepository mocks;
+		mocks.poolMocks = true;
+		first = mocks.Mock<IPooled>();
+		mocks.OnCall(first, IPooled::f).Return(1);
+		mocks.ExpectCall(first, IPooled::g).With(2).Return(3);
+		EQUALS(1, first->f());
+		EQUALS(3, first->g(2));
+	}
+	MockRepository mocks;
+	mocks.poolMocks = true;
+	IPooled *second = mocks.Mock<IPooled>();
+	CHECK(second == first);
+	bool exceptionCaught = false;
+	try
+	{
+		second->f();
+	}
+	catch (HippoMocks::NotImplementedException &)
+	{
+		exceptionCaught = true;
+	}
+	CHECK(exceptionCaught);
+	mocks.OnCall(second, IPooled::g).Return(4);
+	EQUALS(4, second->g(2));
+}
+
+TEST (checkDestroyedMockIsReusedAlive)
+{
+	IPooled *first;
+	{
+		MockRepository mocks;
+		mocks.poolMocks = true;
+		first = mocks.Mock<IPooled>();
+		mocks.ExpectCallDestructor(first);
+		delete first;
+	}
+	MockRepository mocks;
+	mocks.poolMocks = true;
+	IPooled *second = mocks.Mock<IPooled>();
+	CHECK(second == first);
+	mocks.ExpectCall(second, IPooled::f).Return(5);
+	EQUALS(5, second->f());
+}
+
+#ifdef _HIPPOMOCKS__ENABLE_STUB_SUPPORT
+TEST (checkPooledMockBecomesAStub)
+{
+	{
+		MockRepository mocks;
+		mocks.poolMocks = true;
+		mocks.Mock<IPooled>();
+	}
+	MockRepository mocks;
+	mocks.poolMocks = true;
+	IPooled *stub = mocks.Stub<IPooled>();
+	EQUALS(0, stub->g(1));
+}
+#endif
+
+TEST (checkMocksAreFreshWithoutPooling)
+{
+	IPooled *pooled;
+	{
+		MockRepository mocks;
+		mocks.poolMocks = true;
+		pooled = mocks.Mock<IPooled>();
+	}
+	MockRepository mocks;
+	CHECK(!mocks.poolMocks);
+	IPooled *fresh = mocks.Mock<IPooled>();
+	CHECK(fresh != pooled);
+	mocks.ExpectCall(fresh, IPooled::f).Return(6);
+	EQUALS(6, fresh->f());
+}
@@ -0,0 +1,73 @@
+#include "hippomocks.h"
+#include "Framework.h"
+
+struct Version {
+	int major;
+};
+
+// Compares Versions by value rather than by address, so With() must not compare them bytewise.
+namespace HippoMocks {
+template <>
+struct comparer<const Version *>
+{
+	static inline bool compare(const Version *a, const Version *b)
+	{
+		return a->major == b->major;
+	}
+};
+}
+
+class IPacked {
+public:
+	virtual ~IPacked() {}
+	virtual int mixed(char a, short b, bool c, long d, const int *e) = 0;
+	virtual int widen(long a, int &b) = 0;
+	virtual int version(const Version *v) = 0;
+};
+
+TEST (checkPackedArgumentsCompareEveryByte)
+{
+	MockRepository mocks;
+	IPacked *iamock = mocks.Mock<IPacked>();
+	int x = 0, y = 0;
+	mocks.OnCall(iamock, IPacked::mixed).With('a', 2, true, 4L, &x).Return(1);
+	mocks.OnCall(iamock, IPacked::mixed).With('a', 2, true, 4L, &y).Return(2);
+	mocks.OnCall(iamock, IPacked::mixed).With('a', 2, false, 4L, &x).Return(3);
+	mocks.OnCall(iamock, IPacked::mixed).With('b', 2, true, 4L, &x).Return(4);
+	mocks.OnCall(iamock, IPacked::mixed).With('a', 2, true, 5L, &x).Return(5);
+	EQUALS(1, iamock->mixed('a', 2, true, 4L, &x));
+	EQUALS(2, iamock->mixed('a', 2, true, 4L, &y));
+	EQUALS(3, iamock->mixed('a', 2, false, 4L, &x));
+	EQUALS(4, iamock->mixed('b', 2, true, 4L, &x));
+	EQUALS(5, iamock->mixed('a', 2, true, 5L, &x));
+	bool exceptionCaught = false;
+	try
+	{
+		iamock->mixed('a', 3, true, 4L, &x);
+	}
+	catch (HippoMocks::ExpectationException &)
+	{
+		exceptionCaught = true;
+	}
+	CHECK(exceptionCaught);
+}
+
+TEST (checkPackedArgumentsAreConvertedFirst)
+{
+	MockRepository mocks;
+	IPacked *iamock = mocks.Mock<IPacked>();
+	int b = 7;
+	mocks.ExpectCall(iamock, IPacked::widen).With('x', 7).Return(1);
+	mocks.ExpectCall(iamock, IPacked::widen).With(-1, 7).Return(2);
+	EQUALS(1, iamock->widen(120, b));
+	EQUALS(2, iamock->widen(-1L, b));
+}
+
+TEST (checkSpecializedComparerIsNotPacked)
+{
+	MockRepository mocks;
+	IPacked *iamock = mocks.Mock<IPacked>();
+	Version expected = { 3 }, actual = { 3 };
+	mocks.ExpectCall(iamock, IPacked::version).With(&expected).Return(3);
+	EQUALS(3, iamock->version(&actual));
+}
@@ -0,0 +1,169 @@
+#include "hippomocks.h"
+#include "Framework.h"
+
+class IPlaced {
+public:
+	virtual ~IPlaced() {}
+	virtual int f(int a) = 0;
+	virtual void g() = 0;
+};
+
+// Only mocked in this file, so that no pooled mock of it can be handed out.
+class IUnpooled {
+public:
+	virtual ~IUnpooled() {}
+	virtual int f() = 0;
+};
+
+TEST (checkMockAtUsesGivenStorage)
+{
+	MockStorage<IPlaced> storage;
+	MockRepository mocks;
+	IPlaced *p = mocks.MockAt(storage);
+	CHECK((void *)p == (void *)storage.bytes);
+	mocks.ExpectCall(p, IPlaced::f).With(1).Return(2);
+	mocks.OnCall(p, IPlaced::g);
+	EQUALS(2, p->f(1));
+	p->g();
+}
+
+#ifdef HM_MOCK_ALLOCATOR
+static int twice(int a)
+{
+	return a * 2;
+}
+
+TEST (checkRepositoryAllocatesFromBuffer)
+{
+	static char storage[16384];
+	MockBuffer buffer(storage, sizeof(storage));
+	{
+		MockStorage<IPlaced> placed;
+		MockRepository mocks(&buffer);
+		IPlaced *p = mocks.MockAt(placed);
+		mocks.OnCall(p, IPlaced::f).With(3).Return(4);
+		mocks.OnCall(p, IPlaced::f).With(5).Do(twice);
+		size_t used = buffer.used();
+		CHECK(used > 0);
+		EQUALS(4, p->f(3));
+		EQUALS(10, p->f(5));
+#ifndef HM_DISPATCH_STATS
+		// Only the statistics allocate while dispatching.
+		EQUALS(used, buffer.used());
+#endif
+	}
+	MockRepository mocks;
+	IPlaced *p = mocks.Mock<IPlaced>();
+	size_t used = buffer.used();
+	mocks.OnCall(p, IPlaced::f).Return(1);
+	EQUALS(used, buffer.used());
+}
+
+TEST (checkRepositoriesAllocateFromTheirOwnAllocator)
+{
+	static char storage[65536];
+	MockBuffer buffer(storage, sizeof(storage));
+	MockRepository heap;
+	IPlaced *onHeap = heap.Mock<IPlaced>();
+	{
+		MockRepository placed(&buffer);
+		IPlaced *inBuffer = placed.Mock<IPlaced>();
+		placed.OnCall(inBuffer, IPlaced::f).Return(1);
+		size_t used = buffer.used();
+		heap.OnCall(onHeap, IPlaced::f).With(2).Return(3);
+		EQUALS(used, buffer.used());
+		EQUALS(1, inBuffer->f(2));
+	}
+	EQUALS(3, onHeap->f(2));
+}
+
+TEST (checkMockFromBufferIsNotPooled)
+{
+	static char storage[65536];
+	MockBuffer buffer(storage, sizeof(storage));
+	{
+		MockRepository mocks(&buffer);
+		mocks.poolMocks = true;
+		mocks.Mock<IUnpooled>();
+	}
+	MockRepository mocks;
+	mocks.poolMocks = true;
+	IUnpooled *m = mocks.Mock<IUnpooled>();
+	CHECK((char *)m < storage || (char *)m >= storage + sizeof(storage));
+	mocks.ExpectCall(m, IUnpooled::f).Return(4);
+	EQUALS(4, m->f());
+}
+
+#ifndef HM_NO_EXCEPTIONS
+TEST (checkExhaustedBufferThrowsBadAlloc)
+{
+	static char storage[64];
+	MockBuffer buffer(storage, sizeof(storage));
+	MockRepository mocks(&buffer);
+	bool exceptionCaught = false;
+	try
+	{
+		mocks.Mock<IUnpooled>();
+	}
+	catch (std::bad_alloc &)
+	{
+		exceptionCaught = true;
+	}
+	CHECK(exceptionCaught);
+}
+#endif
+
+#ifdef HM_MEMORY_RESOURCE
+class CountingResource : public std::pmr::memory_resource {
+public:
+	CountingResource() : allocations(0), outstanding(0) {}
+	size_t allocations;
+	size_t outstanding;
+private:
+	void *do_allocate(size_t bytes, size_t alignment) override
+	{
+		++allocations;
+		outstanding += bytes;
+		return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+	}
+	void do_deallocate(void *p, size_t bytes, size_t alignment) override
+	{
+		outstanding -= bytes;
+		std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+	}
+	bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+	{
+		return this == &other;
+	}
+};
+
+TEST (checkRepositoryAllocatesFromMemoryResource)
+{
+	CountingResource resource;
+	{
+		MockRepository mocks(resource);
+		mocks.indexArguments = true;
+		IPlaced *p = mocks.Mock<IPlaced>();
+		std::vector<int> results;
+		results.push_back(7);
+		results.push_back(8);
+		mocks.OnCall(p, IPlaced::f).With(1).ReturnSequence(results.begin(), results.end());
+		mocks.OnCall(p, IPlaced::f).With(2).Return(9);
+		EQUALS(7, p->f(1));
+		EQUALS(9, p->f(2));
+		EQUALS(8, p->f(1));
+		CHECK(resource.allocations > 0);
+		CHECK(resource.outstanding > 0);
+	}
+	EQUALS(0u, resource.outstanding);
+}
+
+TEST (checkNullAllocatorMeansTheHeap)
+{
+	MockRepository mocks(0);
+	IPlaced *p = mocks.Mock<IPlaced>();
+	mocks.ExpectCall(p, IPlaced::f).Return(5);
+	EQUALS(5, p->f(1));
+}
+#endif
+#endif
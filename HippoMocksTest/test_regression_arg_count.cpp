@@ -63,3 +63,18 @@ TEST (checkArgCount16SupportedAndWorking)
 	iamock->f16(120,121,122,123,124,125,126,127,128,129,130,131,132,133,134,135);
 }
 
+
+TEST (checkLastArgumentComparedForEveryArgCount)
+{
+	MockRepository mocks;
+	IR *iamock = mocks.Mock<IR>();
+	mocks.OnCall(iamock, IR::f1).With(1);
+	mocks.OnCall(iamock, IR::f8).With(1,2,3,4,5,6,7,8);
+	mocks.OnCall(iamock, IR::f16).With(1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16);
+	iamock->f16(1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16);
+	int exceptions = 0;
+	try { iamock->f1(0); } catch (HippoMocks::ExpectationException &) { exceptions++; }
+	try { iamock->f8(1,2,3,4,5,6,7,0); } catch (HippoMocks::ExpectationException &) { exceptions++; }
+	try { iamock->f16(1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,0); } catch (HippoMocks::ExpectationException &) { exceptions++; }
+	EQUALS(3, exceptions);
+}
@@ -0,0 +1,155 @@
+#include "hippomocks.h"
+#include "Framework.h"
+
+#if __cplusplus > 199711L
+
+#include <cstdio>
+#include <string>
+
+class IDatabase {
+public:
+	virtual ~IDatabase() {}
+	virtual int count(const std::string &table) = 0;
+	virtual std::string name(int id) const = 0;
+	virtual void close() = 0;
+};
+
+class RealDatabase : public IDatabase {
+public:
+	RealDatabase() : calls(0) {}
+	int count(const std::string &table) { calls++; return (int)table.size() * 10; }
+	std::string name(int id) const { return id == 1 ? "one" : "other"; }
+	void close() { calls++; }
+	int calls;
+};
+
+static const char *recordingName = "hippomocks_test_replay.bin";
+
+static void recordSession()
+{
+	RealDatabase real;
+	CallRecording recording(recordingName);
+	MockRepository mocks;
+	IDatabase *db = mocks.Mock<IDatabase>();
+	mocks.RecordCall(db, IDatabase::count, &real, recording);
+	mocks.RecordCall(db, IDatabase::name, &real, recording);
+	mocks.RecordCall(db, IDatabase::close, &real, recording);
+	EQUALS(50, db->count("users"));
+	EQUALS("one", db->name(1));
+	EQUALS(20, db->count("id"));
+	db->close();
+	EQUALS(3, real.calls);
+}
+
+TEST (checkReplayServesRecordedResultsInOrder)
+{
+	recordSession();
+	{
+		CallReplay replay(recordingName);
+		MockRepository mocks;
+		IDatabase *db = mocks.Mock<IDatabase>();
+		mocks.ReplayCall(db, IDatabase::count, replay);
+		mocks.ReplayCall(db, IDatabase::name, replay);
+		mocks.ReplayCall(db, IDatabase::close, replay);
+		EQUALS(50, db->count("anything"));
+		EQUALS("one", db->name(7));
+		CHECK(!replay.Finished());
+		EQUALS(20, db->count("id"));
+		db->close();
+		CHECK(replay.Finished());
+	}
+	remove(recordingName);
+}
+
+TEST (checkReplayOutOfOrderCallIsReported)
+{
+	recordSession();
+	bool exceptionCaught = false;
+	{
+		CallReplay replay(recordingName);
+		MockRepository mocks;
+		IDatabase *db = mocks.Mock<IDatabase>();
+		mocks.ReplayCall(db, IDatabase::count, replay);
+		mocks.ReplayCall(db, IDatabase::close, replay);
+		try
+		{
+			db->close();
+		}
+		catch (HippoMocks::ExpectationException &)
+		{
+			exceptionCaught = true;
+		}
+	}
+	remove(recordingName);
+	CHECK(exceptionCaught);
+}
+
+static const char *otherRecordingName = "hippomocks_test_replay_other.bin";
+
+// Records count() into one file and name() into another.
+static void recordSplitSession()
+{
+	RealDatabase real;
+	CallRecording counts(recordingName);
+	CallRecording names(otherRecordingName);
+	MockRepository mocks;
+	IDatabase *db = mocks.Mock<IDatabase>();
+	mocks.RecordCall(db, IDatabase::count, &real, counts);
+	mocks.RecordCall(db, IDatabase::name, &real, names);
+	EQUALS(50, db->count("users"));
+	EQUALS("one", db->name(1));
+}
+
+TEST (checkEachFunctionReplaysFromItsOwnFile)
+{
+	recordSplitSession();
+	{
+		CallReplay counts(recordingName);
+		CallReplay names(otherRecordingName);
+		MockRepository mocks;
+		IDatabase *db = mocks.Mock<IDatabase>();
+		mocks.ReplayCall(db, IDatabase::count, counts);
+		mocks.ReplayCall(db, IDatabase::name, names);
+		EQUALS(50, db->count("anything"));
+		EQUALS("one", db->name(7));
+		CHECK(counts.Finished());
+		CHECK(names.Finished());
+	}
+	remove(recordingName);
+	remove(otherRecordingName);
+}
+
+TEST (checkReplayCallsWithTheSameLineDoNotShareASlot)
+{
+	recordSplitSession();
+	{
+		CallReplay counts(recordingName);
+		CallReplay names(otherRecordingName);
+		MockRepository mocks;
+		IDatabase *first = mocks.Mock<IDatabase>();
+		IDatabase *second = mocks.Mock<IDatabase>();
+		// What ReplayCall does on the same line of two different files.
+		mocks.RegisterReplay_<5>(first, &IDatabase::count, counts, "IDatabase::count");
+		mocks.RegisterReplay_<5>(second, &IDatabase::name, names, "IDatabase::name");
+		EQUALS(50, first->count("anything"));
+		EQUALS("one", second->name(7));
+	}
+	remove(recordingName);
+	remove(otherRecordingName);
+}
+
+TEST (checkReplayOfMissingFileIsReported)
+{
+	bool exceptionCaught = false;
+	try
+	{
+		CallReplay replay("hippomocks_test_no_such_replay.bin");
+	}
+	catch (HippoMocks::RecordingFileException &)
+	{
+		exceptionCaught = true;
+	}
+	CHECK(exceptionCaught);
+}
+
+#endif
@@ -0,0 +1,119 @@
+#include "hippomocks.h"
+#include "Framework.h"
+
+#if __cplusplus > 199711L
+
+#include <memory>
+#include <string>
+#include <vector>
+
+class Payload {
+public:
+	static int copies;
+	Payload() : data(1024, 'x') {}
+	Payload(const Payload &other) : data(other.data) { copies++; }
+	Payload(Payload &&other) : data(std::move(other.data)) {}
+	Payload &operator=(const Payload &other) { data = other.data; copies++; return *this; }
+	Payload &operator=(Payload &&other) { data = std::move(other.data); return *this; }
+	std::vector<char> data;
+};
+
+int Payload::copies = 0;
+
+class IHeavy {
+public:
+	virtual ~IHeavy() {}
+	virtual Payload load() = 0;
+	virtual std::unique_ptr<int> make() = 0;
+};
+
+TEST (checkReturnMovesTemporaryIn)
+{
+	MockRepository mocks;
+	IHeavy *iamock = mocks.Mock<IHeavy>();
+	Payload::copies = 0;
+	mocks.OnCall(iamock, IHeavy::load).Return(Payload());
+	EQUALS(0, Payload::copies);
+	EQUALS(1024u, iamock->load().data.size());
+	EQUALS(1024u, iamock->load().data.size());
+	// Every call gets its own copy.
+	EQUALS(2, Payload::copies);
+}
+
+TEST (checkReturnMoveAvoidsCopies)
+{
+	MockRepository mocks;
+	IHeavy *iamock = mocks.Mock<IHeavy>();
+	Payload::copies = 0;
+	mocks.ExpectCall(iamock, IHeavy::load).ReturnMove(Payload());
+	EQUALS(1024u, iamock->load().data.size());
+	EQUALS(0, Payload::copies);
+}
+
+TEST (checkReturnOnceAllowsOneCall)
+{
+	MockRepository mocks;
+	IHeavy *iamock = mocks.Mock<IHeavy>();
+	mocks.OnCall(iamock, IHeavy::load).ReturnOnce(Payload());
+	EQUALS(1024u, iamock->load().data.size());
+	bool exceptionCaught = false;
+	try
+	{
+		iamock->load();
+	}
+	catch (HippoMocks::ExpectationException &)
+	{
+		exceptionCaught = true;
+	}
+	CHECK(exceptionCaught);
+}
+
+TEST (checkMoveOnlyReturnValues)
+{
+	MockRepository mocks;
+	IHeavy *iamock = mocks.Mock<IHeavy>();
+	mocks.ExpectCall(iamock, IHeavy::make).Return(std::unique_ptr<int>(new int(42)));
+	mocks.ExpectCall(iamock, IHeavy::make).ReturnOnce(std::unique_ptr<int>(new int(7)));
+	std::unique_ptr<int> first = iamock->make();
+	std::unique_ptr<int> second = iamock->make();
+	CHECK(first && second);
+	EQUALS(42, *first);
+	EQUALS(7, *second);
+}
+
+TEST (checkMoveOnlyReturnAllowsOneCall)
+{
+	MockRepository mocks;
+	IHeavy *iamock = mocks.Mock<IHeavy>();
+	mocks.OnCall(iamock, IHeavy::make).Return(std::unique_ptr<int>(new int(42)));
+	EQUALS(42, *iamock->make());
+	bool exceptionCaught = false;
+	try
+	{
+		iamock->make();
+	}
+	catch (HippoMocks::ExpectationException &)
+	{
+		exceptionCaught = true;
+	}
+	CHECK(exceptionCaught);
+}
+
+TEST (checkReturnOnceRejectsExpectCallsOfMore)
+{
+	MockRepository mocks;
+	IHeavy *iamock = mocks.Mock<IHeavy>();
+	bool exceptionCaught = false;
+	try
+	{
+		mocks.ExpectCalls(iamock, IHeavy::make, 3).ReturnOnce(std::unique_ptr<int>(new int(7)));
+	}
+	catch (HippoMocks::CallCountConflictException &)
+	{
+		exceptionCaught = true;
+	}
+	CHECK(exceptionCaught);
+	mocks.reset();
+}
+
+#endif
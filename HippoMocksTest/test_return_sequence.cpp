@@ -0,0 +1,145 @@
+#include "hippomocks.h"
+#include "Framework.h"
+#include <string>
+#include <vector>
+
+class ISequence {
+public:
+	virtual ~ISequence() {}
+	virtual int next() = 0;
+	virtual std::string name(int) = 0;
+};
+
+TEST (checkReturnSequenceReturnsValuesInOrder)
+{
+	MockRepository mocks;
+	ISequence *iamock = mocks.Mock<ISequence>();
+	std::vector<int> values;
+	for (int i = 1; i <= 10000; i++)
+		values.push_back(i);
+	mocks.OnCall(iamock, ISequence::next).ReturnSequence(values.begin(), values.end());
+	int sum = 0;
+	for (int i = 1; i <= 10000; i++)
+		sum += iamock->next() == i;
+	EQUALS(10000, sum);
+	bool exceptionCaught = false;
+	try
+	{
+		iamock->next();
+	}
+	catch (HippoMocks::ExpectationException &)
+	{
+		exceptionCaught = true;
+	}
+	CHECK(exceptionCaught);
+}
+
+TEST (checkExpectedSequenceMustBeUsedUp)
+{
+	MockRepository mocks;
+	ISequence *iamock = mocks.Mock<ISequence>();
+	const char *names[] = { "one", "two", "three" };
+	mocks.ExpectCall(iamock, ISequence::name).ReturnSequence(names, names + 3);
+	EQUALS("one", iamock->name(1));
+	EQUALS("two", iamock->name(2));
+	bool exceptionCaught = false;
+	try
+	{
+		mocks.VerifyAll();
+	}
+	catch (HippoMocks::CallMissingException &)
+	{
+		exceptionCaught = true;
+	}
+	CHECK(exceptionCaught);
+	EQUALS("three", iamock->name(3));
+}
+
+TEST (checkReturnCycleWrapsAround)
+{
+	MockRepository mocks;
+	ISequence *iamock = mocks.Mock<ISequence>();
+	int values[] = { 4, 5 };
+	mocks.OnCall(iamock, ISequence::next).ReturnCycle(values, values + 2);
+	EQUALS(4, iamock->next());
+	EQUALS(5, iamock->next());
+	EQUALS(4, iamock->next());
+	EQUALS(5, iamock->next());
+}
+
+TEST (checkReturnCycleRejectsEmptyRange)
+{
+	MockRepository mocks;
+	ISequence *iamock = mocks.Mock<ISequence>();
+	int values[] = { 4 };
+	bool exceptionCaught = false;
+	try
+	{
+		mocks.OnCall(iamock, ISequence::next).ReturnCycle(values, values);
+	}
+	catch (HippoMocks::EmptyCycleException &)
+	{
+		exceptionCaught = true;
+	}
+	CHECK(exceptionCaught);
+}
+
+TEST (checkReturnSequenceRejectsEmptyRange)
+{
+	MockRepository mocks;
+	ISequence *iamock = mocks.Mock<ISequence>();
+	int values[] = { 4 };
+	bool exceptionCaught = false;
+	try
+	{
+		mocks.ExpectCall(iamock, ISequence::next).ReturnSequence(values, values);
+	}
+	catch (HippoMocks::EmptySequenceException &)
+	{
+		exceptionCaught = true;
+	}
+	CHECK(exceptionCaught);
+	mocks.reset();
+}
+
+TEST (checkReturnSequenceKeepsAMatchingExpectCalls)
+{
+	MockRepository mocks;
+	ISequence *iamock = mocks.Mock<ISequence>();
+	int values[] = { 4, 5 };
+	mocks.ExpectCalls(iamock, ISequence::next, 2).ReturnSequence(values, values + 2);
+	EQUALS(4, iamock->next());
+	EQUALS(5, iamock->next());
+	mocks.VerifyAll();
+}
+
+TEST (checkReturnSequenceRejectsAnotherExpectCallsCount)
+{
+	MockRepository mocks;
+	ISequence *iamock = mocks.Mock<ISequence>();
+	int values[] = { 4, 5, 6 };
+	bool exceptionCaught = false;
+	try
+	{
+		mocks.ExpectCalls(iamock, ISequence::next, 2).ReturnSequence(values, values + 3);
+	}
+	catch (HippoMocks::CallCountConflictException &)
+	{
+		exceptionCaught = true;
+	}
+	CHECK(exceptionCaught);
+	mocks.reset();
+}
+
+static int square(size_t index) { return (int)(index * index); }
+
+TEST (checkReturnGeneratorIsCalledWithCallIndex)
+{
+	MockRepository mocks;
+	ISequence *iamock = mocks.Mock<ISequence>();
+	mocks.OnCall(iamock, ISequence::next).ReturnGenerator(square);
+	EQUALS(0, iamock->next());
+	EQUALS(1, iamock->next());
+	EQUALS(4, iamock->next());
+	EQUALS(9, iamock->next());
+}
@@ -0,0 +1,79 @@
+#include "hippomocks.h"
+#include "Framework.h"
+#include <string>
+
+class IStub {
+public:
+	virtual ~IStub() {}
+	virtual int count() = 0;
+	virtual bool enabled(int a, int b) = 0;
+	virtual const char *name() const = 0;
+	virtual void notify(const std::string &) = 0;
+	virtual std::string describe() = 0;
+	virtual double ratio() = 0;
+};
+
+#ifdef _HIPPOMOCKS__ENABLE_STUB_SUPPORT
+TEST (checkStubAnswersUnregisteredFunctions)
+{
+	MockRepository mocks;
+	IStub *stub = mocks.Stub<IStub>();
+	EQUALS(0, stub->count());
+	CHECK(!stub->enabled(1, 2));
+	CHECK(stub->name() == NULL);
+	stub->notify("ignored");
+#if defined(__x86_64__) && !defined(_WIN32)
+	EQUALS(0.0, stub->ratio());
+#endif
+}
+
+TEST (checkStubStillHonoursRegistrations)
+{
+	MockRepository mocks;
+	IStub *stub = mocks.Stub<IStub>();
+	mocks.ExpectCall(stub, IStub::count).Return(42);
+	EQUALS(42, stub->count());
+	CHECK(!stub->enabled(3, 4));
+	mocks.reset();
+	// A reset stub still answers everything.
+	EQUALS(0, stub->count());
+}
+#endif
+
+#if __cplusplus > 199711L
+TEST (checkStubCallReturnsValueInitializedResult)
+{
+	MockRepository mocks;
+	IStub *iamock = mocks.Mock<IStub>();
+	mocks.StubCall(iamock, IStub::describe);
+	mocks.StubCall(iamock, IStub::name);
+	mocks.StubCall(iamock, IStub::notify);
+	mocks.ExpectCall(iamock, IStub::count).Return(3);
+	EQUALS("", iamock->describe());
+	CHECK(iamock->name() == NULL);
+	iamock->notify("ignored");
+	EQUALS(3, iamock->count());
+	bool exceptionCaught = false;
+	try
+	{
+		iamock->enabled(1, 2);
+	}
+	catch (HippoMocks::NotImplementedException &)
+	{
+		exceptionCaught = true;
+	}
+	CHECK(exceptionCaught);
+}
+
+#ifdef _HIPPOMOCKS__ENABLE_STUB_SUPPORT
+TEST (checkStubReturnsClassByValueThroughStubCall)
+{
+	MockRepository mocks;
+	IStub *stub = mocks.Stub<IStub>();
+	// The shared thunk cannot build a std::string; the StubCall thunk knows the signature.
+	mocks.StubCall(stub, IStub::describe);
+	EQUALS("", stub->describe());
+	EQUALS(0, stub->count());
+}
+#endif
+#endif
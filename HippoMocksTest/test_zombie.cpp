@@ -27,3 +27,41 @@ TEST (checkZombieCallsAreReported)
 	CHECK(exceptionCaught);
 }
 
+
+TEST (checkDestructorOnlySeesItsOwnMock)
+{
+	MockRepository mocks;
+	IZombie *first = mocks.Mock<IZombie>();
+	IZombie *second = mocks.Mock<IZombie>();
+	mocks.OnCallDestructor(first);
+	mocks.ExpectCall(second, IZombie::a);
+	mocks.ExpectCallDestructor(second);
+	mocks.NeverCall(first, IZombie::a);
+	delete first;
+	second->a();
+	delete second;
+	bool exceptionCaught = false;
+	try
+	{
+		second->a();
+	}
+	catch(HippoMocks::ZombieMockException &)
+	{
+		exceptionCaught = true;
+	}
+	CHECK(exceptionCaught);
+}
+
+TEST (checkDestroyedMockIgnoresMissingCallsOnOtherMocks)
+{
+	MockRepository mocks;
+	mocks.autoExpect = false;
+	IZombie *iamock = mocks.Mock<IZombie>();
+	IZombie *other = mocks.Mock<IZombie>();
+	mocks.ExpectCall(other, IZombie::a);
+	mocks.ExpectCall(iamock, IZombie::a);
+	mocks.ExpectCallDestructor(iamock);
+	iamock->a();
+	delete iamock;
+	other->a();
+}